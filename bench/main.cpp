@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Arquivo JSON com a linha de base dos kernels, quando --benchmark_out não é informado
+#define BENCH_BASELINE "resultados/bench_kernels.json"
+
+int main(int argc, char **argv)
+{
+  std::vector<char *> args(argv, argv + argc);
+  bool has_output = false;
+
+  for (int i = 1; i < argc; i++)
+    has_output |= std::string(argv[i]).rfind("--benchmark_out=", 0) == 0;
+
+  // Toda execução deixa uma linha de base em JSON, comparável com tools/compare.py do Google Benchmark
+  std::string output = "--benchmark_out=" BENCH_BASELINE;
+  std::string format = "--benchmark_out_format=json";
+
+  if (!has_output)
+  {
+    std::error_code error;
+    std::filesystem::create_directories(std::filesystem::path(BENCH_BASELINE).parent_path(), error);
+
+    args.push_back(output.data());
+    args.push_back(format.data());
+  }
+
+  int count = static_cast<int>(args.size());
+
+  ::benchmark::Initialize(&count, args.data());
+  if (::benchmark::ReportUnrecognizedArguments(count, args.data()))
+    return 1;
+
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+  return 0;
+}
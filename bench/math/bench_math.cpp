@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+#include <math/math.hpp>
+#include <core/vector.hpp>
+#include <vector>
+
+/**
+ * @brief Produto de duas matrizes 4x4, a composição das matrizes do pipeline
+ */
+static void BM_MatrixMultiply(benchmark::State &state)
+{
+  core::Matrix a = core::MatrixIdentity();
+  core::Matrix b = core::MatrixIdentity();
+
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 4; j++)
+    {
+      a(i, j) = static_cast<float>(i * 4 + j) * 0.25f;
+      b(i, j) = static_cast<float>(j * 4 + i) * 0.5f;
+    }
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    core::Matrix result = math::MatrixMultiply(a, b);
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MatrixMultiply);
+
+/**
+ * @brief Normalização de um lote de vetores (ex.: as normais dos vértices de uma malha)
+ *
+ * @note Argumento: quantidade de vetores
+ */
+static void BM_Vector3Normalize(benchmark::State &state)
+{
+  std::vector<core::Vector3> vectors(state.range(0));
+
+  for (size_t i = 0; i < vectors.size(); i++)
+    vectors[i] = {static_cast<float>(i % 7) + 0.5f, static_cast<float>(i % 5) - 2.0f, static_cast<float>(i % 3) + 1.0f};
+
+  for (auto _ : state)
+    for (auto &vector : vectors)
+    {
+      core::Vector3 result = math::Vector3Normalize(vector);
+      benchmark::DoNotOptimize(result);
+    }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Vector3Normalize)->RangeMultiplier(8)->Range(64, 4096);
@@ -0,0 +1,228 @@
+#include <benchmark/benchmark.h>
+#include <math/math.hpp>
+#include <math/pipeline.hpp>
+#include <models/light.hpp>
+#include <core/vector.hpp>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <utility>
+
+// Lado do framebuffer usado pelos kernels de preenchimento
+#define BENCH_BUFFER_SIZE 512
+
+/**
+ * @brief Cria um polígono regular
+ *
+ * @param sides Quantidade de vértices
+ * @param center Centro do polígono
+ * @param radius Distância do centro até os vértices
+ */
+static std::vector<core::Vector3> regular_polygon(int sides, core::Vector2 center, float radius)
+{
+  std::vector<core::Vector3> result;
+
+  for (int i = 0; i < sides; i++)
+  {
+    float angle = 2.0f * PI * static_cast<float>(i) / static_cast<float>(sides);
+    result.push_back({center.x + radius * std::cos(angle), center.y + radius * std::sin(angle), 0.5f});
+  }
+
+  return result;
+}
+
+/**
+ * @brief Cria um retângulo de tela no canto do framebuffer (largura = comprimento das scanlines)
+ */
+static std::vector<core::Vector3> screen_rectangle(int width, int height)
+{
+  float x = static_cast<float>(width);
+  float y = static_cast<float>(height);
+
+  return {{0.0f, 0.0f, 0.5f}, {x, 0.0f, 0.5f}, {x, y, 0.5f}, {0.0f, y, 0.5f}};
+}
+
+/**
+ * @brief Cria uma luz omni branca
+ */
+static models::Omni omni_light(core::Vector3 position, float radius)
+{
+  models::Omni result;
+
+  result.position = position;
+  result.intensity = models::ColorToChannels(models::WHITE);
+  result.radius = radius;
+
+  return result;
+}
+
+/**
+ * @brief Recorte 2D (Sutherland-Hodgman) de um polígono regular contra a janela
+ *
+ * @note Argumentos: quantidade de vértices e porcentagem do raio do polígono que fica fora da janela
+ * (0 = polígono inteiro dentro)
+ */
+static void BM_Clip2DPolygon(benchmark::State &state)
+{
+  float radius = 50.0f;
+  float half = state.range(1) == 0 ? radius + 1.0f : radius * static_cast<float>(100 - state.range(1)) / 100.0f;
+
+  std::vector<core::Vector3> polygon = regular_polygon(static_cast<int>(state.range(0)), {0.0f, 0.0f}, radius);
+
+  for (auto _ : state)
+  {
+    std::vector<core::Vector3> result = math::clip2D_polygon(polygon, {-half, -half}, {half, half});
+    benchmark::DoNotOptimize(result.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Clip2DPolygon)->ArgsProduct({{3, 8, 32}, {0, 25, 50, 75}});
+
+/**
+ * @brief Recorte 3D de um polígono regular contra o volume canônico (coordenadas normalizadas)
+ *
+ * @note Argumentos: quantidade de vértices e porcentagem do raio do polígono que fica fora do volume
+ */
+static void BM_Clip3DPolygon(benchmark::State &state)
+{
+  float radius = state.range(1) == 0 ? 0.9f : 100.0f / static_cast<float>(100 - state.range(1));
+
+  std::vector<std::pair<core::Vector4, core::Vector3>> polygon;
+
+  for (const auto &vertex : regular_polygon(static_cast<int>(state.range(0)), {0.0f, 0.0f}, radius))
+    polygon.push_back({{vertex.x, vertex.y, vertex.z, 1.0f}, {0.0f, 0.0f, 1.0f}});
+
+  for (auto _ : state)
+  {
+    std::vector<std::pair<core::Vector4, core::Vector3>> result = math::clip3D_polygon(polygon);
+    benchmark::DoNotOptimize(result.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Clip3DPolygon)->ArgsProduct({{3, 8, 32}, {0, 25, 50, 75}});
+
+/**
+ * @brief Rasterização de uma linha diagonal
+ *
+ * @note Argumento: comprimento da linha em pixels
+ */
+static void BM_BresenhamLine(benchmark::State &state)
+{
+  float length = static_cast<float>(state.range(0));
+
+  for (auto _ : state)
+  {
+    std::vector<core::Vector3> result = math::BresenhamLine({0.0f, 0.0f, 0.0f}, {length, length / 2.0f, 0.0f});
+    benchmark::DoNotOptimize(result.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BresenhamLine)->RangeMultiplier(4)->Range(8, 2048);
+
+/**
+ * @brief Retângulos (largura x altura) dos kernels de preenchimento: polígonos de vários tamanhos e
+ * scanlines longas ou curtas com a mesma área
+ */
+static void fill_sizes(benchmark::internal::Benchmark *benchmark)
+{
+  for (auto size : std::vector<std::pair<int, int>>{{16, 16}, {64, 64}, {256, 256}, {512, 8}, {8, 512}})
+    benchmark->Args({size.first, size.second});
+}
+
+/**
+ * @brief Preenchimento de um retângulo com cor constante
+ *
+ * @note O polígono é sempre o mesmo e o teste de profundidade aceita a profundidade igual, então
+ * todos os pixels passam em todas as iterações sem limpar o buffer de profundidade
+ */
+static void BM_FillPolygonFlat(benchmark::State &state)
+{
+  std::vector<std::vector<float>> z_buffer(BENCH_BUFFER_SIZE, std::vector<float>(BENCH_BUFFER_SIZE, std::numeric_limits<float>::max()));
+  std::vector<std::vector<models::ColorFloat>> color_buffer(BENCH_BUFFER_SIZE, std::vector<models::ColorFloat>(BENCH_BUFFER_SIZE));
+
+  std::vector<core::Vector3> vertexes = screen_rectangle(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+  models::ColorFloat color = {200.0f, 100.0f, 50.0f, 255.0f};
+
+  for (auto _ : state)
+  {
+    math::fill_polygon_flat_shading(vertexes, color, z_buffer, color_buffer, {BENCH_BUFFER_SIZE, BENCH_BUFFER_SIZE});
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+}
+BENCHMARK(BM_FillPolygonFlat)->Apply(fill_sizes);
+
+/**
+ * @brief Preenchimento de um retângulo interpolando as cores dos vértices
+ */
+static void BM_FillPolygonGouraud(benchmark::State &state)
+{
+  std::vector<std::vector<float>> z_buffer(BENCH_BUFFER_SIZE, std::vector<float>(BENCH_BUFFER_SIZE, std::numeric_limits<float>::max()));
+  std::vector<std::vector<models::ColorFloat>> color_buffer(BENCH_BUFFER_SIZE, std::vector<models::ColorFloat>(BENCH_BUFFER_SIZE));
+
+  std::vector<models::ColorFloat> colors = {{255.0f, 0.0f, 0.0f, 255.0f}, {0.0f, 255.0f, 0.0f, 255.0f}, {0.0f, 0.0f, 255.0f, 255.0f}, {255.0f, 255.0f, 255.0f, 255.0f}};
+  std::vector<std::pair<core::Vector3, models::ColorFloat>> vertexes;
+
+  for (const auto &vertex : screen_rectangle(static_cast<int>(state.range(0)), static_cast<int>(state.range(1))))
+    vertexes.push_back({vertex, colors[vertexes.size()]});
+
+  for (auto _ : state)
+  {
+    math::fill_polygon_gourand(vertexes, z_buffer, color_buffer);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+}
+BENCHMARK(BM_FillPolygonGouraud)->Apply(fill_sizes);
+
+/**
+ * @brief Preenchimento de um retângulo com iluminação por pixel
+ *
+ * @note Argumentos: lado do retângulo e quantidade de luzes omni (todas alcançam todos os pixels)
+ */
+static void BM_FillPolygonPhong(benchmark::State &state)
+{
+  std::vector<std::vector<float>> z_buffer(BENCH_BUFFER_SIZE, std::vector<float>(BENCH_BUFFER_SIZE, std::numeric_limits<float>::max()));
+  std::vector<std::vector<models::ColorFloat>> color_buffer(BENCH_BUFFER_SIZE, std::vector<models::ColorFloat>(BENCH_BUFFER_SIZE));
+
+  int side = static_cast<int>(state.range(0));
+  std::vector<std::pair<core::Vector3, core::Vector3>> vertexes;
+  std::vector<core::Vector3> positions;
+
+  for (const auto &vertex : screen_rectangle(side, side))
+  {
+    vertexes.push_back({vertex, {0.0f, 0.0f, 1.0f}});
+    positions.push_back({vertex.x / static_cast<float>(side), vertex.y / static_cast<float>(side), 0.0f});
+  }
+
+  models::Light global_light;
+  global_light.intensity = models::WHITE;
+
+  models::Material material = {{0.2f, 0.2f, 0.2f}, {0.7f, 0.6f, 0.5f}, {0.5f, 0.5f, 0.5f}, 10.0f};
+
+  std::vector<models::Omni> omni_lights;
+  std::vector<core::Vector4> bounds;
+
+  for (int i = 0; i < state.range(1); i++)
+  {
+    omni_lights.push_back(omni_light({static_cast<float>(i % 4) * 0.25f, static_cast<float>(i / 4) * 0.25f, 2.0f}, 0.0f));
+    bounds.push_back({0.0f, 0.0f, static_cast<float>(BENCH_BUFFER_SIZE - 1), static_cast<float>(BENCH_BUFFER_SIZE - 1)});
+  }
+
+  models::LightTiles light_tiles;
+  models::BinOmniLights(light_tiles, bounds, BENCH_BUFFER_SIZE, BENCH_BUFFER_SIZE);
+
+  for (auto _ : state)
+  {
+    math::fill_polygon_phong(vertexes, positions, {0.5f, 0.5f, 0.0f}, global_light, omni_lights, light_tiles, {0.5f, 0.5f, 4.0f}, material, z_buffer, color_buffer);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * side * side);
+}
+BENCHMARK(BM_FillPolygonPhong)->ArgsProduct({{16, 64, 256}, {0, 1, 4, 16}});
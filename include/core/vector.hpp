@@ -292,8 +292,58 @@ namespace core
   Vector4 Vector4Clamp(const Vector4 v, const Vector4 min, const Vector4 max);
   Vector4 Vector4ClampValue(const Vector4 v, const float min, const float max);
 
-  Matrix Flota16ToMatrix(const float16 f);
-  Matrix MatrixIdentity(void);
+  /**
+   * @brief Converte um array de floats para uma matriz 4x4.
+   *
+   * @param f O array de floats (16 indices) a ser convertido.
+   * @return Matrix A matriz 4x4 convertida.
+   *
+   * @note constexpr, para que as matrizes do pipeline possam ser montadas em tempo de compilação
+   */
+  inline constexpr Matrix Flota16ToMatrix(const float16 f)
+  {
+    Matrix result = {0};
+
+    result.m0 = f.v[0];
+    result.m1 = f.v[1];
+    result.m2 = f.v[2];
+    result.m3 = f.v[3];
+    result.m4 = f.v[4];
+    result.m5 = f.v[5];
+    result.m6 = f.v[6];
+    result.m7 = f.v[7];
+    result.m8 = f.v[8];
+    result.m9 = f.v[9];
+    result.m10 = f.v[10];
+    result.m11 = f.v[11];
+    result.m12 = f.v[12];
+    result.m13 = f.v[13];
+    result.m14 = f.v[14];
+    result.m15 = f.v[15];
+
+    return result;
+  }
+
+  /**
+   * @brief Retorna uma matriz 4x4 identidade.
+   *
+   * Esta função cria e retorna uma matriz 4x4 onde todos os elementos são inicializados com 0.0f, exceto
+   * os elementos da diagonal principal, que são inicializados com 1.0f.
+   *
+   * @return Matrix Uma matriz 4x4 identidade.
+   */
+  inline constexpr Matrix MatrixIdentity(void)
+  {
+    Matrix result = {0};
+
+    result.m0 = 1.0f;
+    result.m5 = 1.0f;
+    result.m10 = 1.0f;
+    result.m15 = 1.0f;
+
+    return result;
+  }
+
   Matrix MatrixTranspose(Matrix mat);
   float16 MatrixToFloat16(const Matrix m);
 }
\ No newline at end of file
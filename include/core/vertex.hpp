@@ -106,6 +106,13 @@ namespace core
      */
     MRX_VECTOR3_TYPE normal;
 
+    /**
+     * @brief Posição do vértice no vetor de vértices da malha
+     *
+     * @note Definido pela malha (ver models::Mesh::indexVertices), usado para indexar atributos por vértice
+     */
+    size_t index = 0;
+
   public:
     // Constructors and destructors
     Vertex();
@@ -149,6 +156,9 @@ namespace core
     MRX_VECTOR3_TYPE getNormal() const;
     void setNormal(const MRX_VECTOR3_TYPE &normal);
 
+    size_t getIndex() const;
+    void setIndex(size_t index);
+
     // Methods
     MRX_VECTOR4_TYPE normalize() const;
     core::float4 toArray() const;
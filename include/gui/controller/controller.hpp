@@ -7,8 +7,12 @@
 #include <models/scene.hpp>
 #include <models/camera.hpp>
 #include <models/benchmark.hpp>
+#include <models/recorder.hpp>
+#include <utils/profiler.hpp>
+#include <utils/trace.hpp>
 #include <utils/file.hpp>
 #include <filesystem> // Para verificação de diretório
+#include <future>
 
 namespace GUI
 {
@@ -59,6 +63,15 @@ namespace GUI
 #define FREE_MOVEMENT 0
 #define ORBITAL_MOVEMENT 1
 
+// Cena carregada pelo benchmark (a mesma gravada por save_scene)
+#define BENCHMARK_SCENE "scene.json"
+// Diretório dos resultados do benchmark
+#define BENCHMARK_RESULTS_DIRECTORY "resultados"
+// Arquivo padrão da linha do tempo gravada pelo menu (eventos do Chrome)
+#define TRACE_FILE BENCHMARK_RESULTS_DIRECTORY "/trace.json"
+// Arquivo padrão da entrada gravada e reproduzida pelo menu (ver models/recorder.hpp)
+#define RECORDING_FILE BENCHMARK_RESULTS_DIRECTORY "/sessao.mrxr"
+
   class Controller
   {
   private:
@@ -119,11 +132,9 @@ namespace GUI
      */
     int type_camera_movement = FREE_MOVEMENT;
     /**
-     * @brief Angulo acumulado da camera
-     *
-     * @note Usado no benchmark para trocar a movimentação da câmera
+     * @brief Caminho da câmera durante o benchmark
      */
-    float accumulatedAngle = 0.0f;
+    models::BenchmarkCamera benchmark_camera;
     /**
      * @brief Parâmetros de inserção de objetos
      */
@@ -156,6 +167,32 @@ namespace GUI
      *
      */
     int benchmark_repetitions = 1;
+    /**
+     * @brief Arquivo em que a linha do tempo é escrita quando a gravação termina (ver utils/trace.hpp)
+     */
+    std::string trace_path = TRACE_FILE;
+    /**
+     * @brief Gravação da entrada (câmera, transformações, luzes, materiais e configurações)
+     */
+    models::Recorder recorder;
+    /**
+     * @brief Reprodução da entrada gravada
+     */
+    models::Replay replay;
+    /**
+     * @brief Flag que indica se uma entrada gravada está sendo reproduzida
+     *
+     * @note Durante a reprodução, a entrada do mouse e do teclado é ignorada
+     */
+    bool replaying = false;
+    /**
+     * @brief Início da reprodução
+     */
+    std::chrono::steady_clock::time_point replay_start;
+    /**
+     * @brief Arquivo em que a entrada gravada é escrita e de onde a reprodução é lida
+     */
+    std::string recording_path = RECORDING_FILE;
     /**
      * @brief Tipo do elemento selecionado na cena
      *
@@ -170,17 +207,51 @@ namespace GUI
      * @note -3 para luz global
      */
     int selected_element_index = -1;
+    /**
+     * @brief Quantidade de threads usadas no estágio de geometria
+     *
+     * @note 0 - Quantidade de núcleos da máquina
+     * @note Mantida ao criar uma nova cena
+     */
+    unsigned int worker_threads = 0;
+    /**
+     * @brief Flag que controla o pipeline de quadros
+     *
+     * @note Se verdadeiro, a rasterização de um quadro roda em outra thread enquanto a geometria do
+     * próximo quadro é processada (o quadro exibido tem um quadro de atraso)
+     */
+    bool frame_pipelining = true;
+    /**
+     * @brief Resolução dinâmica: escala da resolução interna escolhida a partir do tempo dos quadros
+     *
+     * @note Mantida ao criar uma nova cena
+     */
+    models::RenderScale render_scale;
+    /**
+     * @brief Rasterização do quadro em andamento, retorna o tempo da rasterização (ms)
+     */
+    std::future<float> pending_frame;
+    /**
+     * @brief Tempo (ms) da rasterização do último quadro concluído
+     */
+    float raster_time = 0.0f;
+    /**
+     * @brief Tempos por estágio e contadores do pipeline no último quadro (ver utils/profiler.hpp)
+     */
+    utils::ProfileFrame profile;
 
     // Constructor and Destructor
-    Controller(float canvasWidth, float canvasHeight);
+    Controller(float canvasWidth, float canvasHeight, unsigned int worker_threads = 0);
     ~Controller();
 
     // Getters and Setters
     models::Scene *getScene();
     void setScene(models::Scene &_scene);
+    void setWorkerThreads(unsigned int worker_threads);
 
     // Methods
     void updateScene();
+    void waitFrame();
     void addObject(models::Mesh *object);
     void removeObject(models::Mesh *object);
     void selectObject(models::Mesh *object);
@@ -193,10 +264,18 @@ namespace GUI
     void on_hierarchy_item_selected(int item_type, int object_index);
     void handleEvents(const SDL_Event &event, SDL_Window *window, float deltaTime);
     void on_file_dialog_open(const std::string &file);
+    void import_obj(const std::string &file);
     void save_scene();
     void start_benchmark();
     void end_benchmark();
     void update_benchmark(double frame_time);
     void update_camera_benchmark();
+    void collect_profile();
+    void start_trace();
+    void stop_trace();
+    void start_recording();
+    void stop_recording();
+    bool start_replay();
+    void stop_replay();
   };
 }
\ No newline at end of file
@@ -40,6 +40,7 @@
 #pragma once
 
 #include <gui/imgui/imgui.h>
+#include <gui/view/components/helpmarker.hpp>
 #include <gui/controller/controller.hpp>
 #include <models/mesh.hpp>
 #include <models/scene.hpp>
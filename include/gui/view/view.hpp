@@ -88,7 +88,7 @@ namespace GUI
      */
     ImGui::FileBrowser fileDialog;
 
-    UI(SDL_Window *window, SDL_Renderer *renderer);
+    UI(SDL_Window *window, SDL_Renderer *renderer, unsigned int worker_threads = 0, const std::string &trace_path = "", const std::string &record_path = "", const std::string &replay_path = "");
     ~UI();
 
     // Components
@@ -0,0 +1,172 @@
+/**********************************************************************************************
+ *   IDIOM: PORTUGUÊS
+ *
+ *   mrxdispatch v1.0 - Variantes dos kernels por conjunto de instruções e escolha em tempo de execução
+ *
+ *   CONVENTIONS: (Convenções)
+ *     - O corpo de um kernel (rasterização, iluminação, transformação e recorte) é escrito uma única
+ *       vez, marcado com ISA_KERNEL, e ISA_VARIANTS o compila em uma variante por conjunto de
+ *       instruções (baseline, SSE4.2, AVX2 e AVX-512) no mesmo arquivo .cpp
+ *     - O processador é consultado (CPUID) uma única vez, na inicialização do programa, e a melhor
+ *       variante suportada passa a ser usada. ISA_DISPATCH escolhe a variante a cada chamada do kernel
+ *       (um polígono, uma face, um bloco de vértices), nunca por pixel
+ *     - Apenas o kernel é compilado com o conjunto de instruções da variante; as funções que ele chama
+ *       e que não são expandidas dentro dele continuam na baseline, então nenhuma instrução nova vaza
+ *       para o restante do programa
+ *     - As variantes não juntam multiplicações e somas em FMA (-ffp-contract=off no xmake.lua), então
+ *       todas dão exatamente o mesmo resultado que a baseline
+ *
+ *   IDIOM: ENGLISH
+ *
+ *   mrxdispatch v1.0 - Per instruction set kernel variants and runtime selection
+ *
+ *   CONVENTIONS:
+ *     - The body of a kernel (rasterization, lighting, transformation and clipping) is written once,
+ *       marked with ISA_KERNEL, and ISA_VARIANTS compiles it into one variant per instruction set
+ *       (baseline, SSE4.2, AVX2 and AVX-512) in the same .cpp file
+ *     - The processor is queried (CPUID) once, when the program starts, and the best supported
+ *       variant is used from then on. ISA_DISPATCH picks the variant on every kernel call (a polygon,
+ *       a face, a block of vertices), never per pixel
+ *     - Only the kernel is compiled for the instruction set of the variant; the functions it calls
+ *       that are not expanded inside it stay at the baseline, so no new instruction leaks into the
+ *       rest of the program
+ *     - The variants do not fuse multiplications and additions into FMA (-ffp-contract=off in
+ *       xmake.lua), so all of them give exactly the same result as the baseline
+ *
+ *   CONFIGURATION:
+ *       MRX_ISA_DISPATCH - Definido quando as variantes são compiladas (GCC ou Clang em x86/x86-64).
+ *                          Nos outros compiladores e arquiteturas há apenas a baseline
+ *
+ *   DEPENDENCIES:
+ *      <string> - Required for: std::string (IsaName)
+ *
+ *   CONTRIBUTORS:
+ *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
+ *
+ *
+ *   LICENSE: GPL 3.0
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **********************************************************************************************/
+#pragma once
+
+#include <string>
+
+// As variantes dependem do atributo target do GCC/Clang
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MRX_ISA_DISPATCH
+#endif
+
+namespace math
+{
+//----------------------------------------------------------------------------------
+// Defines and macros
+//----------------------------------------------------------------------------------
+
+// Conjuntos de instruções das variantes, do menor para o maior
+#define ISA_BASELINE 0
+#define ISA_SSE4 1
+#define ISA_AVX2 2
+#define ISA_AVX512 3
+
+#define ISA_VARIANTS_COUNT 4
+
+#if defined(MRX_ISA_DISPATCH)
+
+// Corpo de um kernel: sempre expandido dentro das variantes, que o compilam com o seu conjunto de instruções
+#define ISA_KERNEL inline __attribute__((always_inline))
+
+#define ISA_TARGET_SSE4 __attribute__((target("sse4.2")))
+#define ISA_TARGET_AVX2 __attribute__((target("avx2")))
+#define ISA_TARGET_AVX512 __attribute__((target("avx512f,avx512vl,avx512bw,avx512dq")))
+
+// Define name_baseline, name_sse4, name_avx2 e name_avx512, que executam kernel(arguments)
+#define ISA_VARIANTS(name, kernel, parameters, arguments)                                       \
+  static auto name##_baseline parameters { return kernel arguments; }                          \
+  ISA_TARGET_SSE4 static auto name##_sse4 parameters { return kernel arguments; }              \
+  ISA_TARGET_AVX2 static auto name##_avx2 parameters { return kernel arguments; }              \
+  ISA_TARGET_AVX512 static auto name##_avx512 parameters { return kernel arguments; }
+
+// Como ISA_VARIANTS, para um kernel com um parâmetro de template (ex.: a política de precisão)
+#define ISA_TEMPLATE_VARIANTS(name, kernel, parameters, arguments)                                  \
+  template <typename T>                                                                            \
+  static auto name##_baseline parameters { return kernel<T> arguments; }                           \
+  template <typename T>                                                                            \
+  ISA_TARGET_SSE4 static auto name##_sse4 parameters { return kernel<T> arguments; }               \
+  template <typename T>                                                                            \
+  ISA_TARGET_AVX2 static auto name##_avx2 parameters { return kernel<T> arguments; }               \
+  template <typename T>                                                                            \
+  ISA_TARGET_AVX512 static auto name##_avx512 parameters { return kernel<T> arguments; }
+
+// Variante em uso de um kernel definido com ISA_VARIANTS / ISA_TEMPLATE_VARIANTS. As funções públicas que
+// chamam ISA_DISPATCH (ex.: math::fill_polygon_phong, models::FlatDiffuseColors) executam sempre a variante
+// do conjunto de instruções em uso (ver math::ActiveIsa); o que o kernel expande roda na mesma variante
+#define ISA_DISPATCH(name) math::IsaVariant(name##_baseline, name##_sse4, name##_avx2, name##_avx512)
+#define ISA_TEMPLATE_DISPATCH(name, type) math::IsaVariant(name##_baseline<type>, name##_sse4<type>, name##_avx2<type>, name##_avx512<type>)
+
+#else
+
+#define ISA_KERNEL inline
+
+#define ISA_VARIANTS(name, kernel, parameters, arguments) \
+  static auto name##_baseline parameters { return kernel arguments; }
+
+#define ISA_TEMPLATE_VARIANTS(name, kernel, parameters, arguments) \
+  template <typename T>                                            \
+  static auto name##_baseline parameters { return kernel<T> arguments; }
+
+#define ISA_DISPATCH(name) name##_baseline
+#define ISA_TEMPLATE_DISPATCH(name, type) name##_baseline<type>
+
+#endif
+
+  //----------------------------------------------------------------------------------
+  // Module Functions Declaration
+  //----------------------------------------------------------------------------------
+
+  int CpuIsa();
+  int MaxIsa();
+  int ActiveIsa();
+  bool SelectIsa(int isa);
+  const char *IsaName(int isa);
+  bool ParseIsa(const std::string &name, int &isa);
+
+  /**
+   * @brief Escolhe, entre as variantes de um kernel, a do conjunto de instruções em uso
+   *
+   * @tparam Function Tipo (ponteiro de função) das variantes
+   * @param baseline Variante baseline
+   * @param sse4 Variante SSE4.2
+   * @param avx2 Variante AVX2
+   * @param avx512 Variante AVX-512
+   *
+   * @return Function Variante do conjunto de instruções em uso (ver ActiveIsa)
+   */
+  template <typename Function>
+  inline Function IsaVariant(Function baseline, Function sse4, Function avx2, Function avx512)
+  {
+    switch (ActiveIsa())
+    {
+    case ISA_AVX512:
+      return avx512;
+    case ISA_AVX2:
+      return avx2;
+    case ISA_SSE4:
+      return sse4;
+    default:
+      return baseline;
+    }
+  }
+} // namespace math
@@ -10,8 +10,15 @@
  *     - Os parâmetros de entrada das funções são sempre recebidos por valor
  *     - As funções sempre usam uma variável "result" para retorno
  *     - As funções sempre têm uma descrição @brief, @param e @return ESCRITAS EM PORTUGUÊS
- *          - A descrição deve estar no arquivo .cpp
+ *     - As funções são definidas no cabeçalho (inline), para que o compilador as expanda dentro dos
+ *       laços do pipeline e da iluminação sem depender de LTO
+ *     - As funções sem trigonometria são constexpr e podem montar vetores e matrizes em tempo de
+ *       compilação (ex.: matrizes de câmeras fixas). Em tempo de compilação, o caminho SIMD é trocado
+ *       pelo escalar e a raiz quadrada é calculada por Sqrt
  *     - Os ângulos estão sempre em radianos (macros DEG2RAD / RAD2DEG fornecidos para conveniência)
+ *     - As políticas de precisão Exact e Fast reúnem as operações caras da iluminação (inverso da
+ *       raiz, normalização, pow e exp). Fast troca a exatidão por aproximações com erro máximo
+ *       documentado (FAST_*_ERROR)
  *
  *
  *   IDIOM: ENGLISH
@@ -24,17 +31,31 @@
  *         - This is a way to avoid any dependency and avoid calling overhead
  *     - Functions input parameters are always received by value
  *     - Functions use always a "result" variable for return
- *     - Functions are always defined inline
  *     - Functions always have a @brief description, @param and @return tags WRITTEN IN PORTUGUESE
- *          - The description must be in the .cpp file
+ *     - Functions are defined in the header, so the compiler can expand them inside the pipeline and
+ *       lighting loops without relying on LTO
+ *     - Functions without trigonometry are constexpr and can build vectors and matrices at compile
+ *       time (e.g. fixed camera matrices). At compile time the SIMD path is replaced by the scalar one
+ *       and the square root is computed by Sqrt
  *     - Angles are always in radians (DEG2RAD/RAD2DEG macros provided for convenience)
+ *     - The Exact and Fast precision policies group the expensive lighting operations (inverse
+ *       square root, normalization, pow and exp). Fast trades exactness for approximations with a
+ *       documented maximum error (FAST_*_ERROR)
  *
  *   CONFIGURATION:
- *       ...
+ *       MRX_SIMD - Usa SSE/AVX (x86) ou NEON (AArch64) em MatrixMultiply, MatrixMultiplyVector,
+ *                  MatrixInvert (apenas SSE/AVX), Vector3DotProduct, Vector3CrossProduct e
+ *                  Vector3Normalize. O AVX é usado quando o compilador gera código AVX (ex.: -mavx).
+ *                  Os caminhos SIMD fazem as mesmas operações, na mesma ordem, que o código escalar,
+ *                  então o resultado é idêntico bit a bit (desde que o compilador não junte
+ *                  multiplicações e somas em FMA, ver -ffp-contract=off no xmake.lua)
  *
  *   DEPENDENCIES:
  *      <cmath.h>    - Required for: sinf(), cosf(), tan(), atan2f(), sqrtf(), floor(), fminf(), fmaxf(), fabs()
  *      <core/vector.hpp> - Required for: types Vector2, Vector3, Matrix and Quaternion
+ *      <type_traits>     - Required for: std::is_constant_evaluated()
+ *      <limits>          - Required for: std::numeric_limits (compile-time Sqrt)
+ *      <bit>, <cstdint>  - Required for: std::bit_cast, std::uint32_t (precision policy Fast)
  *
  *   CONTRIBUTORS:
  *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
@@ -65,9 +86,26 @@
 
 #include <math.h>
 #include <limits.h>
+#include <limits>
+#include <type_traits>
+#include <bit>
+#include <cstdint>
 
 #include <core/vector.hpp>
 
+// Backend SIMD (MRX_SIMD), escolhido pelo conjunto de instruções para o qual o compilador gera código
+#if defined(MRX_SIMD) && defined(__AVX__)
+#define MRX_SIMD_AVX
+#define MRX_SIMD_SSE
+#include <immintrin.h>
+#elif defined(MRX_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#define MRX_SIMD_SSE
+#include <emmintrin.h>
+#elif defined(MRX_SIMD) && (defined(__aarch64__) || defined(_M_ARM64))
+#define MRX_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
 namespace math
 {
 
@@ -91,83 +129,1902 @@ namespace math
 #endif
 
   //----------------------------------------------------------------------------------
-  // Module Functions Declaration - Utils math functions
+  // Module Functions Definition - Utils math functions
   //----------------------------------------------------------------------------------
 
-  float Clamp(float value, float min, float max);
-  float Lerp(float start, float end, float amount);
-  float Normalize(float value, float start, float end);
-  float Remap(float value, float inputStart, float inputEnd, float outputStart, float outputEnd);
-  float Wrap(float value, float min, float max);
-  float FloatEquals(float a, float b);
+  /**
+   * @brief Restringe um valor para estar dentro de um intervalo especificado.
+   *
+   * Esta função recebe um valor de ponto flutuante e garante que ele esteja
+   * dentro do intervalo definido pelos valores mínimo e máximo fornecidos. Se o
+   * valor for menor que o mínimo, o mínimo é retornado. Se o valor for maior que
+   * o máximo, o máximo é retornado. Caso contrário, o valor original é retornado.
+   *
+   * @param value O valor de ponto flutuante a ser restringido.
+   * @param min O valor mínimo permitido.
+   * @param max O valor máximo permitido.
+   * @return O valor restringido, que estará dentro do intervalo [min, max].
+   */
+  inline constexpr float Clamp(float value, float min, float max)
+  {
+    float result = (value < min) ? min : value;
+
+    if (result > max)
+      result = max;
+
+    return result;
+  }
+
+  /**
+   * @brief Interpola linearmente entre dois valores.
+   *
+   * Esta função calcula uma interpolação linear entre dois valores de ponto
+   * flutuante, `start` e `end`, com base na proporção `amount`. O valor `amount`
+   * deve estar no intervalo [0, 1], onde 0 retorna `start` e 1 retorna `end`.
+   * Qualquer valor intermediário de `amount` retorna um ponto entre `start` e `end`.
+   *
+   * @param start O valor inicial.
+   * @param end O valor final.
+   * @param amount A proporção para a interpolação, deve estar no intervalo [0, 1].
+   * @return O valor interpolado.
+   */
+  inline constexpr float Lerp(float start, float end, float amount)
+  {
+    return start + amount * (end - start);
+  }
+
+  /**
+   * @brief Normaliza um valor para um intervalo específico.
+   *
+   * Esta função recebe um valor de ponto flutuante e normaliza-o para o intervalo
+   * definido pelos valores de início e fim fornecidos. O valor retornado estará
+   * no intervalo [0, 1] se o valor original estiver dentro do intervalo [start, end].
+   *
+   * @param value O valor de ponto flutuante a ser normalizado.
+   * @param start O valor de início do intervalo.
+   * @param end O valor final do intervalo.
+   * @return O valor normalizado, que estará no intervalo [0, 1].
+   */
+  inline constexpr float Normalize(float value, float start, float end)
+  {
+    float result = (value - start) / (end - start);
+
+    return result;
+  }
+
+  /**
+   * @brief Remapeia um valor de um intervalo de entrada para um intervalo de saída.
+   *
+   * Esta função remapeia um valor de ponto flutuante, `value`, de um intervalo de entrada
+   * definido pelos valores `inputStart` e `inputEnd` para um intervalo de saída definido
+   * pelos valores `outputStart` e `outputEnd`.
+   *
+   * @param value O valor de ponto flutuante a ser remapeado.
+   * @param inputStart O início do intervalo de entrada.
+   * @param inputEnd O fim do intervalo de entrada.
+   * @param outputStart O início do intervalo de saída.
+   * @param outputEnd O fim do intervalo de saída.
+   * @return O valor remapeado para o intervalo de saída.
+   */
+  inline constexpr float Remap(float value, float inputStart, float inputEnd, float outputStart, float outputEnd)
+  {
+    float result = outputStart + ((outputEnd - outputStart) * ((value - inputStart) / (inputEnd - inputStart)));
+
+    return result;
+  }
+
+  /**
+   * @brief Envolve um valor dentro de um intervalo especificado.
+   *
+   * Esta função envolve um valor de ponto flutuante, `value`, dentro do intervalo
+   * definido pelos valores `min` e `max`. Se `value` ultrapassar o limite superior
+   * (`max`), ele será "enrolado" de volta para o limite inferior (`min`) e vice-versa.
+   *
+   * @param value O valor de ponto flutuante a ser envolvido.
+   * @param min O valor mínimo do intervalo.
+   * @param max O valor máximo do intervalo.
+   * @return O valor envolvido dentro do intervalo [min, max].
+   */
+  inline float Wrap(float value, float min, float max)
+  {
+    float result = value - (max - min) * floorf((value - min) / (max - min));
+
+    return result;
+  }
+
+  /**
+   * @brief Verifica se dois valores de ponto flutuante são aproximadamente iguais.
+   *
+   * Esta função compara dois valores de ponto flutuante e retorna verdadeiro se
+   * eles forem aproximadamente iguais, dentro de uma pequena margem de erro.
+   *
+   * @note O valor de erro é definido por `EPSILON`, que é 0.000001 por padrão.
+   *
+   * @param a O primeiro valor de ponto flutuante a ser comparado.
+   * @param b O segundo valor de ponto flutuante a ser comparado.
+   * @return Verdadeiro se os valores forem aproximadamente iguais, senão falso.
+   */
+  inline float FloatEquals(float a, float b)
+  {
+#if !defined(EPISLON)
+#define EPSILON 0.000001f
+#endif
+
+    return fabsf(a - b) <= EPSILON;
+  }
+
+  /**
+   * @brief Raiz quadrada que também pode ser avaliada em tempo de compilação
+   *
+   * @param value Valor (não negativo)
+   * @return A raiz quadrada do valor. Em tempo de execução é a própria sqrtf, em tempo de compilação
+   * é calculada pelo método de Newton em double e arredondada para float
+   */
+  inline constexpr float Sqrt(float value)
+  {
+    if (!std::is_constant_evaluated())
+      return sqrtf(value);
+
+    if (value == 0.0f || value != value || value == std::numeric_limits<float>::infinity())
+      return value;
+
+    if (value < 0.0f)
+      return std::numeric_limits<float>::quiet_NaN();
+
+    double x = value;
+    double result = value >= 1.0f ? x : 1.0;
+
+    for (int i = 0; i < 256; i++)
+    {
+      double next = 0.5 * (result + x / result);
+      if (next == result)
+        break;
+      result = next;
+    }
+
+    return static_cast<float>(result);
+  }
+
+  /**
+   * @brief Retorna o backend SIMD usado pelas funções de vetores e matrizes
+   *
+   * @return const char* "avx", "sse", "neon" ou "scalar" (compilado sem MRX_SIMD)
+   */
+  inline constexpr const char *SimdBackend()
+  {
+#if defined(MRX_SIMD_AVX)
+    return "avx";
+#elif defined(MRX_SIMD_SSE)
+    return "sse";
+#elif defined(MRX_SIMD_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+  }
 
   //----------------------------------------------------------------------------------
-  // Module Functions Declaration - Vector2 math functions
+  // Module Functions Definition - Vector2 math functions
   //----------------------------------------------------------------------------------
 
-  core::Vector2 Vector2Add(core::Vector2 a, core::Vector2 b);
-  core::Vector2 Vector2AddValue(core::Vector2 a, float scalar);
-  core::Vector2 Vector2Subtract(core::Vector2 a, core::Vector2 b);
-  core::Vector2 Vector2SubtractValue(core::Vector2 a, float scalar);
-  core::Vector2 Vector2Multiply(core::Vector2 a, core::Vector2 b);
-  core::Vector2 Vector2MultiplyValue(core::Vector2 a, float scalar);
-  core::Vector2 Vector2Divide(core::Vector2 a, core::Vector2 b);
-  core::Vector2 Vector2DivideValue(core::Vector2 a, float scalar);
-  core::Vector2 Vector2Negate(core::Vector2 a);
-  core::Vector2 Vector2Normalize(core::Vector2 a);
-  float Vector2DotProduct(core::Vector2 a, core::Vector2 b);
-  float Vector2Distance(core::Vector2 a, core::Vector2 b);
-  float Vector2Angle(core::Vector2 a, core::Vector2 b);
-  core::Vector2 Vector2Scale(core::Vector2 a, float scalar);
-  core::Vector2 Vector2Reflect(core::Vector2 a, core::Vector2 normal);
-  core::Vector2 Vector2Transform(core::Vector2 a, core::Matrix mat);
+  /**
+   * @brief Função que soma dois vetores 2D.
+   *
+   * Esta função calcula a soma de dois vetores bidimensionais(core::Vector2),
+   * `a` e `b`, e retorna o resultado como um novo vetor bidimensional.
+   *
+   * @param a O primeiro vetor bidimensional.
+   * @param b O segundo vetor bidimensional.
+   * @return O vetor bidimensional resultante da soma.
+   */
+  inline constexpr core::Vector2 Vector2Add(core::Vector2 a, core::Vector2 b)
+  {
+    core::Vector2 result = {a.x + b.x, a.y + b.y};
+
+    return result;
+  }
+
+  /**
+   * @brief Adiciona um valor de ponto flutuante (escalar) a um vetor 2D.
+   *
+   * Esta função adiciona um valor de ponto flutuante (escalar) a cada componente
+   * de um vetor bidimensional e retorna o resultado como um novo vetor bidimensional.
+   *
+   * @param a O vetor bidimensional.
+   * @param scalar O valor de ponto flutuante a ser adicionado.
+   * @return O vetor bidimensional resultante da adição.
+   */
+  inline constexpr core::Vector2 Vector2AddValue(core::Vector2 a, float scalar)
+  {
+    core::Vector2 result = {a.x + scalar, a.y + scalar};
+
+    return result;
+  }
+
+  /**
+   * @brief Subtrai dois vetores 2D.
+   *
+   * Esta função calcula a diferença entre dois vetores bidimensionais(core::Vector2),
+   * `a` e `b`, e retorna o resultado como um novo vetor bidimensional.
+   *
+   * @param a O primeiro vetor bidimensional.
+   * @param b O segundo vetor bidimensional.
+   * @return O vetor bidimensional resultante da subtração.
+   */
+  inline constexpr core::Vector2 Vector2Subtract(core::Vector2 a, core::Vector2 b)
+  {
+    core::Vector2 result = {a.x - b.x, a.y - b.y};
+
+    return result;
+  }
+
+  /**
+   * @brief Subtrai um valor de ponto flutuante (escalar) de um vetor 2D.
+   *
+   * Esta função subtrai um valor de ponto flutuante (escalar) de cada componente
+   * de um vetor bidimensional e retorna o resultado como um novo vetor bidimensional.
+   *
+   * @param a O vetor bidimensional.
+   * @param scalar O valor de ponto flutuante a ser subtraído.
+   * @return O vetor bidimensional resultante da subtração.
+   */
+  inline constexpr core::Vector2 Vector2SubtractValue(core::Vector2 a, float scalar)
+  {
+    core::Vector2 result = {a.x - scalar, a.y - scalar};
+
+    return result;
+  }
+
+  /**
+   * @brief Multiplica dois vetores 2D.
+   *
+   * Esta função calcula o produto de dois vetores bidimensionais(core::Vector2),
+   * `a` e `b`, e retorna o resultado como um novo vetor bidimensional.
+   *
+   * @param a O primeiro vetor bidimensional.
+   * @param b O segundo vetor bidimensional.
+   * @return O vetor bidimensional resultante da multiplicação.
+   */
+  inline constexpr core::Vector2 Vector2Multiply(core::Vector2 a, core::Vector2 b)
+  {
+    core::Vector2 result = {a.x * b.x, a.y * b.y};
+
+    return result;
+  }
+
+  /**
+   * @brief Multiplica um vetor 2D por um valor de ponto flutuante (escalar).
+   *
+   * Esta função multiplica cada componente de um vetor bidimensional por um valor
+   * de ponto flutuante (escalar) e retorna o resultado como um novo vetor bidimensional.
+   *
+   * @param a O vetor bidimensional.
+   * @param scalar O valor de ponto flutuante a ser multiplicado.
+   * @return O vetor bidimensional resultante da multiplicação.
+   */
+  inline constexpr core::Vector2 Vector2MultiplyValue(core::Vector2 a, float scalar)
+  {
+    core::Vector2 result = {a.x * scalar, a.y * scalar};
+
+    return result;
+  }
+
+  /**
+   * @brief Divide dois vetores 2D.
+   *
+   * Esta função calcula a divisão de dois vetores bidimensionais(core::Vector2),
+   * `a` e `b`, e retorna o resultado como um novo vetor bidimensional.
+   *
+   * @param a O primeiro vetor bidimensional.
+   * @param b O segundo vetor bidimensional.
+   * @return O vetor bidimensional resultante da divisão.
+   */
+  inline constexpr core::Vector2 Vector2Divide(core::Vector2 a, core::Vector2 b)
+  {
+    core::Vector2 result = {a.x / b.x, a.y / b.y};
+
+    return result;
+  }
+
+  /**
+   * @brief Divide um vetor 2D por um valor de ponto flutuante (escalar).
+   *
+   * Esta função divide cada componente de um vetor bidimensional por um valor
+   * de ponto flutuante (escalar) e retorna o resultado como um novo vetor bidimensional.
+   *
+   * @param a O vetor bidimensional.
+   * @param scalar O valor de ponto flutuante a ser dividido.
+   * @return O vetor bidimensional resultante da divisão.
+   */
+  inline constexpr core::Vector2 Vector2DivideValue(core::Vector2 a, float scalar)
+  {
+    core::Vector2 result = {a.x / scalar, a.y / scalar};
+
+    return result;
+  }
+
+  /**
+   * @brief Inverte um vetor 2D.
+   *
+   * Esta função inverte um vetor bidimensional, `a`, e retorna o resultado como
+   * um novo vetor bidimensional.
+   *
+   * @param a O vetor bidimensional a ser invertido.
+   * @return O vetor bidimensional resultante da inversão.
+   */
+  inline constexpr core::Vector2 Vector2Negate(core::Vector2 a)
+  {
+    core::Vector2 result = {-a.x, -a.y};
+
+    return result;
+  }
+
+  /**
+   * @brief Normaliza um vetor 2D.
+   *
+   * Esta função normaliza um vetor bidimensional, `a`, e retorna o resultado como
+   * um novo vetor bidimensional. O vetor resultante terá comprimento 1.
+   *
+   * @param a O vetor bidimensional a ser normalizado.
+   * @return O vetor bidimensional normalizado.
+   */
+  inline constexpr core::Vector2 Vector2Normalize(core::Vector2 a)
+  {
+    float length = Sqrt(a.x * a.x + a.y * a.y);
+
+    core::Vector2 result = {a.x / length, a.y / length};
+
+    return result;
+  }
+
+  /**
+   * @brief Calcula o produto escalar de dois vetores 2D.
+   *
+   * Esta função calcula o produto escalar de dois vetores bidimensionais(core::Vector2),
+   * `a` e `b`, e retorna o resultado como um valor de ponto flutuante.
+   *
+   * @param a O primeiro vetor bidimensional.
+   * @param b O segundo vetor bidimensional.
+   * @return O produto escalar dos vetores.
+   */
+  inline constexpr float Vector2DotProduct(core::Vector2 a, core::Vector2 b)
+  {
+    float result = (a.x * b.x) + (a.y * b.y);
+
+    return result;
+  }
+
+  /**
+   * @brief Calcula a distância entre dois vetores 2D.
+   *
+   * Esta função calcula a distância entre dois vetores bidimensionais(core::Vector2),
+   * `a` e `b`, e retorna o resultado como um valor de ponto flutuante.
+   *
+   * @param a O primeiro vetor bidimensional.
+   * @param b O segundo vetor bidimensional.
+   * @return A distância entre os vetores.
+   */
+  inline constexpr float Vector2Distance(core::Vector2 a, core::Vector2 b)
+  {
+    float result = Sqrt(((b.x - a.x) * (b.x - a.x)) + ((b.y - a.y) * (b.y - a.y)));
+
+    return result;
+  }
+
+  /**
+   * @brief Calcula o ângulo entre dois vetores 2D.
+   *
+   * Esta função calcula o ângulo entre dois vetores bidimensionais(core::Vector2),
+   * `a` e `b`, e retorna o resultado como um valor de ponto flutuante.
+   *
+   * @param a O primeiro vetor bidimensional.
+   * @param b O segundo vetor bidimensional.
+   * @return O ângulo entre os vetores.
+   */
+  inline float Vector2Angle(core::Vector2 a, core::Vector2 b)
+  {
+    float result = 0.0f;
+
+    float dot = a.x * b.x + a.y * b.y;
+    float det = a.x * b.y - a.y * b.x;
+
+    result = atan2f(det, dot);
+
+    return result;
+  }
+
+  /**
+   * @brief Escala um vetor 2D por um valor de ponto flutuante (escalar).
+   *
+   * Esta função escala um vetor bidimensional por um valor de ponto flutuante (escalar)
+   * e retorna o resultado como um novo vetor bidimensional.
+   *
+   * @param a O vetor bidimensional a ser escalado.
+   * @param scalar O valor de ponto flutuante a ser multiplicado.
+   * @return O vetor bidimensional resultante da escala.
+   */
+  inline constexpr core::Vector2 Vector2Scale(core::Vector2 a, float scalar)
+  {
+    core::Vector2 result = {a.x * scalar, a.y * scalar};
+
+    return result;
+  }
+
+  /**
+   * @brief Calcula o vetor refletido em relação a uma normal.
+   *
+   * Esta função calcula o vetor refletido em relação a uma normal e retorna o
+   * resultado como um novo vetor bidimensional.
+   *
+   * @param a O vetor a ser refletido.
+   * @param normal A normal com a qual o vetor será refletido.
+   * @return O vetor bidimensional resultante da reflexão.
+   */
+  inline constexpr core::Vector2 Vector2Reflect(core::Vector2 a, core::Vector2 normal)
+  {
+    core::Vector2 result = {0};
+
+    float dotProduct = (a.x * normal.x) + (a.y * normal.y);
+
+    result.x = a.x - (2.0f * normal.x) * dotProduct;
+    result.y = a.y - (2.0f * normal.y) * dotProduct;
+
+    return result;
+  }
+
+  /**
+   * @brief Transforma um vetor 2D por uma matriz de transformação.
+   *
+   * Esta função transforma um vetor bidimensional por uma matriz de transformação
+   * e retorna o resultado como um novo vetor bidimensional.
+   *
+   * @param a O vetor bidimensional a ser transformado.
+   * @param mat A matriz de transformação.
+   * @return O vetor bidimensional resultante da transformação.
+   */
+  inline constexpr core::Vector2 Vector2Transform(core::Vector2 a, core::Matrix mat)
+  {
+    core::Vector2 result = {0};
+
+    float x = a.x;
+    float y = a.y;
+    float z = 0;
+
+    result.x = mat.m0 * x + mat.m4 * y + mat.m8 * z + mat.m12;
+    result.y = mat.m1 * x + mat.m5 * y + mat.m9 * z + mat.m13;
+
+    return result;
+  }
 
   //----------------------------------------------------------------------------------
-  // Module Functions Declaration - Vector3 math functions
+  // Module Functions Definition - Vector3 math functions
   //----------------------------------------------------------------------------------
 
-  core::Vector3 Vector3Add(core::Vector3 a, core::Vector3 b);
-  core::Vector3 Vector3AddValue(core::Vector3 a, float scalar);
-  core::Vector3 Vector3Subtract(core::Vector3 a, core::Vector3 b);
-  core::Vector3 Vector3SubtractValue(core::Vector3 a, float scalar);
-  core::Vector3 Vector3Multiply(core::Vector3 a, core::Vector3 b);
-  core::Vector3 Vector3MultiplyValue(core::Vector3 a, float scalar);
-  core::Vector3 Vector3Divide(core::Vector3 a, core::Vector3 b);
-  core::Vector3 Vector3DivideValue(core::Vector3 a, float scalar);
-  core::Vector3 Vector3Negate(core::Vector3 a);
-  core::Vector3 Vector3Normalize(core::Vector3 a);
-  float Vector3DotProduct(core::Vector3 a, core::Vector3 b);
-  core::Vector3 Vector3CrossProduct(core::Vector3 a, core::Vector3 b);
-  float Vector3Distance(core::Vector3 a, core::Vector3 b);
-  float Vector3Angle(core::Vector3 a, core::Vector3 b);
-  core::Vector3 Vector3Scale(core::Vector3 a, float scale);
-  core::Vector3 Vector3Reflect(core::Vector3 a, core::Vector3 normal);
-  core::Vector3 Vector3Transform(core::Vector3 a, core::Matrix mat);
-  core::Vector3 Vector3Perpendicular(core::Vector3 a);
-  core::Vector3 Vector3RotateByQuaternion(core::Vector3 a, core::Quaternion q);
-  core::Vector3 Vector3RotateByAxisAngle(core::Vector3 a, core::Vector3 axis, float angle);
+  /**
+   * @brief Função que soma dois vetores 3D.
+   *
+   * Esta função calcula a soma de dois vetores bidimensionais(core::Vector3),
+   * `a` e `b`, e retorna o resultado como um novo vetor bidimensional.
+   *
+   * @param a O primeiro vetor tridimensional.
+   * @param b O segundo vetor tridimensional.
+   * @return O vetor tridimensional resultante da soma.
+   */
+  inline constexpr core::Vector3 Vector3Add(core::Vector3 a, core::Vector3 b)
+  {
+    core::Vector3 result = {a.x + b.x, a.y + b.y, a.z + b.z};
+
+    return result;
+  }
+
+  /**
+   * @brief Adiciona um valor de ponto flutuante (escalar) a um vetor 3D.
+   *
+   * Esta função adiciona um valor de ponto flutuante (escalar) a cada componente
+   * de um vetor tridimensional e retorna o resultado como um novo vetor tridimensional.
+   *
+   * @param a O vetor tridimensional.
+   * @param scalar O valor de ponto flutuante a ser adicionado.
+   * @return O vetor tridimensional resultante da adição.
+   */
+  inline constexpr core::Vector3 Vector3AddValue(core::Vector3 a, float scalar)
+  {
+    core::Vector3 result = {a.x + scalar, a.y + scalar, a.z + scalar};
+
+    return result;
+  }
+
+  /**
+   * @brief Subtrai dois vetores 3D.
+   *
+   * Esta função calcula a diferença entre dois vetores tridimensionais(core::Vector3),
+   * `a` e `b`, e retorna o resultado como um novo vetor tridimensional.
+   *
+   * @param a O primeiro vetor tridimensional.
+   * @param b O segundo vetor tridimensional.
+   * @return O vetor tridimensional resultante da subtração.
+   */
+  inline constexpr core::Vector3 Vector3Subtract(core::Vector3 a, core::Vector3 b)
+  {
+    core::Vector3 result = {a.x - b.x, a.y - b.y, a.z - b.z};
+
+    return result;
+  }
+
+  /**
+   * @brief Subtrai um valor de ponto flutuante (escalar) de um vetor 3D.
+   *
+   * Esta função subtrai um valor de ponto flutuante (escalar) de cada componente
+   * de um vetor tridimensional e retorna o resultado como um novo vetor tridimensional.
+   *
+   * @param a O vetor tridimensional.
+   * @param scalar O valor de ponto flutuante a ser subtraído.
+   * @return O vetor tridimensional resultante da subtração.
+   */
+  inline constexpr core::Vector3 Vector3SubtractValue(core::Vector3 a, float scalar)
+  {
+    core::Vector3 result = {a.x - scalar, a.y - scalar, a.z - scalar};
+
+    return result;
+  }
+
+  /**
+   * @brief Multiplica dois vetores 3D.
+   *
+   * Esta função calcula o produto de dois vetores tridimensionais(core::Vector3),
+   * `a` e `b`, e retorna o resultado como um novo vetor tridimensional.
+   *
+   * @param a O primeiro vetor tridimensional.
+   * @param b O segundo vetor tridimensional.
+   * @return O vetor tridimensional resultante da multiplicação.
+   */
+  inline constexpr core::Vector3 Vector3Multiply(core::Vector3 a, core::Vector3 b)
+  {
+    core::Vector3 result = {a.x * b.x, a.y * b.y, a.z * b.z};
+
+    return result;
+  }
+
+  /**
+   * @brief Multiplica um vetor 3D por um valor de ponto flutuante (escalar).
+   *
+   * Esta função multiplica cada componente de um vetor tridimensional por um valor
+   * de ponto flutuante (escalar) e retorna o resultado como um novo vetor tridimensional.
+   *
+   * @param a O vetor tridimensional.
+   * @param scalar O valor de ponto flutuante a ser multiplicado.
+   * @return O vetor tridimensional resultante da multiplicação.
+   */
+  inline constexpr core::Vector3 Vector3MultiplyValue(core::Vector3 a, float scalar)
+  {
+    core::Vector3 result = {a.x * scalar, a.y * scalar, a.z * scalar};
+
+    return result;
+  }
+
+  /**
+   * @brief Divide dois vetores 3D.
+   *
+   * Esta função calcula a divisão de dois vetores tridimensionais(core::Vector3),
+   * `a` e `b`, e retorna o resultado como um novo vetor tridimensional.
+   *
+   * @param a O primeiro vetor tridimensional.
+   * @param b O segundo vetor tridimensional.
+   * @return O vetor tridimensional resultante da divisão.
+   */
+  inline constexpr core::Vector3 Vector3Divide(core::Vector3 a, core::Vector3 b)
+  {
+    core::Vector3 result = {a.x / b.x, a.y / b.y, a.z / b.z};
+
+    return result;
+  }
+
+  /**
+   * @brief Divide um vetor 3D por um valor de ponto flutuante (escalar).
+   *
+   * Esta função divide cada componente de um vetor tridimensional por um valor
+   * de ponto flutuante (escalar) e retorna o resultado como um novo vetor tridimensional.
+   *
+   * @param a O vetor tridimensional.
+   * @param scalar O valor de ponto flutuante a ser dividido.
+   * @return O vetor tridimensional resultante da divisão.
+   */
+  inline constexpr core::Vector3 Vector3DivideValue(core::Vector3 a, float scalar)
+  {
+    core::Vector3 result = {a.x / scalar, a.y / scalar, a.z / scalar};
+
+    return result;
+  }
+
+  /**
+   * @brief Inverte um vetor 3D.
+   *
+   * Esta função inverte um vetor tridimensional, `a`, e retorna o resultado como
+   * um novo vetor tridimensional.
+   *
+   * @param a O vetor tridimensional a ser invertido.
+   * @return O vetor tridimensional resultante da inversão.
+   */
+  inline constexpr core::Vector3 Vector3Negate(core::Vector3 a)
+  {
+    core::Vector3 result = {-a.x, -a.y, -a.z};
+
+    return result;
+  }
+
+  /**
+   * @brief Normaliza um vetor 3D.
+   *
+   * Esta função normaliza um vetor tridimensional, `a`, e retorna o resultado como
+   * um novo vetor tridimensional. O vetor resultante terá comprimento 1.
+   *
+   * @param a O vetor tridimensional a ser normalizado.
+   * @return O vetor tridimensional normalizado.
+   */
+  inline constexpr core::Vector3 Vector3Normalize(core::Vector3 a)
+  {
+    core::Vector3 result = {0.0f, 0.0f, 0.0f};
+
+#if defined(MRX_SIMD_SSE)
+    if (!std::is_constant_evaluated())
+    {
+      __m128 vector = _mm_setr_ps(a.x, a.y, a.z, 0.0f);
+      __m128 product = _mm_mul_ps(vector, vector);
+      __m128 length = _mm_add_ss(_mm_add_ss(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 1, 1, 1))), _mm_movehl_ps(product, product));
+      length = _mm_sqrt_ss(length);
+
+      if (_mm_cvtss_f32(length) != 0.0f)
+      {
+        float normalized[4];
+        _mm_storeu_ps(normalized, _mm_div_ps(vector, _mm_shuffle_ps(length, length, _MM_SHUFFLE(0, 0, 0, 0))));
+        result = {normalized[0], normalized[1], normalized[2]};
+      }
+
+      return result;
+    }
+#elif defined(MRX_SIMD_NEON)
+    if (!std::is_constant_evaluated())
+    {
+      float values[4] = {a.x, a.y, a.z, 0.0f};
+      float32x4_t vector = vld1q_f32(values);
+      float32x4_t product = vmulq_f32(vector, vector);
+      float length = sqrtf((vgetq_lane_f32(product, 0) + vgetq_lane_f32(product, 1)) + vgetq_lane_f32(product, 2));
+
+      if (length != 0.0f)
+      {
+        vst1q_f32(values, vdivq_f32(vector, vdupq_n_f32(length)));
+        result = {values[0], values[1], values[2]};
+      }
+
+      return result;
+    }
+#endif
+
+    float length = Sqrt((a.x * a.x) + (a.y * a.y) + (a.z * a.z));
+
+    if (length != 0.0f)
+    {
+      result.x = a.x / length;
+      result.y = a.y / length;
+      result.z = a.z / length;
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Calcula o produto escalar de dois vetores 3D.
+   *
+   * Esta função calcula o produto escalar de dois vetores tridimensionais(core::Vector3),
+   * `a` e `b`, e retorna o resultado como um valor de ponto flutuante.
+   *
+   * @param a O primeiro vetor tridimensional.
+   * @param b O segundo vetor tridimensional.
+   * @return O produto escalar dos vetores.
+   */
+  inline constexpr float Vector3DotProduct(core::Vector3 a, core::Vector3 b)
+  {
+#if defined(MRX_SIMD_SSE)
+    if (!std::is_constant_evaluated())
+    {
+      __m128 product = _mm_mul_ps(_mm_setr_ps(a.x, a.y, a.z, 0.0f), _mm_setr_ps(b.x, b.y, b.z, 0.0f));
+      float result = _mm_cvtss_f32(_mm_add_ss(_mm_add_ss(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 1, 1, 1))), _mm_movehl_ps(product, product)));
+
+      return result;
+    }
+#elif defined(MRX_SIMD_NEON)
+    if (!std::is_constant_evaluated())
+    {
+      float values_a[4] = {a.x, a.y, a.z, 0.0f};
+      float values_b[4] = {b.x, b.y, b.z, 0.0f};
+      float32x4_t product = vmulq_f32(vld1q_f32(values_a), vld1q_f32(values_b));
+      float result = (vgetq_lane_f32(product, 0) + vgetq_lane_f32(product, 1)) + vgetq_lane_f32(product, 2);
+
+      return result;
+    }
+#endif
+
+    float result = (a.x * b.x) + (a.y * b.y) + (a.z * b.z);
+
+    return result;
+  }
+
+  /**
+   * @brief Calcula o produto vetorial de dois vetores 3D.
+   *
+   * Esta função calcula o produto vetorial de dois vetores tridimensionais(core::Vector3),
+   * `a` e `b`, e retorna o resultado como um novo vetor tridimensional.
+   *
+   * @param a O primeiro vetor tridimensional.
+   * @param b O segundo vetor tridimensional.
+   * @return O vetor tridimensional resultante do produto vetorial.
+   */
+  inline constexpr core::Vector3 Vector3CrossProduct(core::Vector3 a, core::Vector3 b)
+  {
+#if defined(MRX_SIMD_SSE)
+    if (!std::is_constant_evaluated())
+    {
+      __m128 vector_a = _mm_setr_ps(a.x, a.y, a.z, 0.0f);
+      __m128 vector_b = _mm_setr_ps(b.x, b.y, b.z, 0.0f);
+
+      // (a.yzx * b.zxy) - (a.zxy * b.yzx)
+      __m128 cross = _mm_sub_ps(
+          _mm_mul_ps(_mm_shuffle_ps(vector_a, vector_a, _MM_SHUFFLE(3, 0, 2, 1)), _mm_shuffle_ps(vector_b, vector_b, _MM_SHUFFLE(3, 1, 0, 2))),
+          _mm_mul_ps(_mm_shuffle_ps(vector_a, vector_a, _MM_SHUFFLE(3, 1, 0, 2)), _mm_shuffle_ps(vector_b, vector_b, _MM_SHUFFLE(3, 0, 2, 1))));
+
+      float values[4];
+      _mm_storeu_ps(values, cross);
+
+      core::Vector3 result = {values[0], values[1], values[2]};
+
+      return result;
+    }
+#elif defined(MRX_SIMD_NEON)
+    if (!std::is_constant_evaluated())
+    {
+      float a_yzx[4] = {a.y, a.z, a.x, 0.0f}, b_zxy[4] = {b.z, b.x, b.y, 0.0f};
+      float a_zxy[4] = {a.z, a.x, a.y, 0.0f}, b_yzx[4] = {b.y, b.z, b.x, 0.0f};
+
+      float values[4];
+      vst1q_f32(values, vsubq_f32(vmulq_f32(vld1q_f32(a_yzx), vld1q_f32(b_zxy)), vmulq_f32(vld1q_f32(a_zxy), vld1q_f32(b_yzx))));
+
+      core::Vector3 result = {values[0], values[1], values[2]};
+
+      return result;
+    }
+#endif
+
+    float x = a.y * b.z - a.z * b.y;
+    float y = a.z * b.x - a.x * b.z;
+    float z = a.x * b.y - a.y * b.x;
+
+    core::Vector3 result = {x, y, z};
+
+    return result;
+  }
+
+  /**
+   * @brief Calcula a distância entre dois vetores 3D.
+   *
+   * Esta função calcula a distância entre dois vetores tridimensionais(core::Vector3),
+   * `a` e `b`, e retorna o resultado como um valor de ponto flutuante.
+   *
+   * @param a O primeiro vetor tridimensional.
+   * @param b O segundo vetor tridimensional.
+   * @return A distância entre os vetores.
+   */
+  inline constexpr float Vector3Distance(core::Vector3 a, core::Vector3 b)
+  {
+    float result = 0.0f;
+
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    float dz = b.z - a.z;
+    result = Sqrt(dx * dx + dy * dy + dz * dz);
+
+    return result;
+  }
+
+  /**
+   * @brief Calcula o ângulo entre dois vetores 3D.
+   *
+   * Esta função calcula o ângulo entre dois vetores tridimensionais(core::Vector3),
+   * `a` e `b`, e retorna o resultado como um valor de ponto flutuante.
+   *
+   * @param a O primeiro vetor tridimensional.
+   * @param b O segundo vetor tridimensional.
+   * @return O ângulo entre os vetores.
+   */
+  inline float Vector3Angle(core::Vector3 a, core::Vector3 b)
+  {
+    float result = 0.0f;
+
+    float x = a.y * b.z - a.z * b.y;
+    float y = a.z * b.x - a.x * b.z;
+    float z = a.x * b.y - a.y * b.x;
+
+    core::Vector3 cross = {x, y, z};
+
+    float len = sqrtf(cross.x * cross.x + cross.y * cross.y + cross.z * cross.z);
+    float dot = (a.x * b.x + a.y * b.y + a.z * b.z);
+    result = atan2f(len, dot);
+
+    return result;
+  }
+
+  /**
+   * @brief Escala um vetor 3D por um valor de ponto flutuante (escalar).
+   *
+   * Esta função escala um vetor tridimensional por um valor de ponto flutuante (escalar)
+   * e retorna o resultado como um novo vetor tridimensional.
+   *
+   * @param a O vetor tridimensional a ser escalado.
+   * @param scalar O valor de ponto flutuante a ser multiplicado.
+   * @return O vetor tridimensional resultante da escala.
+   */
+  inline constexpr core::Vector3 Vector3Scale(core::Vector3 a, float scale)
+  {
+    core::Vector3 result = {a.x * scale, a.y * scale, a.z * scale};
+
+    return result;
+  }
+
+  /**
+   * @brief Calcula o vetor refletido em relação a uma normal.
+   *
+   * Esta função calcula o vetor refletido em relação a uma normal e retorna o
+   * resultado como um novo vetor tridimensional.
+   *
+   * @param a O vetor a ser refletido.
+   * @param normal A normal com a qual o vetor será refletido.
+   * @return O vetor tridimensional resultante da reflexão.
+   */
+  inline constexpr core::Vector3 Vector3Reflect(core::Vector3 a, core::Vector3 normal)
+  {
+    core::Vector3 result = {0};
+
+    float dotProduct = (a.x * normal.x) + (a.y * normal.y) + (a.z * normal.z);
+
+    result.x = a.x - (2.0f * normal.x) * dotProduct;
+    result.y = a.y - (2.0f * normal.y) * dotProduct;
+    result.z = a.z - (2.0f * normal.z) * dotProduct;
+
+    return result;
+  }
+
+  /**
+   * @brief Transforma um vetor 3D por uma matriz de transformação.
+   *
+   * Esta função transforma um vetor tridimensional por uma matriz de transformação
+   * e retorna o resultado como um novo vetor tridimensional.
+   *
+   * @param a O vetor tridimensional a ser transformado.
+   * @param mat A matriz de transformação.
+   * @return O vetor tridimensional resultante da transformação.
+   */
+  inline constexpr core::Vector3 Vector3Transform(core::Vector3 a, core::Matrix mat)
+  {
+    core::Vector3 result = {0};
+
+    float x = a.x;
+    float y = a.y;
+    float z = a.z;
+
+    result.x = mat.m0 * x + mat.m4 * y + mat.m8 * z + mat.m12;
+    result.y = mat.m1 * x + mat.m5 * y + mat.m9 * z + mat.m13;
+    result.z = mat.m2 * x + mat.m6 * y + mat.m10 * z + mat.m14;
+
+    return result;
+  }
+
+  /**
+   * @brief Transforma um vetor 3D por uma matriz de transformação (escala, rotação, translação).
+   *
+   * Esta função transforma um vetor tridimensional por uma matriz de transformação
+   * (escala, rotação, translação) e retorna o resultado como um novo vetor tridimensional.
+   *
+   * @param a O vetor tridimensional a ser transformado.
+   * @param mat A matriz de transformação.
+   * @return O vetor tridimensional resultante da transformação.
+   */
+  inline core::Vector3 Vector3Perpendicular(core::Vector3 a)
+  {
+    core::Vector3 result = {0};
+
+    float x = fabsf(a.x);
+    float y = fabsf(a.y);
+    float z = fabsf(a.z);
+
+    if ((x < y) && (x < z) && (x != 0.0f))
+    {
+      result = {1.0f, 0.0f, 0.0f};
+    }
+    else if ((y < x) && (y < z) && (y != 0.0f))
+    {
+      result = {0.0f, 1.0f, 0.0f};
+    }
+    else if ((z != 0.0f))
+    {
+      result = {0.0f, 0.0f, 1.0f};
+    }
+
+    // Cross product with result
+    x = a.y * result.z - a.z * result.y;
+    y = a.z * result.x - a.x * result.z;
+    z = a.x * result.y - a.y * result.x;
+
+    result = {x, y, z};
+
+    return result;
+  }
+
+  /**
+   * @brief Função que rotaciona um vetor 3D por um quaternion.
+   *
+   * Esta função rotaciona um vetor tridimensional por um quaternion e retorna o
+   * resultado como um novo vetor tridimensional.
+   *
+   * @param a O vetor tridimensional a ser rotacionado.
+   * @param q O quaternion de rotação.
+   * @return O vetor tridimensional resultante da rotação.
+   */
+  inline constexpr core::Vector3 Vector3RotateByQuaternion(core::Vector3 a, core::Quaternion q)
+  {
+    core::Vector3 result = {0};
+    float xx = q.x * q.x;
+    float yy = q.y * q.y;
+    float zz = q.z * q.z;
+    float ww = q.w * q.w;
+    float xy = q.x * q.y;
+    float zw = q.z * q.w;
+    float zx = q.z * q.x;
+    float yw = q.y * q.w;
+    float yz = q.y * q.z;
+    float xw = q.x * q.w;
+
+    // Formula from http://www.euclideanspace.com/maths/algebra/realNormedAlgebra/quaternions/transforms/index.htm
+    result.x = a.x * (xx + ww - yy - zz) + a.y * (2 * xy - 2 * zw) + a.z * (2 * zx + 2 * yw);
+    result.y = a.x * (2 * zw + 2 * xy) + a.y * (ww - xx + yy - zz) + a.z * (-2 * xw + 2 * yz);
+    result.z = a.x * (-2 * yw + 2 * zx) + a.y * (2 * xw + 2 * yz) + a.z * (ww - xx - yy + zz);
+
+    return result;
+  }
+
+  /**
+   * @brief Função que rotaciona um vetor 3D por um eixo e um ângulo.
+   *
+   * Esta função rotaciona um vetor tridimensional por um eixo e um ângulo e retorna o
+   * resultado como um novo vetor tridimensional.
+   *
+   * @param a O vetor tridimensional a ser rotacionado.
+   * @param axis O eixo de rotação.
+   * @param angle O ângulo de rotação.
+   * @return O vetor tridimensional resultante da rotação.
+   */
+  inline core::Vector3 Vector3RotateByAxisAngle(core::Vector3 a, core::Vector3 axis, float angle)
+  {
+
+    // Using Euler-Rodrigues Formula
+    // Ref.: https://en.wikipedia.org/w/index.php?title=Euler%E2%80%93Rodrigues_formula
+
+    core::Vector3 result = a;
+
+    // Vector3Normalize(axis);
+    float length = sqrtf(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
+    if (length == 0.0f)
+      length = 1.0f;
+    float ilength = 1.0f / length;
+    axis.x *= ilength;
+    axis.y *= ilength;
+    axis.z *= ilength;
+
+    angle /= 2.0f;
+    float _a = sinf(angle);
+    float b = axis.x * _a;
+    float c = axis.y * _a;
+    float d = axis.z * _a;
+    _a = cosf(angle);
+    core::Vector3 w = {b, c, d};
+
+    // Vector3CrossProduct(w, v)
+    core::Vector3 wv = {w.y * a.z - w.z * a.y, w.z * a.x - w.x * a.z, w.x * a.y - w.y * a.x};
+
+    // Vector3CrossProduct(w, wv)
+    core::Vector3 wwv = {w.y * wv.z - w.z * wv.y, w.z * wv.x - w.x * wv.z, w.x * wv.y - w.y * wv.x};
+
+    // Vector3Scale(wv, 2*a)
+    _a *= 2;
+    wv.x *= _a;
+    wv.y *= _a;
+    wv.z *= _a;
+
+    // Vector3Scale(wwv, 2)
+    wwv.x *= 2;
+    wwv.y *= 2;
+    wwv.z *= 2;
+
+    result.x += wv.x;
+    result.y += wv.y;
+    result.z += wv.z;
+
+    result.x += wwv.x;
+    result.y += wwv.y;
+    result.z += wwv.z;
+
+    return result;
+  }
+
+  //----------------------------------------------------------------------------------
+  // Module Functions Definition - Matrix math functions
+  //----------------------------------------------------------------------------------
+
+  /**
+   * @brief Função que soma duas matrizes.
+   *
+   * Esta função calcula a soma de duas matrizes 4x4(core::Matrix), `a` e `b`, e retorna o resultado como uma nova matriz 4x4.
+   *
+   * @param a A primeira matriz 4x4.
+   * @param b A segunda matriz 4x4.
+   * @return A matriz 4x4 resultante da soma.
+   */
+  inline constexpr core::Matrix MatrixAdd(core::Matrix a, core::Matrix b)
+  {
+    core::Matrix result = {0};
+
+    result.m0 = a.m0 + b.m0;
+    result.m1 = a.m1 + b.m1;
+    result.m2 = a.m2 + b.m2;
+    result.m3 = a.m3 + b.m3;
+    result.m4 = a.m4 + b.m4;
+    result.m5 = a.m5 + b.m5;
+    result.m6 = a.m6 + b.m6;
+    result.m7 = a.m7 + b.m7;
+    result.m8 = a.m8 + b.m8;
+    result.m9 = a.m9 + b.m9;
+    result.m10 = a.m10 + b.m10;
+    result.m11 = a.m11 + b.m11;
+    result.m12 = a.m12 + b.m12;
+    result.m13 = a.m13 + b.m13;
+    result.m14 = a.m14 + b.m14;
+    result.m15 = a.m15 + b.m15;
+
+    return result;
+  }
+
+  /**
+   * @brief Subtrai duas matrizes.
+   *
+   * Esta função calcula a diferença entre duas matrizes 4x4(core::Matrix), `a` e `b`, e retorna o resultado como uma nova matriz 4x4.
+   *
+   * @param a A primeira matriz 4x4.
+   * @param b A segunda matriz 4x4.
+   * @return A matriz 4x4 resultante da subtração.
+   */
+  inline constexpr core::Matrix MatrixSubtract(core::Matrix a, core::Matrix b)
+  {
+    core::Matrix result = {0};
+
+    result.m0 = a.m0 - b.m0;
+    result.m1 = a.m1 - b.m1;
+    result.m2 = a.m2 - b.m2;
+    result.m3 = a.m3 - b.m3;
+    result.m4 = a.m4 - b.m4;
+    result.m5 = a.m5 - b.m5;
+    result.m6 = a.m6 - b.m6;
+    result.m7 = a.m7 - b.m7;
+    result.m8 = a.m8 - b.m8;
+    result.m9 = a.m9 - b.m9;
+    result.m10 = a.m10 - b.m10;
+    result.m11 = a.m11 - b.m11;
+    result.m12 = a.m12 - b.m12;
+    result.m13 = a.m13 - b.m13;
+    result.m14 = a.m14 - b.m14;
+    result.m15 = a.m15 - b.m15;
+
+    return result;
+  }
+
+  /**
+   * @brief Multiplica duas matrizes.
+   *
+   * Esta função calcula o produto de duas matrizes 4x4(core::Matrix), `a` e `b`, e retorna o resultado como uma nova matriz 4x4.
+   *
+   * @param a A primeira matriz 4x4.
+   * @param b A segunda matriz 4x4.
+   * @return A matriz 4x4 resultante da multiplicação.
+   */
+  inline constexpr core::Matrix MatrixMultiply(core::Matrix a, core::Matrix b)
+  {
+    core::Matrix result = {0};
+
+    // Cada linha da memória do resultado é a combinação das linhas da memória de a pelos elementos da
+    // mesma linha de b, somados na mesma ordem do código escalar
+#if defined(MRX_SIMD_AVX)
+    if (!std::is_constant_evaluated())
+    {
+      // Duas linhas do resultado por vez
+      __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&a.m0));
+      __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&a.m1));
+      __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&a.m2));
+      __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&a.m3));
+
+      for (int row = 0; row < 4; row += 2)
+      {
+        __m256 rows_b = _mm256_loadu_ps(&b.m0 + row * 4);
+
+        __m256 rows = _mm256_mul_ps(_mm256_permute_ps(rows_b, _MM_SHUFFLE(0, 0, 0, 0)), a0);
+        rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_permute_ps(rows_b, _MM_SHUFFLE(1, 1, 1, 1)), a1));
+        rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_permute_ps(rows_b, _MM_SHUFFLE(2, 2, 2, 2)), a2));
+        rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_permute_ps(rows_b, _MM_SHUFFLE(3, 3, 3, 3)), a3));
+
+        _mm256_storeu_ps(&result.m0 + row * 4, rows);
+      }
+
+      return result;
+    }
+#elif defined(MRX_SIMD_SSE)
+    if (!std::is_constant_evaluated())
+    {
+      __m128 a0 = _mm_loadu_ps(&a.m0), a1 = _mm_loadu_ps(&a.m1), a2 = _mm_loadu_ps(&a.m2), a3 = _mm_loadu_ps(&a.m3);
+
+      for (int row = 0; row < 4; row++)
+      {
+        const float *row_b = &b.m0 + row * 4;
+
+        __m128 values = _mm_mul_ps(_mm_set1_ps(row_b[0]), a0);
+        values = _mm_add_ps(values, _mm_mul_ps(_mm_set1_ps(row_b[1]), a1));
+        values = _mm_add_ps(values, _mm_mul_ps(_mm_set1_ps(row_b[2]), a2));
+        values = _mm_add_ps(values, _mm_mul_ps(_mm_set1_ps(row_b[3]), a3));
+
+        _mm_storeu_ps(&result.m0 + row * 4, values);
+      }
+
+      return result;
+    }
+#elif defined(MRX_SIMD_NEON)
+    if (!std::is_constant_evaluated())
+    {
+      float32x4_t a0 = vld1q_f32(&a.m0), a1 = vld1q_f32(&a.m1), a2 = vld1q_f32(&a.m2), a3 = vld1q_f32(&a.m3);
+
+      for (int row = 0; row < 4; row++)
+      {
+        const float *row_b = &b.m0 + row * 4;
+
+        float32x4_t values = vmulq_n_f32(a0, row_b[0]);
+        values = vaddq_f32(values, vmulq_n_f32(a1, row_b[1]));
+        values = vaddq_f32(values, vmulq_n_f32(a2, row_b[2]));
+        values = vaddq_f32(values, vmulq_n_f32(a3, row_b[3]));
+
+        vst1q_f32(&result.m0 + row * 4, values);
+      }
+
+      return result;
+    }
+#endif
+
+    result.m0 = a.m0 * b.m0 + a.m1 * b.m4 + a.m2 * b.m8 + a.m3 * b.m12;
+    result.m1 = a.m0 * b.m1 + a.m1 * b.m5 + a.m2 * b.m9 + a.m3 * b.m13;
+    result.m2 = a.m0 * b.m2 + a.m1 * b.m6 + a.m2 * b.m10 + a.m3 * b.m14;
+    result.m3 = a.m0 * b.m3 + a.m1 * b.m7 + a.m2 * b.m11 + a.m3 * b.m15;
+    result.m4 = a.m4 * b.m0 + a.m5 * b.m4 + a.m6 * b.m8 + a.m7 * b.m12;
+    result.m5 = a.m4 * b.m1 + a.m5 * b.m5 + a.m6 * b.m9 + a.m7 * b.m13;
+    result.m6 = a.m4 * b.m2 + a.m5 * b.m6 + a.m6 * b.m10 + a.m7 * b.m14;
+    result.m7 = a.m4 * b.m3 + a.m5 * b.m7 + a.m6 * b.m11 + a.m7 * b.m15;
+    result.m8 = a.m8 * b.m0 + a.m9 * b.m4 + a.m10 * b.m8 + a.m11 * b.m12;
+    result.m9 = a.m8 * b.m1 + a.m9 * b.m5 + a.m10 * b.m9 + a.m11 * b.m13;
+    result.m10 = a.m8 * b.m2 + a.m9 * b.m6 + a.m10 * b.m10 + a.m11 * b.m14;
+    result.m11 = a.m8 * b.m3 + a.m9 * b.m7 + a.m10 * b.m11 + a.m11 * b.m15;
+    result.m12 = a.m12 * b.m0 + a.m13 * b.m4 + a.m14 * b.m8 + a.m15 * b.m12;
+    result.m13 = a.m12 * b.m1 + a.m13 * b.m5 + a.m14 * b.m9 + a.m15 * b.m13;
+    result.m14 = a.m12 * b.m2 + a.m13 * b.m6 + a.m14 * b.m10 + a.m15 * b.m14;
+    result.m15 = a.m12 * b.m3 + a.m13 * b.m7 + a.m14 * b.m11 + a.m15 * b.m15;
+
+    return result;
+  }
+
+  /**
+   * @brief Multiplica uma matriz por um vetor 4D.
+   *
+   * @param mat A matriz 4x4.
+   * @param vec O vetor 4D.
+   * @note O vetor 4D é tratado como uma matriz 4x1.
+   * @note Esta função é utilizada para transformar um vetor 4D por uma matriz 4x4.
+   * @return O vetor 4D resultante da multiplicação.
+   */
+  inline constexpr core::Vector4 MatrixMultiplyVector(core::Matrix mat, core::Vector4 vec)
+  {
+    core::Vector4 result = {0};
+
+    // O resultado é a combinação das linhas da memória da matriz pelas coordenadas do vetor
+#if defined(MRX_SIMD_SSE)
+    if (!std::is_constant_evaluated())
+    {
+      __m128 values = _mm_mul_ps(_mm_loadu_ps(&mat.m0), _mm_set1_ps(vec.x));
+      values = _mm_add_ps(values, _mm_mul_ps(_mm_loadu_ps(&mat.m1), _mm_set1_ps(vec.y)));
+      values = _mm_add_ps(values, _mm_mul_ps(_mm_loadu_ps(&mat.m2), _mm_set1_ps(vec.z)));
+      values = _mm_add_ps(values, _mm_mul_ps(_mm_loadu_ps(&mat.m3), _mm_set1_ps(vec.w)));
+
+      _mm_storeu_ps(&result.x, values);
+
+      return result;
+    }
+#elif defined(MRX_SIMD_NEON)
+    if (!std::is_constant_evaluated())
+    {
+      float32x4_t values = vmulq_n_f32(vld1q_f32(&mat.m0), vec.x);
+      values = vaddq_f32(values, vmulq_n_f32(vld1q_f32(&mat.m1), vec.y));
+      values = vaddq_f32(values, vmulq_n_f32(vld1q_f32(&mat.m2), vec.z));
+      values = vaddq_f32(values, vmulq_n_f32(vld1q_f32(&mat.m3), vec.w));
+
+      vst1q_f32(&result.x, values);
+
+      return result;
+    }
+#endif
+
+    result.x = mat.m0 * vec.x + mat.m1 * vec.y + mat.m2 * vec.z + mat.m3 * vec.w;
+    result.y = mat.m4 * vec.x + mat.m5 * vec.y + mat.m6 * vec.z + mat.m7 * vec.w;
+    result.z = mat.m8 * vec.x + mat.m9 * vec.y + mat.m10 * vec.z + mat.m11 * vec.w;
+    result.w = mat.m12 * vec.x + mat.m13 * vec.y + mat.m14 * vec.z + mat.m15 * vec.w;
+
+    return result;
+  }
+
+  /**
+   * @brief Função para multiplicar uma matriz por um escalar.
+   *
+   * @param mat Matriz 4x4
+   * @param scalar Escalar
+   * @return core::Matrix
+   */
+  inline constexpr core::Matrix MatrixMultiplyValue(core::Matrix mat, float scalar)
+  {
+    core::Matrix result = {0};
+
+    result.m0 = mat.m0 * scalar;
+    result.m1 = mat.m1 * scalar;
+    result.m2 = mat.m2 * scalar;
+    result.m3 = mat.m3 * scalar;
+    result.m4 = mat.m4 * scalar;
+    result.m5 = mat.m5 * scalar;
+    result.m6 = mat.m6 * scalar;
+    result.m7 = mat.m7 * scalar;
+    result.m8 = mat.m8 * scalar;
+    result.m9 = mat.m9 * scalar;
+    result.m10 = mat.m10 * scalar;
+    result.m11 = mat.m11 * scalar;
+    result.m12 = mat.m12 * scalar;
+    result.m13 = mat.m13 * scalar;
+    result.m14 = mat.m14 * scalar;
+    result.m15 = mat.m15 * scalar;
+
+    return result;
+  }
+
+  /**
+   * @brief Função que calcula o determinante de uma matriz 4x4.
+   *
+   * Esta função calcula o determinante de uma matriz 4x4(core::Matrix) e retorna o resultado como um valor de ponto flutuante.
+   *
+   * @param mat A matriz 4x4.
+   * @return O determinante da matriz.
+   */
+  inline constexpr float MatrixDeterminant(core::Matrix mat)
+  {
+    float result = 0.0f;
+
+    // Cache the matrix to avoid repeated lookups
+    float a00 = mat.m0, a01 = mat.m1, a02 = mat.m2, a03 = mat.m3;
+    float a10 = mat.m4, a11 = mat.m5, a12 = mat.m6, a13 = mat.m7;
+    float a20 = mat.m8, a21 = mat.m9, a22 = mat.m10, a23 = mat.m11;
+    float a30 = mat.m12, a31 = mat.m13, a32 = mat.m14, a33 = mat.m15;
+
+    result = a30 * a21 * a12 * a03 - a20 * a31 * a12 * a03 - a30 * a11 * a22 * a03 + a10 * a31 * a22 * a03 +
+             a20 * a11 * a32 * a03 - a10 * a21 * a32 * a03 - a30 * a21 * a02 * a13 + a20 * a31 * a02 * a13 +
+             a30 * a01 * a22 * a13 - a00 * a31 * a22 * a13 - a20 * a01 * a32 * a13 + a00 * a21 * a32 * a13 +
+             a30 * a11 * a02 * a23 - a10 * a31 * a02 * a23 - a30 * a01 * a12 * a23 + a00 * a31 * a12 * a23 +
+             a10 * a01 * a32 * a23 - a00 * a11 * a32 * a23 - a20 * a11 * a02 * a33 + a10 * a21 * a02 * a33 +
+             a20 * a01 * a12 * a33 - a00 * a21 * a12 * a33 - a10 * a01 * a22 * a33 + a00 * a11 * a22 * a33;
+
+    return result;
+  }
+
+  /**
+   * @brief Transpõe uma matriz.
+   *
+   * Esta função transpõe uma matriz 4x4(core::Matrix) e retorna o resultado como uma nova matriz 4x4.
+   *
+   * @param mat A matriz 4x4.
+   * @return A matriz
+   */
+  inline constexpr core::Matrix MatrixTranspose(core::Matrix mat)
+  {
+    core::Matrix result = {0};
+
+    result.m0 = mat.m0;
+    result.m1 = mat.m4;
+    result.m2 = mat.m8;
+    result.m3 = mat.m12;
+    result.m4 = mat.m1;
+    result.m5 = mat.m5;
+    result.m6 = mat.m9;
+    result.m7 = mat.m13;
+    result.m8 = mat.m2;
+    result.m9 = mat.m6;
+    result.m10 = mat.m10;
+    result.m11 = mat.m14;
+    result.m12 = mat.m3;
+    result.m13 = mat.m7;
+    result.m14 = mat.m11;
+    result.m15 = mat.m15;
+
+    return result;
+  }
+
+  /**
+   * @brief Inverte uma matriz.
+   *
+   * Esta função inverte uma matriz 4x4(core::Matrix) e retorna o resultado como uma nova matriz 4x4.
+   *
+   * @param mat A matriz 4x4.
+   * @return A matriz resultante da inversão.
+   */
+  inline constexpr core::Matrix MatrixInvert(core::Matrix mat)
+  {
+    core::Matrix result = {0};
+
+#if defined(MRX_SIMD_SSE)
+    if (!std::is_constant_evaluated())
+    {
+      // As linhas da memória são as colunas da matriz: transpostas, viram as linhas a0*, a1*, a2* e a3*
+      __m128 a0 = _mm_loadu_ps(&mat.m0), a1 = _mm_loadu_ps(&mat.m1), a2 = _mm_loadu_ps(&mat.m2), a3 = _mm_loadu_ps(&mat.m3);
+      _MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+
+      // Menores 2x2: b00-b03, b06-b09 e (b04, b05, b10, b11), com os mesmos produtos do código escalar
+      float b[12], pairs[4];
+      _mm_storeu_ps(b, _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 3, 2, 1))),
+                                  _mm_mul_ps(_mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 3, 2, 1)), _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 0, 0, 0)))));
+      _mm_storeu_ps(b + 6, _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a2, a2, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(a3, a3, _MM_SHUFFLE(2, 3, 2, 1))),
+                                      _mm_mul_ps(_mm_shuffle_ps(a2, a2, _MM_SHUFFLE(2, 3, 2, 1)), _mm_shuffle_ps(a3, a3, _MM_SHUFFLE(1, 0, 0, 0)))));
+      _mm_storeu_ps(pairs, _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a0, a2, _MM_SHUFFLE(2, 1, 2, 1)), _mm_shuffle_ps(a1, a3, _MM_SHUFFLE(3, 3, 3, 3))),
+                                      _mm_mul_ps(_mm_shuffle_ps(a0, a2, _MM_SHUFFLE(3, 3, 3, 3)), _mm_shuffle_ps(a1, a3, _MM_SHUFFLE(2, 1, 2, 1)))));
+      b[4] = pairs[0];
+      b[5] = pairs[1];
+      b[10] = pairs[2];
+      b[11] = pairs[3];
+
+      float invDet = 1.0f / (b[0] * b[11] - b[1] * b[10] + b[2] * b[9] + b[3] * b[8] - b[4] * b[7] + b[5] * b[6]);
+
+      // Cada linha da memória do resultado soma três produtos com sinais alternados
+      __m128 even = _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f);
+      __m128 odd = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+      __m128 minors[2][3] = {{_mm_setr_ps(b[11], b[11], b[10], b[9]), _mm_setr_ps(b[10], b[8], b[8], b[7]), _mm_setr_ps(b[9], b[7], b[6], b[6])},
+                             {_mm_setr_ps(b[5], b[5], b[4], b[3]), _mm_setr_ps(b[4], b[2], b[2], b[1]), _mm_setr_ps(b[3], b[1], b[0], b[0])}};
+      __m128 rows[4] = {a1, a0, a3, a2};
+
+      for (int row = 0; row < 4; row++)
+      {
+        __m128 a = rows[row];
+        __m128 sign = row % 2 == 0 ? even : odd;
+        __m128 opposite = row % 2 == 0 ? odd : even;
+        const __m128 *minor = minors[row / 2];
+
+        __m128 values = _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 1)), minor[0]), sign);
+        values = _mm_add_ps(values, _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 2, 2)), minor[1]), opposite));
+        values = _mm_add_ps(values, _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 3, 3)), minor[2]), sign));
+
+        _mm_storeu_ps(&result.m0 + row * 4, _mm_mul_ps(values, _mm_set1_ps(invDet)));
+      }
+
+      return result;
+    }
+#endif
+
+    // Cache the matrix values (speed optimization)
+    float a00 = mat.m0, a01 = mat.m1, a02 = mat.m2, a03 = mat.m3;
+    float a10 = mat.m4, a11 = mat.m5, a12 = mat.m6, a13 = mat.m7;
+    float a20 = mat.m8, a21 = mat.m9, a22 = mat.m10, a23 = mat.m11;
+    float a30 = mat.m12, a31 = mat.m13, a32 = mat.m14, a33 = mat.m15;
+
+    float b00 = a00 * a11 - a01 * a10;
+    float b01 = a00 * a12 - a02 * a10;
+    float b02 = a00 * a13 - a03 * a10;
+    float b03 = a01 * a12 - a02 * a11;
+    float b04 = a01 * a13 - a03 * a11;
+    float b05 = a02 * a13 - a03 * a12;
+    float b06 = a20 * a31 - a21 * a30;
+    float b07 = a20 * a32 - a22 * a30;
+    float b08 = a20 * a33 - a23 * a30;
+    float b09 = a21 * a32 - a22 * a31;
+    float b10 = a21 * a33 - a23 * a31;
+    float b11 = a22 * a33 - a23 * a32;
+
+    // Calculate the invert determinant (inlined to avoid double-caching)
+    float invDet = 1.0f / (b00 * b11 - b01 * b10 + b02 * b09 + b03 * b08 - b04 * b07 + b05 * b06);
+
+    result.m0 = (a11 * b11 - a12 * b10 + a13 * b09) * invDet;
+    result.m1 = (-a01 * b11 + a02 * b10 - a03 * b09) * invDet;
+    result.m2 = (a31 * b05 - a32 * b04 + a33 * b03) * invDet;
+    result.m3 = (-a21 * b05 + a22 * b04 - a23 * b03) * invDet;
+    result.m4 = (-a10 * b11 + a12 * b08 - a13 * b07) * invDet;
+    result.m5 = (a00 * b11 - a02 * b08 + a03 * b07) * invDet;
+    result.m6 = (-a30 * b05 + a32 * b02 - a33 * b01) * invDet;
+    result.m7 = (a20 * b05 - a22 * b02 + a23 * b01) * invDet;
+    result.m8 = (a10 * b10 - a11 * b08 + a13 * b06) * invDet;
+    result.m9 = (-a00 * b10 + a01 * b08 - a03 * b06) * invDet;
+    result.m10 = (a30 * b04 - a31 * b02 + a33 * b00) * invDet;
+    result.m11 = (-a20 * b04 + a21 * b02 - a23 * b00) * invDet;
+    result.m12 = (-a10 * b09 + a11 * b07 - a12 * b06) * invDet;
+    result.m13 = (a00 * b09 - a01 * b07 + a02 * b06) * invDet;
+    result.m14 = (-a30 * b03 + a31 * b01 - a32 * b00) * invDet;
+    result.m15 = (a20 * b03 - a21 * b01 + a22 * b00) * invDet;
+
+    return result;
+  }
+
+  /**
+   * @brief Obtém uma matriz de translação com deslocamento em x, y e z. Representados por um vetor 3D.
+   *
+   * @param core::Vector3 A quantidade de deslocamento em x, y e z.
+   * @return A matriz de translação resultante.
+   */
+  inline constexpr core::Matrix MatrixTranslate(core::Vector3 translation)
+  {
+    core::Matrix result = {0};
+
+    // Set the matrix to identity
+    result.m0 = 1.0f;
+    result.m5 = 1.0f;
+    result.m10 = 1.0f;
+    result.m15 = 1.0f;
+
+    result.m12 = translation.x;
+    result.m13 = translation.y;
+    result.m14 = translation.z;
+
+    return result;
+  }
+
+  /**
+   * @brief Obtém uma matriz de rotação em torno de um eixo (x, y ou z).
+   *
+   * @param axis O eixo de rotação.
+   * @param angle O ângulo de rotação.
+   * @return A matriz de rotação resultante.
+   */
+  inline core::Matrix MatrixRotate(core::Vector3 axis, float angle)
+  {
+    core::Matrix result = {0};
+
+    float x = axis.x, y = axis.y, z = axis.z;
+
+    float lengthSquared = x * x + y * y + z * z;
+
+    if ((lengthSquared != 1.0f) && (lengthSquared != 0.0f))
+    {
+      float ilength = 1.0f / sqrtf(lengthSquared);
+      x *= ilength;
+      y *= ilength;
+      z *= ilength;
+    }
+
+    float sinres = sinf(angle);
+    float cosres = cosf(angle);
+    float t = 1.0f - cosres;
+
+    result.m0 = x * x * t + cosres;
+    result.m1 = y * x * t + z * sinres;
+    result.m2 = z * x * t - y * sinres;
+    result.m3 = 0.0f;
+
+    result.m4 = x * y * t - z * sinres;
+    result.m5 = y * y * t + cosres;
+    result.m6 = z * y * t + x * sinres;
+    result.m7 = 0.0f;
+
+    result.m8 = x * z * t + y * sinres;
+    result.m9 = y * z * t - x * sinres;
+    result.m10 = z * z * t + cosres;
+    result.m11 = 0.0f;
+
+    result.m12 = 0.0f;
+    result.m13 = 0.0f;
+    result.m14 = 0.0f;
+    result.m15 = 1.0f;
+
+    return result;
+  }
+
+  /**
+   * @brief Obtém uma matriz de escala com fatores de escala em x, y e z.
+   *
+   * @param scale Vetor 3D com fatores de escala em x, y e z.
+   * @return core::Matrix
+   */
+  inline constexpr core::Matrix MatrixScale(core::Vector3 scale)
+  {
+    core::Matrix result = {1, 0, 0, 0,
+                           0, 1, 0, 0,
+                           0, 0, 1, 0,
+                           0, 0, 0, 1}; // MatrixIdentity()
+
+    result.m0 = scale.x;
+    result.m5 = scale.y;
+    result.m10 = scale.z;
+    result.m15 = 1.0f;
+
+    return result;
+  }
+
+  /**
+   * @brief Obtém uma matriz de rotação em torno do eixo X.
+   *
+   * @param angle O ângulo de rotação.
+   * @return core::Matrix A matriz de rotação resultante.
+   */
+  inline core::Matrix MatrixRotateX(float angle)
+  {
+    core::Matrix result = {0};
+
+    float sinres = sinf(angle);
+    float cosres = cosf(angle);
+
+    result.m0 = 1.0f;
+    result.m5 = cosres;
+    result.m6 = -sinres;
+    result.m9 = sinres;
+    result.m10 = cosres;
+    result.m15 = 1.0f;
+
+    return result;
+  }
+
+  /**
+   * @brief Obtém uma matriz de rotação em torno do eixo Y.
+   *
+   * @param angle O ângulo de rotação.
+   * @return core::Matrix A matriz de rotação resultante.
+   */
+  inline core::Matrix MatrixRotateY(float angle)
+  {
+    core::Matrix result = {0};
+
+    float sinres = sinf(angle);
+    float cosres = cosf(angle);
+
+    result.m0 = cosres;
+    result.m2 = sinres;
+    result.m5 = 1.0f;
+    result.m8 = -sinres;
+    result.m10 = cosres;
+    result.m15 = 1.0f;
+
+    return result;
+  }
+
+  /**
+   * @brief Obtém uma matriz de rotação em torno do eixo Z.
+   *
+   * @param angle O ângulo de rotação.
+   * @return core::Matrix A matriz de rotação resultante.
+   */
+  inline core::Matrix MatrixRotateZ(float angle)
+  {
+    core::Matrix result = {0};
+
+    float sinres = sinf(angle);
+    float cosres = cosf(angle);
+
+    result.m0 = cosres;
+    result.m1 = -sinres;
+    result.m4 = sinres;
+    result.m5 = cosres;
+    result.m10 = 1.0f;
+    result.m15 = 1.0f;
+
+    return result;
+  }
+
+  /**
+   * @brief Obtém uma matriz de rotação em torno dos eixos X, Y e Z.
+   *
+   * @param angle O ângulo de rotação.
+   *
+   * @note Os ângulos são fornecidos em radianos.
+   * @return core::Matrix
+   */
+  inline core::Matrix MatrixRotateXYZ(core::Vector3 angle)
+  {
+    core::Matrix result = {1.0f, 0.0f, 0.0f, 0.0f,
+                           0.0f, 1.0f, 0.0f, 0.0f,
+                           0.0f, 0.0f, 1.0f, 0.0f,
+                           0.0f, 0.0f, 0.0f, 1.0f}; // MatrixIdentity()
+
+    float cosz = cosf(-angle.z);
+    float sinz = sinf(-angle.z);
+    float cosy = cosf(-angle.y);
+    float siny = sinf(-angle.y);
+    float cosx = cosf(-angle.x);
+    float sinx = sinf(-angle.x);
+
+    result.m0 = cosz * cosy;
+    result.m1 = (cosz * siny * sinx) - (sinz * cosx);
+    result.m2 = (cosz * siny * cosx) + (sinz * sinx);
+
+    result.m4 = sinz * cosy;
+    result.m5 = (sinz * siny * sinx) + (cosz * cosx);
+    result.m6 = (sinz * siny * cosx) - (cosz * sinx);
+
+    result.m8 = -siny;
+    result.m9 = cosy * sinx;
+    result.m10 = cosy * cosx;
+
+    return result;
+  }
 
   //----------------------------------------------------------------------------------
-  // Module Functions Declaration - Matrix math functions
+  // Module Functions Definition - Precision policies
   //----------------------------------------------------------------------------------
 
-  core::Matrix MatrixAdd(core::Matrix a, core::Matrix b);
-  core::Matrix MatrixSubtract(core::Matrix a, core::Matrix b);
-  core::Matrix MatrixMultiply(core::Matrix a, core::Matrix b);
-  core::Vector4 MatrixMultiplyVector(core::Matrix mat, core::Vector4 vec);
-  core::Matrix MatrixMultiplyValue(core::Matrix mat, float scalar);
-  float MatrixDeterminant(core::Matrix mat);
-  core::Matrix MatrixInvert(core::Matrix mat);
-  core::Matrix MatrixTranspose(core::Matrix mat);
-
-  // Matrix transformations
-  core::Matrix MatrixTranslate(core::Vector3 vec);
-  core::Matrix MatrixRotate(core::Vector3 axis, float angle);
-  core::Matrix MatrixScale(core::Vector3 vec);
-
-  core::Matrix RotationMatrixX(float angle);
-  core::Matrix RotationMatrixY(float angle);
-  core::Matrix RotationMatrixZ(float angle);
-
-  core::Matrix MatrixRotateXYZ(core::Vector3 angle);
+// Erro relativo máximo de Fast::InverseSqrt, Fast::Normalize e Fast::NormalizeDot (estimativa pelos
+// bits do float e uma iteração de Newton)
+#define FAST_INVERSE_SQRT_ERROR 0.00176f
+// Erro relativo máximo de Fast::Exp2 e Fast::Exp (resultados abaixo de 2^-126 viram 0)
+#define FAST_EXP_ERROR 0.00001f
+// Erro máximo de Fast::Log2, relativo ao resultado e absoluto quando ele está em [-1, 1]
+#define FAST_LOG2_ERROR 0.00001f
+// Erro absoluto máximo de Fast::Pow com base em [0, 1] e expoente em [0, FAST_POW_MAX_EXPONENT]
+// (o brilho especular)
+#define FAST_POW_ERROR 0.00001f
+#define FAST_POW_MAX_EXPONENT 256.0f
+
+  /**
+   * @brief Política de precisão exata: as funções da biblioteca padrão e de mrxmath
+   *
+   * @note A iluminação é escrita sobre uma política (template), então o mesmo código gera a versão
+   * exata e a rápida. Exact mantém o resultado bit a bit da implementação sem política
+   */
+  struct Exact
+  {
+    /**
+     * @brief Calcula o inverso da raiz quadrada
+     *
+     * @param value Valor positivo
+     * @return 1 / sqrt(value)
+     */
+    static inline float InverseSqrt(float value)
+    {
+      float result = 1.0f / sqrtf(value);
+
+      return result;
+    }
+
+    /**
+     * @brief Calcula 2 elevado a um valor
+     *
+     * @param value Expoente
+     * @return 2^value
+     */
+    static inline float Exp2(float value)
+    {
+      float result = exp2f(value);
+
+      return result;
+    }
+
+    /**
+     * @brief Calcula e elevado a um valor
+     *
+     * @param value Expoente
+     * @return e^value
+     */
+    static inline float Exp(float value)
+    {
+      float result = expf(value);
+
+      return result;
+    }
+
+    /**
+     * @brief Calcula o logaritmo na base 2
+     *
+     * @param value Valor positivo
+     * @return log2(value)
+     */
+    static inline float Log2(float value)
+    {
+      float result = log2f(value);
+
+      return result;
+    }
+
+    /**
+     * @brief Eleva uma base a um expoente
+     *
+     * @param base Base
+     * @param exponent Expoente
+     * @return base^exponent
+     */
+    static inline float Pow(float base, float exponent)
+    {
+      float result = powf(base, exponent);
+
+      return result;
+    }
+
+    /**
+     * @brief Normaliza um vetor 3D (ver Vector3Normalize)
+     *
+     * @param a Vetor
+     * @return Vetor unitário na direção de a, ou o vetor nulo
+     */
+    static inline core::Vector3 Normalize(core::Vector3 a)
+    {
+      core::Vector3 result = Vector3Normalize(a);
+
+      return result;
+    }
+
+    /**
+     * @brief Calcula o produto escalar de um vetor com a direção (normalizada) de outro
+     *
+     * @param a Primeiro vetor (normalmente unitário, ex.: a normal)
+     * @param b Vetor cuja direção é usada (ex.: o vetor até a luz)
+     * @return Vector3DotProduct(a, Vector3Normalize(b))
+     */
+    static inline float NormalizeDot(core::Vector3 a, core::Vector3 b)
+    {
+      float result = Vector3DotProduct(a, Vector3Normalize(b));
+
+      return result;
+    }
+  };
+
+  /**
+   * @brief Política de precisão rápida: aproximações sem sqrtf, divisões, powf ou expf
+   *
+   * @note Os erros máximos são FAST_INVERSE_SQRT_ERROR, FAST_EXP_ERROR, FAST_LOG2_ERROR e
+   * FAST_POW_ERROR (verificados nos testes). Os polinômios são avaliados em pares (Estrin), para
+   * encurtar a cadeia de dependências, e as funções são constexpr
+   */
+  struct Fast
+  {
+    /**
+     * @brief Calcula o inverso da raiz quadrada com a estimativa pelos bits do float e uma iteração
+     * de Newton-Raphson
+     *
+     * @param value Valor positivo
+     * @return Aproximação de 1 / sqrt(value), com erro relativo até FAST_INVERSE_SQRT_ERROR
+     */
+    static inline constexpr float InverseSqrt(float value)
+    {
+      float result = std::bit_cast<float>(0x5f375a86u - (std::bit_cast<std::uint32_t>(value) >> 1));
+
+      result = result * (1.5f - (0.5f * value * result * result));
+
+      return result;
+    }
+
+    /**
+     * @brief Calcula 2 elevado a um valor: a parte inteira vai direto para o expoente do float e a
+     * fracionária, em [0, 1), é aproximada por um polinômio de grau 4
+     *
+     * @param value Expoente
+     * @return Aproximação de 2^value, com erro relativo até FAST_EXP_ERROR
+     */
+    static inline constexpr float Exp2(float value)
+    {
+      // Limites do expoente de um float normal, NaN vira o limite inferior
+      value = !(value > -127.0f) ? -127.0f : value;
+      value = value > 127.0f ? 127.0f : value;
+
+      // value + 127 é positivo, então a conversão para int é o piso
+      int integer = static_cast<int>(value + 127.0f);
+      float f = value - static_cast<float>(integer - 127);
+      float f2 = f * f;
+
+      float polynomial = (1.0f + 0.693044873f * f) + f2 * ((0.241279974f + 0.0522429696f * f) + f2 * 0.0134263757f);
+
+      // integer = 0 monta o float 0
+      float result = polynomial * std::bit_cast<float>(static_cast<std::uint32_t>(integer) << 23);
+
+      return result;
+    }
+
+    /**
+     * @brief Calcula e elevado a um valor (ver Exp2)
+     *
+     * @param value Expoente
+     * @return Aproximação de e^value, com erro relativo até FAST_EXP_ERROR
+     */
+    static inline constexpr float Exp(float value)
+    {
+      float result = Exp2(value * 1.44269504f);
+
+      return result;
+    }
+
+    /**
+     * @brief Calcula o logaritmo na base 2: o expoente do float é a parte inteira e a mantissa, levada
+     * para [sqrt(2)/2, sqrt(2)), é aproximada por t * q(t), t = mantissa - 1, com q de grau 5
+     *
+     * @param value Valor positivo e normal (0 resulta em -127)
+     * @return Aproximação de log2(value), com erro até FAST_LOG2_ERROR
+     */
+    static inline constexpr float Log2(float value)
+    {
+      std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+
+      // Expoente em relação a sqrt(2)/2 (0x3f3504f3), sem desvio para ajustar a mantissa
+      std::int32_t exponent = static_cast<std::int32_t>(bits - 0x3f3504f3u) >> 23;
+      float t = std::bit_cast<float>(bits - (static_cast<std::uint32_t>(exponent) << 23)) - 1.0f;
+      float t2 = t * t;
+
+      float polynomial = (1.44270161f - 0.721206435f * t) + t2 * ((0.479812307f - 0.366490886f * t) + t2 * (0.318193749f - 0.206187002f * t));
+
+      float result = static_cast<float>(exponent) + t * polynomial;
+
+      return result;
+    }
+
+    /**
+     * @brief Eleva uma base a um expoente como 2^(exponent * log2(base))
+     *
+     * @param base Base, não negativa
+     * @param exponent Expoente
+     * @return Aproximação de base^exponent, com erro absoluto até FAST_POW_ERROR para base em [0, 1]
+     * e expoente em [0, FAST_POW_MAX_EXPONENT]
+     */
+    static inline constexpr float Pow(float base, float exponent)
+    {
+      float result = Exp2(exponent * Log2(base));
+
+      return result;
+    }
+
+    /**
+     * @brief Normaliza um vetor 3D multiplicando-o pelo inverso aproximado do seu comprimento
+     *
+     * @param a Vetor
+     * @return Vetor com comprimento 1 (erro relativo até FAST_INVERSE_SQRT_ERROR), ou o vetor nulo
+     */
+    static inline constexpr core::Vector3 Normalize(core::Vector3 a)
+    {
+      core::Vector3 result = {0.0f, 0.0f, 0.0f};
+
+      float length = (a.x * a.x) + (a.y * a.y) + (a.z * a.z);
+
+      if (length != 0.0f)
+      {
+        float inverse = InverseSqrt(length);
+
+        result.x = a.x * inverse;
+        result.y = a.y * inverse;
+        result.z = a.z * inverse;
+      }
+
+      return result;
+    }
+
+    /**
+     * @brief Calcula o produto escalar de um vetor com a direção de outro sem montar o vetor
+     * normalizado: (a . b) / |b|
+     *
+     * @param a Primeiro vetor (normalmente unitário, ex.: a normal)
+     * @param b Vetor cuja direção é usada (ex.: o vetor até a luz)
+     * @return Produto escalar, com erro relativo até FAST_INVERSE_SQRT_ERROR (0 se b é nulo)
+     */
+    static inline constexpr float NormalizeDot(core::Vector3 a, core::Vector3 b)
+    {
+      float result = 0.0f;
+
+      float length = (b.x * b.x) + (b.y * b.y) + (b.z * b.z);
+
+      if (length != 0.0f)
+        result = ((a.x * b.x) + (a.y * b.y) + (a.z * b.z)) * InverseSqrt(length);
+
+      return result;
+    }
+  };
+
 } // namespace math
@@ -57,6 +57,7 @@
 #include <vector>
 #include <algorithm>
 #include <optional>
+#include <limits>
 
 namespace math
 {
@@ -64,22 +65,331 @@ namespace math
 #define LEFT_HANDED 0
 #define RIGHT_HANDED 1
 
+// Retângulo de recorte (min x, min y, max x, max y) que não limita a escrita nos buffers
+#define NO_SCISSOR core::Vector4{0.0f, 0.0f, std::numeric_limits<float>::max(), std::numeric_limits<float>::max()}
+
+// Resultado do teste de profundidade de um pixel (retorno de z_buffer)
+#define DEPTH_TEST_SKIPPED 0
+#define DEPTH_TEST_FAILED 1
+#define DEPTH_TEST_PASSED 2
+
+  /**
+   * @brief Testes de profundidade de um pixel em um quadro (mapa de overdraw)
+   *
+   * @param tests Fragmentos que chegaram ao teste de profundidade
+   * @param passes Fragmentos que passaram no teste e foram escritos
+   */
+  typedef struct DepthComplexity
+  {
+    unsigned int tests = 0;
+    unsigned int passes = 0;
+  } DepthComplexity;
+
+  // Testes de profundidade de cada pixel, indexado por [x][y]
+  typedef std::vector<std::vector<DepthComplexity>> DepthComplexityBuffer;
+
   namespace pipeline_adair
   {
     // Funções do Pipeline de Visualização 3D	- Adair Santa Catarina
-    core::Matrix sru_to_src(const core::Vector3 &vrp, const core::Vector3 fp, unsigned int handed = RIGHT_HANDED);
-    core::Matrix projection(const core::Vector3 &vrp, const core::Vector3 p, const float d);
-    core::Matrix src_to_srt(const core::Vector2 min_window, const core::Vector2 min_viewport, const core::Vector2 max_window, const core::Vector2 max_viewport, bool reflected);
-  }
+    // OBS.: constexpr, as matrizes de uma câmera fixa podem ser montadas em tempo de compilação
+
+    /**
+     * @brief Obtém a matriz de transformação de SRU para SRC.
+     * @note SRU: Sistema de Referência do Universo
+     * @note SRC: Sistema de Referência da Câmera
+     *
+     * A matriz de transformação obtida é dada por:
+     *
+     * | u.x  u.y  u.z  -u.vrp |
+     * | v.x  v.y  v.z  -v.vrp |
+     * | n.x  n.y  n.z  -n.vrp |
+     * | 0    0    0    1      |
+     *
+     * @param vrp Vetor de posição da câmera
+     * @param fp Ponto para onde a câmera está olhando
+     * @param handed Flag que indica se o sistema de coordenadas é destro ou canhoto (Padrão: RIGHT_HANDED)
+     * @return Matriz de transformação de SRU para SRC
+     */
+    inline constexpr core::Matrix sru_to_src(const core::Vector3 &vrp, const core::Vector3 fp, unsigned int handed = RIGHT_HANDED)
+    {
+      // Define the n vector.
+      core::Vector3 n;
+
+      if (handed == LEFT_HANDED)
+        n = {fp.x - vrp.x, fp.y - vrp.y, fp.z - vrp.z};
+      else
+        n = {vrp.x - fp.x, vrp.y - fp.y, vrp.z - fp.z};
+
+      core::Vector3 n_normalized = math::Vector3Normalize(n);
+
+      // Define the v vector.
+      // TODO: Choose the up vector, depending on the camera orientation.
+      core::Vector3 up_vec = {0, 1, 0};
+
+      float y1 = math::Vector3DotProduct(up_vec, n_normalized);
+
+      core::Vector3 _y1 = math::Vector3MultiplyValue(n_normalized, y1);
+
+      core::Vector3 v = {up_vec.x - _y1.x, up_vec.y - _y1.y, up_vec.z - _y1.z};
+
+      core::Vector3 v_normalized = math::Vector3Normalize(v);
+
+      // Define the u vector.
+      core::Vector3 u = math::Vector3CrossProduct(v_normalized, n_normalized);
+
+      // Make the transformation matrix.
+      core::Matrix result = core::Flota16ToMatrix({{u.x, u.y, u.z, -math::Vector3DotProduct(u, vrp),
+                                                    v_normalized.x, v_normalized.y, v_normalized.z, -math::Vector3DotProduct(v_normalized, vrp),
+                                                    n_normalized.x, n_normalized.y, n_normalized.z, -math::Vector3DotProduct(n_normalized, vrp),
+                                                    0, 0, 0, 1}});
+
+      return result;
+    }
+    /**
+     * @brief Obtém a matriz de projeção.
+     *
+     * A matriz de projeção obtida é dada por:
+     *
+     * | 1  0  0  0 |
+     * | 0  1  0  0 |
+     * | 0  0  -z_vp/dp  z_vp*z_prp/dp |
+     * | 0  0  -1/d  z_prp/dp |
+     *
+     * @param vrp Vetor de posição da câmera
+     * @param p Vetor 3D que representa o ponto focal da câmera
+     * @param d Distância do VRP ao plano ponto focal
+     * @return Matriz de projeção
+     */
+    inline constexpr core::Matrix projection(const core::Vector3 &vrp, const core::Vector3 p, const float d)
+    {
+
+      // This is the definitions of the projection plane.
+      [[maybe_unused]] core::Vector3 projection_plane = {
+          vrp.x + (p.x - vrp.x) * (d / (vrp.z - p.z)),
+          vrp.y + (p.y - vrp.y) * (d / (vrp.z - p.z)),
+          vrp.z + (p.z - vrp.z) * (d / (vrp.z - p.z))};
+
+      // The distance from the VRP to the projection plane.
+      float dp = d;
+      // The distance from the VRP to the focal point.
+      float z_vp = -dp;
+      // Z coordinate of the point, where the projection lines intersect the projection plane.
+      // In this case, the z_prp is 0. Because this point coincides with the origin of the SRC (0, 0, 0).
+      float z_prp = 0;
+
+      // core::Matrix result = core::Flota16ToMatrix({1, 0, 0, 0,
+      //                                              0, 1, 0, 0,
+      //                                              0, 0, 0, 0,
+      //                                              0, 0, 0, 1});
+      core::Matrix result = core::Flota16ToMatrix({1, 0, 0, 0,
+                                                   0, 1, 0, 0,
+                                                   0, 0, (-z_vp) / dp, z_vp * (z_prp) / dp,
+                                                   0, 0, -1 / d, z_prp / dp});
+
+      return result;
+    }
+    /**
+     * @brief Obtém a matriz de transformação de SRC para SRT.
+     *
+     * A matriz de transformação obtida é dada por:
+     *
+     * | (u_max - u_min)/(x_max - x_min)  0  0  -x_min *((u_max - u_min)/(x_max - x_min)) + u_min |
+     * | 0  (v_min - v_max)/(y_max - y_min)  0  y_min * ((v_max - v_min)/(y_max - y_min)) + v_max |
+     * | 0  0  1  0 |
+     * | 0  0  0  1 |
+     *
+     * @param min_window Vetor 2D que representa o canto inferior esquerdo da janela
+     * @param min_viewport Vetor 2D que representa o canto inferior esquerdo da viewport
+     * @param max_window Vetor 2D que representa o canto superior direito da janela
+     * @param max_viewport Vetor 2D que representa o canto superior direito da viewport
+     * @param reflected Flag que indica se a transformação é refletida
+     * @return Matriz de transformação de SRC para SRT
+     */
+    inline constexpr core::Matrix src_to_srt(const core::Vector2 min_window, const core::Vector2 min_viewport, const core::Vector2 max_window, const core::Vector2 max_viewport, bool reflected = false)
+    {
+      float u_min = min_viewport.x;
+      float u_max = max_viewport.x;
+      float v_min = min_viewport.y;
+      float v_max = max_viewport.y;
+
+      float x_min = min_window.x;
+      float x_max = max_window.x;
+      float y_min = min_window.y;
+      float y_max = max_window.y;
+
+      core::Matrix result;
+
+      if (reflected)
+      {
+        // | (u_max - u_min)/(x_max - x_min), 0, 0, -x_min *((u_max - u_min)/(x_max - x_min)) + u_min |\n
+        // | 0, (v_min - v_max)/(y_max - y_min), 0, y_min * ((v_max - v_min)/(y_max - y_min)) + v_max |\n
+        // | 0, 0, 1, 0 |\n
+        // | 0, 0, 0, 1 |
+        result = core::Flota16ToMatrix({(u_max - u_min) / (x_max - x_min), 0, 0, -x_min * ((u_max - u_min) / (x_max - x_min)) + u_min,
+                                        0, (v_min - v_max) / (y_max - y_min), 0, y_min * ((v_max - v_min) / (y_max - y_min)) + v_max,
+                                        0, 0, 1, 0,
+                                        0, 0, 0, 1});
+      }
+      else
+      {
+        // | (u_max - u_min)/(x_max - x_min), 0, 0, -x_min * ((u_max - u_min)/(x_max - x_min)) + u_min |\n
+        // | 0, (v_max - v_min)/(y_max - y_min), 0, -y_min * ((v_max - v_min)/(y_max - y_min)) + v_min) |\n
+        // | 0, 0, 1, 0 |\n
+        // | 0, 0, 0, 1 |
+        result = core::Flota16ToMatrix({(u_max - u_min) / (x_max - x_min), 0, 0, -x_min * ((u_max - u_min) / (x_max - x_min)) + u_min,
+                                        0, (v_max - v_min) / (y_max - y_min), 0, -y_min * ((v_max - v_min) / (y_max - y_min)) + v_min,
+                                        0, 0, 1, 0,
+                                        0, 0, 0, 1});
+      }
+
+      return result;
+    }  }
 
   namespace pipeline_smith
   {
     // Funções do Pipeline de visualização 3D - Alvy Ray Smith
     // OBS.: O pipeline é simplificado
-    core::Matrix clipping_transformation(const float d, const float far, const core::Vector2 center_window, const core::Vector2 size_window);
-    core::Matrix perspective_transformation(const float near, const float far);
-    core::Matrix src_to_srt(const core::Vector2 min_viewport, const core::Vector2 max_viewport, const float near, const float far);
-  }
+
+    /**
+     * @brief Obtém a matriz de transformação de recorte.
+     *
+     * @param d Distância do VRP ao plano de projeção
+     * @param far Plano de projeção distante
+     * @param center_window Centro da janela
+     * @param size_window Tamanho da janela
+     *
+     * @note O tamanho da janela é metade da largura e metade da altura
+     *
+     * @return core::Matrix
+     */
+    inline constexpr core::Matrix clipping_transformation(const float d, const float far, const core::Vector2 center_window, const core::Vector2 size_window)
+    {
+      // cu = center window x
+      // cv = center window y
+      // su = size window x
+      // sv = size window y
+      // | d/(su*far) 0          -(cu/d*far) 0 |
+      // | 0          d/(sv*far) -(cv/d*far) 0 |
+      // | 0          0          1/far       0 |
+      // | 0          0          0           1 |
+
+      float cu = center_window.x;
+      float cv = center_window.y;
+      float su = size_window.x / 2;
+      float sv = size_window.y / 2;
+
+      // core::Matrix result = core::Flota16ToMatrix({d / (su * far), 0, (-(cu / d) * far), 0,
+      //                                              0, d / (sv * far), (-(cv / d) * far), 0,
+      //                                              0, 0, 1 / far, 0,
+      //                                              0, 0, 0, 1});
+
+      core::Matrix D = core::Flota16ToMatrix({1, 0, -cu / d, 0,
+                                              0, 1, -cv / d, 0,
+                                              0, 0, 1, 0,
+                                              0, 0, 0, 1});
+
+      core::Matrix E = core::Flota16ToMatrix({d / (su * far), 0, 0, 0,
+                                              0, d / (sv * far), 0, 0,
+                                              0, 0, 1 / far, 0,
+                                              0, 0, 0, 1});
+
+      core::Matrix result = math::MatrixMultiply(E, D);
+
+      return result;
+    }
+    /**
+     * @brief Obtém a matrix de transformação perspectiva
+     *
+     * @note A transformação de perspectiva opera diretamente no espaço 3D e transforma o frustum em um paralelepípedo canônico com lados paralelos e comprimento unitário.
+     *
+     * @param near Plano de projeção próximo
+     * @param far Plano de projeção distante
+     * @return core::Matrix
+     */
+    inline constexpr core::Matrix perspective_transformation(const float near, const float far)
+    {
+      // Obs.: A transformação de perspectiva é feita através das seguintes operações:
+      // Translada z_min para a origem => F
+      // Escala o volume canônico em z para que o plano traseiro (far) coincida com z = 1 => G
+      // Realiza a transformação de perspectiva => H
+      // A matriz resultante I é igual à H * G * F
+
+      float z_min = near / far;
+
+      core::Matrix F = math::MatrixTranslate({0.0f, 0.0f, -z_min});
+
+      core::Matrix G = math::MatrixScale({1.0f, 1.0f, 1.0f / (1 - z_min)});
+
+      core::Matrix H = core::Flota16ToMatrix({1, 0, 0, 0,
+                                              0, 1, 0, 0,
+                                              0, 0, 1, 0,
+                                              0, 0, (1 - z_min) / z_min, 0});
+
+      core::Matrix result = math::MatrixMultiply(H, G);
+      result = math::MatrixMultiply(result, F);
+
+      float inv_z_min = 1 / z_min;
+
+      // multiplicar as 3 primeira linhas da matriz I por 1/z_min.
+      // Leva o tronco da piramide no prisma com dimensões 2*z_min em x, y e em z_min em z.
+      // linha 1
+      result.m0 *= inv_z_min;
+      result.m4 *= inv_z_min;
+      result.m8 *= inv_z_min;
+      result.m12 *= inv_z_min;
+      // linha 2
+      result.m1 *= inv_z_min;
+      result.m5 *= inv_z_min;
+      result.m9 *= inv_z_min;
+      result.m13 *= inv_z_min;
+      // linha 3
+      result.m2 *= inv_z_min;
+      result.m6 *= inv_z_min;
+      result.m10 *= inv_z_min;
+      result.m14 *= inv_z_min;
+
+      // multiplicar a matriz pelo escalar z_min
+      // Faz a projeção perspectiva levando o VRP para o infinito.
+      // A projeção passa a ser uma proj. paralela ortográfica ao ignorar a coordenada z.
+      result = math::MatrixMultiplyValue(result, z_min);
+
+      return result;
+    }
+    /**
+     * @brief Obtém a matriz de transformação do volume canônico para o SRT (viewport)
+     *
+     * @param min_viewport Canto inferior esquerdo da viewport
+     * @param max_viewport Canto superior direito da viewport
+     * @param near Plano de projeção próximo
+     * @param far Plano de projeção distante
+     * @return core::Matrix
+     */
+    inline constexpr core::Matrix src_to_srt(const core::Vector2 min_viewport, const core::Vector2 max_viewport, const float near, const float far)
+    {
+
+      core::Matrix K = core::Flota16ToMatrix({0.5f, 0.0f, 0.0f, 0.5f,
+                                              0.0f, 0.5f, 0.0f, 0.5f,
+                                              0.0f, 0.0f, 1.0f, 0.0f,
+                                              0.0f, 0.0f, 0.0f, 1.0f});
+      float dx = max_viewport.x - min_viewport.x;
+      float dy = max_viewport.y - min_viewport.y;
+      float dz = far - near;
+
+      core::Matrix L = core::Flota16ToMatrix({dx, 0, 0, min_viewport.x,
+                                              0, dy, 0, min_viewport.y,
+                                              0, 0, dz, near,
+                                              0, 0, 0, 1});
+
+      core::Matrix M = core::Flota16ToMatrix({1, 0, 0, 0.5f,
+                                              0, 1, 0, 0.5f,
+                                              0, 0, 1, 0.5f,
+                                              0, 0, 0, 1});
+
+      core::Matrix result = math::MatrixMultiply(M, L);
+      result = math::MatrixMultiply(result, K);
+
+      return result;
+    }  }
 
   //-------------------------------------------------------------------------------------------------
   // Funções de Clipping (Clipagem de Linha)
@@ -104,14 +414,22 @@ namespace math
   std::vector<std::pair<core::Vector3, core::Vector3>> clip2D_polygon(const std::vector<std::pair<core::Vector3, core::Vector3>> &polygon, const core::Vector2 &min, const core::Vector2 &max);
 
   std::vector<std::pair<core::Vector4, core::Vector3>> clip3D_polygon(const std::vector<std::pair<core::Vector4, core::Vector3>> &polygon);
+
+  //-------------------------------------------------------------------------------------------------
+  // Transformação de Vértices
+  //-------------------------------------------------------------------------------------------------
+
+  void project_vertices(const core::Matrix &transformation, const core::Vector4 *vertices, core::Vector3 *result, size_t count);
   //-------------------------------------------------------------------------------------------------
   // Funções de Preenchimento de Polígonos e Desenho de Linhas
   //-------------------------------------------------------------------------------------------------
 
   std::vector<core::Vector3> BresenhamLine(core::Vector3 start, core::Vector3 end);
-  void fill_polygon_flat_shading(const std::vector<core::Vector3> &vertexes, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, const core::Vector3 &eye, const core::Vector3 &face_centroid, const core::Vector3 &face_normal, const models::Material &object_material, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer, core::Vector2 max_window_size);
-  void fill_polygon_gourand(const std::vector<std::pair<core::Vector3, models::Color>> &vertexes, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer);
-  void fill_polygon_phong(const std::vector<std::pair<core::Vector3, core::Vector3>> &vertexes, const core::Vector3 &centroid, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, const core::Vector3 &eye, const models::Material &object_material, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer);
-  void z_buffer(const float x, const float y, const float z, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer);
+  void fill_polygon_flat_shading(const std::vector<core::Vector3> &vertexes, const models::ColorFloat &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, core::Vector2 max_window_size, const core::Vector4 &scissor = NO_SCISSOR, math::DepthComplexityBuffer *depth_complexity = nullptr);
+  void fill_polygon_gourand(const std::vector<std::pair<core::Vector3, models::ColorFloat>> &vertexes, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor = NO_SCISSOR, math::DepthComplexityBuffer *depth_complexity = nullptr);
+  template <typename Precision = math::Exact>
+  void fill_polygon_phong(const std::vector<std::pair<core::Vector3, core::Vector3>> &vertexes, const std::vector<core::Vector3> &positions, const core::Vector3 &centroid, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, const models::LightTiles &light_tiles, const core::Vector3 &eye, const models::Material &object_material, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor = NO_SCISSOR, math::DepthComplexityBuffer *depth_complexity = nullptr);
+  void fill_polygon_depth(const std::vector<core::Vector3> &vertexes, std::vector<std::vector<float>> &z_buffer);
+  int z_buffer(const float x, const float y, const float z, const models::ColorFloat &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor = NO_SCISSOR, math::DepthComplexityBuffer *depth_complexity = nullptr);
 
 } // namespace math
\ No newline at end of file
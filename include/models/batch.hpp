@@ -0,0 +1,132 @@
+/**********************************************************************************************
+ *   IDIOM: PORTUGUÊS
+ *
+ *   mrx-batch v1.0 - Renderização em lote: várias cenas, configurações e trajetórias de câmera
+ *
+ *   CONVENTIONS: (Convenções)
+ *     - As funções sempre têm uma descrição @brief, @param e @return no aquivo .cpp
+ *     - Um manifesto (JSON) descreve os trabalhos. Um campo de configuração com uma lista de valores
+ *       gera um trabalho para cada combinação (varredura de parâmetros)
+ *     - Cada trabalho é renderizado por uma única thread, com a sua própria cena e framebuffers
+ *     - Um quadro cuja imagem já existe não é refeito, logo um lote interrompido pode ser retomado.
+ *       A imagem é escrita em um arquivo temporário e renomeada no final, então nunca fica pela metade
+ *
+ *   IDIOM: ENGLISH
+ *
+ *   mrx-batch v1.0 - Batch rendering: many scenes, settings and camera paths
+ *
+ *   CONVENTIONS:
+ *     - The functions always have a @brief, @param and @return description in the .cpp file
+ *     - A manifest (JSON) describes the jobs. A setting given as a list of values expands into one
+ *       job per combination (parameter sweep)
+ *     - Every job is rendered by a single thread that owns its scene and framebuffers
+ *     - Frames whose image already exists are not rendered again, so an interrupted batch can be
+ *       resumed. Images are written to a temporary file and renamed at the end, never left half-written
+ *
+ *   CONFIGURATION:
+ *       ...
+ *
+ *   DEPENDENCIES:
+ *      <models/scene.hpp>         - Required for: models::Scene
+ *      <utils/nlohmann/json.hpp>  - Required for: json
+ *      <string>                   - Required for: std::string
+ *      <vector>                   - Required for: std::vector
+ *
+ *   CONTRIBUTORS:
+ *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
+ *
+ *
+ *   LICENSE: GPL 3.0
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **********************************************************************************************/
+#pragma once
+
+#include <models/scene.hpp>
+#include <utils/nlohmann/json.hpp>
+
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace models
+{
+  //-------------------------------------------------------------------------------------------------
+  // Estruturas
+  //-------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Quadro-chave da trajetória da câmera
+   *
+   * @param position Posição da câmera
+   * @param target Alvo da câmera
+   * @param up Vetor up da câmera
+   * @param d Distância da câmera ao plano de projeção
+   */
+  typedef struct CameraKeyframe
+  {
+    core::Vector3 position;
+    core::Vector3 target;
+    core::Vector3 up;
+    float d;
+  } CameraKeyframe;
+
+  /**
+   * @brief Trabalho de renderização do lote
+   *
+   * @param scene Arquivo da cena
+   * @param output Imagem de saída, pode conter {frame}, {scene}, {pipeline}, {lighting}, {normal} e {centroid}
+   * @param keyframes Quadros-chave da câmera (formato de Camera3D::to_json, campos ausentes vêm da câmera da cena)
+   * @param frames Quantidade de quadros, distribuídos uniformemente ao longo dos quadros-chave
+   * @param pipeline_model Pipeline (-1 = o da cena)
+   * @param lighting_model Modelo de iluminação (-1 = o da cena)
+   * @param normal_algorithm Algoritmo do vetor normal (-1 = o da cena)
+   * @param centroid_algorithm Algoritmo do centroide (-1 = o da cena)
+   * @param precision Precisão da iluminação (-1 = a da cena)
+   * @param width Largura da imagem (0 = largura da viewport da cena)
+   * @param height Altura da imagem (0 = altura da viewport da cena)
+   * @param shadows Liga as sombras das luzes omni
+   */
+  typedef struct RenderJob
+  {
+    std::string scene;
+    std::string output;
+    json keyframes = json::array();
+    int frames = 1;
+    int pipeline_model = -1;
+    int lighting_model = -1;
+    int normal_algorithm = -1;
+    int centroid_algorithm = -1;
+    int precision = -1;
+    int width = 0;
+    int height = 0;
+    bool shadows = false;
+  } RenderJob;
+
+  //-------------------------------------------------------------------------------------------------
+  // Funções
+  //-------------------------------------------------------------------------------------------------
+
+  models::Scene *LoadScene(const std::string &file_path);
+  models::Scene *SceneFromJson(json scene_json);
+  bool ParseRenderSetting(const std::string &setting, const std::string &value, int &result);
+  void ApplyRenderJob(models::Scene *scene, const models::RenderJob &job);
+  bool LoadRenderJobs(const json &manifest, const std::string &base_directory, std::vector<models::RenderJob> &jobs);
+  models::CameraKeyframe ParseCameraKeyframe(const json &keyframe, const models::Camera3D &camera);
+  models::CameraKeyframe InterpolateCameraKeyframes(const std::vector<models::CameraKeyframe> &keyframes, float t);
+  std::string RenderJobOutput(const models::RenderJob &job, int frame);
+  int RunRenderJobs(const std::vector<models::RenderJob> &jobs, unsigned int threads, bool overwrite);
+} // namespace models
@@ -4,16 +4,28 @@
  *   mrxcamera v1.0 - Modelo básico de benchmark
  *
  *   CONVENÇÕES:
+ *     - Os tempos de quadro são guardados em milissegundos
+ *     - O caminho da câmera (aproximação, órbita e afastamento) avança um passo fixo por quadro,
+ *       logo a mesma cena sempre gera a mesma sequência de quadros
  *
  *   IDIOM: ENGLISH
  *
  *   mrxcamera v1.0 - Basic benchmark model
  *
  *   CONVENTIONS:
+ *     - Frame times are stored in milliseconds
+ *     - The camera path (dolly in, orbit, dolly out) advances a fixed step per frame, so the
+ *       same scene always produces the same sequence of frames
  *
  *   CONFIGURATION:
+ *       BENCHMARK_ORBIT_SPEED - Ângulo (radianos) percorrido por quadro na órbita
+ *       BENCHMARK_DOLLY_SPEED - Distância percorrida por quadro na aproximação e no afastamento
+ *       BENCHMARK_END_Z       - Coordenada z da câmera que encerra o caminho
+ *       BENCHMARK_MAX_FRAMES  - Limite de quadros do caminho
  *
  *   DEPENDENCIES:
+ *      <models/camera.hpp>   - Required for: models::Camera3D
+ *      <utils/profiler.hpp>  - Required for: utils::ProfileFrame
  *
  *   CONTRIBUTORS:
  *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
@@ -37,13 +49,33 @@
  **********************************************************************************************/
 #pragma once
 
+#include <models/camera.hpp>
+#include <utils/profiler.hpp>
+#include <utils/histogram.hpp>
+
 #include <vector>
+#include <string>
 #include <algorithm>
 #include <chrono>
 #include <iomanip> // Para formatar a timestamp
 
 namespace models
 {
+// Ângulo (radianos) percorrido por quadro na órbita
+#define BENCHMARK_ORBIT_SPEED 0.01667f
+// Distância percorrida por quadro na aproximação e no afastamento
+#define BENCHMARK_DOLLY_SPEED 1.0f
+// Coordenada z da câmera que encerra o caminho
+#define BENCHMARK_END_Z -192.0f
+// Limite de quadros do caminho, para cenas em que a câmera nunca alcança BENCHMARK_END_Z
+#define BENCHMARK_MAX_FRAMES 100000
+
+#define BENCHMARK_DOLLY 0
+#define BENCHMARK_ORBIT 1
+
+  // Percentis do tempo de quadro exibidos na interface e escritos nos relatórios
+  const double BENCHMARK_PERCENTILES[] = {50.0, 90.0, 99.0, 99.9};
+
   typedef struct Benchmark
   {
     /**
@@ -72,33 +104,86 @@ namespace models
      */
     double average_fps;
     /**
-     * @brief Vetor de tempos de execução de cada frame
+     * @brief Vetor de tempos de execução de cada frame (ms)
      *
+     * @note Vazio quando keep_frame_times é falso
      */
     std::vector<double> frame_times;
     /**
-     * @brief Menor tempo de execução de um frame
+     * @brief Se verdadeiro, guarda o tempo de cada frame em frame_times
+     *
+     * @note As estatísticas e os percentis não dependem de frame_times (ver frame_histogram)
+     */
+    bool keep_frame_times = true;
+    /**
+     * @brief Histograma dos tempos de execução dos frames (ms), usado nos percentis
+     *
+     */
+    utils::Histogram frame_histogram;
+    /**
+     * @brief Menor tempo de execução de um frame (ms)
      *
      */
     double min_frame_time;
     /**
-     * @brief Maior tempo de execução de um frame
+     * @brief Maior tempo de execução de um frame (ms)
      *
      */
     double max_frame_time;
     /**
-     * @brief Média de tempo de execução de um frame
+     * @brief Média de tempo de execução de um frame (ms)
      *
      */
     double average_frame_time;
     /**
-     * @brief Pior 10% dos tempos de execução
+     * @brief Pior 10% dos tempos de execução (ms)
      *
+     * @note Calculado em benchmark_end, a partir de frame_times
      */
     std::vector<double> worst_10_percentile;
+    /**
+     * @brief Tempo de cada estágio (geometria e rasterização) em cada frame (ms)
+     *
+     * @note Preenchido apenas quando os estágios são medidos separadamente (mrx-bench)
+     */
+    std::vector<double> geometry_times;
+    std::vector<double> rasterization_times;
+    /**
+     * @brief Tempos por estágio e contadores do pipeline em cada frame (ver utils/profiler.hpp)
+     *
+     * @note Vazio quando o projeto é compilado sem MRX_PROFILE
+     */
+    std::vector<utils::ProfileFrame> profiles;
   } Benchmark;
 
+  /**
+   * @brief Estado do caminho da câmera do benchmark
+   *
+   * @param movement Movimento corrente (BENCHMARK_DOLLY ou BENCHMARK_ORBIT)
+   * @param angle Ângulo acumulado na órbita
+   * @param frames Quantidade de passos dados
+   * @param finished Se verdadeiro, a câmera chegou ao fim do caminho
+   *
+   * @note A câmera se aproxima até a origem, dá uma volta completa em torno do alvo e então se
+   * afasta até BENCHMARK_END_Z
+   */
+  typedef struct BenchmarkCamera
+  {
+    int movement = BENCHMARK_DOLLY;
+    float angle = 0.0f;
+    int frames = 0;
+    bool finished = false;
+  } BenchmarkCamera;
+
   void benchmark_start(Benchmark *benchmark);
   void benchmark_end(Benchmark *benchmark);
+  void benchmark_update(Benchmark *benchmark, double frame_time);
+  double benchmark_percentile(const Benchmark *benchmark, double percentile);
+  std::string benchmark_percentile_name(double percentile);
+  void benchmark_camera_step(BenchmarkCamera *path, Camera3D *camera);
+  std::string benchmark_results_path(const std::string &directory, const std::string &pipeline, const std::string &shading, int repetition);
+  bool benchmark_write_report(const Benchmark *benchmark, const std::string &file_path, const std::string &pipeline, const std::string &shading, int repetition);
+  bool benchmark_write_json(const Benchmark *benchmark, const std::string &file_path, const std::string &pipeline, const std::string &shading, int repetition);
+  bool benchmark_write_csv(const Benchmark *benchmark, const std::string &file_path);
 
 } // namespace models
\ No newline at end of file
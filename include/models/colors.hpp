@@ -77,6 +77,21 @@ namespace models
 #define MIN_COLOR_VALUE 0
 #define MAX_COLOR_VALUE 255
 
+  /**
+   * @brief Cor RGBA em float (RGBA32F), usada internamente no sombreamento e na rasterização
+   *
+   * @note Os canais usam a mesma escala de models::Color (0 a 255), mas não são limitados nem
+   * arredondados durante o sombreamento. A conversão para RGBA8 acontece uma única vez, no final
+   * do quadro (ver PackColor e models::ResolveFrameBuffer)
+   */
+  typedef struct ColorFloat
+  {
+    float r = 0.0f;
+    float g = 0.0f;
+    float b = 0.0f;
+    float a = 0.0f;
+  } ColorFloat;
+
   // Cores básicas
 
   // Transparente = {0, 0, 0, 0}
@@ -175,4 +190,56 @@ namespace models
     return {static_cast<Uint8>(channels.r), static_cast<Uint8>(channels.g), static_cast<Uint8>(channels.b), 255};
   }
 
+  /**
+   * @brief Converte o valor models::Color para um valor models::ColorFloat
+   *
+   * @param color Cor
+   * @return ColorFloat Cor em float
+   */
+  constexpr ColorFloat ColorToFloat(const Color &color)
+  {
+    return {static_cast<float>(color.r), static_cast<float>(color.g), static_cast<float>(color.b), static_cast<float>(color.a)};
+  }
+
+  /**
+   * @brief Limita um canal em float ao intervalo [0, 255] e arredonda para o inteiro mais próximo
+   *
+   * @param value Valor do canal
+   * @return Uint8 Canal quantizado
+   *
+   * @note As comparações compilam para min/max, sem desvios, então o laço de ResolveFrameBuffer pode ser
+   * vetorizado pelo compilador
+   */
+  constexpr Uint8 QuantizeChannel(float value)
+  {
+    value = value < static_cast<float>(MIN_COLOR_VALUE) ? static_cast<float>(MIN_COLOR_VALUE) : value;
+    value = value > static_cast<float>(MAX_COLOR_VALUE) ? static_cast<float>(MAX_COLOR_VALUE) : value;
+
+    return static_cast<Uint8>(value + 0.5f);
+  }
+
+  /**
+   * @brief Converte o valor models::ColorFloat para um valor models::Color (RGBA8)
+   *
+   * @param color Cor em float
+   * @return Color Cor limitada, arredondada e empacotada
+   */
+  constexpr Color PackColor(const ColorFloat &color)
+  {
+    return {QuantizeChannel(color.r), QuantizeChannel(color.g), QuantizeChannel(color.b), QuantizeChannel(color.a)};
+  }
+
+  /**
+   * @brief Compara duas cores em float
+   *
+   * @param color1 Cor 1
+   * @param color2 Cor 2
+   * @return true - Se as cores forem iguais
+   * @return false - Se as cores forem diferentes
+   */
+  constexpr bool CompareColors(const ColorFloat &color1, const ColorFloat &color2)
+  {
+    return (color1.r == color2.r) && (color1.g == color2.g) && (color1.b == color2.b) && (color1.a == color2.a);
+  }
+
 } // namespace models
\ No newline at end of file
@@ -0,0 +1,238 @@
+/**********************************************************************************************
+ *   IDIOM: PORTUGUÊS
+ *
+ *   mrx-frame v1.0 - Buffers de um quadro (frame): geometria transformada e framebuffer
+ *
+ *   CONVENTIONS: (Convenções)
+ *     - As funções sempre têm uma descrição @brief, @param e @return no aquivo .cpp
+ *     - A geometria de um quadro é uma cópia autocontida do que a rasterização precisa
+ *       (polígonos em coordenadas de tela, materiais e luzes), logo a rasterização de um
+ *       quadro pode rodar em paralelo com a geometria do próximo
+ *     - Cada framebuffer guarda o estado com que foi rasterizado. Se apenas alguns objetos mudaram,
+ *       só o retângulo de tela que eles ocupavam e passaram a ocupar é refeito
+ *
+ *   IDIOM: ENGLISH
+ *
+ *   mrx-frame v1.0 - Per-frame buffers: transformed geometry and framebuffer
+ *
+ *   CONVENTIONS:
+ *     - The functions always have a @brief, @param and @return description in the .cpp file
+ *     - The frame geometry is a self-contained copy of everything rasterization needs
+ *       (screen-space polygons, materials and lights), so rasterizing one frame can run
+ *       concurrently with the geometry of the next one
+ *     - Every framebuffer remembers the state it was rasterized with. When only some objects
+ *       changed, only the screen rectangle they covered before and after is redrawn
+ *
+ *   CONFIGURATION:
+ *       FRAME_PARTIAL_MAX_AREA - Fração máxima da tela refeita parcialmente
+ *       RENDER_SCALE_FRAMES    - Quantidade de quadros usados na média do tempo de quadro
+ *       RENDER_SCALE_STEP      - Passo da escala da resolução interna
+ *       RENDER_SCALE_TOLERANCE - Desvio tolerado do tempo de quadro alvo antes de mudar a escala
+ *       OVERDRAW_HEATMAP_MAX   - Testes de profundidade por pixel exibidos com a cor mais quente
+ *
+ *   DEPENDENCIES:
+ *      <models/colors.hpp> - Required for: models::Color
+ *      <models/light.hpp>  - Required for: models::Light, models::Omni
+ *      <math/pipeline.hpp> - Required for: math::DepthComplexityBuffer
+ *      <vector>            - Required for: std::vector
+ *      <cstdint>           - Required for: std::uint64_t
+ *
+ *   CONTRIBUTORS:
+ *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
+ *
+ *
+ *   LICENSE: GPL 3.0
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **********************************************************************************************/
+#pragma once
+
+#include <models/common.hpp>
+#include <models/colors.hpp>
+#include <models/light.hpp>
+#include <math/pipeline.hpp>
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace models
+{
+  //-------------------------------------------------------------------------------------------------
+  // Estruturas
+  //-------------------------------------------------------------------------------------------------
+
+#define FRAME_POLYGON 0
+#define FRAME_BOUNDING_BOX 1
+
+// Fração máxima da tela refeita parcialmente, acima dela o quadro é refeito por completo
+#define FRAME_PARTIAL_MAX_AREA 0.5f
+
+// Quantidade de quadros usados na média do tempo de quadro da resolução dinâmica
+#define RENDER_SCALE_FRAMES 8
+// Passo da escala da resolução interna (evita refazer o quadro por variações pequenas)
+#define RENDER_SCALE_STEP 0.05f
+// Desvio relativo tolerado do tempo de quadro alvo antes de mudar a escala
+#define RENDER_SCALE_TOLERANCE 0.1f
+
+// Testes de profundidade por pixel exibidos com a cor mais quente do mapa de overdraw
+#define OVERDRAW_HEATMAP_MAX 8
+
+  /**
+   * @brief Objeto de um quadro, usado para descobrir quais objetos mudaram entre dois quadros
+   *
+   * @param id Identificador do objeto (endereço da malha)
+   * @param version Versão da malha (ver Mesh::touch)
+   * @param selected Se verdadeiro, o objeto está selecionado (caixa envolvente)
+   * @param bounds Retângulo de tela ocupado pelo objeto (min x, min y, max x, max y), vazio se max x < min x
+   */
+  typedef struct FrameObject
+  {
+    const void *id = nullptr;
+    unsigned long version = 0;
+    bool selected = false;
+    core::Vector4 bounds = {0.0f, 0.0f, -1.0f, -1.0f};
+  } FrameObject;
+
+  /**
+   * @brief Buffers de profundidade e de cores de um quadro
+   *
+   * @param width Largura do buffer (pixels)
+   * @param height Altura do buffer (pixels)
+   * @param z_buffer Buffer de profundidade, indexado por [x][y]
+   * @param shading_buffer Cores em float (RGBA32F) escritas pela rasterização, indexado por [x][y]
+   * @param color_buffer Cores em RGBA8 exibidas pela interface, indexado por [x][y] (ver ResolveFrameBuffer)
+   * @param state Estado da cena com que o buffer foi rasterizado (ver FrameGeometry::state)
+   * @param omni_lights Luzes com que o buffer foi rasterizado, mantêm os mapas de sombra usados
+   * @param materials Materiais com que o buffer foi rasterizado
+   * @param objects Objetos com que o buffer foi rasterizado, com o retângulo de tela de cada um
+   * @param dirty Retângulo refeito na última rasterização (min x, min y, max x, max y), vazio se nada mudou
+   * @param depth_complexity Testes de profundidade de cada pixel, indexado por [x][y] (vazio fora do mapa de overdraw)
+   * @param overdraw_ratio Fragmentos escritos por pixel coberto (1 = nenhum pixel escrito mais de uma vez)
+   * @param depth_complexity_ratio Testes de profundidade por pixel coberto
+   */
+  typedef struct FrameBuffer
+  {
+    int width = 0;
+    int height = 0;
+    std::vector<std::vector<float>> z_buffer;
+    std::vector<std::vector<models::ColorFloat>> shading_buffer;
+    std::vector<std::vector<models::Color>> color_buffer;
+    std::vector<std::uint64_t> state;
+    std::vector<models::Omni> omni_lights;
+    std::vector<models::Material> materials;
+    std::vector<FrameObject> objects;
+    core::Vector4 dirty = {0.0f, 0.0f, -1.0f, -1.0f};
+    math::DepthComplexityBuffer depth_complexity;
+    float overdraw_ratio = 0.0f;
+    float depth_complexity_ratio = 0.0f;
+  } FrameBuffer;
+
+  /**
+   * @brief Primitiva já transformada para coordenadas de tela
+   *
+   * @param type FRAME_POLYGON ou FRAME_BOUNDING_BOX
+   * @param first Índice do primeiro vértice em FrameGeometry::vertexes
+   * @param count Quantidade de vértices da primitiva
+   * @param centroid Centroide do objeto (Phong Shading)
+   * @param color Cor da face (Flat Shading), já iluminada no estágio de geometria
+   * @param material Índice do material em FrameGeometry::materials
+   */
+  typedef struct FramePolygon
+  {
+    int type = FRAME_POLYGON;
+    size_t first = 0;
+    size_t count = 0;
+    core::Vector3 centroid = {0.0f, 0.0f, 0.0f};
+    models::ColorFloat color;
+    int material = 0;
+  } FramePolygon;
+
+  /**
+   * @brief Geometria transformada de um quadro, pronta para a rasterização
+   *
+   * @param state Estado da cena comum a todos os objetos: câmera, luzes e configurações (ver Scene::renderState)
+   * @param lighting_model Modelo de iluminação do quadro
+   * @param precision Precisão da iluminação do quadro (EXACT_PRECISION ou FAST_PRECISION)
+   * @param width Largura do framebuffer
+   * @param height Altura do framebuffer
+   * @param eye Posição do observador
+   * @param global_light Cópia da luz global
+   * @param omni_lights Cópia das luzes omnidirecionais
+   * @param light_tiles Listas das luzes omnidirecionais que alcançam cada bloco da tela
+   * @param materials Materiais dos objetos do quadro
+   * @param objects Objetos do quadro, indexados como os materiais
+   * @param polygons Primitivas na ordem em que devem ser rasterizadas
+   * @param vertexes Vértices (coordenadas de tela) de todas as primitivas
+   * @param attributes Atributo de cada vértice: normal (Phong) ou cor em float (Gouraud), vazio no Flat Shading
+   * @param positions Posição (SRU) de cada vértice no Phong Shading, usada na atenuação e nas sombras por pixel
+   * @param overdraw Se verdadeiro, o quadro é exibido como mapa de overdraw (ver OverdrawHeatmap)
+   */
+  typedef struct FrameGeometry
+  {
+    std::vector<std::uint64_t> state;
+    int lighting_model = FLAT_SHADING;
+    int precision = EXACT_PRECISION;
+    bool overdraw = false;
+    int width = 0;
+    int height = 0;
+    core::Vector3 eye = {0.0f, 0.0f, 0.0f};
+    models::Light global_light;
+    std::vector<models::Omni> omni_lights;
+    models::LightTiles light_tiles;
+    std::vector<models::Material> materials;
+    std::vector<FrameObject> objects;
+    std::vector<FramePolygon> polygons;
+    std::vector<core::Vector3> vertexes;
+    std::vector<core::Vector3> attributes;
+    std::vector<core::Vector3> positions;
+  } FrameGeometry;
+
+  /**
+   * @brief Controle da resolução dinâmica: escolhe a resolução interna do framebuffer a partir do
+   * tempo dos últimos quadros
+   *
+   * @param enabled Se falso, a escala é sempre 1 (resolução da viewport)
+   * @param target_fps Quadros por segundo desejados
+   * @param min_scale Menor escala permitida
+   * @param scale Escala atual da resolução interna (0, 1]
+   * @param frame_times Tempo (ms) dos últimos quadros rasterizados com a escala atual
+   */
+  typedef struct RenderScale
+  {
+    bool enabled = false;
+    float target_fps = 30.0f;
+    float min_scale = 0.5f;
+    float scale = 1.0f;
+    std::vector<float> frame_times;
+  } RenderScale;
+
+  //-------------------------------------------------------------------------------------------------
+  // Funções
+  //-------------------------------------------------------------------------------------------------
+
+  void ClearFrameBuffer(models::FrameBuffer &frame_buffer, int width, int height);
+  void ClearFrameBuffer(models::FrameBuffer &frame_buffer, const core::Vector4 &rectangle);
+  void ClearFrameGeometry(models::FrameGeometry &frame);
+  void AppendFrameGeometry(models::FrameGeometry &frame, const models::FrameGeometry &part);
+  void RasterizeFrame(const models::FrameGeometry &frame, models::FrameBuffer &frame_buffer);
+  core::Vector4 FrameDirtyRectangle(const models::FrameGeometry &frame, const models::FrameBuffer &frame_buffer, const std::vector<core::Vector4> &bounds, bool &partial);
+  void ResolveFrameBuffer(models::FrameBuffer &frame_buffer);
+  void ResolveFrameBuffer(models::FrameBuffer &frame_buffer, const core::Vector4 &rectangle);
+  void UpscaleFrameBuffer(const models::FrameBuffer &source, models::FrameBuffer &destination, int width, int height, float scale);
+  models::ColorFloat OverdrawHeatmapColor(unsigned int tests);
+  void OverdrawHeatmap(models::FrameBuffer &frame_buffer, const core::Vector4 &rectangle);
+  float UpdateRenderScale(models::RenderScale &render_scale, float frame_time);
+} // namespace models
@@ -0,0 +1,92 @@
+/**********************************************************************************************
+ *   IDIOM: PORTUGUÊS
+ *
+ *   mrx-golden v1.0 - Cenas de referência para os testes de regressão por imagem
+ *
+ *   CONVENTIONS: (Convenções)
+ *     - As funções sempre têm uma descrição @brief, @param e @return no aquivo .cpp
+ *     - A cena de referência é montada apenas com shapes::* e uma câmera fixa, e renderizada em um
+ *       único quadro, sem janela, para cada combinação de pipeline e modelo de iluminação
+ *     - As imagens de referência (PPM) ficam em MRX_GOLDEN_DIRECTORY e só são refeitas de propósito,
+ *       com o mrx-golden, quando uma mudança na imagem é esperada
+ *
+ *   IDIOM: ENGLISH
+ *
+ *   mrx-golden v1.0 - Reference scenes for the golden-image regression tests
+ *
+ *   CONVENTIONS:
+ *     - The functions always have a @brief, @param and @return description in the .cpp file
+ *     - The reference scene is built only from shapes::* and a fixed camera, and is rendered as a
+ *       single headless frame for every pipeline and lighting model combination
+ *     - The reference images (PPM) live in MRX_GOLDEN_DIRECTORY and are only regenerated on
+ *       purpose, with mrx-golden, when a change in the image is expected
+ *
+ *   CONFIGURATION:
+ *       MRX_GOLDEN_DIRECTORY     - Diretório das imagens de referência (definido pelo xmake)
+ *       GOLDEN_CHANNEL_TOLERANCE - Diferença por canal abaixo da qual o pixel é igual à referência
+ *       GOLDEN_MISMATCH_PERCENT  - Porcentagem máxima de pixels diferentes da referência
+ *
+ *   DEPENDENCIES:
+ *      <models/scene.hpp> - Required for: models::Scene
+ *      <string>           - Required for: std::string
+ *      <vector>           - Required for: std::vector
+ *
+ *   CONTRIBUTORS:
+ *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
+ *
+ *
+ *   LICENSE: GPL 3.0
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **********************************************************************************************/
+#pragma once
+
+#include <models/scene.hpp>
+
+#include <string>
+#include <vector>
+
+namespace models
+{
+// Diretório das imagens de referência (o xmake define o caminho absoluto em tests/golden)
+#ifndef MRX_GOLDEN_DIRECTORY
+#define MRX_GOLDEN_DIRECTORY "tests/golden"
+#endif
+
+// Resolução das imagens de referência
+#define GOLDEN_WIDTH 160
+#define GOLDEN_HEIGHT 120
+// Diferença por canal abaixo da qual um pixel é considerado igual à referência (arredondamentos)
+#define GOLDEN_CHANNEL_TOLERANCE 8
+// Porcentagem máxima de pixels acima da tolerância (bordas que mudam de pixel entre compiladores)
+#define GOLDEN_MISMATCH_PERCENT 0.5
+
+  /**
+   * @brief Combinação renderizada na regressão por imagem
+   *
+   * @param pipeline Nome do pipeline (adair ou smith)
+   * @param lighting Nome do modelo de iluminação (flat, gouraud ou phong)
+   */
+  typedef struct GoldenCase
+  {
+    std::string pipeline;
+    std::string lighting;
+  } GoldenCase;
+
+  std::vector<models::GoldenCase> GoldenCases();
+  models::Scene *GoldenScene(const models::GoldenCase &golden_case);
+  std::vector<std::vector<models::Color>> RenderGolden(const models::GoldenCase &golden_case);
+  std::string GoldenReferencePath(const std::string &directory, const models::GoldenCase &golden_case);
+} // namespace models
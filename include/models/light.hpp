@@ -5,13 +5,23 @@
  *
  *   CONVENTIONS: (Convenções)
  *     - As funções sempre têm uma descrição @brief, @param e @return no aquivo .cpp
+ *     - As funções de iluminação são templates da política de precisão (math::Exact, o padrão, ou
+ *       math::Fast), instanciados para as duas no .cpp
+ *     - PhongIlluminationLights e OmniAttenuation são definidas no cabeçalho, para que os kernels de
+ *       rasterização as expandam no laço de pixels, na variante já escolhida (ver math/dispatch.hpp)
+ *     - OmniVisibility é definida em models/shadow.hpp, incluído no fim deste cabeçalho
  *
  *   IDIOM: ENGLISH
  *
  *   mrx-light v1.0 - Lighting structures and lighting manipulation functions
  *
  *   CONVENTIONS:
-
+ *     - The lighting functions are templates over the precision policy (math::Exact, the default,
+ *       or math::Fast), instantiated for both in the .cpp file
+ *     - PhongIlluminationLights and OmniAttenuation are defined in the header, so the rasterization
+ *       kernels expand them in the pixel loop, in the variant already chosen (see math/dispatch.hpp)
+ *     - OmniVisibility is defined in models/shadow.hpp, included at the end of this header
+ *
  *   CONFIGURATION:
  *       ...
  *
@@ -43,10 +53,12 @@
 
 #include <models/colors.hpp>
 #include <math/math.hpp>
+#include <math/dispatch.hpp>
 
 #include <vector>
 #include <tuple>
 #include <string>
+#include <memory>
 
 namespace models
 {
@@ -54,11 +66,16 @@ namespace models
   // Estruturas
   //-------------------------------------------------------------------------------------------------
 
+  // Mapa de sombra de uma luz omni (ver models/shadow.hpp)
+  struct ShadowCubeMap;
+
   /**
    * @brief Lampada Omnidirecional
    *
    * @param position Posição da Luz
    * @param color Cor da Luz
+   * @param radius Raio de influência da luz (0 = sem atenuação)
+   * @param shadow_map Mapa de sombra da luz (nullptr = sem sombras)
 
    A cena pode ter um vetor de lampadas omni
    */
@@ -72,8 +89,31 @@ namespace models
     ColorChannels intensity;
     // Identificador da Luz
     std::string id;
+    // Raio de influência da luz, fora dele a luz não contribui (0 = alcance infinito)
+    float radius = 0.0f;
+    // Mapa de sombra usado na rasterização, definido apenas nas cópias das luzes de cada quadro
+    std::shared_ptr<const models::ShadowCubeMap> shadow_map;
   } Omni;
 
+// Tamanho (em pixels) dos blocos de tela usados na seleção de luzes
+#define LIGHT_TILE_SIZE 16
+
+  /**
+   * @brief Listas de luzes omni relevantes para cada bloco da tela
+   *
+   * @param tile_size Tamanho do bloco em pixels
+   * @param columns Quantidade de blocos na horizontal
+   * @param rows Quantidade de blocos na vertical
+   * @param lights Índices (em ordem crescente) das luzes que alcançam cada bloco, indexado por [linha * columns + coluna]
+   */
+  typedef struct LightTiles
+  {
+    int tile_size = LIGHT_TILE_SIZE;
+    int columns = 0;
+    int rows = 0;
+    std::vector<std::vector<unsigned int>> lights;
+  } LightTiles;
+
   /**
    * @brief Luz
    *
@@ -90,14 +130,208 @@ namespace models
 #define GOURAUD_SHADING 1
 #define PHONG_SHADING 2
 
+// Precisão das funções matemáticas da iluminação (ver math::Exact e math::Fast)
+#define EXACT_PRECISION 0
+#define FAST_PRECISION 1
+
+// Termos usados pela iluminação constante (Flat e Gouraud Shading), 0 = descartado
+// Obs.: Com o termo especular descartado, a iluminação constante não depende do observador
+#define FLAT_AMBIENT_TERM 0
+#define FLAT_SPECULAR_TERM 0
+
+  /**
+   * @brief Iluminação constante de uma malha (uma cor por face no Flat, por vértice no Gouraud)
+   *
+   * @param version Versão da malha (ver models::Mesh::getVersion)
+   * @param normal_algorithm Algoritmo dos vetores normais dos vértices
+   * @param precision Precisão usada no cálculo (EXACT_PRECISION ou FAST_PRECISION)
+   * @param global_light Cópia da luz global
+   * @param omni_lights Cópia das luzes omni, incluindo os mapas de sombra
+   * @param material Material da malha
+   * @param diffuse Termos que não dependem do observador (ambiente e difuso) de cada elemento
+   * @param view_valid Se verdadeiro, colors foi calculado para o observador em eye
+   * @param eye Posição do observador usada no termo especular
+   * @param colors Cor final (diffuse + especular) de cada elemento, indexada pela face ou por core::Vertex::getIndex
+   *
+   * @note diffuse só é recalculado quando a malha, as luzes ou o material mudam. Quando apenas a câmera
+   * se move, só o termo especular é refeito, e nem isso se o material não tem especular
+   */
+  typedef struct LightingCache
+  {
+    unsigned long version = 0;
+    int normal_algorithm = -1;
+    int precision = EXACT_PRECISION;
+    models::Light global_light;
+    std::vector<models::Omni> omni_lights;
+    models::Material material = {};
+    std::vector<core::Vector3> diffuse;
+    bool view_valid = false;
+    core::Vector3 eye = {0.0f, 0.0f, 0.0f};
+    std::vector<core::Vector3> colors;
+  } LightingCache;
+
   //-------------------------------------------------------------------------------------------------
   // Funções
   //-------------------------------------------------------------------------------------------------
 
   void LightOrbital(models::Omni *omni, float orbitalSpeed);
 
-  models::Color FlatShading(const models::Light &light, const std::vector<models::Omni> &omni, const core::Vector3 &centroid, const core::Vector3 &face_normal, const core::Vector3 &eye, const models::Material &material);
-  models::Color GouraudShading(const models::Light &light, const std::vector<models::Omni> &omni, const std::pair<core::Vector3, core::Vector3> &vertex, const core::Vector3 &eye, const models::Material &material);
-  models::Color PhongIllumination(const models::Light &light, const std::vector<models::Omni> &omni, const core::Vector3 &centroid, const core::Vector3 &pixel, const core::Vector3 &pixel_normal, const core::Vector3 &eye, const models::Material &material);
-  models::Color PhongShading(const models::Light &light, const std::vector<models::Omni> &omni, const core::Vector3 &centroid, const std::pair<core::Vector3, core::Vector3> &vertex, const core::Vector3 &eye, const models::Material &material);
-} // namespace models
\ No newline at end of file
+  ISA_KERNEL float OmniVisibility(const models::Omni &omni, const core::Vector3 &point);
+  core::Vector4 OmniBoundingBox(const models::Omni &omni, const core::Matrix &transformation, const core::Matrix *viewport, int width, int height);
+  void BinOmniLights(models::LightTiles &tiles, const std::vector<core::Vector4> &bounds, int width, int height);
+  const std::vector<unsigned int> &GetTileLights(const models::LightTiles &tiles, float x, float y);
+  void GatherTileLights(const models::LightTiles &tiles, const core::Vector4 &box, std::vector<unsigned int> &result);
+  void GatherOmniLights(const std::vector<models::Omni> &omni, const core::Vector3 *positions, size_t count, std::vector<unsigned int> &result);
+
+  template <typename Precision = math::Exact>
+  models::ColorFloat FlatShading(const models::Light &light, const std::vector<models::Omni> &omni, const core::Vector3 &centroid, const core::Vector3 &face_normal, const core::Vector3 &eye, const models::Material &material);
+  template <typename Precision = math::Exact>
+  models::ColorFloat GouraudShading(const models::Light &light, const std::vector<models::Omni> &omni, const std::pair<core::Vector3, core::Vector3> &vertex, const core::Vector3 &eye, const models::Material &material);
+  bool FlatViewDependent(const models::Material &material);
+  template <typename Precision = math::Exact>
+  void FlatDiffuseColors(const models::Light &light, const std::vector<models::Omni> &omni, const std::vector<unsigned int> &lights, const core::Vector3 *positions, const core::Vector3 *normals, size_t count, const models::Material &material, core::Vector3 *diffuse);
+  template <typename Precision = math::Exact>
+  void FlatSpecularColors(const std::vector<models::Omni> &omni, const std::vector<unsigned int> &lights, const core::Vector3 *positions, const core::Vector3 *normals, size_t count, const core::Vector3 &eye, const models::Material &material, const core::Vector3 *diffuse, core::Vector3 *colors);
+  bool LightingCacheMatches(const models::LightingCache &cache, unsigned long version, int normal_algorithm, const models::Light &light, const std::vector<models::Omni> &omni, const models::Material &material, int precision = EXACT_PRECISION);
+  bool LightingCacheViewMatches(const models::LightingCache &cache, const core::Vector3 &eye);
+  void BeginLightingCache(models::LightingCache &cache, unsigned long version, int normal_algorithm, const models::Light &light, const std::vector<models::Omni> &omni, const models::Material &material, size_t count, int precision = EXACT_PRECISION);
+  void BeginLightingCacheView(models::LightingCache &cache, const core::Vector3 &eye);
+  template <typename Precision = math::Exact>
+  models::ColorFloat PhongIllumination(const models::Light &light, const std::vector<models::Omni> &omni, const core::Vector3 &centroid, const core::Vector3 &pixel, const core::Vector3 &pixel_normal, const core::Vector3 &eye, const models::Material &material);
+  template <typename Precision = math::Exact>
+  models::ColorFloat PhongIllumination(const models::Light &light, const std::vector<models::Omni> &omni, const std::vector<unsigned int> &lights, const core::Vector3 &centroid, const core::Vector3 &pixel, const core::Vector3 &pixel_normal, const core::Vector3 &eye, const models::Material &material);
+  template <typename Precision = math::Exact>
+  models::ColorFloat PhongShading(const models::Light &light, const std::vector<models::Omni> &omni, const core::Vector3 &centroid, const std::pair<core::Vector3, core::Vector3> &vertex, const core::Vector3 &eye, const models::Material &material);
+  template <typename Precision = math::Exact>
+  models::ColorFloat PhongShading(const models::Light &light, const std::vector<models::Omni> &omni, const std::vector<unsigned int> &lights, const core::Vector3 &centroid, const std::pair<core::Vector3, core::Vector3> &vertex, const core::Vector3 &eye, const models::Material &material);
+
+  //-------------------------------------------------------------------------------------------------
+  // Funções expandidas nos kernels (definidas no cabeçalho)
+  //-------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Calcula a atenuação de uma luz omni em um ponto
+   *
+   * @param omni Luz omnidirecional
+   * @param point Ponto iluminado
+   *
+   * @return float Fator de atenuação entre 0 (fora do raio) e 1
+   *
+   * @note Usa a queda suave (1 - (d / r)²)², que chega a zero exatamente no raio da luz
+   * @note Luzes com raio 0 não são atenuadas
+   */
+  inline float OmniAttenuation(const models::Omni &omni, const core::Vector3 &point)
+  {
+    if (omni.radius <= 0.0f)
+      return 1.0f;
+
+    float distance = math::Vector3Distance(omni.position, point);
+
+    if (distance >= omni.radius)
+      return 0.0f;
+
+    float ratio = distance / omni.radius;
+    float result = 1.0f - ratio * ratio;
+
+    return result * result;
+  }
+
+  /**
+   * @brief Calcula a iluminação de Phong com uma lista opcional de luzes
+   *
+   * @tparam Precision Política de precisão (math::Exact ou math::Fast)
+   * @param light Luz ambiente da cena
+   * @param omni Vetor de Lampadas omnidirecionais
+   * @param lights Índices das luzes consideradas (nullptr = todas)
+   * @param centroid Centroide da face
+   * @param pixel Posição do pixel no SRU (usada na atenuação e na sombra)
+   * @param pixel_normal Normal do pixel
+   * @param eye Posição do observador (câmera)
+   * @param material Material do objeto
+   *
+   * @return models::ColorFloat Cor do pixel
+   *
+   * @note Definida no cabeçalho e expandida em cada variante do conjunto de instruções (ver ISA_KERNEL),
+   * inclusive dentro do laço de pixels de math::fill_polygon_phong
+   */
+  template <typename Precision>
+  ISA_KERNEL models::ColorFloat PhongIlluminationLights(const models::Light &light, const std::vector<models::Omni> &omni, const std::vector<unsigned int> *lights, const core::Vector3 &centroid, const core::Vector3 &pixel, const core::Vector3 &pixel_normal, const core::Vector3 &eye, const models::Material &material)
+  {
+    // As contribuições são acumuladas em float, sem limitar ou arredondar (ver models::ResolveFrameBuffer)
+    models::ColorFloat ambient_illumination;
+    models::ColorFloat diffuse_illumination;
+    models::ColorFloat specular_illumination;
+
+    core::Vector3 pixel_normal_normalized = Precision::Normalize(pixel_normal);
+
+    // Passo 1: Calcular a iluminação ambiente
+    ambient_illumination.r = light.intensity.r * material.ambient.r;
+    ambient_illumination.g = light.intensity.g * material.ambient.g;
+    ambient_illumination.b = light.intensity.b * material.ambient.b;
+
+    // pre computar o vetor S (direção do observador) já que ele é constante
+    core::Vector3 S = Precision::Normalize(math::Vector3Subtract(eye, centroid));
+
+    size_t count = lights != nullptr ? lights->size() : omni.size();
+
+    // Para cada fonte de luz na cena
+    for (size_t i = 0; i < count; i++)
+    {
+      const models::Omni &lamp = omni[lights != nullptr ? (*lights)[i] : i];
+
+      // A atenuação e a sombra dependem da posição do pixel (SRU), a direção da luz usa o centroide
+      float attenuation = models::OmniAttenuation(lamp, pixel);
+
+      if (attenuation <= 0.0f)
+        continue;
+
+      attenuation *= models::OmniVisibility(lamp, pixel);
+
+      if (attenuation <= 0.0f)
+        continue;
+
+      // Passo 2: Calcular a iluminação difusa
+      // Vetor da luz (direção da luz)
+      core::Vector3 L = Precision::Normalize(math::Vector3Subtract(lamp.position, centroid));
+
+      float cos_theta = math::Vector3DotProduct(pixel_normal_normalized, L);
+
+      models::ColorChannels kd = material.diffuse;
+
+      if (cos_theta > 0)
+      {
+        diffuse_illumination.r += lamp.intensity.r * kd.r * cos_theta * attenuation;
+        diffuse_illumination.g += lamp.intensity.g * kd.g * cos_theta * attenuation;
+        diffuse_illumination.b += lamp.intensity.b * kd.b * cos_theta * attenuation;
+
+        // Passo 3: Calcular a iluminação especular
+        // Cosseno entre a normal e o vetor médio H = (L + S) / |L + S|, sem montar H
+        float cos_alpha = Precision::NormalizeDot(pixel_normal_normalized, math::Vector3Add(L, S));
+
+        models::ColorChannels ks = material.specular;
+        float n = material.shininess;
+
+        if (cos_alpha > 0)
+        {
+          float specular = Precision::Pow(cos_alpha, n);
+
+          specular_illumination.r += lamp.intensity.r * ks.r * specular * attenuation;
+          specular_illumination.g += lamp.intensity.g * ks.g * specular * attenuation;
+          specular_illumination.b += lamp.intensity.b * ks.b * specular * attenuation;
+        }
+      }
+    }
+
+    // Passo 4: Calcular a cor final
+    models::ColorFloat color = {
+        ambient_illumination.r + diffuse_illumination.r + specular_illumination.r,
+        ambient_illumination.g + diffuse_illumination.g + specular_illumination.g,
+        ambient_illumination.b + diffuse_illumination.b + specular_illumination.b,
+        static_cast<float>(MAX_COLOR_VALUE)};
+
+    return color;
+  }
+} // namespace models
+
+// Define OmniVisibility, expandida em PhongIlluminationLights
+#include <models/shadow.hpp>
\ No newline at end of file
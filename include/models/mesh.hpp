@@ -22,6 +22,7 @@
  *      <core/vertex.hpp> - Required for: class Vertex
  *      <core/face.hpp> - Required for: class Face
  *      <core/halfedge.hpp> - Required for: class HalfEdge
+ *      <utils/thread_pool.hpp> - Required for: utils::ThreadPool (importação de OBJ)
  *      <vector>    - Required for: std::vector
  *      <string>    - Required for: std::string
  *      <stdexcept> - Required for: standard exceptions
@@ -53,6 +54,7 @@
 #include <stdexcept> // Include this for standard exceptions
 #include <limits>    // Include this for std::numeric_limits
 #include <map>       // Include this for std::map
+#include <atomic>    // Include this for std::atomic
 
 #include <models/common.hpp>
 
@@ -62,10 +64,14 @@
 #include <core/face.hpp>
 #include <core/halfedge.hpp>
 
+#include <utils/thread_pool.hpp>
+
 using json = nlohmann::json;
 
 namespace models
 {
+// Quantidade de faces (ou vértices) por bloco na criação paralela de uma malha importada
+#define MESH_BUILD_CHUNK_SIZE 4096
 
   class Mesh
   {
@@ -107,9 +113,27 @@ namespace models
     /**
      * @brief Mapa de vértices da malha
      *
-     * @note Usado apenas na criação da malha
+     * @note Usado apenas por addEdge e findEdge (criação aresta por aresta). createMesh monta as
+     * meias arestas diretamente dos índices das faces
      */
     std::map<std::string, core::HalfEdge *> half_edges_map;
+    /**
+     * @brief Versão da geometria da malha
+     *
+     * @note Muda sempre que os vértices são alterados (ver touch), é usada para invalidar caches
+     * @note As versões vêm de um contador global, então nenhuma malha repete a versão de outra
+     */
+    unsigned long version = 0;
+    /**
+     * @brief Esfera envolvente (x, y, z = centro, w = raio) e a versão em que foi calculada
+     */
+    core::Vector4 bounding_sphere = {0.0f, 0.0f, 0.0f, 0.0f};
+    unsigned long bounding_sphere_version = 0;
+
+    static std::atomic<unsigned long> next_version;
+
+    void buildHalfEdges(const std::vector<std::vector<int>> &index_faces, utils::ThreadPool *pool);
+    void initializeAttributes();
 
   public:
     // Atributos da malha
@@ -157,13 +181,15 @@ namespace models
     Mesh &operator=(const Mesh &mesh);
 
     // Getters and Setters
-    std::vector<core::Vertex *> getVertices() const;
-    std::vector<core::Face *> getFaces() const;
-    std::vector<core::HalfEdge *> getHalfEdges() const;
+    const std::vector<core::Vertex *> &getVertices() const;
+    const std::vector<core::Face *> &getFaces() const;
+    const std::vector<core::HalfEdge *> &getHalfEdges() const;
     int getNumFaces() const;
     std::string getId() const;
     std::string getName() const;
     bool isSelected() const;
+    unsigned long getVersion() const;
+    core::Vector4 getBoundingSphere();
 
     void setVertices(const std::vector<core::Vertex *> vertices);
     void setFaces(const std::vector<core::Face *> faces);
@@ -176,15 +202,19 @@ namespace models
 
     // Functions
     void createMesh(std::vector<std::vector<int>> index_faces);
-    void createMesh(const std::string &filename);
+    bool createMesh(const std::string &filename, utils::ThreadPool &pool);
     void createMesh(const std::vector<core::Vertex> &vertices, std::vector<std::vector<int>> index_faces);
     core::Vector4 getBox(bool screen_coordinates);                // x = min_x, y = min_y, z = max_x, w = max_y
     std::vector<core::Vector3> getBox3D(bool screen_coordinates); // v[0] = min, v[1] = max
     void determineNormals();
+    void determineNormals(size_t begin, size_t end);
     void determineNormalsByAverage();
+    void determineNormalsByAverage(size_t begin, size_t end);
     core::Vector3 getCentroidByMean();
     core::Vector3 getCentroidByWrapBox();
 
+    void touch();
+    void indexVertices();
     void clearMesh();
     core::HalfEdge *addEdge(core::Vertex *vertex1, core::Vertex *vertex2);
     core::Face *addFaceByHalfEdges(std::vector<core::HalfEdge *> half_edges);
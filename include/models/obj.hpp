@@ -0,0 +1,102 @@
+/**********************************************************************************************
+ *   IDIOM: PORTUGUÊS
+ *
+ *   mrx-obj v1.0 - Leitura de arquivos Wavefront OBJ
+ *
+ *   CONVENTIONS: (Convenções)
+ *     - As funções sempre têm uma descrição @brief, @param e @return no aquivo .cpp
+ *     - O arquivo é mapeado na memória e dividido em blocos que terminam em fim de linha. Os blocos
+ *       são analisados em paralelo (std::from_chars) e depois juntados na ordem do arquivo, então o
+ *       resultado não depende da quantidade de threads
+ *     - São lidos os vértices (v, com w opcional), as normais (vn) e as faces (f) com qualquer
+ *       quantidade de vértices, nas formas v, v/vt, v//vn e v/vt/vn, com índices positivos ou
+ *       negativos (relativos ao fim da lista). As demais instruções (vt, o, g, s, usemtl, ...) são
+ *       ignoradas
+ *     - Os índices de ObjData começam em 0 e já foram resolvidos e validados
+ *
+ *   IDIOM: ENGLISH
+ *
+ *   mrx-obj v1.0 - Wavefront OBJ reader
+ *
+ *   CONVENTIONS:
+ *     - The functions always have a @brief, @param and @return description in the .cpp file
+ *     - The file is memory-mapped and split into chunks that end at a line break. The chunks are
+ *       parsed in parallel (std::from_chars) and then joined in file order, so the result does not
+ *       depend on the number of threads
+ *     - Vertices (v, with optional w), normals (vn) and faces (f) with any number of vertices are
+ *       read, in the v, v/vt, v//vn and v/vt/vn forms, with positive or negative (relative to the end
+ *       of the list) indices. Every other statement (vt, o, g, s, usemtl, ...) is ignored
+ *     - The indices in ObjData start at 0 and are already resolved and validated
+ *
+ *   CONFIGURATION:
+ *       OBJ_CHUNK_SIZE - Tamanho aproximado (bytes) dos blocos analisados em paralelo
+ *
+ *   DEPENDENCIES:
+ *      <core/vector.hpp>        - Required for: core::Vector3, core::Vector4
+ *      <utils/thread_pool.hpp>  - Required for: utils::ThreadPool
+ *      <string>                 - Required for: std::string
+ *      <vector>                 - Required for: std::vector
+ *
+ *   CONTRIBUTORS:
+ *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
+ *
+ *
+ *   LICENSE: GPL 3.0
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **********************************************************************************************/
+#pragma once
+
+#include <core/vector.hpp>
+#include <utils/thread_pool.hpp>
+
+#include <string>
+#include <vector>
+
+namespace models
+{
+  //-------------------------------------------------------------------------------------------------
+  // Estruturas
+  //-------------------------------------------------------------------------------------------------
+
+// Tamanho aproximado dos blocos do arquivo analisados em paralelo (1 MiB)
+#define OBJ_CHUNK_SIZE (1 << 20)
+
+  /**
+   * @brief Conteúdo de um arquivo OBJ
+   *
+   * @param positions Posições dos vértices (v), na ordem do arquivo
+   * @param normals Normais (vn), na ordem do arquivo
+   * @param face_offsets Início de cada face em position_indices e normal_indices, com uma posição
+   * a mais no fim (a face i vai de face_offsets[i] a face_offsets[i + 1])
+   * @param position_indices Posição de cada vértice das faces
+   * @param normal_indices Normal de cada vértice das faces, -1 se o vértice não tem normal
+   */
+  typedef struct ObjData
+  {
+    std::vector<core::Vector4> positions;
+    std::vector<core::Vector3> normals;
+    std::vector<int> face_offsets;
+    std::vector<int> position_indices;
+    std::vector<int> normal_indices;
+  } ObjData;
+
+  //-------------------------------------------------------------------------------------------------
+  // Funções
+  //-------------------------------------------------------------------------------------------------
+
+  bool ParseObj(const char *data, size_t size, models::ObjData &result, utils::ThreadPool &pool, size_t chunk_size = OBJ_CHUNK_SIZE);
+  bool ReadObj(const std::string &file_path, models::ObjData &result, utils::ThreadPool &pool);
+} // namespace models
@@ -0,0 +1,181 @@
+/**********************************************************************************************
+ *   IDIOM: PORTUGUÊS
+ *
+ *   mrx-recorder v1.0 - Gravação e reprodução determinística da entrada da interface
+ *
+ *   CONVENTIONS: (Convenções)
+ *     - As funções sempre têm uma descrição @brief, @param e @return no aquivo .cpp
+ *     - A gravação guarda a cena inicial e, a cada quadro, apenas o que mudou: transformações do
+ *       objeto selecionado (no momento em que acontecem) e o estado absoluto da câmera, das luzes,
+ *       dos materiais, da seleção e das configurações do pipeline (comparado ao quadro anterior)
+ *     - Cada quadro termina com um marcador RECORD_FRAME com o instante (ms) desde o início da
+ *       gravação. A reprodução aplica um quadro gravado por quadro renderizado (travada no quadro,
+ *       não no relógio), então o resultado não depende da velocidade da máquina
+ *     - Inserir, remover ou carregar objetos não é gravado: a gravação precisa ser encerrada
+ *       (RecordFrame retorna falso quando a quantidade de objetos muda)
+ *
+ *   IDIOM: ENGLISH
+ *
+ *   mrx-recorder v1.0 - Deterministic record and replay of the interface input
+ *
+ *   CONVENTIONS:
+ *     - The functions always have a @brief, @param and @return description in the .cpp file
+ *     - A recording stores the initial scene and, every frame, only what changed: transformations
+ *       of the selected object (as they happen) and the absolute state of the camera, lights,
+ *       materials, selection and pipeline settings (diffed against the previous frame)
+ *     - Every frame ends with a RECORD_FRAME marker holding the time (ms) since the recording
+ *       started. Replay applies one recorded frame per rendered frame (frame-locked, not
+ *       clock-locked), so the result does not depend on the speed of the machine
+ *     - Inserting, removing or loading objects is not recorded: the recording has to stop
+ *       (RecordFrame returns false when the number of objects changes)
+ *
+ *   CONFIGURATION:
+ *       RECORDING_MAGIC   - Assinatura no início do arquivo
+ *       RECORDING_VERSION - Versão do formato do arquivo
+ *
+ *   DEPENDENCIES:
+ *      <models/scene.hpp>  - Required for: models::Scene
+ *      <chrono>            - Required for: std::chrono::steady_clock
+ *      <string>            - Required for: std::string
+ *      <vector>            - Required for: std::vector
+ *
+ *   CONTRIBUTORS:
+ *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
+ *
+ *
+ *   LICENSE: GPL 3.0
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **********************************************************************************************/
+#pragma once
+
+#include <models/scene.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace models
+{
+  //-------------------------------------------------------------------------------------------------
+  // Estruturas
+  //-------------------------------------------------------------------------------------------------
+
+// Assinatura no início do arquivo de gravação
+#define RECORDING_MAGIC "MRXR"
+// Versão do formato do arquivo de gravação
+#define RECORDING_VERSION 2
+// Maior quantidade de valores de um evento (câmera)
+#define RECORD_MAX_VALUES 12
+
+// Fim de um quadro: instante (ms) desde o início da gravação
+#define RECORD_FRAME 0
+// Câmera: posição, alvo, up, d, near e far
+#define RECORD_CAMERA 1
+// Objeto selecionado (índice, -1 = nenhum)
+#define RECORD_SELECT 2
+// Transformações do objeto do índice: deslocamento, ângulos, eixo e ângulo, escala
+#define RECORD_TRANSLATE 3
+#define RECORD_ROTATE 4
+#define RECORD_ROTATE_AXIS 5
+#define RECORD_SCALE 6
+// Luz global: intensidade RGBA
+#define RECORD_GLOBAL_LIGHT 7
+// Luz omni do índice: posição, intensidade e raio
+#define RECORD_OMNI_LIGHT 8
+// Material do objeto do índice: ambiente, difusa, especular e brilho
+#define RECORD_MATERIAL 9
+// Configurações: iluminação, pipeline, normal, centroide, recorte, sombras, overdraw, escala e precisão
+#define RECORD_SETTINGS 10
+
+#define RECORD_TYPES 11
+
+  /**
+   * @brief Evento gravado
+   *
+   * @param type Tipo do evento (RECORD_*)
+   * @param index Objeto ou luz do evento (no RECORD_FRAME, o número do quadro)
+   * @param values Valores do evento, apenas os RecordValues(type) primeiros são usados
+   */
+  typedef struct RecordEvent
+  {
+    int type = RECORD_FRAME;
+    int index = 0;
+    float values[RECORD_MAX_VALUES] = {};
+  } RecordEvent;
+
+  /**
+   * @brief Sessão gravada
+   *
+   * @param scene Cena no início da gravação (Scene::to_json), vazio se não foi guardada
+   * @param events Eventos em ordem, cada quadro termina com um RECORD_FRAME
+   * @param frames Quantidade de quadros gravados
+   */
+  typedef struct Recording
+  {
+    std::string scene;
+    std::vector<models::RecordEvent> events;
+    int frames = 0;
+  } Recording;
+
+  /**
+   * @brief Gravação em andamento
+   *
+   * @param active Se verdadeiro, os quadros e as transformações estão sendo gravados
+   * @param recording Sessão gravada até o momento
+   * @param state Estado absoluto da cena no último quadro gravado (ver RecordFrame)
+   * @param objects Quantidade de objetos da cena no início da gravação
+   * @param start Início da gravação
+   */
+  typedef struct Recorder
+  {
+    bool active = false;
+    models::Recording recording;
+    std::vector<models::RecordEvent> state;
+    size_t objects = 0;
+    std::chrono::steady_clock::time_point start;
+  } Recorder;
+
+  /**
+   * @brief Reprodução de uma sessão gravada
+   *
+   * @param recording Sessão reproduzida
+   * @param cursor Próximo evento aplicado
+   * @param frame Quantidade de quadros reproduzidos
+   * @param timestamp Instante (ms) gravado do último quadro reproduzido
+   */
+  typedef struct Replay
+  {
+    models::Recording recording;
+    size_t cursor = 0;
+    int frame = 0;
+    float timestamp = 0.0f;
+  } Replay;
+
+  //-------------------------------------------------------------------------------------------------
+  // Funções
+  //-------------------------------------------------------------------------------------------------
+
+  int RecordValues(int type);
+  void RecordStart(models::Recorder &recorder, models::Scene *scene);
+  void RecordStop(models::Recorder &recorder, models::Scene *scene);
+  bool RecordFrame(models::Recorder &recorder, models::Scene *scene);
+  void RecordTransform(models::Recorder &recorder, models::Scene *scene, int type, core::Vector3 values, float angle = 0.0f);
+  bool WriteRecording(const models::Recording &recording, const std::string &file_path);
+  bool ReadRecording(const std::string &file_path, models::Recording &recording);
+  void ReplayStart(models::Replay &replay, const models::Recording &recording);
+  bool ReplayFrame(models::Replay &replay, models::Scene *scene);
+  bool ReplayFinished(const models::Replay &replay);
+} // namespace models
@@ -46,15 +46,20 @@
 #include <limits>
 
 #include <vector>
+#include <cstdint>
 #include <iostream>
+#include <algorithm>
 
 #include <models/mesh.hpp>
 #include <models/camera.hpp>
 #include <math/pipeline.hpp>
 #include <models/colors.hpp>
 #include <models/light.hpp>
+#include <models/frame.hpp>
+#include <models/shadow.hpp>
 #include <utils/nlohmann/json.hpp>
 #include <utils/utils.hpp>
+#include <utils/thread_pool.hpp>
 
 using json = nlohmann::json;
 
@@ -69,6 +74,12 @@ namespace models
 #define CENTROID_BY_MEAN 0
 #define CENTROID_BY_WRAP_BOX 1
 
+// Quantidade de vértices/faces processados por bloco no estágio de geometria
+#define GEOMETRY_CHUNK_SIZE 2048
+
+  // Gravação da entrada (ver models/recorder.hpp)
+  typedef struct Recorder Recorder;
+
   class Scene
   {
   private:
@@ -108,16 +119,102 @@ namespace models
      * @brief Flag que indica se a cena foi processada
      */
     bool processed = false;
-
-  public:
     /**
-     * @brief Buffer de profundidade
+     * @brief Quantidade de threads usadas no estágio de geometria
+     *
+     * @note 0 - Quantidade de núcleos da máquina (Padrão)
+     */
+    unsigned int worker_threads = 0;
+    /**
+     * @brief Conjunto de threads do estágio de geometria
+     *
+     * @note Criado sob demanda na primeira rasterização
+     */
+    utils::ThreadPool *thread_pool = nullptr;
+    /**
+     * @brief Framebuffers da cena (frente e trás)
+     *
+     * @note A interface exibe o framebuffer da frente enquanto a rasterização escreve no de trás
+     */
+    models::FrameBuffer frame_buffers[2];
+    /**
+     * @brief Framebuffer exibido quando a resolução interna é menor que a da viewport
+     *
+     * @note Ampliado do framebuffer da frente com filtro bilinear (ver getDisplayBuffer)
+     */
+    models::FrameBuffer display_buffer;
+    /**
+     * @brief Flag que indica se o framebuffer exibido precisa ser ampliado novamente
+     */
+    bool display_outdated = true;
+    /**
+     * @brief Índice do framebuffer da frente
+     */
+    int front_buffer = 0;
+    /**
+     * @brief Geometria dos quadros, alternada a cada quadro para que a rasterização de um quadro
+     * possa rodar enquanto a geometria do próximo é montada
      */
-    std::vector<std::vector<float>> z_buffer;
+    models::FrameGeometry frame_geometry[2];
     /**
-     * @brief Buffer de cores
+     * @brief Índice da geometria do quadro corrente
+     */
+    int current_geometry = 0;
+    /**
+     * @brief Mapas de sombra das luzes omni, um por luz
+     *
+     * @note Um mapa só é refeito quando a luz ou um objeto dentro do seu raio muda. O mapa refeito é
+     * sempre um novo objeto, já que a rasterização do quadro anterior pode estar lendo o antigo
+     */
+    std::vector<std::shared_ptr<models::ShadowCubeMap>> shadow_maps;
+    /**
+     * @brief Iluminação constante de cada objeto, indexada como os objetos: cor de cada vértice
+     * (Gouraud Shading) e de cada face (Flat Shading)
+     *
+     * @note Cada elemento é iluminado no máximo uma vez por quadro. Os termos que não dependem do
+     * observador são mantidos entre os quadros enquanto a malha, as luzes e o material não mudam
      */
-    std::vector<std::vector<models::Color>> color_buffer;
+    std::vector<models::LightingCache> vertex_colors;
+    std::vector<models::LightingCache> face_colors;
+    /**
+     * @brief Estado da cena (câmera, luzes, objetos, materiais e configurações do pipeline) no
+     * último quadro processado
+     *
+     * @note Usado por hasChanged para evitar refazer um quadro idêntico ao anterior
+     */
+    std::vector<std::uint64_t> rendered_state;
+
+    /**
+     * @brief Bloco de trabalho da montagem da geometria do quadro
+     *
+     * @param object Objeto do bloco
+     * @param material Índice do material do objeto em FrameGeometry::materials
+     * @param bounding_box Se verdadeiro, o bloco emite apenas a caixa envolvente do objeto
+     * @param begin Primeira face do bloco
+     * @param end Face seguinte à última do bloco
+     * @param centroid Centroide do objeto
+     */
+    typedef struct FrameChunk
+    {
+      models::Mesh *object;
+      int material;
+      bool bounding_box;
+      size_t begin;
+      size_t end;
+      core::Vector3 centroid;
+    } FrameChunk;
+
+    utils::ThreadPool *getThreadPool();
+    void geometry_stage(const core::Matrix &transformation);
+    void normals_stage(bool face_normals = false);
+    void beginFrameGeometry(models::FrameGeometry &frame);
+    void binOmniLights(models::FrameGeometry &frame, const core::Matrix &transformation, const core::Matrix *viewport);
+    void updateShadowMaps();
+    void updateLightingCaches(const models::FrameGeometry &frame);
+    std::vector<FrameChunk> frameChunks(bool bounding_box);
+    void renderState(std::vector<std::uint64_t> &state, bool objects = true);
+
+  public:
     /**
      * @brief Luz global da cena
      *
@@ -142,6 +239,13 @@ namespace models
      * @note 2 - Phong Shading
      */
     int lighting_model = FLAT_SHADING;
+    /**
+     * @brief Flag que determina a precisão das funções matemáticas da iluminação
+     *
+     * @note 0 - Exata (Padrão)
+     * @note 1 - Rápida: aproximações com erro máximo documentado (ver math::Fast)
+     */
+    int precision = EXACT_PRECISION;
     /**
      * @brief Flag que determina qual modelo de pipeline será utilizado
      *
@@ -168,6 +272,31 @@ namespace models
      *
      */
     bool clipping = true;
+    /**
+     * @brief Flag que controla as sombras das luzes omni (mapas de sombra)
+     *
+     */
+    bool shadows = false;
+    /**
+     * @brief Flag que exibe o quadro como mapa de overdraw (testes de profundidade por pixel)
+     *
+     * @note As razões de overdraw do quadro ficam no framebuffer (ver models::OverdrawHeatmap)
+     */
+    bool overdraw = false;
+    /**
+     * @brief Escala da resolução interna do framebuffer em relação à viewport, no intervalo (0, 1]
+     *
+     * @note 1 - Resolução da viewport (Padrão)
+     * @note Abaixo de 1 a imagem é ampliada com filtro bilinear na exibição (ver getDisplayBuffer)
+     */
+    float render_scale = 1.0f;
+    /**
+     * @brief Gravação da entrada em andamento (ver models/recorder.hpp)
+     *
+     * @note Se não for nulo, as transformações do objeto selecionado são gravadas no momento em que
+     * acontecem
+     */
+    models::Recorder *recorder = nullptr;
 
     // Construtor and Destrutor
     Scene();
@@ -180,10 +309,17 @@ namespace models
     models::Mesh *getSelectedObject();
     core::Vector2 getMinViewport();
     core::Vector2 getMaxViewport();
+    core::Vector2 getRenderMinViewport();
+    core::Vector2 getRenderMaxViewport();
     core::Vector2 getMinWindow();
     core::Vector2 getMaxWindow();
     bool getReflection();
     bool getProcessed();
+    unsigned int getWorkerThreads();
+    models::FrameBuffer &getFrontBuffer();
+    models::FrameBuffer &getBackBuffer();
+    models::FrameBuffer &getDisplayBuffer();
+    std::shared_ptr<const models::ShadowCubeMap> getShadowMap(size_t index);
     void setCamera(models::Camera3D *camera);
     void setObjects(std::vector<models::Mesh *> objects);
     void setSelectedObject(models::Mesh *selected_object);
@@ -193,16 +329,25 @@ namespace models
     void setMaxWindow(core::Vector2 max_window);
     void setReflection(bool reflection);
     void setProcessed(bool processed);
+    void setWorkerThreads(unsigned int worker_threads);
 
     // Functions
     void addObject(models::Mesh *object);
     void removeObject(models::Mesh *object);
     void adair_pipeline();
     void smith_pipeline();
+    void pipeline();
+    void invalidate();
+    models::FrameGeometry &nextFrameGeometry();
+    void geometry(models::FrameGeometry &frame);
+    void adair_geometry(models::FrameGeometry &frame);
+    void smith_geometry(models::FrameGeometry &frame);
+    void rasterize(const models::FrameGeometry &frame);
+    void swapBuffers();
+    bool hasChanged();
     void selectObject(int x, int y);
     void deselectObject();
     void moveCamera(int x, int y);
-    void initializeBuffers();
     json to_json();
     void from_json(json json_data);
 
@@ -0,0 +1,214 @@
+/**********************************************************************************************
+ *   IDIOM: PORTUGUÊS
+ *
+ *   mrx-shadow v1.0 - Mapas de sombra (cube maps) das luzes omnidirecionais
+ *
+ *   CONVENTIONS: (Convenções)
+ *     - As funções sempre têm uma descrição @brief, @param e @return no aquivo .cpp
+ *     - Cada luz omni tem um cube map com 6 faces (+X, -X, +Y, -Y, +Z, -Z) preenchidas por uma
+ *       passagem apenas de profundidade do rasterizador
+ *     - O mapa guarda a chave com que foi gerado (posição e raio da luz, objetos e suas versões),
+ *       então só precisa ser refeito quando a luz ou um objeto dentro do seu raio muda
+ *     - A consulta do mapa (SampleShadowCubeMap, OmniVisibility) é definida no cabeçalho, para que
+ *       os kernels de rasterização a expandam no laço de pixels (ver models/light.hpp)
+ *
+ *   IDIOM: ENGLISH
+ *
+ *   mrx-shadow v1.0 - Shadow cube maps for omnidirectional lights
+ *
+ *   CONVENTIONS:
+ *     - The functions always have a @brief, @param and @return description in the .cpp file
+ *     - Every omni light owns a cube map with 6 faces (+X, -X, +Y, -Y, +Z, -Z) filled by a
+ *       depth-only pass of the rasterizer
+ *     - The map stores the key it was built with (light position and radius, casters and their
+ *       versions), so it is only rebuilt when the light or an object inside its radius changes
+ *     - The map lookup (SampleShadowCubeMap, OmniVisibility) is defined in the header, so the
+ *       rasterization kernels expand it in the pixel loop (see models/light.hpp)
+ *
+ *   CONFIGURATION:
+ *       SHADOW_MAP_SIZE - Resolução (texels) de cada face do cube map
+ *
+ *   DEPENDENCIES:
+ *      <models/light.hpp>   - Required for: models::Omni
+ *      <models/mesh.hpp>    - Required for: models::Mesh
+ *      <math/dispatch.hpp>  - Required for: ISA_KERNEL
+ *      <vector>             - Required for: std::vector
+ *
+ *   CONTRIBUTORS:
+ *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
+ *
+ *
+ *   LICENSE: GPL 3.0
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **********************************************************************************************/
+#pragma once
+
+#include <models/common.hpp>
+#include <models/light.hpp>
+#include <models/mesh.hpp>
+
+#include <math/dispatch.hpp>
+
+#include <vector>
+#include <utility>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace models
+{
+  //-------------------------------------------------------------------------------------------------
+  // Estruturas
+  //-------------------------------------------------------------------------------------------------
+
+// Resolução (texels) de cada face do cube map
+#define SHADOW_MAP_SIZE 256
+// Distância mínima até a luz para que um ponto projete sombra
+#define SHADOW_NEAR 0.01f
+// Tolerância relativa da comparação de profundidade (evita que a superfície sombreie a si mesma)
+#define SHADOW_BIAS 0.05f
+
+#define SHADOW_FACES 6
+
+  /**
+   * @brief Mapa de sombra (cube map) de uma luz omni
+   *
+   * @param position Posição da luz quando o mapa foi gerado
+   * @param radius Raio de influência da luz quando o mapa foi gerado
+   * @param size Resolução de cada face
+   * @param faces Profundidade de cada face (-1 / distância ao longo do eixo), indexada por [x][y]
+   * @param casters Objetos que projetam sombra e a versão de cada um quando o mapa foi gerado
+   */
+  typedef struct ShadowCubeMap
+  {
+    core::Vector3 position = {0.0f, 0.0f, 0.0f};
+    float radius = 0.0f;
+    int size = SHADOW_MAP_SIZE;
+    std::vector<std::vector<float>> faces[SHADOW_FACES];
+    std::vector<std::pair<const models::Mesh *, unsigned long>> casters;
+  } ShadowCubeMap;
+
+  //-------------------------------------------------------------------------------------------------
+  // Funções
+  //-------------------------------------------------------------------------------------------------
+
+  std::vector<models::Mesh *> ShadowCasters(const models::Omni &omni, const std::vector<models::Mesh *> &objects);
+  bool ShadowCubeMapMatches(const models::ShadowCubeMap &map, const models::Omni &omni, const std::vector<models::Mesh *> &casters);
+  void BeginShadowCubeMap(models::ShadowCubeMap &map, const models::Omni &omni, const std::vector<models::Mesh *> &casters, int size);
+  void RenderShadowCubeFace(models::ShadowCubeMap &map, int face, const std::vector<models::Mesh *> &casters);
+  void BuildShadowCubeMap(models::ShadowCubeMap &map, const models::Omni &omni, const std::vector<models::Mesh *> &casters, int size = SHADOW_MAP_SIZE);
+
+  //-------------------------------------------------------------------------------------------------
+  // Funções expandidas nos kernels (definidas no cabeçalho)
+  //-------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Converte um ponto relativo à luz para as coordenadas de uma face do cube map
+   *
+   * @param face Face do cube map (0: +X, 1: -X, 2: +Y, 3: -Y, 4: +Z, 5: -Z)
+   * @param point Ponto relativo à posição da luz
+   *
+   * @return core::Vector3 x, y = coordenadas no plano da face, z = distância ao longo do eixo da face
+   *
+   * @note A face enxerga os pontos com |x| <= z e |y| <= z (abertura de 90 graus)
+   */
+  ISA_KERNEL core::Vector3 CubeFaceCoordinates(int face, const core::Vector3 &point)
+  {
+    switch (face)
+    {
+    case 0:
+      return {-point.z, -point.y, point.x};
+    case 1:
+      return {point.z, -point.y, -point.x};
+    case 2:
+      return {point.x, point.z, point.y};
+    case 3:
+      return {point.x, -point.z, -point.y};
+    case 4:
+      return {point.x, -point.y, point.z};
+    default:
+      return {-point.x, -point.y, -point.z};
+    }
+  }
+
+  /**
+   * @brief Consulta o mapa de sombra em um ponto
+   *
+   * @param map Mapa de sombra
+   * @param point Ponto iluminado (coordenadas do SRU)
+   *
+   * @return float 0 se algum objeto está entre a luz e o ponto, 1 caso contrário
+   */
+  ISA_KERNEL float SampleShadowCubeMap(const models::ShadowCubeMap &map, const core::Vector3 &point)
+  {
+    core::Vector3 direction = math::Vector3Subtract(point, map.position);
+
+    float x = std::fabs(direction.x);
+    float y = std::fabs(direction.y);
+    float z = std::fabs(direction.z);
+
+    // A face é a do eixo dominante da direção
+    int face = 0;
+    if (x >= y && x >= z)
+      face = direction.x >= 0.0f ? 0 : 1;
+    else if (y >= z)
+      face = direction.y >= 0.0f ? 2 : 3;
+    else
+      face = direction.z >= 0.0f ? 4 : 5;
+
+    const std::vector<std::vector<float>> &depth = map.faces[face];
+
+    if (depth.empty())
+      return 1.0f;
+
+    core::Vector3 p = models::CubeFaceCoordinates(face, direction);
+
+    if (p.z <= SHADOW_NEAR)
+      return 1.0f;
+
+    float scale = 0.5f * static_cast<float>(map.size - 1);
+    int i = std::clamp(static_cast<int>(std::lround((p.x / p.z + 1.0f) * scale)), 0, map.size - 1);
+    int j = std::clamp(static_cast<int>(std::lround((p.y / p.z + 1.0f) * scale)), 0, map.size - 1);
+
+    float occluder = depth[i][j];
+
+    if (occluder == std::numeric_limits<float>::infinity())
+      return 1.0f;
+
+    // Converte de volta para a distância ao longo do eixo da face
+    occluder = -1.0f / occluder;
+
+    return p.z > occluder * (1.0f + SHADOW_BIAS) ? 0.0f : 1.0f;
+  }
+
+  /**
+   * @brief Calcula a visibilidade de um ponto a partir de uma luz omni
+   *
+   * @param omni Luz omnidirecional
+   * @param point Ponto iluminado (coordenadas do SRU)
+   *
+   * @return float 0 se o ponto está na sombra, 1 caso contrário
+   *
+   * @note Luzes sem mapa de sombra iluminam todos os pontos
+   */
+  ISA_KERNEL float OmniVisibility(const models::Omni &omni, const core::Vector3 &point)
+  {
+    if (omni.shadow_map == nullptr)
+      return 1.0f;
+
+    return models::SampleShadowCubeMap(*omni.shadow_map, point);
+  }
+} // namespace models
@@ -15,7 +15,8 @@
  *       ...
  *
  *   DEPENDENCIES:
- *
+ *      <string>  - Required for: std::string
+ *      <cstddef> - Required for: size_t
  *
  *   CONTRIBUTORS:
  *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
@@ -41,6 +42,8 @@
 
 #include <fstream>
 #include <iostream>
+#include <string>
+#include <cstddef>
 
 #include <utils/nlohmann/json.hpp>
 
@@ -48,7 +51,20 @@ using json = nlohmann::json;
 
 namespace utils
 {
+  /**
+   * @brief Arquivo mapeado na memória (somente leitura)
+   *
+   * @param data Conteúdo do arquivo, nullptr se o arquivo está vazio ou não foi mapeado
+   * @param size Tamanho do arquivo em bytes
+   */
+  typedef struct MappedFile
+  {
+    const char *data = nullptr;
+    size_t size = 0;
+  } MappedFile;
 
   json load_json(const std::string &file_path);
   void save_json(const std::string &file_path, const json &json_data);
+  bool map_file(const std::string &file_path, utils::MappedFile &file);
+  void unmap_file(utils::MappedFile &file);
 } // namespace utils
\ No newline at end of file
@@ -0,0 +1,86 @@
+/**********************************************************************************************
+ *   IDIOM: PORTUGUÊS
+ *
+ *   mrxhistogram v1.0 - Histograma com baldes logarítmicos (estilo HDR) para percentis em O(1)
+ *
+ *   CONVENTIONS: (Convenções)
+ *     - As funções sempre têm uma descrição @brief, @param e @return no aquivo .cpp
+ *     - Cada potência de 2 acima de HISTOGRAM_MIN_VALUE é dividida em HISTOGRAM_SUB_BUCKETS baldes
+ *       iguais, então o erro relativo de um percentil é no máximo 1 / HISTOGRAM_SUB_BUCKETS
+ *     - Adicionar um valor é O(1) e a memória é fixa, independente da quantidade de valores
+ *     - Os percentis são calculados sob demanda, percorrendo os baldes
+ *
+ *   IDIOM: ENGLISH
+ *
+ *   mrxhistogram v1.0 - Log-bucketed (HDR-style) histogram for O(1) percentiles
+ *
+ *   CONVENTIONS:
+ *     - The functions always have a @brief, @param and @return description in the .cpp file
+ *     - Every power of 2 above HISTOGRAM_MIN_VALUE is split into HISTOGRAM_SUB_BUCKETS equal
+ *       buckets, so the relative error of a percentile is at most 1 / HISTOGRAM_SUB_BUCKETS
+ *     - Adding a value is O(1) and memory is fixed, regardless of how many values are added
+ *     - Percentiles are computed on demand by walking the buckets
+ *
+ *   CONFIGURATION:
+ *       HISTOGRAM_MIN_VALUE   - Menor valor distinguido (valores menores caem no primeiro balde)
+ *       HISTOGRAM_SUB_BUCKETS - Baldes por potência de 2 (precisão)
+ *       HISTOGRAM_OCTAVES     - Potências de 2 cobertas acima de HISTOGRAM_MIN_VALUE (alcance)
+ *
+ *   DEPENDENCIES:
+ *      <vector>  - Required for: std::vector
+ *      <cstdint> - Required for: uint64_t
+ *
+ *   CONTRIBUTORS:
+ *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
+ *
+ *
+ *   LICENSE: GPL 3.0
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **********************************************************************************************/
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+namespace utils
+{
+// Menor valor distinguido pelo histograma (1 µs quando os valores estão em ms)
+#define HISTOGRAM_MIN_VALUE 0.001
+// Baldes por potência de 2 (erro relativo máximo de 1/128 < 0,8%)
+#define HISTOGRAM_SUB_BUCKETS 128
+// Potências de 2 cobertas acima de HISTOGRAM_MIN_VALUE (até ~18 minutos em ms)
+#define HISTOGRAM_OCTAVES 30
+
+  /**
+   * @brief Histograma com baldes logarítmicos
+   *
+   * @param counts Quantidade de valores em cada balde (vazio até o primeiro valor)
+   * @param total Quantidade de valores adicionados
+   * @param min Menor valor adicionado
+   * @param max Maior valor adicionado
+   */
+  typedef struct Histogram
+  {
+    std::vector<uint64_t> counts;
+    uint64_t total = 0;
+    double min = 0.0;
+    double max = 0.0;
+  } Histogram;
+
+  void HistogramReset(utils::Histogram &histogram);
+  void HistogramAdd(utils::Histogram &histogram, double value);
+  double HistogramPercentile(const utils::Histogram &histogram, double percentile);
+} // namespace utils
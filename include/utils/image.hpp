@@ -0,0 +1,80 @@
+/**********************************************************************************************
+ *   IDIOM: PORTUGUÊS
+ *
+ *   mrximage v1.0 - Escrita do buffer de cores de um quadro em arquivos de imagem (PPM e PNG)
+ *
+ *   CONVENTIONS: (Convenções)
+ *     - As funções sempre têm uma descrição @brief, @param e @return no aquivo .cpp
+ *     - O buffer de cores é indexado por [x][y], com y = 0 na linha de cima da imagem
+ *     - Não depende de bibliotecas externas: o PNG usa blocos deflate sem compressão
+ *     - O PPM também pode ser lido, e duas imagens comparadas com tolerância (imagens de referência)
+ *
+ *   IDIOM: ENGLISH
+ *
+ *   mrximage v1.0 - Writes the color buffer of a frame to image files (PPM and PNG)
+ *
+ *   CONVENTIONS:
+ *     - The functions always have a @brief, @param and @return description in the .cpp file
+ *     - The color buffer is indexed by [x][y], with y = 0 being the top row of the image
+ *     - No external dependencies: PNG files use stored (uncompressed) deflate blocks
+ *     - PPM files can also be read back, and two images compared with a tolerance (golden images)
+ *
+ *   CONFIGURATION:
+ *       ...
+ *
+ *   DEPENDENCIES:
+ *      <models/colors.hpp> - Required for: models::Color
+ *      <string>            - Required for: std::string
+ *      <vector>            - Required for: std::vector
+ *
+ *   CONTRIBUTORS:
+ *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
+ *
+ *
+ *   LICENSE: GPL 3.0
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **********************************************************************************************/
+#pragma once
+
+#include <models/colors.hpp>
+
+#include <string>
+#include <vector>
+
+namespace utils
+{
+  /**
+   * @brief Diferença entre duas imagens (apenas os canais RGB)
+   *
+   * @param same_size Se falso, as resoluções são diferentes e os demais campos não são calculados
+   * @param max_error Maior diferença de um canal em um pixel (0 a 255)
+   * @param mismatched Quantidade de pixels com algum canal acima da tolerância
+   * @param mismatch_percent Porcentagem dos pixels acima da tolerância
+   */
+  typedef struct ImageDifference
+  {
+    bool same_size = true;
+    int max_error = 0;
+    size_t mismatched = 0;
+    double mismatch_percent = 0.0;
+  } ImageDifference;
+
+  bool WritePPM(const std::string &file_path, const std::vector<std::vector<models::Color>> &color_buffer);
+  bool WritePNG(const std::string &file_path, const std::vector<std::vector<models::Color>> &color_buffer);
+  bool WriteImage(const std::string &file_path, const std::vector<std::vector<models::Color>> &color_buffer);
+  bool ReadPPM(const std::string &file_path, std::vector<std::vector<models::Color>> &color_buffer);
+  utils::ImageDifference CompareImages(const std::vector<std::vector<models::Color>> &image, const std::vector<std::vector<models::Color>> &reference, int tolerance);
+} // namespace utils
@@ -0,0 +1,133 @@
+/**********************************************************************************************
+ *   IDIOM: PORTUGUÊS
+ *
+ *   mrxprofiler v1.0 - Cronômetros por escopo e contadores dos estágios do pipeline
+ *
+ *   CONVENTIONS: (Convenções)
+ *     - As funções sempre têm uma descrição @brief, @param e @return no aquivo .cpp
+ *     - O código do pipeline usa apenas as macros MRX_PROFILE_SCOPE e MRX_PROFILE_COUNT, que não
+ *       geram código quando MRX_PROFILE não está definida
+ *     - Os tempos e contadores são acumulados em variáveis atômicas (somados entre as threads) e
+ *       zerados a cada quadro por ProfilerCollect
+ *     - Os cronômetros envolvem blocos de trabalho (blocos do parallel_for, um quadro inteiro),
+ *       nunca um pixel, para que o custo da medição não distorça o resultado
+ *
+ *   IDIOM: ENGLISH
+ *
+ *   mrxprofiler v1.0 - Scoped timers and counters for the pipeline stages
+ *
+ *   CONVENTIONS:
+ *     - The functions always have a @brief, @param and @return description in the .cpp file
+ *     - The pipeline code only uses the MRX_PROFILE_SCOPE and MRX_PROFILE_COUNT macros, which
+ *       expand to nothing when MRX_PROFILE is not defined
+ *     - Times and counters are accumulated in atomics (summed across threads) and reset every
+ *       frame by ProfilerCollect
+ *     - Timers wrap batches of work (parallel_for chunks, a whole frame), never a single pixel,
+ *       so the cost of measuring does not skew the result
+ *
+ *   CONFIGURATION:
+ *       MRX_PROFILE - Liga os cronômetros e contadores (opção "profile" do xmake, ligada por padrão)
+ *
+ *   DEPENDENCIES:
+ *      <chrono>  - Required for: std::chrono::steady_clock
+ *      <cstdint> - Required for: uint64_t
+ *
+ *   CONTRIBUTORS:
+ *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
+ *
+ *
+ *   LICENSE: GPL 3.0
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **********************************************************************************************/
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace utils
+{
+// Estágios do pipeline medidos
+#define PROFILE_TRANSFORM 0
+#define PROFILE_CULL 1
+#define PROFILE_CLIP 2
+#define PROFILE_LIGHTING 3
+#define PROFILE_RASTER 4
+#define PROFILE_DEPTH_TEST 5
+#define PROFILE_PRESENT 6
+#define PROFILE_STAGES 7
+
+// Contadores do pipeline
+#define PROFILE_FACES_SUBMITTED 0
+#define PROFILE_FACES_CULLED 1
+#define PROFILE_FACES_CLIPPED 2
+#define PROFILE_PIXELS_SHADED 3
+#define PROFILE_PIXELS_REJECTED 4
+#define PROFILE_COUNTERS 5
+
+  /**
+   * @brief Tempos e contadores acumulados em um quadro
+   *
+   * @param time Tempo (ns) de cada estágio, somado entre as threads
+   * @param calls Quantidade de medições (ou de itens, no teste de profundidade) de cada estágio
+   * @param counters Valor de cada contador
+   */
+  typedef struct ProfileFrame
+  {
+    uint64_t time[PROFILE_STAGES] = {};
+    uint64_t calls[PROFILE_STAGES] = {};
+    uint64_t counters[PROFILE_COUNTERS] = {};
+  } ProfileFrame;
+
+  /**
+   * @brief Cronômetro que soma ao estágio o tempo entre a construção e a destruição
+   */
+  class ProfileScope
+  {
+  private:
+    int stage;
+    std::chrono::steady_clock::time_point start;
+
+  public:
+    explicit ProfileScope(int stage);
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+  };
+
+  void ProfilerAddTime(int stage, uint64_t nanoseconds, uint64_t calls = 1);
+  void ProfilerAddCount(int counter, uint64_t amount);
+  utils::ProfileFrame ProfilerCollect();
+  float ProfileStageMilliseconds(const utils::ProfileFrame &frame, int stage);
+  const char *ProfileStageName(int stage);
+  const char *ProfileCounterName(int counter);
+} // namespace utils
+
+#define MRX_PROFILE_CONCAT_INNER(a, b) a##b
+#define MRX_PROFILE_CONCAT(a, b) MRX_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef MRX_PROFILE
+// Mede o tempo até o fim do escopo atual
+#define MRX_PROFILE_SCOPE(stage) utils::ProfileScope MRX_PROFILE_CONCAT(profile_scope_, __LINE__)(stage)
+// Soma um valor a um contador
+#define MRX_PROFILE_COUNT(counter, amount) utils::ProfilerAddCount(counter, static_cast<uint64_t>(amount))
+// Soma itens a um estágio sem medir o tempo (usado quando o item é pequeno demais para o cronômetro)
+#define MRX_PROFILE_CALLS(stage, amount) utils::ProfilerAddTime(stage, 0, static_cast<uint64_t>(amount))
+#else
+#define MRX_PROFILE_SCOPE(stage) ((void)0)
+#define MRX_PROFILE_COUNT(counter, amount) ((void)0)
+#define MRX_PROFILE_CALLS(stage, amount) ((void)0)
+#endif
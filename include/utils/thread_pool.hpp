@@ -0,0 +1,139 @@
+/**********************************************************************************************
+ *   IDIOM: PORTUGUÊS
+ *
+ *   mrxthreadpool v1.0 - Conjunto reutilizável de threads para paralelizar os estágios do pipeline
+ *
+ *   CONVENTIONS: (Convenções)
+ *     - As funções sempre têm uma descrição @brief, @param e @return no aquivo .cpp
+ *     - O trabalho é dividido em blocos de tamanho fixo, cada bloco escreve em dados disjuntos,
+ *       logo o resultado não depende da quantidade de threads
+ *
+ *   IDIOM: ENGLISH
+ *
+ *   mrxthreadpool v1.0 - Reusable worker pool used to parallelize the pipeline stages
+ *
+ *   CONVENTIONS:
+ *     - The functions always have a @brief, @param and @return description in the .cpp file
+ *     - Work is split in fixed-size chunks, every chunk writes to disjoint data,
+ *       so the result does not depend on the number of threads
+ *
+ *   CONFIGURATION:
+ *       ...
+ *
+ *   DEPENDENCIES:
+ *      <thread>             - Required for: std::jthread, std::stop_token
+ *      <mutex>              - Required for: std::mutex, std::unique_lock
+ *      <condition_variable> - Required for: std::condition_variable_any
+ *      <functional>         - Required for: std::function
+ *      <atomic>             - Required for: std::atomic
+ *
+ *   CONTRIBUTORS:
+ *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
+ *
+ *
+ *   LICENSE: GPL 3.0
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **********************************************************************************************/
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+namespace utils
+{
+  class ThreadPool
+  {
+  private:
+    /**
+     * @brief Threads trabalhadoras do conjunto
+     *
+     * @note A thread que chama parallel_for também processa blocos, logo são criadas (num_threads - 1) threads
+     */
+    std::vector<std::jthread> workers;
+    /**
+     * @brief Quantidade total de threads que participam de um parallel_for
+     */
+    unsigned int num_threads = 1;
+    /**
+     * @brief Mutex que protege o estado da tarefa corrente
+     */
+    std::mutex mutex;
+    /**
+     * @brief Serializa chamadas concorrentes de parallel_for
+     */
+    std::mutex submit_mutex;
+    /**
+     * @brief Sinaliza as threads trabalhadoras quando uma nova tarefa é publicada
+     */
+    std::condition_variable_any work_available;
+    /**
+     * @brief Sinaliza a thread que chamou parallel_for quando todos os blocos terminaram
+     */
+    std::condition_variable_any work_done;
+    /**
+     * @brief Tarefa corrente, recebe o intervalo [begin, end) a ser processado
+     */
+    const std::function<void(size_t, size_t)> *task = nullptr;
+    /**
+     * @brief Quantidade de itens e tamanho do bloco da tarefa corrente
+     */
+    size_t task_count = 0;
+    size_t task_chunk_size = 1;
+    size_t task_num_chunks = 0;
+    /**
+     * @brief Próximo bloco a ser processado
+     */
+    std::atomic<size_t> next_chunk = 0;
+    /**
+     * @brief Quantidade de blocos já concluídos da tarefa corrente
+     */
+    size_t finished_chunks = 0;
+    /**
+     * @brief Quantidade de threads trabalhadoras processando a tarefa corrente
+     */
+    unsigned int active_workers = 0;
+    /**
+     * @brief Contador de tarefas publicadas, usado para acordar as threads trabalhadoras
+     */
+    size_t generation = 0;
+
+    void worker_loop(std::stop_token stop_token);
+    size_t run_chunks();
+    void stop();
+
+  public:
+    // Constructors and Destructors
+    explicit ThreadPool(unsigned int num_threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // Getters and Setters
+    unsigned int getNumThreads() const;
+    void setNumThreads(unsigned int num_threads);
+
+    // Functions
+    void parallel_for(size_t count, size_t chunk_size, const std::function<void(size_t, size_t)> &function);
+
+    static unsigned int hardware_threads();
+  };
+} // namespace utils
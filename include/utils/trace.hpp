@@ -0,0 +1,133 @@
+/**********************************************************************************************
+ *   IDIOM: PORTUGUÊS
+ *
+ *   mrxtrace v1.0 - Linha do tempo dos quadros no formato de eventos do Chrome (chrome://tracing)
+ *
+ *   CONVENTIONS: (Convenções)
+ *     - As funções sempre têm uma descrição @brief, @param e @return no aquivo .cpp
+ *     - Os eventos ficam em um buffer circular de tamanho fixo: quando ele enche, os eventos mais
+ *       antigos são sobrescritos, então a memória usada não cresce durante a gravação
+ *     - Cada evento guarda o início e a duração de um escopo (evento "X" do Chrome, que equivale
+ *       ao par begin/end)
+ *     - Os nomes e categorias são ponteiros para textos estáticos, nunca copiados
+ *     - Os estágios medidos por MRX_PROFILE_SCOPE também viram eventos enquanto a gravação está
+ *       ligada, o restante do código usa MRX_TRACE_SCOPE
+ *
+ *   IDIOM: ENGLISH
+ *
+ *   mrxtrace v1.0 - Frame timelines in the Chrome trace-event format (chrome://tracing)
+ *
+ *   CONVENTIONS:
+ *     - The functions always have a @brief, @param and @return description in the .cpp file
+ *     - Events live in a fixed-size ring buffer: once it is full the oldest events are
+ *       overwritten, so memory does not grow while recording
+ *     - Each event stores the start and duration of a scope (Chrome "X" event, equivalent to a
+ *       begin/end pair)
+ *     - Names and categories are pointers to static strings, never copied
+ *     - Stages timed by MRX_PROFILE_SCOPE also become events while recording, the rest of the
+ *       code uses MRX_TRACE_SCOPE
+ *
+ *   CONFIGURATION:
+ *       MRX_PROFILE    - Compila os eventos (mesma opção "profile" do xmake dos cronômetros)
+ *       TRACE_CAPACITY - Quantidade padrão de eventos do buffer circular
+ *
+ *   DEPENDENCIES:
+ *      <chrono>                 - Required for: std::chrono::steady_clock
+ *      <utils/nlohmann/json.hpp> - Required for: nlohmann::json
+ *
+ *   CONTRIBUTORS:
+ *      Marcos Augusto Campagnaro: Initial implementation, review and maintenance
+ *
+ *
+ *   LICENSE: GPL 3.0
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **********************************************************************************************/
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <utils/nlohmann/json.hpp>
+
+namespace utils
+{
+// Quantidade padrão de eventos do buffer circular (~2,5 MB)
+#define TRACE_CAPACITY 65536
+
+// Categorias dos eventos
+#define TRACE_PIPELINE "pipeline"
+#define TRACE_WORKER "worker"
+#define TRACE_IO "io"
+#define TRACE_FRAME "frame"
+
+  /**
+   * @brief Evento da linha do tempo
+   *
+   * @param name Nome do evento (texto estático)
+   * @param category Categoria do evento (TRACE_PIPELINE, TRACE_WORKER, ...)
+   * @param start Início (ns) desde o começo da gravação
+   * @param duration Duração (ns)
+   * @param thread Identificador da thread que gerou o evento (sequencial, a partir de 0)
+   */
+  typedef struct TraceEvent
+  {
+    const char *name = nullptr;
+    const char *category = nullptr;
+    uint64_t start = 0;
+    uint64_t duration = 0;
+    uint32_t thread = 0;
+  } TraceEvent;
+
+  /**
+   * @brief Gera um evento com o tempo entre a construção e a destruição, se a gravação estiver ligada
+   */
+  class TraceScope
+  {
+  private:
+    const char *name;
+    const char *category;
+    bool active;
+    std::chrono::steady_clock::time_point start;
+
+  public:
+    TraceScope(const char *name, const char *category);
+    ~TraceScope();
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+  };
+
+  void TraceStart(size_t capacity = TRACE_CAPACITY);
+  void TraceStop();
+  bool TraceEnabled();
+  void TraceThreadName(const char *name);
+  void TraceRecord(const char *name, const char *category, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+  std::vector<utils::TraceEvent> TraceEvents();
+  uint64_t TraceDropped();
+  nlohmann::json TraceToJson();
+  bool TraceWrite(const std::string &file_path);
+} // namespace utils
+
+#ifdef MRX_PROFILE
+// Gera um evento com a duração do escopo atual
+#define MRX_TRACE_SCOPE(name, category) utils::TraceScope MRX_TRACE_CONCAT(trace_scope_, __LINE__)(name, category)
+#define MRX_TRACE_CONCAT_INNER(a, b) a##b
+#define MRX_TRACE_CONCAT(a, b) MRX_TRACE_CONCAT_INNER(a, b)
+#else
+#define MRX_TRACE_SCOPE(name, category) ((void)0)
+#endif
@@ -41,8 +41,6 @@
  **********************************************************************************************/
 #pragma once
 
-#include <SDL.h>
-
 #include <gui/imgui/imgui.h>
 #include <core/vertex.hpp>
 #include <core/halfedge.hpp>
@@ -56,19 +54,20 @@ namespace utils
 {
 
   // Funções para desenhar pixel-a-pixel
-  void setPixel(const float x, const float y, const float z, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer);
-  void DrawVertexBuffer(const core::Vector3 point, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer, const int size);
-  void DrawLineBuffer(const std::vector<core::Vector3> &vertexes, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer);
+  void setPixel(const float x, const float y, const float z, const models::ColorFloat &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor = NO_SCISSOR);
+  void DrawVertexBuffer(const core::Vector3 point, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const int size);
+  void DrawLineBuffer(const std::vector<core::Vector3> &vertexes, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor = NO_SCISSOR);
 
   // Funções para rasterização de polígonos
-  void DrawFaceBufferFlatShading(const std::vector<core::Vector3> &vertexes, const core::Vector3 &eye, const core::Vector3 &face_centroid, const core::Vector3 &face_normal, const models::Material &object_material, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer);
-  void DrawFaceBufferGouraudShading(const std::vector<std::pair<core::Vector3, models::Color>> &vertexes, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer);
-  void DrawFaceBufferPhongShading(const std::vector<std::pair<core::Vector3, core::Vector3>> &vertexes, const core::Vector3 &centroid, const core::Vector3 &eye, const models::Material &object_material, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer);
+  void DrawFaceBufferFlatShading(const std::vector<core::Vector3> &vertexes, const models::ColorFloat &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor = NO_SCISSOR, math::DepthComplexityBuffer *depth_complexity = nullptr);
+  void DrawFaceBufferGouraudShading(const std::vector<std::pair<core::Vector3, models::ColorFloat>> &vertexes, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor = NO_SCISSOR, math::DepthComplexityBuffer *depth_complexity = nullptr);
+  template <typename Precision = math::Exact>
+  void DrawFaceBufferPhongShading(const std::vector<std::pair<core::Vector3, core::Vector3>> &vertexes, const std::vector<core::Vector3> &positions, const core::Vector3 &centroid, const core::Vector3 &eye, const models::Material &object_material, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, const models::LightTiles &light_tiles, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor = NO_SCISSOR, math::DepthComplexityBuffer *depth_complexity = nullptr);
   void DrawBuffer(ImDrawList *draw_list, const std::vector<std::vector<float>> &z_buffer, const std::vector<std::vector<models::Color>> &color_buffer, core::Vector2 min_window_size);
 
   // Demais funções de desenho
   void DrawString(const char *text, const core::Vector3 &position, const models::Color &color);
-  void DrawBoundingBox(const core::Vector2 &min, const core::Vector2 &max, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer);
+  void DrawBoundingBox(const core::Vector2 &min, const core::Vector2 &max, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor = NO_SCISSOR);
 
   core::Vector4 GetBoundingBox(const std::vector<core::Vector3> &vertexes);
 }
\ No newline at end of file
@@ -509,26 +509,6 @@ namespace core
   // Methods - Matrix
   // ------------------------------------------------------------------------------------------
 
-  /**
-   * @brief Retorna uma matriz 4x4 identidade.
-   *
-   * Esta função cria e retorna uma matriz 4x4 onde todos os elementos são inicializados com 0.0f, exceto
-   * os elementos da diagonal principal, que são inicializados com 1.0f.
-   *
-   * @return Matrix Uma matriz 4x4 identidade.
-   */
-  Matrix MatrixIdentity(void)
-  {
-    Matrix result = {0};
-
-    result.m0 = 1.0f;
-    result.m5 = 1.0f;
-    result.m10 = 1.0f;
-    result.m15 = 1.0f;
-
-    return result;
-  }
-
   /**
    * @brief Calcula a transposta de uma matriz.
    *
@@ -579,34 +559,4 @@ namespace core
     return result;
   }
 
-  /**
-   * @brief Converte um array de floats para uma matriz 4x4.
-   *
-   * @param f O array de floats (16 indices) a ser convertido.
-   * @return Matrix A matriz 4x4 convertida.
-   */
-  Matrix Flota16ToMatrix(float16 f)
-  {
-    Matrix result = {0};
-
-    result.m0 = f.v[0];
-    result.m1 = f.v[1];
-    result.m2 = f.v[2];
-    result.m3 = f.v[3];
-    result.m4 = f.v[4];
-    result.m5 = f.v[5];
-    result.m6 = f.v[6];
-    result.m7 = f.v[7];
-    result.m8 = f.v[8];
-    result.m9 = f.v[9];
-    result.m10 = f.v[10];
-    result.m11 = f.v[11];
-    result.m12 = f.v[12];
-    result.m13 = f.v[13];
-    result.m14 = f.v[14];
-    result.m15 = f.v[15];
-
-    return result;
-  }
-
 } // namespace core
\ No newline at end of file
@@ -333,6 +333,26 @@ namespace core
     this->normal = normal;
   }
 
+  /**
+   * @brief Método get do índice do vértice na malha
+   *
+   * @return size_t Posição do vértice no vetor de vértices da malha
+   */
+  size_t Vertex::getIndex() const
+  {
+    return this->index;
+  }
+
+  /**
+   * @brief Método set do índice do vértice na malha
+   *
+   * @param index Posição do vértice no vetor de vértices da malha
+   */
+  void Vertex::setIndex(size_t index)
+  {
+    this->index = index;
+  }
+
   // ------------------------------------------------------------------------------------------
   // Methods
   // ------------------------------------------------------------------------------------------s
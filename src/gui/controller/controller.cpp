@@ -1,10 +1,21 @@
 #include <gui/controller/controller.hpp>
 #include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <cctype>
 
-GUI::Controller::Controller(float canvasWidth, float canvasHeight)
+/**
+ * @brief Construtor da classe Controller
+ *
+ * @param canvasWidth Largura da janela
+ * @param canvasHeight Altura da janela
+ * @param worker_threads Quantidade de threads do estágio de geometria (0 = automático)
+ */
+GUI::Controller::Controller(float canvasWidth, float canvasHeight, unsigned int worker_threads)
 {
   this->windowHeight = static_cast<int>(canvasHeight);
   this->windowWidth = static_cast<int>(canvasWidth);
+  this->worker_threads = worker_threads;
 
   this->scene = new models::Scene(
       models::CreateCamera3D({10, 10, 20}, {0, 0, 0}, {0, 1, 0}, 30, 20, 40),
@@ -16,6 +27,8 @@ GUI::Controller::Controller(float canvasWidth, float canvasHeight)
       {-2, -2},
       {2, 2});
 
+  this->scene->setWorkerThreads(this->worker_threads);
+
   this->insertionOptions = {1, 1.0f, 1.0f, 10, 10, 1.0f, 0.5f, 100, 100};
 }
 
@@ -25,6 +38,7 @@ GUI::Controller::Controller(float canvasWidth, float canvasHeight)
  */
 GUI::Controller::~Controller()
 {
+  this->waitFrame();
 }
 
 /**
@@ -47,18 +61,95 @@ void GUI::Controller::setScene(models::Scene &_scene)
   this->scene = &_scene;
 }
 
+/**
+ * @brief Define a quantidade de threads usadas no estágio de geometria
+ *
+ * @param worker_threads Quantidade de threads (0 = quantidade de núcleos da máquina)
+ */
+void GUI::Controller::setWorkerThreads(unsigned int worker_threads)
+{
+  this->worker_threads = worker_threads;
+  this->scene->setWorkerThreads(worker_threads);
+}
+
 /**
  * @brief Atualiza a cena caso haja alguma alteração
  *
+ * @note Com o pipeline de quadros ativo, a geometria do quadro N + 1 é processada enquanto o quadro N
+ * é rasterizado em outra thread, então o framebuffer exibido é o do quadro anterior
+ * @note Se nada mudou desde o último quadro, o framebuffer atual é reaproveitado
+ * @note O tempo de cada quadro rasterizado alimenta a resolução dinâmica (ver models::UpdateRenderScale)
+ * @note A entrada do quadro já foi aplicada à cena: a reprodução a substitui pelo próximo quadro
+ * gravado e a gravação a guarda
  */
 void GUI::Controller::updateScene()
 {
   // models::CameraOrbital(this->scene->getCamera(), this->camera_rotation_sensitivity);
 
-  if (this->scene->pipeline_model == SANTA_CATARINA_PIPELINE)
-    this->scene->adair_pipeline();
-  else
-    this->scene->smith_pipeline();
+  this->scene->render_scale = this->render_scale.scale;
+
+  if (this->replaying && !models::ReplayFrame(this->replay, this->scene))
+    this->stop_replay();
+
+  // A quantidade de objetos mudou: inserir e remover objetos não é gravado
+  if (this->recorder.active && !models::RecordFrame(this->recorder, this->scene))
+    this->stop_recording();
+
+  if (!this->scene->hasChanged())
+  {
+    // Exibe o último quadro assim que a sua rasterização termina, sem bloquear a interface
+    if (this->pending_frame.valid() && this->pending_frame.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+      this->waitFrame();
+
+    return;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+
+  if (!this->frame_pipelining)
+  {
+    this->waitFrame();
+
+    start = std::chrono::steady_clock::now();
+
+    this->scene->pipeline();
+
+    models::UpdateRenderScale(this->render_scale, std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count());
+    return;
+  }
+
+  models::Scene *scene = this->scene;
+  models::FrameGeometry &frame = scene->nextFrameGeometry();
+
+  scene->geometry(frame);
+
+  float geometry_time = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  // O quadro anterior precisa terminar antes que o framebuffer de trás seja reaproveitado
+  this->waitFrame();
+
+  this->pending_frame = std::async(std::launch::async, [scene, &frame]()
+                                   {
+    auto start = std::chrono::steady_clock::now();
+    scene->rasterize(frame);
+    return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count(); });
+
+  // A geometria e a rasterização rodam em paralelo, então o quadro custa o mais lento dos dois
+  models::UpdateRenderScale(this->render_scale, std::max(geometry_time, this->raster_time));
+}
+
+/**
+ * @brief Aguarda a rasterização do quadro em andamento e o exibe
+ *
+ * @note Troca os framebuffers da cena quando existe um quadro em andamento
+ */
+void GUI::Controller::waitFrame()
+{
+  if (!this->pending_frame.valid())
+    return;
+
+  this->raster_time = this->pending_frame.get();
+  this->scene->swapBuffers();
 }
 
 /**
@@ -110,6 +201,18 @@ void GUI::Controller::selectObject(models::Mesh *object)
  */
 void GUI::Controller::newScene()
 {
+  this->waitFrame();
+
+  if (this->recorder.active)
+    this->stop_recording();
+
+  // A cena anterior é liberada junto com os seus objetos e as threads do estágio de geometria
+  delete this->scene;
+
+  // Os ponteiros dos objetos liberados podem ser reaproveitados pelos novos objetos
+  this->previousRotation.clear();
+  this->previousScale.clear();
+  this->previousTranslations.clear();
 
   float canvasWidth = static_cast<float>(this->windowWidth);
   float canvasHeight = static_cast<float>(this->windowHeight);
@@ -124,6 +227,8 @@ void GUI::Controller::newScene()
       {-3, -3},
       {3, 3});
 
+  this->scene->setWorkerThreads(this->worker_threads);
+
   this->insertionOptions = {1, 1.0f, 1.0f, 10, 10};
 }
 
@@ -194,6 +299,10 @@ void GUI::Controller::scale_object(models::Mesh *object, core::Vector3 scale)
  */
 void GUI::Controller::handleEvents(const SDL_Event &event, SDL_Window *window, float deltaTime)
 {
+  // A reprodução controla a cena até terminar
+  if (this->replaying && event.type != SDL_QUIT && event.type != SDL_WINDOWEVENT)
+    return;
+
   switch (event.type)
   {
   case SDL_QUIT:
@@ -371,9 +480,25 @@ void GUI::Controller::on_hierarchy_item_selected(int item_type, int object_index
  * @brief Callback para quando o diálogo de arquivos é aberto
  *
  * @param file Caminho do arquivo selecionado
+ *
+ * @note Arquivos .obj são importados como um novo objeto da cena (ver import_obj), os demais são
+ * cenas salvas em JSON
  */
 void GUI::Controller::on_file_dialog_open(const std::string &file)
 {
+  std::string extension = std::filesystem::path(file).extension().string();
+  std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c)
+                 { return static_cast<char>(std::tolower(c)); });
+
+  if (extension == ".obj")
+  {
+    this->import_obj(file);
+    return;
+  }
+
+  // Os objetos da cena são substituídos, o que não é gravado
+  if (this->recorder.active)
+    this->stop_recording();
 
   json j = utils::load_json(file);
 
@@ -382,6 +507,27 @@ void GUI::Controller::on_file_dialog_open(const std::string &file)
   this->updateScene();
 }
 
+/**
+ * @brief Importa um arquivo Wavefront OBJ como um novo objeto da cena
+ *
+ * @param file Caminho do arquivo
+ *
+ * @note Em caso de erro a cena não muda e o erro é escrito em std::cerr
+ */
+void GUI::Controller::import_obj(const std::string &file)
+{
+  models::Mesh *object = new models::Mesh();
+
+  // A leitura usa as threads da cena (ver setWorkerThreads)
+  if (!object->createMesh(file, *this->scene->getThreadPool()))
+  {
+    delete object;
+    return;
+  }
+
+  this->addObject(object);
+}
+
 /**
  * @brief Salva a cena em um arquivo
  *
@@ -401,8 +547,9 @@ void GUI::Controller::start_benchmark()
 {
   this->benchmarking = true;
 
-  on_file_dialog_open("C:\\Users\\marco\\OneDrive\\Documentos\\TCC\\mrx-scene\\scene.json");
+  on_file_dialog_open(BENCHMARK_SCENE);
 
+  this->benchmark_camera = models::BenchmarkCamera();
   models::benchmark_start(&this->benchmark_results);
 }
 
@@ -413,8 +560,6 @@ void GUI::Controller::end_benchmark()
   // Finaliza o benchmark
   models::benchmark_end(&this->benchmark_results);
 
-  std::string filename;
-  std::string output_dir = "C:\\Users\\marco\\OneDrive\\Documentos\\TCC\\mrx-scene\\resultados";
   std::string shading_model;
   std::string repetition = std::to_string(this->benchmark_repetitions);
 
@@ -425,58 +570,14 @@ void GUI::Controller::end_benchmark()
   else
     shading_model = "phong";
 
-  if (this->getScene()->pipeline_model == SMITH_PIPELINE)
-  {
-    filename = "benchmark_pipeline_smith_" + shading_model + "_results_" + (repetition) + ".txt";
-    output_dir += "\\SMITH\\";
-  }
-  else
-  {
-    filename = "benchmark_pipeline_adair_" + shading_model + "_results_" + repetition + ".txt";
-    output_dir += "\\ADAIR\\";
-  }
-
-  if (this->getScene()->lighting_model == FLAT_SHADING)
-    output_dir += "\\FLAT\\";
-  else if (this->getScene()->lighting_model == GOURAUD_SHADING)
-    output_dir += "\\GOURAUD\\";
-  else
-    output_dir += "\\PHONG\\";
+  std::string pipeline = this->getScene()->pipeline_model == SMITH_PIPELINE ? "smith" : "adair";
 
-  // Caminho completo
-  std::string full_path = output_dir + "\\" + filename;
+  std::string full_path = models::benchmark_results_path(BENCHMARK_RESULTS_DIRECTORY, pipeline, shading_model, this->benchmark_repetitions) + ".txt";
 
-  // Abre um arquivo para escrita
-  std::ofstream outFile(full_path);
-  if (!outFile.is_open())
-  {
-    std::cerr << "Erro ao abrir o arquivo para escrita!" << std::endl;
+  if (!models::benchmark_write_report(&this->benchmark_results, full_path, pipeline == "smith" ? "Smith" : "Adair", shading_model, this->benchmark_repetitions))
     return;
-  }
 
-  // Escreve os resultados no arquivo
-  outFile << "=== Benchmark Results ===\n\n"
-          << "Configuration:\n"
-          << "Pipeline: " << (this->getScene()->pipeline_model == SMITH_PIPELINE ? "Smith" : "Adair") << "\n"
-          << "Shading: " << shading_model << "\n"
-          << "Repetitions: " << this->benchmark_repetitions << "\n\n"
-          << "Performance Metrics:\n"
-          << std::fixed << std::setprecision(4)
-          << "Total Time: " << this->benchmark_results.total_time.count() << " s\n"
-          << "Total Frames: " << this->benchmark_results.total_frames << "\n"
-          << "Average FPS: " << this->benchmark_results.total_frames / this->benchmark_results.total_time.count() << "\n"
-          << "Avg Frame Time: " << this->benchmark_results.average_frame_time << " ms\n"
-          << "Min Frame Time: " << this->benchmark_results.min_frame_time << " ms\n"
-          << "Max Frame Time: " << this->benchmark_results.max_frame_time << " ms\n\n"
-          << "Worst 10% Frame Times (ms):\n";
-
-  for (const auto &time : this->benchmark_results.worst_10_percentile)
-  {
-    outFile << time << "\n";
-  }
-
-  outFile.close();
-  std::cout << "Results of benchmark " + repetition + " saved to: " << filename << std::endl;
+  std::cout << "Results of benchmark " + repetition + " saved to: " << full_path << std::endl;
   this->benchmark_repetitions++;
 
   if (this->benchmark_repetitions <= 10)
@@ -485,67 +586,137 @@ void GUI::Controller::end_benchmark()
   }
 }
 
+/**
+ * @brief Adiciona o tempo de um quadro ao benchmark
+ *
+ * @param frame_time Tempo do quadro (ms)
+ */
 void GUI::Controller::update_benchmark(double frame_time)
 {
-  // Adiciona o tempo do frame ao vetor de tempos
-  this->benchmark_results.frame_times.push_back(frame_time);
+  models::benchmark_update(&this->benchmark_results, frame_time);
 
-  // Atualiza o tempo total de execução corretamente
-  this->benchmark_results.total_time += std::chrono::duration<double>(frame_time);
+#ifdef MRX_PROFILE
+  this->benchmark_results.profiles.push_back(this->profile);
+#endif
+}
 
-  // Atualiza o número total de frames
-  this->benchmark_results.total_frames++;
+/**
+ * @brief Avança a câmera um passo no caminho do benchmark
+ */
+void GUI::Controller::update_camera_benchmark()
+{
+  models::benchmark_camera_step(&this->benchmark_camera, this->getScene()->getCamera());
+}
 
-  // Atualiza o tempo mínimo e máximo de frame
-  if (frame_time < this->benchmark_results.min_frame_time || this->benchmark_results.total_frames == 1)
-  {
-    this->benchmark_results.min_frame_time = frame_time;
-  }
-  if (frame_time > this->benchmark_results.max_frame_time)
-  {
-    this->benchmark_results.max_frame_time = frame_time;
-  }
+/**
+ * @brief Guarda os tempos por estágio e os contadores acumulados no quadro e os zera
+ *
+ * @note Deve ser chamada uma vez por quadro, depois que ele é exibido
+ */
+void GUI::Controller::collect_profile()
+{
+  this->profile = utils::ProfilerCollect();
+}
 
-  // Calcula a média de tempo de frame corretamente
-  this->benchmark_results.average_frame_time = (this->benchmark_results.total_time.count() / this->benchmark_results.total_frames);
+/**
+ * @brief Liga a gravação da linha do tempo dos quadros, descartando a gravação anterior
+ *
+ * @note A memória é limitada pelo buffer circular (TRACE_CAPACITY eventos)
+ */
+void GUI::Controller::start_trace()
+{
+  utils::TraceStart();
+}
 
-  // Calcula a média de FPS corretamente
-  if (this->benchmark_results.total_time.count() > 0)
-  {
-    this->benchmark_results.average_fps = this->benchmark_results.total_frames / this->benchmark_results.total_time.count();
-  }
-  else
-  {
-    this->benchmark_results.average_fps = 0.0;
-  }
+/**
+ * @brief Encerra a gravação da linha do tempo e escreve os eventos em trace_path
+ */
+void GUI::Controller::stop_trace()
+{
+  utils::TraceStop();
+
+  std::filesystem::path directory = std::filesystem::path(this->trace_path).parent_path();
+  std::error_code error;
+
+  if (!directory.empty())
+    std::filesystem::create_directories(directory, error);
+
+  if (utils::TraceWrite(this->trace_path))
+    std::cout << "Linha do tempo: " << utils::TraceEvents().size() << " eventos (" << utils::TraceDropped() << " descartados) -> " << this->trace_path << std::endl;
+}
 
-  // Atualiza os 10% piores frames
-  if (this->benchmark_results.frame_times.size() >= 10)
+/**
+ * @brief Inicia a gravação da entrada a partir da cena atual, descartando a gravação anterior
+ *
+ * @note A gravação termina sozinha quando objetos são inseridos, removidos ou carregados
+ */
+void GUI::Controller::start_recording()
+{
+  if (this->replaying)
+    return;
+
+  models::RecordStart(this->recorder, this->scene);
+}
+
+/**
+ * @brief Encerra a gravação da entrada e a escreve em recording_path
+ */
+void GUI::Controller::stop_recording()
+{
+  models::RecordStop(this->recorder, this->scene);
+
+  std::filesystem::path directory = std::filesystem::path(this->recording_path).parent_path();
+  std::error_code error;
+
+  if (!directory.empty())
+    std::filesystem::create_directories(directory, error);
+
+  if (models::WriteRecording(this->recorder.recording, this->recording_path))
+    std::cout << "Entrada gravada: " << this->recorder.recording.frames << " quadros (" << this->recorder.recording.events.size() << " eventos) -> " << this->recording_path << std::endl;
+}
+
+/**
+ * @brief Reproduz a entrada gravada em recording_path, um quadro gravado por quadro exibido
+ *
+ * @return bool Verdadeiro se a reprodução começou e falso se o arquivo não é uma gravação válida
+ *
+ * @note A cena é substituída pela cena guardada no início da gravação
+ */
+bool GUI::Controller::start_replay()
+{
+  if (this->recorder.active)
+    return false;
+
+  models::Recording recording;
+
+  if (!models::ReadRecording(this->recording_path, recording))
+    return false;
+
+  json scene_json = json::parse(recording.scene, nullptr, false);
+
+  if (!scene_json.is_discarded() && scene_json.contains("objects"))
   {
-    std::vector<double> sorted_times = this->benchmark_results.frame_times;
-    std::sort(sorted_times.begin(), sorted_times.end());
-    int worst_count = sorted_times.size() / 10;
-    this->benchmark_results.worst_10_percentile.assign(
-        sorted_times.end() - worst_count, sorted_times.end());
+    this->waitFrame();
+    this->scene->from_json(scene_json);
   }
+
+  this->on_hierarchy_item_selected(GUI::ItemSelected::NONE, -1);
+
+  models::ReplayStart(this->replay, recording);
+  this->replaying = true;
+  this->replay_start = std::chrono::steady_clock::now();
+
+  return true;
 }
 
-void GUI::Controller::update_camera_benchmark()
+/**
+ * @brief Encerra a reprodução e compara a sua duração com a da gravação
+ */
+void GUI::Controller::stop_replay()
 {
-  models::Camera3D *camera = this->getScene()->getCamera();
+  this->replaying = false;
 
-  if (this->type_camera_movement == ORBITAL_MOVEMENT)
-  {
-    models::CameraOrbital(camera, this->camera_rotation_sensitivity);
-    accumulatedAngle += this->camera_rotation_sensitivity;
+  float duration = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - this->replay_start).count();
 
-    // Se acumulou 360 graus (2π radianos) ou mais, reinicia o movimento
-    if (accumulatedAngle >= 2 * M_PI)
-    {
-      accumulatedAngle = 0.0f; // reinicia o contador
-      this->type_camera_movement = FREE_MOVEMENT;
-    }
-  }
-  else
-    models::CameraMoveForward(camera, 1.0f, true);
-}
\ No newline at end of file
+  std::cout << "Reprodução: " << this->replay.frame << " de " << this->replay.recording.frames << " quadros em " << duration << " ms (gravação: " << this->replay.timestamp << " ms)" << std::endl;
+}
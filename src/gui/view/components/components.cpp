@@ -1,6 +1,8 @@
 #include <gui/view/components/components.hpp>
+#include <utils/profiler.hpp>
 
 #include <iostream>
+#include <cstdio>
 
 namespace GUI
 {
@@ -64,9 +66,26 @@ namespace GUI
     if (scene->getObjects().size() == 0)
       return;
 
+    models::FrameBuffer &frame_buffer = scene->getDisplayBuffer();
+
+    // Nenhum quadro foi concluído ainda
+    if (frame_buffer.width == 0)
+      return;
+
     ImDrawList *draw_list = ImGui::GetForegroundDrawList();
 
-    utils::DrawBuffer(draw_list, scene->z_buffer, scene->color_buffer, scene->getMinViewport());
+    MRX_PROFILE_SCOPE(PROFILE_PRESENT);
+    utils::DrawBuffer(draw_list, frame_buffer.z_buffer, frame_buffer.color_buffer, scene->getMinViewport());
+
+    // Mapa de overdraw: as razões ficam no framebuffer rasterizado, não no ampliado
+    if (scene->overdraw)
+    {
+      const models::FrameBuffer &front = scene->getFrontBuffer();
+      char text[128];
+
+      std::snprintf(text, sizeof(text), "FPS: %.1f | Overdraw: %.2fx | Complexidade: %.2fx", ImGui::GetIO().Framerate, front.overdraw_ratio, front.depth_complexity_ratio);
+      utils::DrawString(text, {scene->getMinViewport().x + 8.0f, scene->getMinViewport().y + 8.0f, 0.0f}, models::WHITE);
+    }
   }
 
 } // namespace GUI
\ No newline at end of file
@@ -30,6 +30,13 @@ namespace GUI
 
           fileDialog.Open();
         }
+        if (ImGui::MenuItem("Importar OBJ"))
+        {
+          fileDialog.SetTitle("Importar OBJ");
+          fileDialog.SetTypeFilters({".obj"});
+
+          fileDialog.Open();
+        }
         if (ImGui::MenuItem("Salvar"))
         {
           controller->save_scene();
@@ -127,6 +134,14 @@ namespace GUI
           ImGui::RadioButton("Gouraud Shading", &controller->getScene()->lighting_model, GOURAUD_SHADING);
           ImGui::RadioButton("Phong Shading", &controller->getScene()->lighting_model, PHONG_SHADING);
 
+          ImGui::Checkbox("Sombras", &controller->getScene()->shadows);
+          ImGui::SameLine();
+          GUI::components::HelpMarker("Sombras das luzes omni (mapas de sombra). Os mapas só são refeitos quando a luz ou um objeto dentro do seu raio muda");
+
+          ImGui::Checkbox("Mapa de overdraw", &controller->getScene()->overdraw);
+          ImGui::SameLine();
+          GUI::components::HelpMarker("Exibe quantos testes de profundidade cada pixel recebeu, de azul (1) a vermelho (8 ou mais), e a razão de overdraw do quadro ao lado dos FPS");
+
           if (ImGui::BeginMenu("Normais dos vértices"))
           {
             ImGui::RadioButton("Foley", &controller->getScene()->normal_algorithm, FOLEY_UNIT_NORMAL_VECTOR);
@@ -140,6 +155,19 @@ namespace GUI
             ImGui::EndMenu();
           }
 
+          if (ImGui::BeginMenu("Precisão"))
+          {
+            ImGui::RadioButton("Exata", &controller->getScene()->precision, EXACT_PRECISION);
+            ImGui::SameLine();
+            GUI::components::HelpMarker("Normalizações com raiz quadrada e divisão e o brilho especular com pow, como na implementação de referência");
+
+            ImGui::RadioButton("Rápida", &controller->getScene()->precision, FAST_PRECISION);
+            ImGui::SameLine();
+            GUI::components::HelpMarker("Inverso da raiz aproximado (uma iteração de Newton) e pow polinomial. O erro das normalizações fica abaixo de 0,2%");
+
+            ImGui::EndMenu();
+          }
+
           if (ImGui::BeginMenu("Centroide"))
           {
             ImGui::RadioButton("Média dos vértices", &controller->getScene()->centroid_algorithm, CENTROID_BY_MEAN);
@@ -172,11 +200,70 @@ namespace GUI
           ImGui::EndMenu();
         }
 
+        if (ImGui::BeginMenu("Desempenho"))
+        {
+          int worker_threads = static_cast<int>(controller->worker_threads);
+          int max_threads = static_cast<int>(utils::ThreadPool::hardware_threads());
+
+          if (ImGui::SliderInt("Threads da geometria", &worker_threads, 0, max_threads))
+            controller->setWorkerThreads(static_cast<unsigned int>(worker_threads));
+          ImGui::SameLine();
+          GUI::components::HelpMarker("Quantidade de threads usadas na transformação dos vértices, na ocultação de faces e no cálculo das normais (0 = automático)");
+
+          if (ImGui::Checkbox("Pipeline de quadros", &controller->frame_pipelining))
+            controller->waitFrame();
+          ImGui::SameLine();
+          GUI::components::HelpMarker("Rasteriza o quadro anterior em outra thread enquanto a geometria do próximo quadro é processada (adiciona um quadro de atraso)");
+
+          ImGui::Checkbox("Resolução dinâmica", &controller->render_scale.enabled);
+          ImGui::SameLine();
+          GUI::components::HelpMarker("Reduz a resolução interna do framebuffer para manter o FPS alvo. A imagem é ampliada com filtro bilinear na exibição");
+
+          if (controller->render_scale.enabled)
+          {
+            ImGui::SliderFloat("FPS alvo", &controller->render_scale.target_fps, 5.0f, 120.0f, "%.0f");
+            ImGui::SliderFloat("Escala mínima", &controller->render_scale.min_scale, 0.25f, 1.0f, "%.2f");
+            ImGui::Text("Escala atual: %.2f", controller->render_scale.scale);
+          }
+
+          ImGui::EndMenu();
+        }
+
         if (ImGui::MenuItem("Benchmark"))
         {
           controller->start_benchmark();
         }
 
+        if (ImGui::MenuItem("Gravar linha do tempo", nullptr, utils::TraceEnabled()))
+        {
+          if (utils::TraceEnabled())
+            controller->stop_trace();
+          else
+            controller->start_trace();
+        }
+        if (ImGui::IsItemHovered())
+          ImGui::SetTooltip("Grava os estágios do pipeline, as tarefas das threads e a leitura/escrita de arquivos. Ao desmarcar, escreve %s (abra em chrome://tracing ou ui.perfetto.dev)", controller->trace_path.c_str());
+
+        if (ImGui::MenuItem("Gravar entrada", nullptr, controller->recorder.active, !controller->replaying))
+        {
+          if (controller->recorder.active)
+            controller->stop_recording();
+          else
+            controller->start_recording();
+        }
+        if (ImGui::IsItemHovered())
+          ImGui::SetTooltip("Grava a câmera, as transformações, as luzes, os materiais e as configurações a cada quadro. Ao desmarcar, escreve %s", controller->recording_path.c_str());
+
+        if (ImGui::MenuItem("Reproduzir entrada", nullptr, controller->replaying, !controller->recorder.active))
+        {
+          if (controller->replaying)
+            controller->stop_replay();
+          else
+            controller->start_replay();
+        }
+        if (ImGui::IsItemHovered())
+          ImGui::SetTooltip("Reproduz %s quadro a quadro, a partir da cena gravada. O mouse e o teclado são ignorados até o fim", controller->recording_path.c_str());
+
         ImGui::EndMenu();
       }
       ImGui::EndMainMenuBar();
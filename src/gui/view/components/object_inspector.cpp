@@ -192,5 +192,12 @@ namespace GUI
     omni_light->intensity.r = static_cast<models::Uint8>(intensity[0] * 255);
     omni_light->intensity.g = static_cast<models::Uint8>(intensity[1] * 255);
     omni_light->intensity.b = static_cast<models::Uint8>(intensity[2] * 255);
+
+    ImGui::Text("Raio de influência:");
+
+    if (ImGui::InputFloat("##radius", &omni_light->radius) && omni_light->radius < 0.0f)
+      omni_light->radius = 0.0f;
+    ImGui::SameLine();
+    GUI::components::HelpMarker("A luz não alcança objetos mais distantes que o raio (0 = alcance infinito, sem atenuação)");
   }
 } // namespace GUI
\ No newline at end of file
@@ -5,7 +5,17 @@
 #undef near
 #undef far
 
-GUI::UI::UI(SDL_Window *window, SDL_Renderer *renderer)
+/**
+ * @brief Construtor da classe UI
+ *
+ * @param window Janela da aplicação
+ * @param renderer Renderizador da aplicação
+ * @param worker_threads Quantidade de threads do estágio de geometria (0 = automático)
+ * @param trace_path Se não for vazio, grava a linha do tempo desde o início e a escreve neste arquivo
+ * @param record_path Se não for vazio, grava a entrada desde o início e a escreve neste arquivo
+ * @param replay_path Se não for vazio, reproduz a entrada gravada neste arquivo
+ */
+GUI::UI::UI(SDL_Window *window, SDL_Renderer *renderer, unsigned int worker_threads, const std::string &trace_path, const std::string &record_path, const std::string &replay_path)
     : window(window), renderer(renderer)
 {
 
@@ -23,10 +33,27 @@ GUI::UI::UI(SDL_Window *window, SDL_Renderer *renderer)
   float window_height = static_cast<float>(dm.h);
 
   // Setup controller
-  this->controller = new GUI::Controller(window_width, window_height);
+  this->controller = new GUI::Controller(window_width, window_height, worker_threads);
 
   this->hierarchyViewer = new GUI::components::HierarchyViewer(this->controller);
 
+  if (!trace_path.empty())
+  {
+    this->controller->trace_path = trace_path;
+    this->controller->start_trace();
+  }
+
+  if (!replay_path.empty())
+  {
+    this->controller->recording_path = replay_path;
+    this->controller->start_replay();
+  }
+  else if (!record_path.empty())
+  {
+    this->controller->recording_path = record_path;
+    this->controller->start_recording();
+  }
+
   this->controller->updateScene();
 }
 
@@ -35,6 +62,13 @@ GUI::UI::UI(SDL_Window *window, SDL_Renderer *renderer)
  */
 GUI::UI::~UI()
 {
+  // A gravação em andamento é escrita antes de fechar
+  if (utils::TraceEnabled())
+    this->controller->stop_trace();
+
+  if (this->controller->recorder.active)
+    this->controller->stop_recording();
+
   // Cleanup
   ImGui_ImplSDLRenderer2_Shutdown();
   ImGui_ImplSDL2_Shutdown();
@@ -128,6 +162,8 @@ void GUI::UI::object_properties()
  */
 void GUI::UI::render()
 {
+  MRX_TRACE_SCOPE("frame", TRACE_FRAME);
+
   // Mede o tempo de rasterização
   auto start_time = std::chrono::high_resolution_clock::now();
 
@@ -148,19 +184,6 @@ void GUI::UI::render()
     ImGui::SetNextWindowSize(ImVec2(static_cast<float>(this->controller->windowWidth), static_cast<float>(this->controller->windowHeight)));
     ImGui::Begin("benchmark", nullptr, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoBringToFrontOnFocus);
 
-    if (camera->position == core::Vector3{0.0f, 0.0f, 0.0f})
-    {
-      if (this->controller->type_camera_movement == ORBITAL_MOVEMENT)
-      {
-        this->controller->type_camera_movement = FREE_MOVEMENT;
-        // Re centraliza a camera no eixo Z
-        //  Arredonda pra baixo pra eliminar casa decimais que a rotação deixou
-        camera->position = {0.0f, 0.0f, 0.0f};
-      }
-      else
-        this->controller->type_camera_movement = ORBITAL_MOVEMENT;
-    }
-
     this->controller->update_camera_benchmark();
 
     core::Vector3 vrp = camera->position;
@@ -174,6 +197,12 @@ void GUI::UI::render()
     // Desenha os fps na tela
     ImGui::TextColored(ImColor(models::GET_COLOR_UI32(models::YELLOW)), "FPS: %.1f", ImGui::GetIO().Framerate);
 
+    if (this->controller->getScene()->overdraw)
+    {
+      ImGui::SameLine();
+      ImGui::TextColored(ImColor(models::GET_COLOR_UI32(models::YELLOW)), "Overdraw: %.2fx", this->controller->getScene()->getFrontBuffer().overdraw_ratio);
+    }
+
     ImGui::Text("Pipeline: ");
     ImGui::SameLine();
     if (this->controller->getScene()->pipeline_model == SMITH_PIPELINE)
@@ -266,37 +295,42 @@ void GUI::UI::render()
       ImGui::Text("%.4f ms", this->controller->benchmark_results.max_frame_time);
     }
 
-    ImGui::Dummy(ImVec2(0, 50));
+#ifdef MRX_PROFILE
+    // Tempo de cada estágio e contadores do último quadro (somados entre as threads)
+    ImGui::Dummy(ImVec2(0, 10));
+    const utils::ProfileFrame &profile = this->controller->profile;
 
-    // Grafico dos 10% piores frames
+    for (int stage = 0; stage < PROFILE_STAGES; stage++)
+    {
+      ImGui::TextColored(ImColor(models::GET_COLOR_UI32(models::CYAN)), "%s:", utils::ProfileStageName(stage));
+      ImGui::SameLine();
 
-    // Converte os doubles para float (necessário para PlotLines)
-    static std::vector<float> worst_10_percentile_float;
-    worst_10_percentile_float.clear();
-    for (double time : this->controller->benchmark_results.worst_10_percentile)
+      // O teste de profundidade é contado por pixel, sem cronômetro
+      if (stage == PROFILE_DEPTH_TEST)
+        ImGui::Text("%llu px", static_cast<unsigned long long>(profile.calls[stage]));
+      else
+        ImGui::Text("%.4f ms", utils::ProfileStageMilliseconds(profile, stage));
+    }
+
+    for (int counter = 0; counter < PROFILE_COUNTERS; counter++)
     {
-      worst_10_percentile_float.push_back(static_cast<float>(time));
+      ImGui::TextColored(ImColor(models::GET_COLOR_UI32(models::MAGENTA)), "%s:", utils::ProfileCounterName(counter));
+      ImGui::SameLine();
+      ImGui::Text("%llu", static_cast<unsigned long long>(profile.counters[counter]));
     }
+#endif
 
-    char overlay_2[64];
-    snprintf(
-        overlay_2,
-        sizeof(overlay_2),
-        "Worst 10%% Frame Times (ms) - Total (%d)",
-        static_cast<int>(this->controller->benchmark_results.worst_10_percentile.size()) // Converte para int
-    );
+    ImGui::Dummy(ImVec2(0, 50));
 
-    // Plot do gráfico
-    ImGui::PlotLines(
-        "",                                                 // Label do gráfico
-        worst_10_percentile_float.data(),                   // Dados (array de floats)
-        static_cast<int>(worst_10_percentile_float.size()), // Número de pontos
-        0,                                                  // Offset para início dos dados
-        overlay_2,                                          // Rótulo overlay (opcional)
-        0.0f,                                               // Escala mínima (0 = auto)
-        FLT_MAX,                                            // Escala máxima (FLT_MAX = auto)
-        ImVec2(available_width, 150)                        // Tamanho do gráfico (largura, altura)
-    );
+    // Percentis do tempo dos quadros (histograma, sem ordenar os tempos a cada quadro)
+    ImGui::Text("Frame Time Percentiles (ms)");
+
+    for (double percentile : models::BENCHMARK_PERCENTILES)
+    {
+      ImGui::TextColored(ImColor(models::GET_COLOR_UI32(models::YELLOW)), "%s:", models::benchmark_percentile_name(percentile).c_str());
+      ImGui::SameLine();
+      ImGui::Text("%.4f ms", models::benchmark_percentile(&this->controller->benchmark_results, percentile));
+    }
 
     ImGui::End();
 
@@ -305,7 +339,7 @@ void GUI::UI::render()
 
     ImGui::End();
 
-    if (vrp.z <= -192.0f)
+    if (this->controller->benchmark_camera.finished)
       this->controller->end_benchmark();
   }
   else
@@ -345,10 +379,12 @@ void GUI::UI::render()
   ImGui_ImplSDLRenderer2_RenderDrawData(ImGui::GetDrawData(), this->renderer);
   SDL_RenderPresent(this->renderer);
 
+  this->controller->collect_profile();
+
   if (this->controller->benchmarking)
   {
     auto end_time = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> frame_time = end_time - start_time;
+    std::chrono::duration<double, std::milli> frame_time = end_time - start_time;
 
     // Atualiza o benchmark com o tempo do frame
     this->controller->update_benchmark(frame_time.count());
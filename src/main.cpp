@@ -5,6 +5,7 @@
 #include <SDL.h>
 
 #include <iostream>
+#include <cxxopts.hpp>
 #include <core/vertex.hpp>
 
 #include <models/camera.hpp>
@@ -14,6 +15,7 @@
 #include <math/math.hpp>
 
 #include <utils/utils.hpp>
+#include <utils/trace.hpp>
 
 #include <gui/view/view.hpp>
 #include <gui/controller/controller.hpp>
@@ -22,6 +24,34 @@
 
 int main(int argc, char *argv[])
 {
+  // Argumentos de linha de comando
+  cxxopts::Options options("app", "MRX - PIPELINE TESTER");
+
+  options.add_options()
+      ("t,threads", "Quantidade de threads do estágio de geometria (0 = quantidade de núcleos)", cxxopts::value<unsigned int>()->default_value("0"))
+      ("trace", "Grava a linha do tempo dos quadros desde o início e a escreve neste arquivo ao sair (JSON de eventos do Chrome)", cxxopts::value<std::string>())
+      ("record", "Grava a entrada (câmera, transformações, luzes e configurações) desde o início e a escreve neste arquivo ao sair", cxxopts::value<std::string>())
+      ("replay", "Reproduz, quadro a quadro, a entrada gravada neste arquivo", cxxopts::value<std::string>())
+      ("h,help", "Mostra esta ajuda");
+
+  cxxopts::ParseResult arguments;
+
+  try
+  {
+    arguments = options.parse(argc, argv);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Erro ao ler os argumentos: " << e.what() << std::endl;
+    std::cout << options.help() << std::endl;
+    return -1;
+  }
+
+  if (arguments.count("help"))
+  {
+    std::cout << options.help() << std::endl;
+    return 0;
+  }
 
   // Setup SDL
   if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER | SDL_INIT_GAMECONTROLLER) != 0)
@@ -62,7 +92,12 @@ int main(int argc, char *argv[])
   ImGui_ImplSDLRenderer2_DestroyDeviceObjects();
   ImGui_ImplSDLRenderer2_CreateDeviceObjects();
 
-  GUI::UI *ui = new GUI::UI(window, renderer);
+  utils::TraceThreadName("main");
+
+  auto path = [&arguments](const std::string &name)
+  { return arguments.count(name) ? arguments[name].as<std::string>() : std::string(); };
+
+  GUI::UI *ui = new GUI::UI(window, renderer, arguments["threads"].as<unsigned int>(), path("trace"), path("record"), path("replay"));
 
   // Main loop
   bool done = false;
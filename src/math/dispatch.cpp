@@ -0,0 +1,167 @@
+#include <math/dispatch.hpp>
+
+#include <atomic>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace math
+{
+  /**
+   * @brief Consulta o processador (CPUID) pelo maior conjunto de instruções das variantes que ele e o
+   * sistema operacional suportam
+   *
+   * @return int ISA_BASELINE, ISA_SSE4, ISA_AVX2 ou ISA_AVX512
+   *
+   * @note O AVX2 e o AVX-512 também exigem que o sistema operacional salve os registradores largos
+   * (XCR0), o que __builtin_cpu_supports já verifica
+   */
+  static int DetectIsa()
+  {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq"))
+      return ISA_AVX512;
+    if (__builtin_cpu_supports("avx2"))
+      return ISA_AVX2;
+    if (__builtin_cpu_supports("sse4.2"))
+      return ISA_SSE4;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4];
+    __cpuid(info, 0);
+    int max_leaf = info[0];
+
+    __cpuid(info, 1);
+    bool sse4 = (info[2] & (1 << 20)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+
+    // Registradores salvos pelo sistema operacional: XMM/YMM (bits 1 e 2) e os do AVX-512 (bits 5 a 7)
+    unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+    bool ymm = (xcr0 & 0x06) == 0x06;
+    bool zmm = (xcr0 & 0xe6) == 0xe6;
+
+    if (max_leaf >= 7)
+    {
+      __cpuidex(info, 7, 0);
+      bool avx2 = avx && ymm && (info[1] & (1 << 5)) != 0;
+      // AVX-512 F (16), DQ (17), BW (30) e VL (31)
+      bool avx512 = avx2 && zmm && (info[1] & (1 << 16)) && (info[1] & (1 << 17)) && (info[1] & (1 << 30)) && (info[1] & (1u << 31));
+
+      if (avx512)
+        return ISA_AVX512;
+      if (avx2)
+        return ISA_AVX2;
+    }
+
+    if (sse4)
+      return ISA_SSE4;
+#endif
+
+    return ISA_BASELINE;
+  }
+
+  // Conjunto de instruções do processador, consultado uma única vez na inicialização do programa
+  static const int cpu_isa = DetectIsa();
+
+  // Variante em uso pelos kernels. Antes da inicialização (zero) os kernels usam a baseline
+  static std::atomic<int> active_isa = cpu_isa < MaxIsa() ? cpu_isa : MaxIsa();
+
+  /**
+   * @brief Retorna o maior conjunto de instruções das variantes suportado pelo processador
+   *
+   * @return int ISA_BASELINE, ISA_SSE4, ISA_AVX2 ou ISA_AVX512
+   */
+  int CpuIsa()
+  {
+    return cpu_isa;
+  }
+
+  /**
+   * @brief Retorna o maior conjunto de instruções para o qual as variantes foram compiladas
+   *
+   * @return int ISA_AVX512 com MRX_ISA_DISPATCH e ISA_BASELINE caso contrário
+   */
+  int MaxIsa()
+  {
+#if defined(MRX_ISA_DISPATCH)
+    return ISA_AVX512;
+#else
+    return ISA_BASELINE;
+#endif
+  }
+
+  /**
+   * @brief Retorna o conjunto de instruções da variante usada pelos kernels
+   *
+   * @return int ISA_BASELINE, ISA_SSE4, ISA_AVX2 ou ISA_AVX512
+   */
+  int ActiveIsa()
+  {
+    return active_isa.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Troca a variante usada pelos kernels (ex.: para comparar as variantes no benchmark)
+   *
+   * @param isa Conjunto de instruções (ISA_*)
+   *
+   * @return bool Verdadeiro se a variante foi escolhida e falso se o processador não suporta o
+   * conjunto de instruções ou se ele não foi compilado (a variante em uso não muda)
+   *
+   * @note Deve ser chamada entre quadros, não enquanto o pipeline está em execução
+   */
+  bool SelectIsa(int isa)
+  {
+    if (isa < ISA_BASELINE || isa > cpu_isa || isa > MaxIsa())
+      return false;
+
+    active_isa.store(isa, std::memory_order_relaxed);
+    return true;
+  }
+
+  /**
+   * @brief Retorna o nome de um conjunto de instruções
+   *
+   * @param isa Conjunto de instruções (ISA_*)
+   *
+   * @return const char* "baseline", "sse4", "avx2" ou "avx512"
+   */
+  const char *IsaName(int isa)
+  {
+    switch (isa)
+    {
+    case ISA_AVX512:
+      return "avx512";
+    case ISA_AVX2:
+      return "avx2";
+    case ISA_SSE4:
+      return "sse4";
+    default:
+      return "baseline";
+    }
+  }
+
+  /**
+   * @brief Lê o nome de um conjunto de instruções (ver IsaName)
+   *
+   * @param name Nome informado
+   * @param isa Conjunto de instruções lido (ISA_*)
+   *
+   * @return bool Verdadeiro se o nome é válido e falso caso contrário
+   */
+  bool ParseIsa(const std::string &name, int &isa)
+  {
+    for (int i = ISA_BASELINE; i < ISA_VARIANTS_COUNT; i++)
+      if (name == IsaName(i))
+      {
+        isa = i;
+        return true;
+      }
+
+    return false;
+  }
+} // namespace math
@@ -1,299 +1,13 @@
 #include <math/pipeline.hpp>
 #include <math/math.hpp>
+#include <math/dispatch.hpp>
+#include <utils/profiler.hpp>
 
 #include <iostream>
 
 namespace math
 {
 
-  /**
-   * @brief Obtém a matriz de transformação de SRU para SRC.
-   * @note SRU: Sistema de Referência do Universo
-   * @note SRC: Sistema de Referência da Câmera
-   *
-   * A matriz de transformação obtida é dada por:
-   *
-   * | u.x  u.y  u.z  -u.vrp |
-   * | v.x  v.y  v.z  -v.vrp |
-   * | n.x  n.y  n.z  -n.vrp |
-   * | 0    0    0    1      |
-   *
-   * @param vrp Vetor de posição da câmera
-   * @param fp Ponto para onde a câmera está olhando
-   * @param handed Flag que indica se o sistema de coordenadas é destro ou canhoto (Padrão: RIGHT_HANDED)
-   * @return Matriz de transformação de SRU para SRC
-   */
-  core::Matrix pipeline_adair::sru_to_src(const core::Vector3 &vrp, const core::Vector3 fp, unsigned int handed)
-  {
-    // Define the n vector.
-    core::Vector3 n;
-
-    if (handed == LEFT_HANDED)
-      n = {fp.x - vrp.x, fp.y - vrp.y, fp.z - vrp.z};
-    else
-      n = {vrp.x - fp.x, vrp.y - fp.y, vrp.z - fp.z};
-
-    core::Vector3 n_normalized = math::Vector3Normalize(n);
-
-    // Define the v vector.
-    // TODO: Choose the up vector, depending on the camera orientation.
-    core::Vector3 up_vec = {0, 1, 0};
-
-    float y1 = math::Vector3DotProduct(up_vec, n_normalized);
-
-    core::Vector3 _y1 = math::Vector3MultiplyValue(n_normalized, y1);
-
-    core::Vector3 v = {up_vec.x - _y1.x, up_vec.y - _y1.y, up_vec.z - _y1.z};
-
-    core::Vector3 v_normalized = math::Vector3Normalize(v);
-
-    // Define the u vector.
-    core::Vector3 u = math::Vector3CrossProduct(v_normalized, n_normalized);
-
-    // Make the transformation matrix.
-    core::Matrix result = core::Flota16ToMatrix({{u.x, u.y, u.z, -math::Vector3DotProduct(u, vrp),
-                                                  v_normalized.x, v_normalized.y, v_normalized.z, -math::Vector3DotProduct(v_normalized, vrp),
-                                                  n_normalized.x, n_normalized.y, n_normalized.z, -math::Vector3DotProduct(n_normalized, vrp),
-                                                  0, 0, 0, 1}});
-
-    return result;
-  }
-
-  /**
-   * @brief Obtém a matriz de projeção.
-   *
-   * A matriz de projeção obtida é dada por:
-   *
-   * | 1  0  0  0 |
-   * | 0  1  0  0 |
-   * | 0  0  -z_vp/dp  z_vp*z_prp/dp |
-   * | 0  0  -1/d  z_prp/dp |
-   *
-   * @param vrp Vetor de posição da câmera
-   * @param p Vetor 3D que representa o ponto focal da câmera
-   * @param d Distância do VRP ao plano ponto focal
-   * @return Matriz de projeção
-   */
-  core::Matrix pipeline_adair::projection(const core::Vector3 &vrp, const core::Vector3 p, const float d)
-  {
-
-    // This is the definitions of the projection plane.
-    core::Vector3 projection_plane = {
-        vrp.x + (p.x - vrp.x) * (d / (vrp.z - p.z)),
-        vrp.y + (p.y - vrp.y) * (d / (vrp.z - p.z)),
-        vrp.z + (p.z - vrp.z) * (d / (vrp.z - p.z))};
-
-    // The distance from the VRP to the projection plane.
-    float dp = d;
-    // The distance from the VRP to the focal point.
-    float z_vp = -dp;
-    // Z coordinate of the point, where the projection lines intersect the projection plane.
-    // In this case, the z_prp is 0. Because this point coincides with the origin of the SRC (0, 0, 0).
-    float z_prp = 0;
-
-    // core::Matrix result = core::Flota16ToMatrix({1, 0, 0, 0,
-    //                                              0, 1, 0, 0,
-    //                                              0, 0, 0, 0,
-    //                                              0, 0, 0, 1});
-    core::Matrix result = core::Flota16ToMatrix({1, 0, 0, 0,
-                                                 0, 1, 0, 0,
-                                                 0, 0, (-z_vp) / dp, z_vp * (z_prp) / dp,
-                                                 0, 0, -1 / d, z_prp / dp});
-
-    return result;
-  }
-
-  /**
-   * @brief Obtém a matriz de transformação de SRC para SRT.
-   *
-   * A matriz de transformação obtida é dada por:
-   *
-   * | (u_max - u_min)/(x_max - x_min)  0  0  -x_min *((u_max - u_min)/(x_max - x_min)) + u_min |
-   * | 0  (v_min - v_max)/(y_max - y_min)  0  y_min * ((v_max - v_min)/(y_max - y_min)) + v_max |
-   * | 0  0  1  0 |
-   * | 0  0  0  1 |
-   *
-   * @param min_window Vetor 2D que representa o canto inferior esquerdo da janela
-   * @param min_viewport Vetor 2D que representa o canto inferior esquerdo da viewport
-   * @param max_window Vetor 2D que representa o canto superior direito da janela
-   * @param max_viewport Vetor 2D que representa o canto superior direito da viewport
-   * @param reflected Flag que indica se a transformação é refletida
-   * @return Matriz de transformação de SRC para SRT
-   */
-  core::Matrix pipeline_adair::src_to_srt(const core::Vector2 min_window, const core::Vector2 min_viewport, const core::Vector2 max_window, const core::Vector2 max_viewport, bool reflected = false)
-  {
-    float u_min = min_viewport.x;
-    float u_max = max_viewport.x;
-    float v_min = min_viewport.y;
-    float v_max = max_viewport.y;
-
-    float x_min = min_window.x;
-    float x_max = max_window.x;
-    float y_min = min_window.y;
-    float y_max = max_window.y;
-
-    core::Matrix result;
-
-    if (reflected)
-    {
-      // | (u_max - u_min)/(x_max - x_min), 0, 0, -x_min *((u_max - u_min)/(x_max - x_min)) + u_min |\n
-      // | 0, (v_min - v_max)/(y_max - y_min), 0, y_min * ((v_max - v_min)/(y_max - y_min)) + v_max |\n
-      // | 0, 0, 1, 0 |\n
-      // | 0, 0, 0, 1 |
-      result = core::Flota16ToMatrix({(u_max - u_min) / (x_max - x_min), 0, 0, -x_min * ((u_max - u_min) / (x_max - x_min)) + u_min,
-                                      0, (v_min - v_max) / (y_max - y_min), 0, y_min * ((v_max - v_min) / (y_max - y_min)) + v_max,
-                                      0, 0, 1, 0,
-                                      0, 0, 0, 1});
-    }
-    else
-    {
-      // | (u_max - u_min)/(x_max - x_min), 0, 0, -x_min * ((u_max - u_min)/(x_max - x_min)) + u_min |\n
-      // | 0, (v_max - v_min)/(y_max - y_min), 0, -y_min * ((v_max - v_min)/(y_max - y_min)) + v_min) |\n
-      // | 0, 0, 1, 0 |\n
-      // | 0, 0, 0, 1 |
-      result = core::Flota16ToMatrix({(u_max - u_min) / (x_max - x_min), 0, 0, -x_min * ((u_max - u_min) / (x_max - x_min)) + u_min,
-                                      0, (v_max - v_min) / (y_max - y_min), 0, -y_min * ((v_max - v_min) / (y_max - y_min)) + v_min,
-                                      0, 0, 1, 0,
-                                      0, 0, 0, 1});
-    }
-
-    return result;
-  }
-
-  /**
-   * @brief Obtém a matriz de transformação de recorte.
-   *
-   * @param d Distância do VRP ao plano de projeção
-   * @param far Plano de projeção distante
-   * @param center_window Centro da janela
-   * @param size_window Tamanho da janela
-   *
-   * @note O tamanho da janela é metade da largura e metade da altura
-   *
-   * @return core::Matrix
-   */
-  core::Matrix pipeline_smith::clipping_transformation(const float d, const float far, const core::Vector2 center_window, const core::Vector2 size_window)
-  {
-    // cu = center window x
-    // cv = center window y
-    // su = size window x
-    // sv = size window y
-    // | d/(su*far) 0          -(cu/d*far) 0 |
-    // | 0          d/(sv*far) -(cv/d*far) 0 |
-    // | 0          0          1/far       0 |
-    // | 0          0          0           1 |
-
-    float cu = center_window.x;
-    float cv = center_window.y;
-    float su = size_window.x / 2;
-    float sv = size_window.y / 2;
-
-    // core::Matrix result = core::Flota16ToMatrix({d / (su * far), 0, (-(cu / d) * far), 0,
-    //                                              0, d / (sv * far), (-(cv / d) * far), 0,
-    //                                              0, 0, 1 / far, 0,
-    //                                              0, 0, 0, 1});
-
-    core::Matrix D = core::Flota16ToMatrix({1, 0, -cu / d, 0,
-                                            0, 1, -cv / d, 0,
-                                            0, 0, 1, 0,
-                                            0, 0, 0, 1});
-
-    core::Matrix E = core::Flota16ToMatrix({d / (su * far), 0, 0, 0,
-                                            0, d / (sv * far), 0, 0,
-                                            0, 0, 1 / far, 0,
-                                            0, 0, 0, 1});
-
-    core::Matrix result = math::MatrixMultiply(E, D);
-
-    return result;
-  }
-
-  /**
-   * @brief Obtém a matrix de transformação perspectiva
-   *
-   * @note A transformação de perspectiva opera diretamente no espaço 3D e transforma o frustum em um paralelepípedo canônico com lados paralelos e comprimento unitário.
-   *
-   * @param near Plano de projeção próximo
-   * @param far Plano de projeção distante
-   * @return core::Matrix
-   */
-  core::Matrix pipeline_smith::perspective_transformation(const float near, const float far)
-  {
-    // Obs.: A transformação de perspectiva é feita através das seguintes operações:
-    // Translada z_min para a origem => F
-    // Escala o volume canônico em z para que o plano traseiro (far) coincida com z = 1 => G
-    // Realiza a transformação de perspectiva => H
-    // A matriz resultante I é igual à H * G * F
-
-    float z_min = near / far;
-
-    core::Matrix F = math::MatrixTranslate({0.0f, 0.0f, -z_min});
-
-    core::Matrix G = math::MatrixScale({1.0f, 1.0f, 1.0f / (1 - z_min)});
-
-    core::Matrix H = core::Flota16ToMatrix({1, 0, 0, 0,
-                                            0, 1, 0, 0,
-                                            0, 0, 1, 0,
-                                            0, 0, (1 - z_min) / z_min, 0});
-
-    core::Matrix result = math::MatrixMultiply(H, G);
-    result = math::MatrixMultiply(result, F);
-
-    float inv_z_min = 1 / z_min;
-
-    // multiplicar as 3 primeira linhas da matriz I por 1/z_min.
-    // Leva o tronco da piramide no prisma com dimensões 2*z_min em x, y e em z_min em z.
-    // linha 1
-    result.m0 *= inv_z_min;
-    result.m4 *= inv_z_min;
-    result.m8 *= inv_z_min;
-    result.m12 *= inv_z_min;
-    // linha 2
-    result.m1 *= inv_z_min;
-    result.m5 *= inv_z_min;
-    result.m9 *= inv_z_min;
-    result.m13 *= inv_z_min;
-    // linha 3
-    result.m2 *= inv_z_min;
-    result.m6 *= inv_z_min;
-    result.m10 *= inv_z_min;
-    result.m14 *= inv_z_min;
-
-    // multiplicar a matriz pelo escalar z_min
-    // Faz a projeção perspectiva levando o VRP para o infinito.
-    // A projeção passa a ser uma proj. paralela ortográfica ao ignorar a coordenada z.
-    result = math::MatrixMultiplyValue(result, z_min);
-
-    return result;
-  }
-
-  core::Matrix pipeline_smith::src_to_srt(const core::Vector2 min_viewport, const core::Vector2 max_viewport, const float near, const float far)
-  {
-
-    core::Matrix K = core::Flota16ToMatrix({0.5f, 0.0f, 0.0f, 0.5f,
-                                            0.0f, 0.5f, 0.0f, 0.5f,
-                                            0.0f, 0.0f, 1.0f, 0.0f,
-                                            0.0f, 0.0f, 0.0f, 1.0f});
-    float dx = max_viewport.x - min_viewport.x;
-    float dy = max_viewport.y - min_viewport.y;
-    float dz = far - near;
-
-    core::Matrix L = core::Flota16ToMatrix({dx, 0, 0, min_viewport.x,
-                                            0, dy, 0, min_viewport.y,
-                                            0, 0, dz, near,
-                                            0, 0, 0, 1});
-
-    core::Matrix M = core::Flota16ToMatrix({1, 0, 0, 0.5f,
-                                            0, 1, 0, 0.5f,
-                                            0, 0, 1, 0.5f,
-                                            0, 0, 0, 1});
-
-    core::Matrix result = math::MatrixMultiply(M, L);
-    result = math::MatrixMultiply(result, K);
-
-    return result;
-  }
-
   //-------------------------------------------------------------------------------------------------
   // Clipagem de Clipping (Clipagem de Linha)
   //-------------------------------------------------------------------------------------------------
@@ -516,16 +230,11 @@ namespace math
   }
 
   /**
-   * @brief Clipa um polígono 2D
-   *
-   * @param polygon Lista de vértices do polígono percorridos no sentido anti-horário
-   * @param min Limite inferior esquerdo da janela de recorte
-   * @param max Limite superior direito da janela de recorte
-   * @return std::vector<core::Vector3> Lista de vértices do polígono clipado
+   * @brief Corpo de clip2D_polygon (pontos), expandido em cada variante do conjunto de instruções
    *
-   * @note O algoritmo de Sutherland-Hodgman é utilizado
+   * @note Os parâmetros e o retorno são os de clip2D_polygon
    */
-  std::vector<core::Vector3> clip2D_polygon(const std::vector<core::Vector3> &polygon, const core::Vector2 &min, const core::Vector2 &max)
+  static ISA_KERNEL std::vector<core::Vector3> clip2D_polygon_kernel(const std::vector<core::Vector3> &polygon, const core::Vector2 &min, const core::Vector2 &max)
   {
     std::vector<core::Vector3> result = polygon;
 
@@ -577,18 +286,29 @@ namespace math
     return result;
   }
 
+  ISA_VARIANTS(clip2D_polygon_points, clip2D_polygon_kernel, (const std::vector<core::Vector3> &polygon, const core::Vector2 &min, const core::Vector2 &max), (polygon, min, max))
+
   /**
    * @brief Clipa um polígono 2D
    *
-   * @param polygon Lista de vértices do polígono percorridos no sentido anti-horário (coordenadas e normal/cor)
+   * @param polygon Lista de vértices do polígono percorridos no sentido anti-horário
    * @param min Limite inferior esquerdo da janela de recorte
    * @param max Limite superior direito da janela de recorte
-   * @return std::vector<std::pair<core::Vector3, core::Vector3>> Lista de vértices e normal/cor do polígono clipado
+   * @return std::vector<core::Vector3> Lista de vértices do polígono clipado
    *
    * @note O algoritmo de Sutherland-Hodgman é utilizado
-   * @note Refatorar para utilizar a mesma função de clipagem dos polígonos 2D
    */
-  std::vector<std::pair<core::Vector3, core::Vector3>> clip2D_polygon(const std::vector<std::pair<core::Vector3, core::Vector3>> &polygon, const core::Vector2 &min, const core::Vector2 &max)
+  std::vector<core::Vector3> clip2D_polygon(const std::vector<core::Vector3> &polygon, const core::Vector2 &min, const core::Vector2 &max)
+  {
+    return ISA_DISPATCH(clip2D_polygon_points)(polygon, min, max);
+  }
+
+  /**
+   * @brief Corpo de clip2D_polygon (vértices e atributos), expandido em cada variante do conjunto de instruções
+   *
+   * @note Os parâmetros e o retorno são os de clip2D_polygon
+   */
+  static ISA_KERNEL std::vector<std::pair<core::Vector3, core::Vector3>> clip2D_polygon_kernel(const std::vector<std::pair<core::Vector3, core::Vector3>> &polygon, const core::Vector2 &min, const core::Vector2 &max)
   {
     std::vector<std::pair<core::Vector3, core::Vector3>> result = polygon;
 
@@ -640,15 +360,30 @@ namespace math
     return result;
   }
 
+  ISA_VARIANTS(clip2D_polygon_attributes, clip2D_polygon_kernel, (const std::vector<std::pair<core::Vector3, core::Vector3>> &polygon, const core::Vector2 &min, const core::Vector2 &max), (polygon, min, max))
+
   /**
-   * @brief Clipa um polígono 3D
+   * @brief Clipa um polígono 2D
    *
    * @param polygon Lista de vértices do polígono percorridos no sentido anti-horário (coordenadas e normal/cor)
-   * @return std::vector<std::pair<core::Vector4, core::Vector3>> Lista de vértices e normal/cor do polígono clipado
+   * @param min Limite inferior esquerdo da janela de recorte
+   * @param max Limite superior direito da janela de recorte
+   * @return std::vector<std::pair<core::Vector3, core::Vector3>> Lista de vértices e normal/cor do polígono clipado
    *
    * @note O algoritmo de Sutherland-Hodgman é utilizado
+   * @note Refatorar para utilizar a mesma função de clipagem dos polígonos 2D
    */
-  std::vector<std::pair<core::Vector4, core::Vector3>> clip3D_polygon(const std::vector<std::pair<core::Vector4, core::Vector3>> &polygon)
+  std::vector<std::pair<core::Vector3, core::Vector3>> clip2D_polygon(const std::vector<std::pair<core::Vector3, core::Vector3>> &polygon, const core::Vector2 &min, const core::Vector2 &max)
+  {
+    return ISA_DISPATCH(clip2D_polygon_attributes)(polygon, min, max);
+  }
+
+  /**
+   * @brief Corpo de clip3D_polygon, expandido em cada variante do conjunto de instruções
+   *
+   * @note Os parâmetros e o retorno são os de clip3D_polygon
+   */
+  static ISA_KERNEL std::vector<std::pair<core::Vector4, core::Vector3>> clip3D_polygon_kernel(const std::vector<std::pair<core::Vector4, core::Vector3>> &polygon)
   {
     // Define volume de recorte fixo (coordenadas normalizadas)
     const core::Vector3 min = {-1, -1, 0.01f};
@@ -721,6 +456,55 @@ namespace math
     return result; // Retorna o polígono clipado
   }
 
+  ISA_VARIANTS(clip3D_polygon, clip3D_polygon_kernel, (const std::vector<std::pair<core::Vector4, core::Vector3>> &polygon), (polygon))
+
+  /**
+   * @brief Clipa um polígono 3D
+   *
+   * @param polygon Lista de vértices do polígono percorridos no sentido anti-horário (coordenadas e normal/cor)
+   * @return std::vector<std::pair<core::Vector4, core::Vector3>> Lista de vértices e normal/cor do polígono clipado
+   *
+   * @note O algoritmo de Sutherland-Hodgman é utilizado
+   */
+  std::vector<std::pair<core::Vector4, core::Vector3>> clip3D_polygon(const std::vector<std::pair<core::Vector4, core::Vector3>> &polygon)
+  {
+    return ISA_DISPATCH(clip3D_polygon)(polygon);
+  }
+
+  //-------------------------------------------------------------------------------------------------
+  // Transformação de Vértices
+  //-------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Corpo de project_vertices, expandido em cada variante do conjunto de instruções
+   *
+   * @note Os parâmetros são os de project_vertices
+   */
+  static ISA_KERNEL void project_vertices_kernel(const core::Matrix &transformation, const core::Vector4 *vertices, core::Vector3 *result, size_t count)
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      core::Vector4 vector = math::MatrixMultiplyVector(transformation, vertices[i]);
+
+      result[i] = {vector.x / vector.w, vector.y / vector.w, vector.z};
+    }
+  }
+
+  ISA_VARIANTS(project_vertices, project_vertices_kernel, (const core::Matrix &transformation, const core::Vector4 *vertices, core::Vector3 *result, size_t count), (transformation, vertices, result, count))
+
+  /**
+   * @brief Transforma um bloco de vértices para as coordenadas de tela (divisão perspectiva em x e y)
+   *
+   * @param transformation Matriz de transformação (SRU para SRT)
+   * @param vertices Vértices no SRU
+   * @param result Coordenadas de tela de cada vértice (x / w, y / w, z)
+   * @param count Quantidade de vértices
+   */
+  void project_vertices(const core::Matrix &transformation, const core::Vector4 *vertices, core::Vector3 *result, size_t count)
+  {
+    ISA_DISPATCH(project_vertices)(transformation, vertices, result, count);
+  }
+
   //-------------------------------------------------------------------------------------------------
   // Funções de Preenchimento de Polígonos e Desenho de Linhas
   //-------------------------------------------------------------------------------------------------
@@ -785,25 +569,48 @@ namespace math
   }
 
   /**
-   * @brief Preenche um polígono com sombreamento flat
-   *
-   * @param vertexes Vertices da face do polígono
-   * @param color Cor do polígono
-   * @param global_light Luz global
-   * @param omni_lights Luzes omni
-   * @param eye Posição do observador
-   * @param face_centroid Centroide da face
-   * @param face_normal Vetor normal da face
-   * @param object_material Material do objeto
-   * @param z_buffer Buffer de profundidade
-   * @param color_buffer Buffer de cores
-   * @param max_window_size Tamanho máximo da janela
+   * @brief Corpo de z_buffer, expandido nos kernels de rasterização para que o teste de profundidade de
+   * cada pixel rode na variante do conjunto de instruções do kernel
    *
+   * @note Os parâmetros e o retorno são os de z_buffer
    */
-  void fill_polygon_flat_shading(const std::vector<core::Vector3> &vertexes, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, const core::Vector3 &eye, const core::Vector3 &face_centroid, const core::Vector3 &face_normal, const models::Material &object_material, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer, core::Vector2 max_window_size)
+  static ISA_KERNEL int z_buffer_kernel(const float x, const float y, const float z, const models::ColorFloat &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity)
   {
-    models::Color color = models::FlatShading(global_light, omni_lights, face_centroid, face_normal, eye, object_material);
+    // Arredondamento para o pixel mais próximo
+    int x_int = static_cast<int>(x);
+    int y_int = static_cast<int>(y);
+
+    if (x_int < 0 || x_int >= z_buffer.size() || y_int < 0 || y_int >= z_buffer[0].size())
+      return DEPTH_TEST_SKIPPED;
+
+    if (x_int < scissor.x || x_int > scissor.z || y_int < scissor.y || y_int > scissor.w)
+      return DEPTH_TEST_SKIPPED;
+
+    math::DepthComplexity *counts = depth_complexity != nullptr ? &(*depth_complexity)[x_int][y_int] : nullptr;
+
+    if (counts != nullptr)
+      counts->tests++;
+
+    // Se o pixel atual estiver mais distante que o pixel já desenhado, não atualiza os buffers
+    if (z_buffer[x_int][y_int] < z)
+      return DEPTH_TEST_FAILED;
+
+    z_buffer[x_int][y_int] = z;
+    color_buffer[x_int][y_int] = color;
+
+    if (counts != nullptr)
+      counts->passes++;
 
+    return DEPTH_TEST_PASSED;
+  }
+
+  /**
+   * @brief Corpo de fill_polygon_flat_shading, expandido em cada variante do conjunto de instruções
+   *
+   * @note Os parâmetros são os de fill_polygon_flat_shading
+   */
+  static ISA_KERNEL void fill_polygon_flat_shading_kernel(const std::vector<core::Vector3> &vertexes, const models::ColorFloat &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, core::Vector2 max_window_size, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity)
+  {
     int y_min = std::numeric_limits<int>::max();
     int y_max = std::numeric_limits<int>::min();
 
@@ -849,8 +656,14 @@ namespace math
       }
     }
 
+    // Quantidade de pixels por resultado do teste de profundidade
+    int tested[3] = {0, 0, 0};
+
     for (auto scanline : scanlines)
     {
+      if (scanline.empty() || scanline[0].y < scissor.y || scanline[0].y > scissor.w)
+        continue;
+
       std::sort(scanline.begin(), scanline.end(), [](core::Vector3 a, core::Vector3 b)
                 { return a.x < b.x; });
 
@@ -866,25 +679,47 @@ namespace math
         for (float x = ceilf(start.x); x <= floorf(end.x); x++)
         {
 
-          math::z_buffer(x, start.y, z, color, z_buffer, color_buffer);
+          tested[z_buffer_kernel(x, start.y, z, color, z_buffer, color_buffer, scissor, depth_complexity)]++;
           z += mz;
         }
       }
     }
+
+    MRX_PROFILE_CALLS(PROFILE_DEPTH_TEST, tested[DEPTH_TEST_FAILED] + tested[DEPTH_TEST_PASSED]);
+    MRX_PROFILE_COUNT(PROFILE_PIXELS_SHADED, tested[DEPTH_TEST_PASSED]);
+    MRX_PROFILE_COUNT(PROFILE_PIXELS_REJECTED, tested[DEPTH_TEST_FAILED]);
   }
 
+  ISA_VARIANTS(fill_polygon_flat_shading, fill_polygon_flat_shading_kernel, (const std::vector<core::Vector3> &vertexes, const models::ColorFloat &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, core::Vector2 max_window_size, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity), (vertexes, color, z_buffer, color_buffer, max_window_size, scissor, depth_complexity))
+
   /**
-   * @brief Preenche um polígono com sombreamento de Gourand
+   * @brief Preenche um polígono com sombreamento flat
    *
    * @param vertexes Vertices da face do polígono
+   * @param color Cor do polígono
    * @param z_buffer Buffer de profundidade
    * @param color_buffer Buffer de cores
+   * @param max_window_size Tamanho máximo da janela
+   * @param scissor Retângulo de recorte (min x, min y, max x, max y), os pixels fora dele são ignorados
+   * @param depth_complexity Contagem dos testes de profundidade por pixel (ver z_buffer), pode ser nulo
    *
+   * @note As linhas e colunas seguem a mesma interpolação com ou sem recorte, então os pixels dentro
+   * do retângulo são idênticos aos de um preenchimento completo
    */
-  void fill_polygon_gourand(const std::vector<std::pair<core::Vector3, models::Color>> &_vertexes, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer)
+  void fill_polygon_flat_shading(const std::vector<core::Vector3> &vertexes, const models::ColorFloat &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, core::Vector2 max_window_size, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity)
+  {
+    ISA_DISPATCH(fill_polygon_flat_shading)(vertexes, color, z_buffer, color_buffer, max_window_size, scissor, depth_complexity);
+  }
+
+  /**
+   * @brief Corpo de fill_polygon_gourand, expandido em cada variante do conjunto de instruções
+   *
+   * @note Os parâmetros são os de fill_polygon_gourand
+   */
+  static ISA_KERNEL void fill_polygon_gourand_kernel(const std::vector<std::pair<core::Vector3, models::ColorFloat>> &_vertexes, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity)
   {
     // Usando para associar cada vértice com sua cor calculada
-    std::vector<std::pair<core::Vector3, models::Color>> vertexes = _vertexes;
+    std::vector<std::pair<core::Vector3, models::ColorFloat>> vertexes = _vertexes;
 
     int y_min = std::numeric_limits<int>::max();
     int y_max = std::numeric_limits<int>::min();
@@ -901,7 +736,7 @@ namespace math
     // Vetor de scanlines
     // 1º parâmetro do par: vetor de coordenadas SRT (coordenadas de tela)
     // 2º parâmetro do par: cor do pixel
-    std::vector<std::vector<std::pair<core::Vector3, models::Color>>> scanlines(y_max - y_min);
+    std::vector<std::vector<std::pair<core::Vector3, models::ColorFloat>>> scanlines(y_max - y_min);
 
     // Como a lista de vertices é composta pelo inicio e fim da aresta, o incremento é de 2
     for (int i = 0; i < vertexes.size(); i++)
@@ -911,8 +746,8 @@ namespace math
       core::Vector3 start = vertexes[i].first;
       core::Vector3 end = vertexes[k].first;
 
-      models::Color start_color = vertexes[i].second;
-      models::Color end_color = vertexes[k].second;
+      models::ColorFloat start_color = vertexes[i].second;
+      models::ColorFloat end_color = vertexes[k].second;
 
       // Se a linha for horizontal, não faz nada
       if (start.y == end.y)
@@ -943,7 +778,7 @@ namespace math
       for (int y = static_cast<int>(start.y); y < static_cast<int>(end.y); y++)
       {
 
-        scanlines[y - y_min].push_back(std::make_pair<core::Vector3, models::Color>({x, static_cast<float>(y), z}, {models::ChannelsToColor({r, g, b})}));
+        scanlines[y - y_min].push_back(std::make_pair<core::Vector3, models::ColorFloat>({x, static_cast<float>(y), z}, {r, g, b, start_color.a}));
         x += m_inv;
         z += dz;
 
@@ -953,10 +788,16 @@ namespace math
       }
     }
 
+    // Quantidade de pixels por resultado do teste de profundidade
+    int tested[3] = {0, 0, 0};
+
     for (int i = 0; i < scanlines.size(); i++)
     {
+      if (y_min + i < scissor.y || y_min + i > scissor.w)
+        continue;
+
       std::sort(scanlines[i].begin(), scanlines[i].end(),
-                [](std::pair<core::Vector3, models::Color> a, std::pair<core::Vector3, models::Color> b)
+                [](std::pair<core::Vector3, models::ColorFloat> a, std::pair<core::Vector3, models::ColorFloat> b)
                 { return a.first.x < b.first.x; });
 
       for (int j = 0; j < scanlines[i].size(); j = j + 2)
@@ -965,8 +806,8 @@ namespace math
         core::Vector3 start = scanlines[i][j].first;
         core::Vector3 end = scanlines[i][j + 1].first;
 
-        models::Color start_color = scanlines[i][j].second;
-        models::Color end_color = scanlines[i][j + 1].second;
+        models::ColorFloat start_color = scanlines[i][j].second;
+        models::ColorFloat end_color = scanlines[i][j + 1].second;
 
         float dx = end.x - start.x;
 
@@ -983,9 +824,9 @@ namespace math
 
         for (float x = ceilf(start.x); x <= floorf(end.x); x++)
         {
-          models::Color current_color = models::ChannelsToColor({r, g, b});
+          models::ColorFloat current_color = {r, g, b, start_color.a};
 
-          math::z_buffer(x, start.y, z, current_color, z_buffer, color_buffer);
+          tested[z_buffer_kernel(x, start.y, z, current_color, z_buffer, color_buffer, scissor, depth_complexity)]++;
           z += dz;
           r += dr;
           g += dg;
@@ -993,20 +834,35 @@ namespace math
         }
       }
     }
+
+    MRX_PROFILE_CALLS(PROFILE_DEPTH_TEST, tested[DEPTH_TEST_FAILED] + tested[DEPTH_TEST_PASSED]);
+    MRX_PROFILE_COUNT(PROFILE_PIXELS_SHADED, tested[DEPTH_TEST_PASSED]);
+    MRX_PROFILE_COUNT(PROFILE_PIXELS_REJECTED, tested[DEPTH_TEST_FAILED]);
   }
 
+  ISA_VARIANTS(fill_polygon_gourand, fill_polygon_gourand_kernel, (const std::vector<std::pair<core::Vector3, models::ColorFloat>> &_vertexes, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity), (_vertexes, z_buffer, color_buffer, scissor, depth_complexity))
+
   /**
-   * @brief Preenche um polígono com sombreamento de Phong
+   * @brief Preenche um polígono com sombreamento de Gourand
    *
-   * @param _vertexes Lista de vertices e normais dos vertices
-   * @param global_light Luz ambiente global
-   * @param omni_lights Lista de luzes omnidirecionais
-   * @param eye Posição do observador
-   * @param object_material Material do objeto
+   * @param vertexes Vertices da face do polígono
    * @param z_buffer Buffer de profundidade
    * @param color_buffer Buffer de cores
+   * @param scissor Retângulo de recorte (ver fill_polygon_flat_shading)
+   * @param depth_complexity Contagem dos testes de profundidade por pixel (ver z_buffer), pode ser nulo
    */
-  void fill_polygon_phong(const std::vector<std::pair<core::Vector3, core::Vector3>> &_vertexes, const core::Vector3 &centroid, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, const core::Vector3 &eye, const models::Material &object_material, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer)
+  void fill_polygon_gourand(const std::vector<std::pair<core::Vector3, models::ColorFloat>> &_vertexes, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity)
+  {
+    ISA_DISPATCH(fill_polygon_gourand)(_vertexes, z_buffer, color_buffer, scissor, depth_complexity);
+  }
+
+  /**
+   * @brief Corpo de fill_polygon_phong, expandido em cada variante do conjunto de instruções
+   *
+   * @note Os parâmetros são os de fill_polygon_phong
+   */
+  template <typename Precision>
+  static ISA_KERNEL void fill_polygon_phong_kernel(const std::vector<std::pair<core::Vector3, core::Vector3>> &_vertexes, const std::vector<core::Vector3> &positions, const core::Vector3 &centroid, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, const models::LightTiles &light_tiles, const core::Vector3 &eye, const models::Material &object_material, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity)
   {
     int y_min = std::numeric_limits<int>::max();
     int y_max = std::numeric_limits<int>::min();
@@ -1021,9 +877,12 @@ namespace math
     }
 
     // Vetor de scanlines
-    // 1º parâmetro do par: vetor de coordenadas SRT (coordenadas de tela)
-    // 2º parâmetro do par: vetor normal do pixel (interpolado)
-    std::vector<std::vector<std::tuple<core::Vector3, core::Vector3>>> scanlines(y_max - y_min);
+    // 1º parâmetro da tupla: vetor de coordenadas SRT (coordenadas de tela)
+    // 2º parâmetro da tupla: vetor normal do pixel (interpolado)
+    // 3º parâmetro da tupla: posição do pixel no SRU (interpolada)
+    std::vector<std::vector<std::tuple<core::Vector3, core::Vector3, core::Vector3>>> scanlines(y_max - y_min);
+
+    bool has_positions = positions.size() == _vertexes.size();
 
     for (int l = 0; l < _vertexes.size(); l++)
     {
@@ -1034,6 +893,9 @@ namespace math
       core::Vector3 start_normal = _vertexes[l].second;
       core::Vector3 end_normal = _vertexes[m].second;
 
+      core::Vector3 start_position = has_positions ? positions[l] : centroid;
+      core::Vector3 end_position = has_positions ? positions[m] : centroid;
+
       // Se a linha for horizontal, não faz nada
       if (start.y == end.y)
         continue;
@@ -1042,6 +904,7 @@ namespace math
       {
         std::swap(start, end);
         std::swap(start_normal, end_normal);
+        std::swap(start_position, end_position);
       }
 
       float dy = end.y - start.y;
@@ -1070,22 +933,33 @@ namespace math
       float j = start_normal.y;
       float k = start_normal.z;
 
+      // taxa de variação da posição (SRU) em relação ao y
+      core::Vector3 t_p = math::Vector3DivideValue(math::Vector3Subtract(end_position, start_position), dy);
+      core::Vector3 p = start_position;
+
       for (int y = static_cast<int>(start.y); y < static_cast<int>(end.y); y++)
       {
-        scanlines[y - y_min].push_back(std::make_tuple<core::Vector3, core::Vector3>({x, static_cast<float>(y), z}, {i, j, k}));
+        scanlines[y - y_min].push_back(std::make_tuple<core::Vector3, core::Vector3, core::Vector3>({x, static_cast<float>(y), z}, {i, j, k}, core::Vector3(p)));
         // incrementa com as taxas de variação (interpolação linear)
         x += t_x;
         z += t_z;
         i += t_i;
         j += t_j;
         k += t_k;
+        p = math::Vector3Add(p, t_p);
       }
     }
 
+    // Quantidade de pixels por resultado do teste de profundidade
+    int tested[3] = {0, 0, 0};
+
     for (int row = 0; row < scanlines.size(); row++)
     {
+      if (y_min + row < scissor.y || y_min + row > scissor.w)
+        continue;
+
       std::sort(scanlines[row].begin(), scanlines[row].end(),
-                [](std::tuple<core::Vector3, core::Vector3> a, std::tuple<core::Vector3, core::Vector3> b)
+                [](const std::tuple<core::Vector3, core::Vector3, core::Vector3> &a, const std::tuple<core::Vector3, core::Vector3, core::Vector3> &b)
                 { return std::get<0>(a).x < std::get<0>(b).x; });
 
       for (int col = 0; col < scanlines[row].size(); col += 2)
@@ -1108,46 +982,199 @@ namespace math
         float j = start_normal.y;
         float k = start_normal.z;
 
+        core::Vector3 start_position = std::get<2>(scanlines[row][col]);
+        core::Vector3 dp = math::Vector3DivideValue(math::Vector3Subtract(std::get<2>(scanlines[row][col + 1]), start_position), dx);
+        core::Vector3 p = start_position;
+
+        // Luzes do bloco da tela do pixel, buscadas apenas quando o pixel entra em outro bloco
+        const std::vector<unsigned int> *lights = nullptr;
+        float tile_end = 0.0f;
+
         for (float x = ceilf(start.x); x <= floorf(end.x); x++)
         {
-          core::Vector3 v = {x, start.y, z};
           core::Vector3 n = {i, j, k};
 
-          models::Color color = models::PhongShading(global_light, omni_lights, centroid, std::make_pair(v, n), eye, object_material);
-          math::z_buffer(x, start.y, z, color, z_buffer, color_buffer);
+          // Fora do recorte a cor não é calculada, mas a interpolação continua
+          if (x < scissor.x || x > scissor.z)
+          {
+            z += dz;
+            i += dn_i;
+            j += dn_j;
+            k += dn_k;
+            p = math::Vector3Add(p, dp);
+            continue;
+          }
+
+          if (lights == nullptr || x >= tile_end)
+          {
+            float tile_size = static_cast<float>(light_tiles.tile_size);
+
+            lights = &models::GetTileLights(light_tiles, x, start.y);
+            tile_end = (floorf(x / tile_size) + 1.0f) * tile_size;
+          }
+
+          models::ColorFloat color = models::PhongIlluminationLights<Precision>(global_light, omni_lights, lights, centroid, p, n, eye, object_material);
+          tested[z_buffer_kernel(x, start.y, z, color, z_buffer, color_buffer, NO_SCISSOR, depth_complexity)]++;
           z += dz;
           i += dn_i;
           j += dn_j;
           k += dn_k;
+          p = math::Vector3Add(p, dp);
         }
       }
     }
+
+    MRX_PROFILE_CALLS(PROFILE_DEPTH_TEST, tested[DEPTH_TEST_FAILED] + tested[DEPTH_TEST_PASSED]);
+    MRX_PROFILE_COUNT(PROFILE_PIXELS_SHADED, tested[DEPTH_TEST_PASSED]);
+    MRX_PROFILE_COUNT(PROFILE_PIXELS_REJECTED, tested[DEPTH_TEST_FAILED]);
   }
 
+  ISA_TEMPLATE_VARIANTS(fill_polygon_phong, fill_polygon_phong_kernel, (const std::vector<std::pair<core::Vector3, core::Vector3>> &_vertexes, const std::vector<core::Vector3> &positions, const core::Vector3 &centroid, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, const models::LightTiles &light_tiles, const core::Vector3 &eye, const models::Material &object_material, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity), (_vertexes, positions, centroid, global_light, omni_lights, light_tiles, eye, object_material, z_buffer, color_buffer, scissor, depth_complexity))
+
   /**
-   * @brief Atualiza o buffer de profundidade
+   * @brief Preenche um polígono com sombreamento de Phong
    *
-   * @param z Profundidade do pixel
-   * @param color Cor do pixel
+   * @tparam Precision Política de precisão da iluminação (math::Exact ou math::Fast)
+   * @param _vertexes Lista de vertices e normais dos vertices
+   * @param positions Posição (SRU) de cada vértice, usada na atenuação e nas sombras (vazio = centroide)
+   * @param centroid Centroide do objeto
+   * @param global_light Luz ambiente global
+   * @param omni_lights Lista de luzes omnidirecionais
+   * @param light_tiles Listas de luzes omni por bloco da tela, cada pixel usa a lista do seu bloco
+   * @param eye Posição do observador
+   * @param object_material Material do objeto
    * @param z_buffer Buffer de profundidade
    * @param color_buffer Buffer de cores
-   * @param window_size Tamanho da janela
+   * @param scissor Retângulo de recorte (ver fill_polygon_flat_shading)
+   * @param depth_complexity Contagem dos testes de profundidade por pixel (ver z_buffer), pode ser nulo
    */
-  void z_buffer(const float x, const float y, const float z, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer)
+  template <typename Precision>
+  void fill_polygon_phong(const std::vector<std::pair<core::Vector3, core::Vector3>> &_vertexes, const std::vector<core::Vector3> &positions, const core::Vector3 &centroid, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, const models::LightTiles &light_tiles, const core::Vector3 &eye, const models::Material &object_material, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity)
   {
-    // Arredondamento para o pixel mais próximo
-    int x_int = static_cast<int>(x);
-    int y_int = static_cast<int>(y);
+    ISA_TEMPLATE_DISPATCH(fill_polygon_phong, Precision)(_vertexes, positions, centroid, global_light, omni_lights, light_tiles, eye, object_material, z_buffer, color_buffer, scissor, depth_complexity);
+  }
 
-    if (x_int < 0 || x_int >= z_buffer.size() || y_int < 0 || y_int >= z_buffer[0].size())
+  template void fill_polygon_phong<math::Exact>(const std::vector<std::pair<core::Vector3, core::Vector3>> &, const std::vector<core::Vector3> &, const core::Vector3 &, const models::Light &, const std::vector<models::Omni> &, const models::LightTiles &, const core::Vector3 &, const models::Material &, std::vector<std::vector<float>> &, std::vector<std::vector<models::ColorFloat>> &, const core::Vector4 &, math::DepthComplexityBuffer *);
+  template void fill_polygon_phong<math::Fast>(const std::vector<std::pair<core::Vector3, core::Vector3>> &, const std::vector<core::Vector3> &, const core::Vector3 &, const models::Light &, const std::vector<models::Omni> &, const models::LightTiles &, const core::Vector3 &, const models::Material &, std::vector<std::vector<float>> &, std::vector<std::vector<models::ColorFloat>> &, const core::Vector4 &, math::DepthComplexityBuffer *);
+
+  /**
+   * @brief Corpo de fill_polygon_depth, expandido em cada variante do conjunto de instruções
+   *
+   * @note Os parâmetros são os de fill_polygon_depth
+   */
+  static ISA_KERNEL void fill_polygon_depth_kernel(const std::vector<core::Vector3> &vertexes, std::vector<std::vector<float>> &z_buffer)
+  {
+    if (vertexes.size() < 3 || z_buffer.empty())
       return;
 
-    // Se o pixel atual estiver mais distante que o pixel já desenhado, não atualiza os buffers
-    if (z_buffer[x_int][y_int] < z)
+    int width = static_cast<int>(z_buffer.size());
+    int height = static_cast<int>(z_buffer[0].size());
+
+    int y_min = std::numeric_limits<int>::max();
+    int y_max = std::numeric_limits<int>::min();
+
+    for (const auto &vertex : vertexes)
+    {
+      y_min = std::min(y_min, static_cast<int>(vertex.y));
+      y_max = std::max(y_max, static_cast<int>(vertex.y));
+    }
+
+    y_min = std::max(y_min, 0);
+    y_max = std::min(y_max, height);
+
+    if (y_min >= y_max)
       return;
 
-    z_buffer[x_int][y_int] = z;
-    color_buffer[x_int][y_int] = color;
+    // A última linha do polígono, quando está dentro do buffer, também é preenchida (ex.: a borda do mapa de sombra)
+    bool last_row = y_max < height;
+
+    // x e profundidade das interseções de cada scanline com as arestas
+    std::vector<std::vector<std::pair<float, float>>> scanlines(y_max - y_min + (last_row ? 1 : 0));
+
+    for (size_t i = 0; i < vertexes.size(); i++)
+    {
+      core::Vector3 start = vertexes[i];
+      core::Vector3 end = vertexes[(i + 1) % vertexes.size()];
+
+      if (start.y == end.y)
+        continue;
+
+      if (start.y > end.y)
+        std::swap(start, end);
+
+      float m_inv = (end.x - start.x) / (end.y - start.y);
+      float mz = (end.z - start.z) / (end.y - start.y);
+
+      for (int y = std::max(static_cast<int>(start.y), y_min); y < std::min(static_cast<int>(end.y), y_max); y++)
+      {
+        float dy = static_cast<float>(y - static_cast<int>(start.y));
+        scanlines[y - y_min].push_back(std::make_pair(start.x + m_inv * dy, start.z + mz * dy));
+      }
+
+      // As arestas que chegam na última linha contribuem com o seu vértice final, sempre em pares
+      if (last_row && static_cast<int>(end.y) == y_max && static_cast<int>(start.y) < y_max)
+        scanlines[y_max - y_min].push_back(std::make_pair(end.x, end.z));
+    }
+
+    for (size_t row = 0; row < scanlines.size(); row++)
+    {
+      std::vector<std::pair<float, float>> &scanline = scanlines[row];
+      std::sort(scanline.begin(), scanline.end());
+
+      int y = y_min + static_cast<int>(row);
+
+      for (size_t j = 0; j + 1 < scanline.size(); j += 2)
+      {
+        float start_x = scanline[j].first;
+        float end_x = scanline[j + 1].first;
+
+        float mz = end_x != start_x ? (scanline[j + 1].second - scanline[j].second) / (end_x - start_x) : 0.0f;
+
+        int x_begin = std::max(static_cast<int>(ceilf(start_x)), 0);
+        int x_end = std::min(static_cast<int>(floorf(end_x)), width - 1);
+
+        for (int x = x_begin; x <= x_end; x++)
+        {
+          float z = scanline[j].second + (static_cast<float>(x) - start_x) * mz;
+
+          if (z < z_buffer[x][y])
+            z_buffer[x][y] = z;
+        }
+      }
+    }
+  }
+
+  ISA_VARIANTS(fill_polygon_depth, fill_polygon_depth_kernel, (const std::vector<core::Vector3> &vertexes, std::vector<std::vector<float>> &z_buffer), (vertexes, z_buffer))
+
+  /**
+   * @brief Preenche apenas o buffer de profundidade de um polígono (usado nos mapas de sombra)
+   *
+   * @param vertexes Vertices do polígono (x, y = pixel, z = profundidade)
+   * @param z_buffer Buffer de profundidade, mantém o menor valor de cada pixel
+   *
+   * @note As linhas e colunas fora do buffer são ignoradas
+   * @note A última linha e a última coluna do polígono são preenchidas, então um polígono que cobre
+   * [0, tamanho - 1] preenche o buffer inteiro
+   */
+  void fill_polygon_depth(const std::vector<core::Vector3> &vertexes, std::vector<std::vector<float>> &z_buffer)
+  {
+    ISA_DISPATCH(fill_polygon_depth)(vertexes, z_buffer);
+  }
+
+  /**
+   * @brief Atualiza o buffer de profundidade
+   *
+   * @param z Profundidade do pixel
+   * @param color Cor do pixel
+   * @param z_buffer Buffer de profundidade
+   * @param color_buffer Buffer de cores
+   * @param scissor Retângulo de recorte (min x, min y, max x, max y), os pixels fora dele são ignorados
+   * @param depth_complexity Se não for nulo, conta os testes e os fragmentos escritos em cada pixel
+   * @return int DEPTH_TEST_SKIPPED (fora do buffer ou do recorte), DEPTH_TEST_FAILED ou DEPTH_TEST_PASSED
+   */
+  int z_buffer(const float x, const float y, const float z, const models::ColorFloat &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity)
+  {
+    return z_buffer_kernel(x, y, z, color, z_buffer, color_buffer, scissor, depth_complexity);
   }
 
 } // namespace math
\ No newline at end of file
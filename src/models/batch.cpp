@@ -0,0 +1,505 @@
+#include <models/batch.hpp>
+#include <utils/file.hpp>
+#include <utils/image.hpp>
+#include <utils/thread_pool.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <set>
+
+namespace models
+{
+  /**
+   * @brief Retorna os nomes aceitos de uma configuração, na ordem dos seus valores
+   *
+   * @param setting Configuração: pipeline, lighting, normal, centroid ou precision
+   *
+   * @return const std::vector<std::string>& Nomes aceitos (vazio se a configuração não existe)
+   */
+  static const std::vector<std::string> &RenderSettingNames(const std::string &setting)
+  {
+    static const std::vector<std::string> pipeline = {"adair", "smith"};
+    static const std::vector<std::string> lighting = {"flat", "gouraud", "phong"};
+    static const std::vector<std::string> normal = {"foley", "conci"};
+    static const std::vector<std::string> centroid = {"mean", "box"};
+    static const std::vector<std::string> precision = {"exact", "fast"};
+    static const std::vector<std::string> none = {};
+
+    if (setting == "pipeline")
+      return pipeline;
+    if (setting == "lighting")
+      return lighting;
+    if (setting == "normal")
+      return normal;
+    if (setting == "centroid")
+      return centroid;
+    if (setting == "precision")
+      return precision;
+
+    return none;
+  }
+
+  /**
+   * @brief Substitui todas as ocorrências de um marcador em um texto
+   *
+   * @param text Texto
+   * @param marker Marcador, por exemplo {frame}
+   * @param value Valor do marcador
+   */
+  static void ReplaceMarker(std::string &text, const std::string &marker, const std::string &value)
+  {
+    for (size_t position = text.find(marker); position != std::string::npos; position = text.find(marker, position + value.size()))
+      text.replace(position, marker.size(), value);
+  }
+
+  /**
+   * @brief Lê uma configuração do manifesto que pode ser um nome ou uma lista de nomes
+   *
+   * @param entry Trabalho do manifesto
+   * @param key Chave da configuração no manifesto
+   * @param setting Configuração (ver ParseRenderSetting)
+   * @param values Valores lidos ({-1} se a configuração não foi informada)
+   *
+   * @return bool Verdadeiro se todos os nomes são válidos e falso caso contrário
+   */
+  static bool ParseRenderSettingList(const json &entry, const std::string &key, const std::string &setting, std::vector<int> &values)
+  {
+    values.clear();
+
+    if (!entry.contains(key))
+    {
+      values.push_back(-1);
+      return true;
+    }
+
+    json names = entry[key].is_array() ? entry[key] : json::array({entry[key]});
+
+    for (const auto &name : names)
+    {
+      int value;
+
+      if (!ParseRenderSetting(setting, name.get<std::string>(), value))
+        return false;
+
+      values.push_back(value);
+    }
+
+    return !values.empty();
+  }
+
+  /**
+   * @brief Carrega uma cena salva pela interface
+   *
+   * @param file_path Arquivo da cena ({"scene": Scene::to_json()} ou apenas Scene::to_json())
+   *
+   * @return models::Scene* Cena carregada ou nullptr se o arquivo não contém uma cena
+   */
+  models::Scene *LoadScene(const std::string &file_path)
+  {
+    models::Scene *scene = SceneFromJson(utils::load_json(file_path));
+
+    if (scene == nullptr)
+      std::cerr << "Erro: O arquivo '" << file_path << "' não contém uma cena." << std::endl;
+
+    return scene;
+  }
+
+  /**
+   * @brief Cria uma cena a partir do JSON salvo pela interface
+   *
+   * @param scene_json Cena ({"scene": Scene::to_json()} ou apenas Scene::to_json())
+   *
+   * @return models::Scene* Cena criada ou nullptr se o JSON não contém uma cena
+   */
+  models::Scene *SceneFromJson(json scene_json)
+  {
+    if (scene_json.contains("scene"))
+      scene_json = scene_json["scene"];
+
+    if (!scene_json.contains("camera") || !scene_json.contains("objects"))
+      return nullptr;
+
+    models::Scene *scene = new models::Scene(models::Camera3D::from_json(scene_json["camera"]), {}, {0.0f, 0.0f}, {0.0f, 0.0f}, {0.0f, 0.0f}, {0.0f, 0.0f});
+    scene->from_json(scene_json);
+
+    return scene;
+  }
+
+  /**
+   * @brief Converte o nome de uma configuração de renderização no seu valor
+   *
+   * @param setting Configuração: pipeline (adair, smith), lighting (flat, gouraud, phong),
+   * normal (foley, conci), centroid (mean, box) ou precision (exact, fast)
+   * @param value Nome do valor
+   * @param result Valor correspondente ao nome
+   *
+   * @return bool Verdadeiro se o nome é aceito e falso caso contrário
+   */
+  bool ParseRenderSetting(const std::string &setting, const std::string &value, int &result)
+  {
+    const std::vector<std::string> &names = RenderSettingNames(setting);
+
+    for (size_t i = 0; i < names.size(); i++)
+      if (names[i] == value)
+      {
+        result = static_cast<int>(i);
+        return true;
+      }
+
+    std::cerr << "Erro: Valor '" << value << "' inválido para " << setting << "." << std::endl;
+    return false;
+  }
+
+  /**
+   * @brief Aplica as configurações e a resolução de um trabalho à cena
+   *
+   * @param scene Cena
+   * @param job Trabalho
+   *
+   * @note A viewport passa a começar na origem da imagem
+   */
+  void ApplyRenderJob(models::Scene *scene, const models::RenderJob &job)
+  {
+    if (job.pipeline_model >= 0)
+      scene->pipeline_model = job.pipeline_model;
+    if (job.lighting_model >= 0)
+      scene->lighting_model = job.lighting_model;
+    if (job.normal_algorithm >= 0)
+      scene->normal_algorithm = job.normal_algorithm;
+    if (job.centroid_algorithm >= 0)
+      scene->centroid_algorithm = job.centroid_algorithm;
+    if (job.precision >= 0)
+      scene->precision = job.precision;
+
+    scene->shadows = job.shadows;
+
+    core::Vector2 min_viewport = scene->getMinViewport();
+    core::Vector2 max_viewport = scene->getMaxViewport();
+
+    int width = job.width > 0 ? job.width : static_cast<int>(max_viewport.x - min_viewport.x) + 1;
+    int height = job.height > 0 ? job.height : static_cast<int>(max_viewport.y - min_viewport.y) + 1;
+
+    scene->setMinViewport({0.0f, 0.0f});
+    scene->setMaxViewport({static_cast<float>(std::max(width, 1) - 1), static_cast<float>(std::max(height, 1) - 1)});
+  }
+
+  /**
+   * @brief Lê os trabalhos de um manifesto de renderização em lote
+   *
+   * @param manifest Manifesto: {"defaults": {...}, "jobs": [{...}, ...]}
+   * @param base_directory Diretório usado para resolver os caminhos relativos (normalmente o do manifesto)
+   * @param jobs Trabalhos lidos
+   *
+   * @return bool Verdadeiro se o manifesto é válido e falso caso contrário
+   *
+   * @note Cada trabalho herda os campos de "defaults". Os campos scene, pipeline, lighting, normal e
+   * centroid aceitam uma lista, e o trabalho é repetido para cada combinação
+   */
+  bool LoadRenderJobs(const json &manifest, const std::string &base_directory, std::vector<models::RenderJob> &jobs)
+  {
+    jobs.clear();
+
+    if (!manifest.contains("jobs") || !manifest["jobs"].is_array())
+    {
+      std::cerr << "Erro: O manifesto não contém a lista \"jobs\"." << std::endl;
+      return false;
+    }
+
+    std::filesystem::path base = base_directory;
+
+    try
+    {
+      for (const auto &job_json : manifest["jobs"])
+      {
+        json entry = manifest.contains("defaults") ? manifest["defaults"] : json::object();
+        entry.update(job_json);
+
+        if (!entry.contains("scene") || !entry.contains("output"))
+        {
+          std::cerr << "Erro: Todo trabalho precisa dos campos \"scene\" e \"output\"." << std::endl;
+          return false;
+        }
+
+        models::RenderJob job;
+
+        job.output = (base / entry["output"].get<std::string>()).string();
+
+        if (entry.contains("camera"))
+          job.keyframes = entry["camera"].is_array() ? entry["camera"] : json::array({entry["camera"]});
+
+        // Valida os quadros-chave aqui, já que a cena só é carregada na renderização
+        models::Camera3D camera = {};
+        for (const auto &keyframe : job.keyframes)
+          ParseCameraKeyframe(keyframe, camera);
+
+        job.frames = entry.value("frames", std::max(1, static_cast<int>(job.keyframes.size())));
+        job.width = entry.value("width", 0);
+        job.height = entry.value("height", 0);
+        job.shadows = entry.value("shadows", false);
+
+        if (entry.contains("precision") && !ParseRenderSetting("precision", entry["precision"].get<std::string>(), job.precision))
+          return false;
+
+        if (job.frames < 1)
+        {
+          std::cerr << "Erro: Quantidade de quadros inválida (" << job.frames << ")." << std::endl;
+          return false;
+        }
+
+        json scenes = entry["scene"].is_array() ? entry["scene"] : json::array({entry["scene"]});
+        std::vector<int> pipelines, lightings, normals, centroids;
+
+        if (!ParseRenderSettingList(entry, "pipeline", "pipeline", pipelines) ||
+            !ParseRenderSettingList(entry, "lighting", "lighting", lightings) ||
+            !ParseRenderSettingList(entry, "normal_algorithm", "normal", normals) ||
+            !ParseRenderSettingList(entry, "centroid_algorithm", "centroid", centroids))
+          return false;
+
+        for (const auto &scene : scenes)
+          for (int pipeline : pipelines)
+            for (int lighting : lightings)
+              for (int normal : normals)
+                for (int centroid : centroids)
+                {
+                  job.scene = (base / scene.get<std::string>()).string();
+                  job.pipeline_model = pipeline;
+                  job.lighting_model = lighting;
+                  job.normal_algorithm = normal;
+                  job.centroid_algorithm = centroid;
+
+                  jobs.push_back(job);
+                }
+      }
+    }
+    catch (const json::exception &e)
+    {
+      std::cerr << "Erro ao ler o manifesto: " << e.what() << std::endl;
+      return false;
+    }
+
+    // Dois quadros escrevendo na mesma imagem indicam que faltam marcadores na saída
+    std::set<std::string> outputs;
+
+    for (const models::RenderJob &job : jobs)
+      for (int frame = 0; frame < job.frames; frame++)
+        if (!outputs.insert(RenderJobOutput(job, frame)).second)
+        {
+          std::cerr << "Erro: A imagem '" << RenderJobOutput(job, frame) << "' é gerada por mais de um quadro (use os marcadores {scene}, {pipeline}, {lighting}, {normal} e {centroid})." << std::endl;
+          return false;
+        }
+
+    return true;
+  }
+
+  /**
+   * @brief Lê um quadro-chave da câmera
+   *
+   * @param keyframe Quadro-chave no formato de Camera3D::to_json
+   * @param camera Câmera da cena, usada nos campos ausentes
+   *
+   * @return models::CameraKeyframe Quadro-chave
+   */
+  models::CameraKeyframe ParseCameraKeyframe(const json &keyframe, const models::Camera3D &camera)
+  {
+    models::CameraKeyframe result = {camera.position, camera.target, camera.up, camera.d};
+
+    if (keyframe.contains("position"))
+      result.position = core::Vector3::from_json(keyframe["position"]);
+    if (keyframe.contains("target"))
+      result.target = core::Vector3::from_json(keyframe["target"]);
+    if (keyframe.contains("up"))
+      result.up = core::Vector3::from_json(keyframe["up"]);
+    if (keyframe.contains("d"))
+      result.d = keyframe["d"];
+
+    return result;
+  }
+
+  /**
+   * @brief Interpola linearmente a câmera ao longo dos quadros-chave
+   *
+   * @param keyframes Quadros-chave (ao menos um), igualmente espaçados no tempo
+   * @param t Posição na trajetória, de 0 (primeiro quadro-chave) a 1 (último)
+   *
+   * @return models::CameraKeyframe Câmera interpolada
+   */
+  models::CameraKeyframe InterpolateCameraKeyframes(const std::vector<models::CameraKeyframe> &keyframes, float t)
+  {
+    if (keyframes.size() == 1)
+      return keyframes[0];
+
+    float position = std::clamp(t, 0.0f, 1.0f) * static_cast<float>(keyframes.size() - 1);
+    size_t index = std::min(static_cast<size_t>(position), keyframes.size() - 2);
+    float weight = position - static_cast<float>(index);
+
+    const models::CameraKeyframe &a = keyframes[index];
+    const models::CameraKeyframe &b = keyframes[index + 1];
+
+    auto mix = [weight](const core::Vector3 &u, const core::Vector3 &v) -> core::Vector3
+    {
+      return {u.x + (v.x - u.x) * weight, u.y + (v.y - u.y) * weight, u.z + (v.z - u.z) * weight};
+    };
+
+    return {mix(a.position, b.position), mix(a.target, b.target), mix(a.up, b.up), a.d + (b.d - a.d) * weight};
+  }
+
+  /**
+   * @brief Retorna a imagem de saída de um quadro do trabalho
+   *
+   * @param job Trabalho
+   * @param frame Índice do quadro
+   *
+   * @return std::string Caminho da imagem, com os marcadores substituídos
+   *
+   * @note Se o trabalho tem mais de um quadro e a saída não contém {frame}, o número do quadro é
+   * adicionado antes da extensão
+   */
+  std::string RenderJobOutput(const models::RenderJob &job, int frame)
+  {
+    std::string output = job.output;
+
+    if (job.frames > 1 && output.find("{frame}") == std::string::npos)
+    {
+      std::filesystem::path path = output;
+      output = (path.parent_path() / (path.stem().string() + "_{frame}" + path.extension().string())).string();
+    }
+
+    char frame_number[16];
+    std::snprintf(frame_number, sizeof(frame_number), "%04d", frame);
+
+    auto name = [](const std::string &setting, int value) -> std::string
+    {
+      return value >= 0 ? RenderSettingNames(setting)[value] : "cena";
+    };
+
+    ReplaceMarker(output, "{frame}", frame_number);
+    ReplaceMarker(output, "{scene}", std::filesystem::path(job.scene).stem().string());
+    ReplaceMarker(output, "{pipeline}", name("pipeline", job.pipeline_model));
+    ReplaceMarker(output, "{lighting}", name("lighting", job.lighting_model));
+    ReplaceMarker(output, "{normal}", name("normal", job.normal_algorithm));
+    ReplaceMarker(output, "{centroid}", name("centroid", job.centroid_algorithm));
+
+    return output;
+  }
+
+  /**
+   * @brief Renderiza os trabalhos do lote em paralelo
+   *
+   * @param jobs Trabalhos
+   * @param threads Quantidade de trabalhos renderizados ao mesmo tempo (0 = quantidade de núcleos)
+   * @param overwrite Se verdadeiro, refaz também os quadros cuja imagem já existe
+   *
+   * @return int Quantidade de quadros que falharam
+   *
+   * @note Cada trabalho usa uma única thread no estágio de geometria, o paralelismo vem de renderizar
+   * vários trabalhos ao mesmo tempo. O progresso é escrito na saída padrão a cada quadro
+   */
+  int RunRenderJobs(const std::vector<models::RenderJob> &jobs, unsigned int threads, bool overwrite)
+  {
+    int total = 0;
+    for (const models::RenderJob &job : jobs)
+      total += job.frames;
+
+    std::atomic<int> finished = 0;
+    std::atomic<int> failures = 0;
+    std::mutex output_mutex;
+
+    auto report = [&](const std::string &output, const std::string &status)
+    {
+      std::lock_guard<std::mutex> lock(output_mutex);
+      std::cout << "[" << ++finished << "/" << total << "] " << output << " " << status << std::endl;
+    };
+
+    auto render_job = [&](const models::RenderJob &job)
+    {
+      std::vector<std::string> outputs;
+      std::vector<int> pending;
+
+      for (int frame = 0; frame < job.frames; frame++)
+      {
+        outputs.push_back(RenderJobOutput(job, frame));
+
+        if (overwrite || !std::filesystem::exists(outputs.back()))
+          pending.push_back(frame);
+        else
+          report(outputs.back(), "(já existe)");
+      }
+
+      if (pending.empty())
+        return;
+
+      models::Scene *scene = LoadScene(job.scene);
+
+      if (scene == nullptr)
+      {
+        for (int frame : pending)
+          report(outputs[frame], "(falhou)");
+
+        failures += static_cast<int>(pending.size());
+        return;
+      }
+
+      ApplyRenderJob(scene, job);
+      scene->setWorkerThreads(1);
+
+      models::Camera3D *camera = scene->getCamera();
+      std::vector<models::CameraKeyframe> keyframes;
+
+      for (const auto &keyframe : job.keyframes)
+        keyframes.push_back(ParseCameraKeyframe(keyframe, *camera));
+
+      if (keyframes.empty())
+        keyframes.push_back(ParseCameraKeyframe(json::object(), *camera));
+
+      for (int frame : pending)
+      {
+        models::CameraKeyframe key = InterpolateCameraKeyframes(keyframes, job.frames > 1 ? static_cast<float>(frame) / static_cast<float>(job.frames - 1) : 0.0f);
+        camera->position = key.position;
+        camera->target = key.target;
+        camera->up = key.up;
+        camera->d = key.d;
+
+        auto start = std::chrono::steady_clock::now();
+        scene->pipeline();
+        float time = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        // Escreve em um arquivo temporário para não deixar uma imagem incompleta se o lote for interrompido
+        std::filesystem::path path = outputs[frame];
+        std::filesystem::path temporary = path.parent_path() / (path.stem().string() + ".part" + path.extension().string());
+        std::error_code error;
+
+        if (path.has_parent_path())
+          std::filesystem::create_directories(path.parent_path(), error);
+
+        bool written = utils::WriteImage(temporary.string(), scene->getDisplayBuffer().color_buffer);
+
+        if (written)
+          std::filesystem::rename(temporary, path, error);
+
+        if (!written || error)
+        {
+          failures++;
+          report(outputs[frame], "(falhou)");
+        }
+        else
+          report(outputs[frame], "(" + std::to_string(time) + " ms)");
+      }
+
+      delete scene;
+    };
+
+    utils::ThreadPool thread_pool(threads);
+
+    thread_pool.parallel_for(jobs.size(), 1, [&](size_t begin, size_t end)
+                             {
+      for (size_t i = begin; i < end; i++)
+        render_job(jobs[i]); });
+
+    return failures;
+  }
+} // namespace models
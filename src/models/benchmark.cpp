@@ -1,22 +1,433 @@
 #include <models/benchmark.hpp>
+#include <math/dispatch.hpp>
+#include <utils/nlohmann/json.hpp>
+
+#include <cctype>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using json = nlohmann::json;
 
 namespace models
 {
-  void models::benchmark_start(Benchmark *benchmark)
+  /**
+   * @brief Inicia um benchmark, descartando os resultados anteriores
+   *
+   * @param benchmark Benchmark
+   */
+  void benchmark_start(Benchmark *benchmark)
   {
     benchmark->start_time = std::chrono::high_resolution_clock::now();
+    benchmark->total_time = std::chrono::duration<double>(0.0);
     benchmark->total_frames = 0.0;
     benchmark->average_fps = 0.0;
     benchmark->frame_times.clear();
+    utils::HistogramReset(benchmark->frame_histogram);
     benchmark->min_frame_time = 0.0;
     benchmark->max_frame_time = 0.0;
     benchmark->average_frame_time = 0.0;
     benchmark->worst_10_percentile.clear();
+    benchmark->geometry_times.clear();
+    benchmark->rasterization_times.clear();
+    benchmark->profiles.clear();
   }
 
-  void models::benchmark_end(Benchmark *benchmark)
+  /**
+   * @brief Finaliza um benchmark
+   *
+   * @param benchmark Benchmark
+   *
+   * @note O tempo total passa a ser o tempo de relógio entre benchmark_start e benchmark_end
+   * @note Os 10% piores frames são separados aqui, com uma única ordenação dos tempos guardados
+   */
+  void benchmark_end(Benchmark *benchmark)
   {
     benchmark->end_time = std::chrono::high_resolution_clock::now();
     benchmark->total_time = benchmark->end_time - benchmark->start_time;
+
+    benchmark->worst_10_percentile.clear();
+
+    if (benchmark->frame_times.size() >= 10)
+    {
+      std::vector<double> sorted_times = benchmark->frame_times;
+      std::sort(sorted_times.begin(), sorted_times.end());
+      size_t worst_count = sorted_times.size() / 10;
+      benchmark->worst_10_percentile.assign(sorted_times.end() - worst_count, sorted_times.end());
+    }
+  }
+
+  /**
+   * @brief Adiciona o tempo de um quadro ao benchmark e atualiza as estatísticas
+   *
+   * @param benchmark Benchmark
+   * @param frame_time Tempo do quadro (ms)
+   *
+   * @note O(1): os percentis vêm do histograma (ver benchmark_percentile), sem ordenar os tempos
+   */
+  void benchmark_update(Benchmark *benchmark, double frame_time)
+  {
+    if (benchmark->keep_frame_times)
+      benchmark->frame_times.push_back(frame_time);
+
+    utils::HistogramAdd(benchmark->frame_histogram, frame_time);
+    benchmark->total_time += std::chrono::duration<double>(frame_time / 1000.0);
+    benchmark->total_frames++;
+
+    if (frame_time < benchmark->min_frame_time || benchmark->total_frames == 1)
+      benchmark->min_frame_time = frame_time;
+
+    if (frame_time > benchmark->max_frame_time)
+      benchmark->max_frame_time = frame_time;
+
+    benchmark->average_frame_time = benchmark->total_time.count() * 1000.0 / benchmark->total_frames;
+    benchmark->average_fps = benchmark->total_time.count() > 0 ? benchmark->total_frames / benchmark->total_time.count() : 0.0;
+  }
+
+  /**
+   * @brief Retorna um percentil do tempo dos quadros
+   *
+   * @param benchmark Benchmark
+   * @param percentile Percentil, no intervalo [0, 100] (ex.: 99.9)
+   *
+   * @return double Tempo (ms), com erro relativo de no máximo 1 / HISTOGRAM_SUB_BUCKETS
+   */
+  double benchmark_percentile(const Benchmark *benchmark, double percentile)
+  {
+    return utils::HistogramPercentile(benchmark->frame_histogram, percentile);
+  }
+
+  /**
+   * @brief Retorna o nome de um percentil nos relatórios (ex.: 99.9 -> "p99.9")
+   *
+   * @param percentile Percentil
+   * @return std::string Nome do percentil
+   */
+  std::string benchmark_percentile_name(double percentile)
+  {
+    std::ostringstream name;
+    name << "p" << percentile;
+
+    return name.str();
+  }
+
+  /**
+   * @brief Avança a câmera um passo no caminho do benchmark
+   *
+   * @param path Estado do caminho
+   * @param camera Câmera
+   *
+   * @note A câmera se aproxima até a origem, dá uma volta completa em torno do alvo e se afasta até
+   * BENCHMARK_END_Z. Cada passo tem tamanho fixo, então o caminho não depende do tempo dos quadros
+   */
+  void benchmark_camera_step(BenchmarkCamera *path, Camera3D *camera)
+  {
+    if (camera->position == core::Vector3{0.0f, 0.0f, 0.0f})
+      path->movement = path->movement == BENCHMARK_ORBIT ? BENCHMARK_DOLLY : BENCHMARK_ORBIT;
+
+    if (path->movement == BENCHMARK_ORBIT)
+    {
+      models::CameraOrbital(camera, BENCHMARK_ORBIT_SPEED);
+      path->angle += BENCHMARK_ORBIT_SPEED;
+
+      // Completou a volta: passa a se afastar
+      if (path->angle >= 2 * M_PI)
+      {
+        path->angle = 0.0f;
+        path->movement = BENCHMARK_DOLLY;
+      }
+    }
+    else
+      models::CameraMoveForward(camera, BENCHMARK_DOLLY_SPEED, true);
+
+    path->frames++;
+    path->finished = camera->position.z <= BENCHMARK_END_Z || path->frames >= BENCHMARK_MAX_FRAMES;
+  }
+
+  /**
+   * @brief Retorna o caminho (sem extensão) dos resultados de uma repetição do benchmark, criando
+   * os diretórios que faltam
+   *
+   * @param directory Diretório dos resultados
+   * @param pipeline Nome do pipeline (adair ou smith)
+   * @param shading Nome do modelo de iluminação (flat, gouraud ou phong)
+   * @param repetition Número da repetição
+   *
+   * @return std::string <directory>/<PIPELINE>/<SHADING>/benchmark_pipeline_<pipeline>_<shading>_results_<repetition>
+   */
+  std::string benchmark_results_path(const std::string &directory, const std::string &pipeline, const std::string &shading, int repetition)
+  {
+    auto upper = [](std::string text)
+    {
+      std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c)
+                     { return static_cast<char>(std::toupper(c)); });
+      return text;
+    };
+
+    std::filesystem::path output_dir = std::filesystem::path(directory) / upper(pipeline) / upper(shading);
+
+    std::error_code error;
+    std::filesystem::create_directories(output_dir, error);
+
+    return (output_dir / ("benchmark_pipeline_" + pipeline + "_" + shading + "_results_" + std::to_string(repetition))).string();
+  }
+
+  /**
+   * @brief Soma os tempos e contadores de todos os quadros do benchmark
+   *
+   * @param benchmark Benchmark
+   *
+   * @return utils::ProfileFrame Soma de benchmark->profiles
+   */
+  static utils::ProfileFrame benchmark_profile_total(const Benchmark *benchmark)
+  {
+    utils::ProfileFrame result;
+
+    for (const auto &profile : benchmark->profiles)
+    {
+      for (int stage = 0; stage < PROFILE_STAGES; stage++)
+      {
+        result.time[stage] += profile.time[stage];
+        result.calls[stage] += profile.calls[stage];
+      }
+
+      for (int counter = 0; counter < PROFILE_COUNTERS; counter++)
+        result.counters[counter] += profile.counters[counter];
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Escreve o relatório de texto do benchmark (formato dos arquivos em resultados/)
+   *
+   * @param benchmark Benchmark finalizado
+   * @param file_path Arquivo de saída
+   * @param pipeline Nome do pipeline
+   * @param shading Nome do modelo de iluminação
+   * @param repetition Número da repetição
+   *
+   * @return bool Verdadeiro se o arquivo foi escrito com sucesso e falso caso contrário
+   */
+  bool benchmark_write_report(const Benchmark *benchmark, const std::string &file_path, const std::string &pipeline, const std::string &shading, int repetition)
+  {
+    std::ofstream file(file_path);
+
+    if (!file.is_open())
+    {
+      std::cerr << "Erro ao abrir o arquivo '" << file_path << "' para escrita!" << std::endl;
+      return false;
+    }
+
+    file << "=== Benchmark Results ===\n\n"
+         << "Configuration:\n"
+         << "Pipeline: " << pipeline << "\n"
+         << "Shading: " << shading << "\n"
+         << "Repetitions: " << repetition << "\n"
+         << "ISA: " << math::IsaName(math::ActiveIsa()) << "\n\n"
+         << "Performance Metrics:\n"
+         << std::fixed << std::setprecision(4)
+         << "Total Time: " << benchmark->total_time.count() << " s\n"
+         << "Total Frames: " << benchmark->total_frames << "\n"
+         << "Average FPS: " << benchmark->total_frames / benchmark->total_time.count() << "\n"
+         << "Avg Frame Time: " << benchmark->average_frame_time << " ms\n"
+         << "Min Frame Time: " << benchmark->min_frame_time << " ms\n"
+         << "Max Frame Time: " << benchmark->max_frame_time << " ms\n\n"
+         << "Frame Time Percentiles (ms):\n";
+
+    for (double percentile : BENCHMARK_PERCENTILES)
+      file << benchmark_percentile_name(percentile) << ": " << benchmark_percentile(benchmark, percentile) << "\n";
+
+    file << "\nWorst 10% Frame Times (ms):\n";
+
+    for (const auto &time : benchmark->worst_10_percentile)
+      file << time << "\n";
+
+    if (!benchmark->profiles.empty())
+    {
+      double frames = static_cast<double>(benchmark->profiles.size());
+      utils::ProfileFrame total = benchmark_profile_total(benchmark);
+
+      file << "\nPipeline Stages (average per frame, summed across threads):\n";
+      for (int stage = 0; stage < PROFILE_STAGES; stage++)
+        file << utils::ProfileStageName(stage) << ": " << utils::ProfileStageMilliseconds(total, stage) / frames << " ms, " << static_cast<double>(total.calls[stage]) / frames << " calls\n";
+
+      file << "\nPipeline Counters (average per frame):\n";
+      for (int counter = 0; counter < PROFILE_COUNTERS; counter++)
+        file << utils::ProfileCounterName(counter) << ": " << static_cast<double>(total.counters[counter]) / frames << "\n";
+    }
+
+    return !file.fail();
+  }
+
+  /**
+   * @brief Resume uma série de tempos (média, mínimo e máximo)
+   *
+   * @param times Tempos (ms)
+   *
+   * @return json {"average", "min", "max"}
+   */
+  static json benchmark_summary(const std::vector<double> &times)
+  {
+    if (times.empty())
+      return json{{"average", 0.0}, {"min", 0.0}, {"max", 0.0}};
+
+    double total = 0.0;
+    for (double time : times)
+      total += time;
+
+    return json{
+        {"average", total / static_cast<double>(times.size())},
+        {"min", *std::min_element(times.begin(), times.end())},
+        {"max", *std::max_element(times.begin(), times.end())}};
+  }
+
+  /**
+   * @brief Escreve os resultados do benchmark em JSON: as métricas do relatório, o resumo de cada
+   * estágio e os tempos de cada quadro
+   *
+   * @param benchmark Benchmark finalizado
+   * @param file_path Arquivo de saída
+   * @param pipeline Nome do pipeline
+   * @param shading Nome do modelo de iluminação
+   * @param repetition Número da repetição
+   *
+   * @return bool Verdadeiro se o arquivo foi escrito com sucesso e falso caso contrário
+   */
+  bool benchmark_write_json(const Benchmark *benchmark, const std::string &file_path, const std::string &pipeline, const std::string &shading, int repetition)
+  {
+    std::ofstream file(file_path);
+
+    if (!file.is_open())
+    {
+      std::cerr << "Erro ao abrir o arquivo '" << file_path << "' para escrita!" << std::endl;
+      return false;
+    }
+
+    json j;
+
+    j["configuration"] = {{"pipeline", pipeline}, {"shading", shading}, {"repetition", repetition}, {"isa", math::IsaName(math::ActiveIsa())}};
+    j["metrics"] = {
+        {"total_time_s", benchmark->total_time.count()},
+        {"total_frames", benchmark->total_frames},
+        {"average_fps", benchmark->total_time.count() > 0 ? benchmark->total_frames / benchmark->total_time.count() : 0.0},
+        {"average_frame_time_ms", benchmark->average_frame_time},
+        {"min_frame_time_ms", benchmark->min_frame_time},
+        {"max_frame_time_ms", benchmark->max_frame_time},
+        {"worst_10_percentile_ms", benchmark->worst_10_percentile}};
+
+    for (double percentile : BENCHMARK_PERCENTILES)
+      j["metrics"]["percentiles_ms"][benchmark_percentile_name(percentile)] = benchmark_percentile(benchmark, percentile);
+
+    j["stages_ms"] = {
+        {"geometry", benchmark_summary(benchmark->geometry_times)},
+        {"rasterization", benchmark_summary(benchmark->rasterization_times)}};
+    j["frames_ms"] = {
+        {"frame", benchmark->frame_times},
+        {"geometry", benchmark->geometry_times},
+        {"rasterization", benchmark->rasterization_times}};
+
+    if (!benchmark->profiles.empty())
+    {
+      json stages = json::object();
+      json counters = json::object();
+      json frames = json::object();
+
+      for (int stage = 0; stage < PROFILE_STAGES; stage++)
+      {
+        std::vector<double> times;
+        for (const auto &profile : benchmark->profiles)
+          times.push_back(utils::ProfileStageMilliseconds(profile, stage));
+
+        stages[utils::ProfileStageName(stage)] = benchmark_summary(times);
+        frames[std::string(utils::ProfileStageName(stage)) + "_ms"] = times;
+      }
+
+      for (int counter = 0; counter < PROFILE_COUNTERS; counter++)
+      {
+        std::vector<double> values;
+        for (const auto &profile : benchmark->profiles)
+          values.push_back(static_cast<double>(profile.counters[counter]));
+
+        counters[utils::ProfileCounterName(counter)] = benchmark_summary(values);
+        frames[utils::ProfileCounterName(counter)] = values;
+      }
+
+      j["profile"] = {{"stages_ms", stages}, {"counters", counters}, {"frames", frames}};
+    }
+
+    file << j.dump(2) << std::endl;
+
+    return !file.fail();
+  }
+
+  /**
+   * @brief Escreve os tempos de cada quadro do benchmark em CSV (um quadro por linha)
+   *
+   * @param benchmark Benchmark finalizado
+   * @param file_path Arquivo de saída
+   *
+   * @return bool Verdadeiro se o arquivo foi escrito com sucesso e falso caso contrário
+   *
+   * @note Colunas: frame, frame_ms, geometry_ms, rasterization_ms (vazios quando não medidos ou guardados)
+   * e, se houver, o tempo de cada estágio do profiler (<estágio>_ms) e os contadores
+   */
+  bool benchmark_write_csv(const Benchmark *benchmark, const std::string &file_path)
+  {
+    std::ofstream file(file_path);
+
+    if (!file.is_open())
+    {
+      std::cerr << "Erro ao abrir o arquivo '" << file_path << "' para escrita!" << std::endl;
+      return false;
+    }
+
+    file << "frame,frame_ms,geometry_ms,rasterization_ms";
+
+    if (!benchmark->profiles.empty())
+    {
+      for (int stage = 0; stage < PROFILE_STAGES; stage++)
+        file << "," << utils::ProfileStageName(stage) << "_ms";
+      for (int counter = 0; counter < PROFILE_COUNTERS; counter++)
+        file << "," << utils::ProfileCounterName(counter);
+    }
+
+    file << "\n"
+         << std::fixed << std::setprecision(6);
+
+    // Sem o registro dos quadros (keep_frame_times), as linhas vêm dos estágios e a coluna frame_ms fica vazia
+    size_t rows = std::max({benchmark->frame_times.size(), benchmark->geometry_times.size(), benchmark->profiles.size()});
+
+    for (size_t i = 0; i < rows; i++)
+    {
+      file << i << ",";
+
+      if (i < benchmark->frame_times.size())
+        file << benchmark->frame_times[i];
+      file << ",";
+
+      if (i < benchmark->geometry_times.size())
+        file << benchmark->geometry_times[i];
+      file << ",";
+
+      if (i < benchmark->rasterization_times.size())
+        file << benchmark->rasterization_times[i];
+
+      if (!benchmark->profiles.empty())
+      {
+        utils::ProfileFrame profile = i < benchmark->profiles.size() ? benchmark->profiles[i] : utils::ProfileFrame();
+
+        for (int stage = 0; stage < PROFILE_STAGES; stage++)
+          file << "," << utils::ProfileStageMilliseconds(profile, stage);
+        for (int counter = 0; counter < PROFILE_COUNTERS; counter++)
+          file << "," << profile.counters[counter];
+      }
+
+      file << "\n";
+    }
+
+    return !file.fail();
   }
-} // namespace models
\ No newline at end of file
+} // namespace models
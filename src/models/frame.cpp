@@ -0,0 +1,561 @@
+#include <models/frame.hpp>
+#include <utils/utils.hpp>
+#include <utils/profiler.hpp>
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace models
+{
+  /**
+   * @brief Limpa o framebuffer, redimensionando-o apenas quando o tamanho muda
+   *
+   * @param frame_buffer Framebuffer a ser limpo
+   * @param width Largura do framebuffer
+   * @param height Altura do framebuffer
+   *
+   * @note O buffer de profundidade é preenchido com infinito e o de cores em float com transparente.
+   * O buffer RGBA8 não precisa ser limpo, pois é inteiramente reescrito por ResolveFrameBuffer
+   */
+  void ClearFrameBuffer(models::FrameBuffer &frame_buffer, int width, int height)
+  {
+    if (frame_buffer.width != width || frame_buffer.height != height)
+    {
+      frame_buffer.width = width;
+      frame_buffer.height = height;
+      frame_buffer.z_buffer.assign(width, std::vector<float>(height, std::numeric_limits<float>::infinity()));
+      frame_buffer.shading_buffer.assign(width, std::vector<models::ColorFloat>(height, models::ColorFloat()));
+      frame_buffer.color_buffer.assign(width, std::vector<models::Color>(height, models::TRANSPARENT));
+      return;
+    }
+
+    for (auto &column : frame_buffer.z_buffer)
+      std::fill(column.begin(), column.end(), std::numeric_limits<float>::infinity());
+
+    for (auto &column : frame_buffer.shading_buffer)
+      std::fill(column.begin(), column.end(), models::ColorFloat());
+  }
+
+  /**
+   * @brief Limpa apenas um retângulo do framebuffer
+   *
+   * @param frame_buffer Framebuffer a ser limpo, já com o tamanho do quadro
+   * @param rectangle Retângulo (min x, min y, max x, max y), dentro da tela
+   */
+  void ClearFrameBuffer(models::FrameBuffer &frame_buffer, const core::Vector4 &rectangle)
+  {
+    int y_begin = static_cast<int>(rectangle.y);
+    int y_end = static_cast<int>(rectangle.w) + 1;
+
+    for (int x = static_cast<int>(rectangle.x); x <= static_cast<int>(rectangle.z); x++)
+    {
+      std::fill(frame_buffer.z_buffer[x].begin() + y_begin, frame_buffer.z_buffer[x].begin() + y_end, std::numeric_limits<float>::infinity());
+      std::fill(frame_buffer.shading_buffer[x].begin() + y_begin, frame_buffer.shading_buffer[x].begin() + y_end, models::ColorFloat());
+    }
+  }
+
+  /**
+   * @brief Limpa a geometria de um quadro mantendo a memória alocada
+   *
+   * @param frame Geometria do quadro
+   */
+  void ClearFrameGeometry(models::FrameGeometry &frame)
+  {
+    frame.omni_lights.clear();
+    frame.materials.clear();
+    frame.objects.clear();
+    frame.polygons.clear();
+    frame.vertexes.clear();
+    frame.attributes.clear();
+    frame.positions.clear();
+  }
+
+  /**
+   * @brief Concatena as primitivas de uma parte da geometria no quadro
+   *
+   * @param frame Geometria do quadro
+   * @param part Parte da geometria (produzida por um bloco do estágio de geometria)
+   *
+   * @note Os índices dos vértices da parte são deslocados para o final do quadro
+   */
+  void AppendFrameGeometry(models::FrameGeometry &frame, const models::FrameGeometry &part)
+  {
+    size_t offset = frame.vertexes.size();
+
+    for (auto polygon : part.polygons)
+    {
+      polygon.first += offset;
+      frame.polygons.push_back(polygon);
+    }
+
+    frame.vertexes.insert(frame.vertexes.end(), part.vertexes.begin(), part.vertexes.end());
+    frame.attributes.insert(frame.attributes.end(), part.attributes.begin(), part.attributes.end());
+    frame.positions.insert(frame.positions.end(), part.positions.begin(), part.positions.end());
+  }
+
+  /**
+   * @brief Une dois retângulos de tela
+   *
+   * @param a Retângulo (min x, min y, max x, max y), vazio se max x < min x
+   * @param b Retângulo (min x, min y, max x, max y), vazio se max x < min x
+   *
+   * @return core::Vector4 Menor retângulo que contém os dois
+   */
+  static core::Vector4 UniteRectangles(const core::Vector4 &a, const core::Vector4 &b)
+  {
+    if (a.z < a.x)
+      return b;
+    if (b.z < b.x)
+      return a;
+
+    return {std::min(a.x, b.x), std::min(a.y, b.y), std::max(a.z, b.z), std::max(a.w, b.w)};
+  }
+
+  /**
+   * @brief Calcula o retângulo de tela ocupado por uma primitiva
+   *
+   * @param frame Geometria do quadro
+   * @param polygon Primitiva
+   *
+   * @return core::Vector4 Retângulo (min x, min y, max x, max y) em pixels inteiros, conservador em
+   * relação aos pixels escritos pelo preenchimento
+   */
+  static core::Vector4 PolygonBounds(const models::FrameGeometry &frame, const models::FramePolygon &polygon)
+  {
+    core::Vector4 result = {0.0f, 0.0f, -1.0f, -1.0f};
+
+    for (size_t i = polygon.first; i < polygon.first + polygon.count; i++)
+    {
+      const core::Vector3 &vertex = frame.vertexes[i];
+      result = UniteRectangles(result, {floorf(vertex.x), floorf(vertex.y), ceilf(vertex.x), ceilf(vertex.y)});
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Calcula o retângulo que precisa ser refeito em relação ao conteúdo atual do framebuffer
+   *
+   * @param frame Geometria do quadro
+   * @param frame_buffer Framebuffer com o quadro rasterizado anteriormente
+   * @param bounds Retângulo de tela de cada objeto do quadro
+   * @param partial Verdadeiro se o quadro pode ser refeito apenas dentro do retângulo retornado
+   *
+   * @return core::Vector4 União dos retângulos antigo e novo dos objetos que mudaram, limitada à tela
+   * (vazio se nada mudou)
+   *
+   * @note O quadro é refeito por completo quando o tamanho, a câmera, as luzes, as configurações, a
+   * lista de objetos ou algum mapa de sombra mudaram, ou quando o retângulo passa de
+   * FRAME_PARTIAL_MAX_AREA da tela
+   */
+  core::Vector4 FrameDirtyRectangle(const models::FrameGeometry &frame, const models::FrameBuffer &frame_buffer, const std::vector<core::Vector4> &bounds, bool &partial)
+  {
+    core::Vector4 full = {0.0f, 0.0f, static_cast<float>(frame.width - 1), static_cast<float>(frame.height - 1)};
+
+    partial = false;
+
+    if (frame_buffer.width != frame.width || frame_buffer.height != frame.height || frame_buffer.state != frame.state)
+      return full;
+
+    if (frame_buffer.objects.size() != frame.objects.size() || frame_buffer.omni_lights.size() != frame.omni_lights.size())
+      return full;
+
+    // Um mapa de sombra refeito é sempre um novo objeto (ver Scene::updateShadowMaps)
+    for (size_t i = 0; i < frame.omni_lights.size(); i++)
+      if (frame_buffer.omni_lights[i].shadow_map != frame.omni_lights[i].shadow_map)
+        return full;
+
+    core::Vector4 result = {0.0f, 0.0f, -1.0f, -1.0f};
+
+    for (size_t i = 0; i < frame.objects.size(); i++)
+    {
+      const models::FrameObject &previous = frame_buffer.objects[i];
+      const models::FrameObject &current = frame.objects[i];
+
+      if (previous.id != current.id)
+        return full;
+
+      const models::Material &a = frame_buffer.materials[i];
+      const models::Material &b = frame.materials[i];
+
+      bool same_material = a.ambient.r == b.ambient.r && a.ambient.g == b.ambient.g && a.ambient.b == b.ambient.b &&
+                           a.diffuse.r == b.diffuse.r && a.diffuse.g == b.diffuse.g && a.diffuse.b == b.diffuse.b &&
+                           a.specular.r == b.specular.r && a.specular.g == b.specular.g && a.specular.b == b.specular.b &&
+                           a.shininess == b.shininess;
+
+      if (previous.version == current.version && previous.selected == current.selected && same_material)
+        continue;
+
+      result = UniteRectangles(result, UniteRectangles(previous.bounds, bounds[i]));
+    }
+
+    // Limita à tela
+    result = {std::max(result.x, full.x), std::max(result.y, full.y), std::min(result.z, full.z), std::min(result.w, full.w)};
+
+    if (result.z < result.x || result.w < result.y)
+    {
+      partial = true;
+      return {0.0f, 0.0f, -1.0f, -1.0f};
+    }
+
+    float area = (result.z - result.x + 1.0f) * (result.w - result.y + 1.0f);
+
+    if (area > FRAME_PARTIAL_MAX_AREA * static_cast<float>(frame.width) * static_cast<float>(frame.height))
+      return full;
+
+    partial = true;
+    return result;
+  }
+
+  /**
+   * @brief Rasteriza a geometria de um quadro no framebuffer
+   *
+   * @param frame Geometria do quadro
+   * @param frame_buffer Framebuffer de destino
+   *
+   * @note Não acessa a cena, apenas a geometria do quadro, por isso pode ser executada em outra thread
+   * @note As cores são escritas em float e convertidas para RGBA8 uma única vez, no final (ver ResolveFrameBuffer)
+   * @note Se apenas alguns objetos mudaram desde o quadro que está no framebuffer, somente o
+   * retângulo que eles ocupavam e passaram a ocupar é limpo e refeito, com as primitivas que o
+   * tocam e na mesma ordem, então o resultado é idêntico ao de refazer a tela inteira
+   */
+  void RasterizeFrame(const models::FrameGeometry &frame, models::FrameBuffer &frame_buffer)
+  {
+    MRX_PROFILE_SCOPE(PROFILE_RASTER);
+
+    // Retângulo de tela de cada objeto
+    std::vector<core::Vector4> bounds(frame.objects.size(), {0.0f, 0.0f, -1.0f, -1.0f});
+
+    for (const auto &polygon : frame.polygons)
+      if (polygon.material < static_cast<int>(bounds.size()))
+        bounds[polygon.material] = UniteRectangles(bounds[polygon.material], PolygonBounds(frame, polygon));
+
+    bool partial = false;
+    core::Vector4 scissor = models::FrameDirtyRectangle(frame, frame_buffer, bounds, partial);
+
+    frame_buffer.dirty = scissor;
+
+    // Nada mudou: o framebuffer já contém o quadro
+    if (scissor.z < scissor.x)
+      return;
+
+    if (partial)
+      models::ClearFrameBuffer(frame_buffer, scissor);
+    else
+      models::ClearFrameBuffer(frame_buffer, frame.width, frame.height);
+
+    // Mapa de overdraw: as contagens são limpas no mesmo retângulo que o buffer de profundidade
+    math::DepthComplexityBuffer *depth_complexity = nullptr;
+
+    if (frame.overdraw)
+    {
+      if (!partial || frame_buffer.depth_complexity.size() != static_cast<size_t>(frame.width))
+        frame_buffer.depth_complexity.assign(frame.width, std::vector<math::DepthComplexity>(frame.height));
+      else
+        for (int x = static_cast<int>(scissor.x); x <= static_cast<int>(scissor.z); x++)
+          std::fill(frame_buffer.depth_complexity[x].begin() + static_cast<int>(scissor.y), frame_buffer.depth_complexity[x].begin() + static_cast<int>(scissor.w) + 1, math::DepthComplexity());
+
+      depth_complexity = &frame_buffer.depth_complexity;
+    }
+    else
+    {
+      frame_buffer.depth_complexity.clear();
+      frame_buffer.overdraw_ratio = 0.0f;
+      frame_buffer.depth_complexity_ratio = 0.0f;
+    }
+
+    // Vetores temporários reaproveitados entre as primitivas
+    std::vector<core::Vector3> vertexes;
+    std::vector<std::pair<core::Vector3, models::ColorFloat>> vertexes_gouraud;
+    std::vector<std::pair<core::Vector3, core::Vector3>> vertexes_phong;
+    std::vector<core::Vector3> positions;
+
+    for (const auto &polygon : frame.polygons)
+    {
+      if (partial)
+      {
+        core::Vector4 rectangle = PolygonBounds(frame, polygon);
+
+        if (rectangle.z < scissor.x || rectangle.x > scissor.z || rectangle.w < scissor.y || rectangle.y > scissor.w)
+          continue;
+      }
+
+      auto begin = frame.vertexes.begin() + polygon.first;
+
+      if (polygon.type == FRAME_BOUNDING_BOX)
+      {
+        core::Vector3 min = *begin;
+        core::Vector3 max = *(begin + 1);
+
+        utils::DrawBoundingBox({min.x, min.y}, {max.x, max.y}, models::YELLOW, frame_buffer.z_buffer, frame_buffer.shading_buffer, scissor);
+        continue;
+      }
+
+      const models::Material &material = frame.materials[polygon.material];
+
+      if (frame.lighting_model == FLAT_SHADING)
+      {
+        vertexes.assign(begin, begin + polygon.count);
+
+        utils::DrawFaceBufferFlatShading(vertexes, polygon.color, frame_buffer.z_buffer, frame_buffer.shading_buffer, scissor, depth_complexity);
+      }
+      else if (frame.lighting_model == GOURAUD_SHADING)
+      {
+        vertexes_gouraud.clear();
+
+        for (size_t i = polygon.first; i < polygon.first + polygon.count; i++)
+        {
+          core::Vector3 color = frame.attributes[i];
+          vertexes_gouraud.push_back(std::make_pair(frame.vertexes[i], models::ColorFloat{color.x, color.y, color.z, static_cast<float>(MAX_COLOR_VALUE)}));
+        }
+
+        utils::DrawFaceBufferGouraudShading(vertexes_gouraud, frame_buffer.z_buffer, frame_buffer.shading_buffer, scissor, depth_complexity);
+      }
+      else if (frame.lighting_model == PHONG_SHADING)
+      {
+        vertexes_phong.clear();
+
+        for (size_t i = polygon.first; i < polygon.first + polygon.count; i++)
+          vertexes_phong.push_back(std::make_pair(frame.vertexes[i], frame.attributes[i]));
+
+        positions.assign(frame.positions.begin() + polygon.first, frame.positions.begin() + polygon.first + polygon.count);
+
+        if (frame.precision == FAST_PRECISION)
+          utils::DrawFaceBufferPhongShading<math::Fast>(vertexes_phong, positions, polygon.centroid, frame.eye, material, frame.global_light, frame.omni_lights, frame.light_tiles, frame_buffer.z_buffer, frame_buffer.shading_buffer, scissor, depth_complexity);
+        else
+          utils::DrawFaceBufferPhongShading<math::Exact>(vertexes_phong, positions, polygon.centroid, frame.eye, material, frame.global_light, frame.omni_lights, frame.light_tiles, frame_buffer.z_buffer, frame_buffer.shading_buffer, scissor, depth_complexity);
+      }
+    }
+
+    if (frame.overdraw)
+      models::OverdrawHeatmap(frame_buffer, scissor);
+
+    models::ResolveFrameBuffer(frame_buffer, scissor);
+
+    // Estado com que o framebuffer foi rasterizado, comparado no próximo quadro
+    frame_buffer.state = frame.state;
+    frame_buffer.omni_lights = frame.omni_lights;
+    frame_buffer.materials = frame.materials;
+    frame_buffer.objects = frame.objects;
+
+    for (size_t i = 0; i < bounds.size(); i++)
+      frame_buffer.objects[i].bounds = bounds[i];
+  }
+
+  /**
+   * @brief Converte as cores em float do quadro para o buffer RGBA8 exibido pela interface
+   *
+   * @param frame_buffer Framebuffer já rasterizado
+   *
+   * @note É o único ponto onde as cores são limitadas, arredondadas e empacotadas. Cada coluna é
+   * percorrida em sequência, sem desvios, para que o compilador possa vetorizar o laço
+   */
+  void ResolveFrameBuffer(models::FrameBuffer &frame_buffer)
+  {
+    models::ResolveFrameBuffer(frame_buffer, {0.0f, 0.0f, static_cast<float>(frame_buffer.width - 1), static_cast<float>(frame_buffer.height - 1)});
+  }
+
+  /**
+   * @brief Converte as cores em float de um retângulo do quadro para o buffer RGBA8
+   *
+   * @param frame_buffer Framebuffer já rasterizado
+   * @param rectangle Retângulo (min x, min y, max x, max y), dentro da tela
+   */
+  void ResolveFrameBuffer(models::FrameBuffer &frame_buffer, const core::Vector4 &rectangle)
+  {
+    int x_end = static_cast<int>(rectangle.z);
+    int y_begin = static_cast<int>(rectangle.y);
+    int y_end = static_cast<int>(rectangle.w);
+
+    for (int x = static_cast<int>(rectangle.x); x <= x_end; x++)
+    {
+      const models::ColorFloat *source = frame_buffer.shading_buffer[x].data();
+      models::Color *destination = frame_buffer.color_buffer[x].data();
+
+      for (int y = y_begin; y <= y_end; y++)
+        destination[y] = models::PackColor(source[y]);
+    }
+  }
+
+  /**
+   * @brief Amplia um framebuffer rasterizado em resolução reduzida com filtro bilinear
+   *
+   * @param source Framebuffer rasterizado com a resolução interna
+   * @param destination Framebuffer exibido pela interface
+   * @param width Largura do framebuffer exibido
+   * @param height Altura do framebuffer exibido
+   * @param scale Escala da resolução interna (o pixel (x, y) exibido corresponde a (x * scale, y * scale))
+   *
+   * @note A interpolação usa as cores em float. O fundo é transparente, então as cores são
+   * ponderadas pela cobertura (alfa) para que as bordas dos objetos não escureçam
+   * @note A profundidade é amostrada do pixel mais próximo
+   */
+  void UpscaleFrameBuffer(const models::FrameBuffer &source, models::FrameBuffer &destination, int width, int height, float scale)
+  {
+    // Todos os pixels são reescritos, basta redimensionar
+    if (destination.width != width || destination.height != height)
+      models::ClearFrameBuffer(destination, width, height);
+
+    if (source.width == 0 || source.height == 0)
+      return;
+
+    for (int x = 0; x < width; x++)
+    {
+      float u = std::min(static_cast<float>(x) * scale, static_cast<float>(source.width - 1));
+      int x0 = static_cast<int>(u);
+      int x1 = std::min(x0 + 1, source.width - 1);
+      float fx = u - static_cast<float>(x0);
+
+      for (int y = 0; y < height; y++)
+      {
+        float v = std::min(static_cast<float>(y) * scale, static_cast<float>(source.height - 1));
+        int y0 = static_cast<int>(v);
+        int y1 = std::min(y0 + 1, source.height - 1);
+        float fy = v - static_cast<float>(y0);
+
+        const models::ColorFloat *samples[4] = {&source.shading_buffer[x0][y0], &source.shading_buffer[x1][y0], &source.shading_buffer[x0][y1], &source.shading_buffer[x1][y1]};
+        float weights[4] = {(1.0f - fx) * (1.0f - fy), fx * (1.0f - fy), (1.0f - fx) * fy, fx * fy};
+
+        models::ColorFloat color = {0.0f, 0.0f, 0.0f, 0.0f};
+
+        for (int i = 0; i < 4; i++)
+        {
+          float weight = weights[i] * samples[i]->a;
+
+          color.r += samples[i]->r * weight;
+          color.g += samples[i]->g * weight;
+          color.b += samples[i]->b * weight;
+          color.a += weight;
+        }
+
+        if (color.a > 0.0f)
+        {
+          color.r /= color.a;
+          color.g /= color.a;
+          color.b /= color.a;
+        }
+
+        destination.color_buffer[x][y] = models::PackColor(color);
+        destination.z_buffer[x][y] = source.z_buffer[std::lround(u)][std::lround(v)];
+      }
+    }
+  }
+
+  /**
+   * @brief Cor do mapa de overdraw para uma quantidade de testes de profundidade
+   *
+   * @param tests Testes de profundidade do pixel (pelo menos 1)
+   *
+   * @return models::ColorFloat Azul (1 teste), ciano, verde, amarelo e vermelho (OVERDRAW_HEATMAP_MAX
+   * testes ou mais), interpolando entre as cores
+   */
+  models::ColorFloat OverdrawHeatmapColor(unsigned int tests)
+  {
+    static const core::Vector3 stops[] = {{0.0f, 0.0f, 255.0f}, {0.0f, 255.0f, 255.0f}, {0.0f, 255.0f, 0.0f}, {255.0f, 255.0f, 0.0f}, {255.0f, 0.0f, 0.0f}};
+    const int segments = static_cast<int>(sizeof(stops) / sizeof(stops[0])) - 1;
+
+    float t = static_cast<float>(std::clamp(tests, 1u, static_cast<unsigned int>(OVERDRAW_HEATMAP_MAX)) - 1) / static_cast<float>(OVERDRAW_HEATMAP_MAX - 1);
+    float position = t * static_cast<float>(segments);
+    int segment = std::min(static_cast<int>(position), segments - 1);
+    float f = position - static_cast<float>(segment);
+
+    const core::Vector3 &a = stops[segment];
+    const core::Vector3 &b = stops[segment + 1];
+
+    return {a.x + (b.x - a.x) * f, a.y + (b.y - a.y) * f, a.z + (b.z - a.z) * f, static_cast<float>(MAX_COLOR_VALUE)};
+  }
+
+  /**
+   * @brief Substitui as cores de um retângulo do quadro pelo mapa de overdraw e atualiza as razões
+   * de overdraw do quadro inteiro
+   *
+   * @param frame_buffer Framebuffer rasterizado com as contagens dos testes de profundidade
+   * @param rectangle Retângulo refeito (min x, min y, max x, max y), dentro da tela
+   *
+   * @note Os pixels sem nenhum teste mantêm a cor original (fundo ou caixa envolvente)
+   * @note As cores são escritas no buffer em float, então a ampliação (render_scale) e a conversão
+   * para RGBA8 funcionam como em um quadro normal
+   */
+  void OverdrawHeatmap(models::FrameBuffer &frame_buffer, const core::Vector4 &rectangle)
+  {
+    if (frame_buffer.depth_complexity.empty())
+      return;
+
+    int y_begin = static_cast<int>(rectangle.y);
+    int y_end = static_cast<int>(rectangle.w);
+
+    for (int x = static_cast<int>(rectangle.x); x <= static_cast<int>(rectangle.z); x++)
+      for (int y = y_begin; y <= y_end; y++)
+        if (frame_buffer.depth_complexity[x][y].tests > 0)
+          frame_buffer.shading_buffer[x][y] = models::OverdrawHeatmapColor(frame_buffer.depth_complexity[x][y].tests);
+
+    // As razões valem para a tela inteira, inclusive fora do retângulo refeito
+    std::uint64_t covered = 0;
+    std::uint64_t tests = 0;
+    std::uint64_t passes = 0;
+
+    for (const auto &column : frame_buffer.depth_complexity)
+      for (const auto &counts : column)
+      {
+        covered += counts.passes > 0;
+        tests += counts.tests;
+        passes += counts.passes;
+      }
+
+    frame_buffer.overdraw_ratio = covered > 0 ? static_cast<float>(passes) / static_cast<float>(covered) : 0.0f;
+    frame_buffer.depth_complexity_ratio = covered > 0 ? static_cast<float>(tests) / static_cast<float>(covered) : 0.0f;
+  }
+
+  /**
+   * @brief Atualiza a escala da resolução interna com o tempo de um quadro
+   *
+   * @param render_scale Controle da resolução dinâmica
+   * @param frame_time Tempo (ms) do último quadro rasterizado
+   *
+   * @return float Escala a ser usada no próximo quadro
+   *
+   * @note O custo da rasterização é proporcional à quantidade de pixels, ou seja, ao quadrado da
+   * escala. Com a média dos últimos RENDER_SCALE_FRAMES quadros, a escala é corrigida pela raiz da
+   * razão entre o tempo alvo e o tempo medido, arredondada para RENDER_SCALE_STEP
+   * @note Depois de uma mudança, as medidas antigas são descartadas, pois foram feitas com outra escala
+   */
+  float UpdateRenderScale(models::RenderScale &render_scale, float frame_time)
+  {
+    if (!render_scale.enabled || render_scale.target_fps <= 0.0f)
+    {
+      render_scale.scale = 1.0f;
+      render_scale.frame_times.clear();
+      return render_scale.scale;
+    }
+
+    render_scale.frame_times.push_back(frame_time);
+
+    if (render_scale.frame_times.size() < RENDER_SCALE_FRAMES)
+      return render_scale.scale;
+
+    float average = 0.0f;
+    for (float time : render_scale.frame_times)
+      average += time;
+    average /= static_cast<float>(render_scale.frame_times.size());
+
+    render_scale.frame_times.erase(render_scale.frame_times.begin());
+
+    float target = 1000.0f / render_scale.target_fps;
+
+    if (average <= 0.0f || std::fabs(average - target) <= target * RENDER_SCALE_TOLERANCE)
+      return render_scale.scale;
+
+    float scale = render_scale.scale * std::sqrt(target / average);
+    scale = std::round(scale / RENDER_SCALE_STEP) * RENDER_SCALE_STEP;
+    scale = std::clamp(scale, std::max(render_scale.min_scale, RENDER_SCALE_STEP), 1.0f);
+
+    if (scale != render_scale.scale)
+    {
+      render_scale.scale = scale;
+      render_scale.frame_times.clear();
+    }
+
+    return render_scale.scale;
+  }
+} // namespace models
@@ -0,0 +1,98 @@
+#include <models/golden.hpp>
+#include <models/batch.hpp>
+#include <shapes/shapes.hpp>
+
+#include <filesystem>
+
+namespace models
+{
+  /**
+   * @brief Retorna todas as combinações de pipeline e modelo de iluminação da regressão por imagem
+   *
+   * @return std::vector<models::GoldenCase> Adair e Smith com Flat, Gouraud e Phong
+   */
+  std::vector<models::GoldenCase> GoldenCases()
+  {
+    std::vector<models::GoldenCase> cases;
+
+    for (const char *pipeline : {"adair", "smith"})
+      for (const char *lighting : {"flat", "gouraud", "phong"})
+        cases.push_back({pipeline, lighting});
+
+    return cases;
+  }
+
+  /**
+   * @brief Monta a cena de referência
+   *
+   * @param golden_case Pipeline e modelo de iluminação
+   *
+   * @return models::Scene* Cena com objetos sobrepostos, um deles cortado pela borda da janela, e
+   * duas luzes omni (uma com raio de influência)
+   *
+   * @note Uma única thread no estágio de geometria, para que a referência não dependa da máquina
+   */
+  models::Scene *GoldenScene(const models::GoldenCase &golden_case)
+  {
+    // O pipeline de Smith normaliza o volume de visão por near e far, então a mesma câmera precisa de
+    // uma janela menor para enquadrar os objetos como no pipeline de Adair
+    core::Vector2 window = golden_case.pipeline == "smith" ? core::Vector2{1.0f, 0.75f} : core::Vector2{6.0f, 4.5f};
+
+    models::Scene *scene = new models::Scene(
+        models::CreateCamera3D({14.0f, 10.0f, 22.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, 30.0f, 12.0f, 45.0f),
+        {shapes::cube({-3.0f, 0.0f, 0.0f}),
+         shapes::icosphere(1.5f, 2, {1.5f, 0.5f, 1.0f}),
+         shapes::torus(2.0f, 0.6f, 24, 12, {0.0f, -1.5f, -3.0f}),
+         shapes::cone(1.2f, 2.5f, 16, {3.5f, 0.0f, -2.0f}),
+         shapes::cylinder(1.0f, 3.0f, 16, {-6.5f, 0.0f, 2.0f})},
+        {0.0f, 0.0f},
+        {static_cast<float>(GOLDEN_WIDTH - 1), static_cast<float>(GOLDEN_HEIGHT - 1)},
+        {-window.x, -window.y},
+        window);
+
+    models::Omni omni;
+    omni.position = {-2.0f, 4.0f, 3.0f};
+    omni.intensity = {180.0f, 120.0f, 60.0f};
+    omni.radius = 8.0f;
+    omni.id = "Omnidirectional light  " + std::to_string(scene->omni_lights.size());
+    scene->omni_lights.push_back(omni);
+
+    models::ParseRenderSetting("pipeline", golden_case.pipeline, scene->pipeline_model);
+    models::ParseRenderSetting("lighting", golden_case.lighting, scene->lighting_model);
+    scene->setWorkerThreads(1);
+
+    return scene;
+  }
+
+  /**
+   * @brief Renderiza um quadro da cena de referência
+   *
+   * @param golden_case Pipeline e modelo de iluminação
+   *
+   * @return std::vector<std::vector<models::Color>> Buffer de cores do quadro, indexado por [x][y]
+   */
+  std::vector<std::vector<models::Color>> RenderGolden(const models::GoldenCase &golden_case)
+  {
+    models::Scene *scene = GoldenScene(golden_case);
+
+    scene->pipeline();
+    std::vector<std::vector<models::Color>> color_buffer = scene->getFrontBuffer().color_buffer;
+
+    delete scene;
+
+    return color_buffer;
+  }
+
+  /**
+   * @brief Retorna o caminho da imagem de referência de uma combinação
+   *
+   * @param directory Diretório das imagens de referência
+   * @param golden_case Pipeline e modelo de iluminação
+   *
+   * @return std::string Caminho da imagem (<directory>/<pipeline>_<lighting>.ppm)
+   */
+  std::string GoldenReferencePath(const std::string &directory, const models::GoldenCase &golden_case)
+  {
+    return (std::filesystem::path(directory) / (golden_case.pipeline + "_" + golden_case.lighting + ".ppm")).string();
+  }
+} // namespace models
@@ -1,4 +1,9 @@
 #include <models/light.hpp>
+#include <models/shadow.hpp>
+#include <math/dispatch.hpp>
+
+#include <algorithm>
+#include <limits>
 
 namespace models
 {
@@ -26,45 +31,321 @@ namespace models
   }
 
   /**
-   * @brief Calcula a iluminação de um objeto utilizando o modelo de iluminação constante
+   * @brief Calcula o retângulo da tela alcançado por uma luz omni
+   *
+   * @param omni Luz omnidirecional
+   * @param transformation Matriz que leva do SRU para a tela (Adair) ou para o espaço de recorte (Smith)
+   * @param viewport Matriz de viewport aplicada depois da transformação (Smith) ou nullptr (Adair)
+   * @param width Largura da tela
+   * @param height Altura da tela
+   *
+   * @return core::Vector4 Retângulo da tela (x = min_x, y = min_y, z = max_x, w = max_y)
+   *
+   * @note Projeta os 8 cantos da caixa envolvente da esfera de influência. Se algum canto estiver
+   * atrás do observador, ou se a luz não tiver raio, retorna a tela inteira
+   */
+  core::Vector4 OmniBoundingBox(const models::Omni &omni, const core::Matrix &transformation, const core::Matrix *viewport, int width, int height)
+  {
+    core::Vector4 result = {0.0f, 0.0f, static_cast<float>(width - 1), static_cast<float>(height - 1)};
+
+    if (omni.radius <= 0.0f)
+      return result;
+
+    float min_x = std::numeric_limits<float>::max();
+    float min_y = std::numeric_limits<float>::max();
+    float max_x = std::numeric_limits<float>::lowest();
+    float max_y = std::numeric_limits<float>::lowest();
+
+    for (int i = 0; i < 8; i++)
+    {
+      core::Vector4 corner = {
+          omni.position.x + (i & 1 ? omni.radius : -omni.radius),
+          omni.position.y + (i & 2 ? omni.radius : -omni.radius),
+          omni.position.z + (i & 4 ? omni.radius : -omni.radius),
+          1.0f};
+
+      core::Vector4 v = math::MatrixMultiplyVector(transformation, corner);
+
+      // O canto está atrás do observador, a projeção não é confiável
+      if (v.w <= EPSILON)
+        return result;
+
+      if (viewport != nullptr)
+        v = math::MatrixMultiplyVector(*viewport, v);
+
+      float x = v.x / v.w;
+      float y = v.y / v.w;
+
+      min_x = std::min(min_x, x);
+      min_y = std::min(min_y, y);
+      max_x = std::max(max_x, x);
+      max_y = std::max(max_y, y);
+    }
+
+    return {min_x, min_y, max_x, max_y};
+  }
+
+  /**
+   * @brief Converte uma coordenada da tela no índice do bloco que a contém
+   *
+   * @param value Coordenada (x ou y)
+   * @param tile_size Tamanho do bloco em pixels
+   * @param count Quantidade de blocos no eixo
+   *
+   * @return int Índice do bloco, limitado a [0, count - 1]
+   *
+   * @note O valor é limitado antes da conversão para int, logo coordenadas infinitas ou NaN são seguras
+   */
+  static int TileIndex(float value, int tile_size, int count)
+  {
+    if (!(value > 0.0f))
+      return 0;
+
+    if (value >= static_cast<float>(count * tile_size))
+      return count - 1;
+
+    return static_cast<int>(value) / tile_size;
+  }
+
+  /**
+   * @brief Distribui as luzes omni nos blocos da tela que elas alcançam
+   *
+   * @param tiles Listas de luzes por bloco (reaproveita a memória já alocada)
+   * @param bounds Retângulo da tela de cada luz (ver OmniBoundingBox)
+   * @param width Largura da tela
+   * @param height Altura da tela
+   *
+   * @note As luzes são inseridas em ordem crescente de índice, então a soma das contribuições segue
+   * a mesma ordem do laço sobre todas as luzes
+   */
+  void BinOmniLights(models::LightTiles &tiles, const std::vector<core::Vector4> &bounds, int width, int height)
+  {
+    tiles.columns = std::max(1, (width + tiles.tile_size - 1) / tiles.tile_size);
+    tiles.rows = std::max(1, (height + tiles.tile_size - 1) / tiles.tile_size);
+    tiles.lights.resize(tiles.columns * tiles.rows);
+
+    for (auto &list : tiles.lights)
+      list.clear();
+
+    for (unsigned int i = 0; i < bounds.size(); i++)
+    {
+      const core::Vector4 &box = bounds[i];
+
+      // A luz está totalmente fora da tela
+      if (box.z < 0.0f || box.w < 0.0f || box.x > static_cast<float>(width - 1) || box.y > static_cast<float>(height - 1))
+        continue;
+
+      int min_column = TileIndex(box.x, tiles.tile_size, tiles.columns);
+      int max_column = TileIndex(box.z, tiles.tile_size, tiles.columns);
+      int min_row = TileIndex(box.y, tiles.tile_size, tiles.rows);
+      int max_row = TileIndex(box.w, tiles.tile_size, tiles.rows);
+
+      for (int row = min_row; row <= max_row; row++)
+        for (int column = min_column; column <= max_column; column++)
+          tiles.lights[row * tiles.columns + column].push_back(i);
+    }
+  }
+
+  /**
+   * @brief Retorna a lista de luzes do bloco que contém um pixel
+   *
+   * @param tiles Listas de luzes por bloco
+   * @param x Coordenada x do pixel
+   * @param y Coordenada y do pixel
+   *
+   * @return const std::vector<unsigned int>& Índices das luzes do bloco
+   *
+   * @note Pixels fora da tela usam o bloco mais próximo
+   */
+  const std::vector<unsigned int> &GetTileLights(const models::LightTiles &tiles, float x, float y)
+  {
+    int column = TileIndex(x, tiles.tile_size, tiles.columns);
+    int row = TileIndex(y, tiles.tile_size, tiles.rows);
+
+    return tiles.lights[row * tiles.columns + column];
+  }
+
+  /**
+   * @brief Reúne as luzes de todos os blocos cobertos por um retângulo da tela
+   *
+   * @param tiles Listas de luzes por bloco
+   * @param box Retângulo da tela (x = min_x, y = min_y, z = max_x, w = max_y)
+   * @param result Índices das luzes, sem repetição e em ordem crescente
+   */
+  void GatherTileLights(const models::LightTiles &tiles, const core::Vector4 &box, std::vector<unsigned int> &result)
+  {
+    result.clear();
+
+    int min_column = TileIndex(box.x, tiles.tile_size, tiles.columns);
+    int max_column = TileIndex(box.z, tiles.tile_size, tiles.columns);
+    int min_row = TileIndex(box.y, tiles.tile_size, tiles.rows);
+    int max_row = TileIndex(box.w, tiles.tile_size, tiles.rows);
+
+    for (int row = min_row; row <= max_row; row++)
+      for (int column = min_column; column <= max_column; column++)
+      {
+        const std::vector<unsigned int> &list = tiles.lights[row * tiles.columns + column];
+        result.insert(result.end(), list.begin(), list.end());
+      }
+
+    // Um único bloco já está ordenado e sem repetições
+    if (min_row == max_row && min_column == max_column)
+      return;
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+  }
+
+  /**
+   * @brief Reúne as luzes omni que alcançam a caixa envolvente de um bloco de pontos
+   *
+   * @param omni Luzes omnidirecionais
+   * @param positions Pontos do bloco (coordenadas do SRU)
+   * @param count Quantidade de pontos
+   * @param result Índices das luzes, em ordem crescente
+   *
+   * @note Ao contrário dos blocos da tela, não depende da câmera e pode ser usada na iluminação guardada
+   * em models::LightingCache. Luzes sem raio alcançam todos os pontos
+   */
+  void GatherOmniLights(const std::vector<models::Omni> &omni, const core::Vector3 *positions, size_t count, std::vector<unsigned int> &result)
+  {
+    result.clear();
+
+    if (count == 0)
+      return;
+
+    core::Vector3 min = positions[0];
+    core::Vector3 max = positions[0];
+
+    for (size_t i = 1; i < count; i++)
+    {
+      min = {std::min(min.x, positions[i].x), std::min(min.y, positions[i].y), std::min(min.z, positions[i].z)};
+      max = {std::max(max.x, positions[i].x), std::max(max.y, positions[i].y), std::max(max.z, positions[i].z)};
+    }
+
+    for (unsigned int i = 0; i < omni.size(); i++)
+    {
+      const core::Vector3 &position = omni[i].position;
+
+      // Ponto da caixa mais próximo da luz: nenhum ponto do bloco está mais perto dela
+      core::Vector3 closest = {std::clamp(position.x, min.x, max.x), std::clamp(position.y, min.y, max.y), std::clamp(position.z, min.z, max.z)};
+
+      if (omni[i].radius <= 0.0f || math::Vector3Distance(position, closest) <= omni[i].radius)
+        result.push_back(i);
+    }
+  }
+
+  /**
+   * @brief Calcula os termos da iluminação constante que não dependem do observador (ambiente e difuso)
    *
+   * @tparam Precision Política de precisão (math::Exact ou math::Fast)
    * @param light Luz ambiente da cena
-   * @param omni Lampa omnidirecionais
+   * @param omni Lampadas omnidirecionais
+   * @param lights Índices das luzes consideradas (nullptr = todas)
    * @param centroid Centroide da face
-   * @param eye Posição do observador (câmera)
+   * @param face_normal Vetor normal da face
    * @param material Material do objeto
+   *
+   * @return models::ColorFloat Soma dos termos ambiente e difuso
+   *
+   * @note Expandida em cada variante do conjunto de instruções (ver ISA_KERNEL)
    */
-  models::Color FlatShading(const models::Light &light, const std::vector<models::Omni> &omni, const core::Vector3 &centroid, const core::Vector3 &face_normal, const core::Vector3 &eye, const models::Material &material)
+  template <typename Precision>
+  static ISA_KERNEL models::ColorFloat FlatDiffuseLights(const models::Light &light, const std::vector<models::Omni> &omni, const std::vector<unsigned int> *lights, const core::Vector3 &centroid, const core::Vector3 &face_normal, const models::Material &material)
   {
-    models::Color ambient_illumination = models::BLACK;
-    models::Color diffuse_illumination = models::BLACK;
-    models::Color specular_illumination = models::BLACK;
+    // As contribuições são acumuladas em float, sem limitar ou arredondar (ver models::ResolveFrameBuffer)
+    models::ColorFloat ambient_illumination;
+    models::ColorFloat diffuse_illumination;
 
     // Passo 1: Calcular a iluminação ambiente
-    ambient_illumination.r = static_cast<models::Uint8>(math::Clamp(light.intensity.r * material.ambient.r, 0, 255));
-    ambient_illumination.g = static_cast<models::Uint8>(math::Clamp(light.intensity.g * material.ambient.g, 0, 255));
-    ambient_illumination.b = static_cast<models::Uint8>(math::Clamp(light.intensity.b * material.ambient.b, 0, 255));
+    if (FLAT_AMBIENT_TERM)
+    {
+      ambient_illumination.r = light.intensity.r * material.ambient.r;
+      ambient_illumination.g = light.intensity.g * material.ambient.g;
+      ambient_illumination.b = light.intensity.b * material.ambient.b;
+    }
 
-    // pre computar o vetor S (direção do observador) já que ele é constante
-    core::Vector3 S = math::Vector3Normalize(math::Vector3Subtract(eye, centroid));
+    size_t count = lights != nullptr ? lights->size() : omni.size();
 
     // Para cada fonte de luz na cena
-    for (auto lamp : omni)
+    for (size_t i = 0; i < count; i++)
     {
-      // Passo 2: Calcular a iluminação difusa
-      // Vetor da luz (direção da luz)
-      core::Vector3 L = math::Vector3Normalize(math::Vector3Subtract(lamp.position, centroid));
+      const models::Omni &lamp = omni[lights != nullptr ? (*lights)[i] : i];
 
-      float cos_theta = math::Vector3DotProduct(face_normal, L);
+      float attenuation = models::OmniAttenuation(lamp, centroid);
+
+      if (attenuation <= 0.0f)
+        continue;
+
+      attenuation *= models::OmniVisibility(lamp, centroid);
+
+      if (attenuation <= 0.0f)
+        continue;
+
+      // Passo 2: Calcular a iluminação difusa
+      // Cosseno entre a normal e o vetor da luz (direção da luz), sem montar o vetor normalizado
+      float cos_theta = Precision::NormalizeDot(face_normal, math::Vector3Subtract(lamp.position, centroid));
 
       models::ColorChannels kd = material.diffuse;
 
       if (cos_theta > 0)
       {
-        diffuse_illumination.r = static_cast<models::Uint8>(math::Clamp(diffuse_illumination.r + (lamp.intensity.r * kd.r * cos_theta), 0, 255));
-        diffuse_illumination.g = static_cast<models::Uint8>(math::Clamp(diffuse_illumination.g + (lamp.intensity.g * kd.g * cos_theta), 0, 255));
-        diffuse_illumination.b = static_cast<models::Uint8>(math::Clamp(diffuse_illumination.b + (lamp.intensity.b * kd.b * cos_theta), 0, 255));
+        diffuse_illumination.r += lamp.intensity.r * kd.r * cos_theta * attenuation;
+        diffuse_illumination.g += lamp.intensity.g * kd.g * cos_theta * attenuation;
+        diffuse_illumination.b += lamp.intensity.b * kd.b * cos_theta * attenuation;
       }
+    }
+
+    return {
+        ambient_illumination.r + diffuse_illumination.r,
+        ambient_illumination.g + diffuse_illumination.g,
+        ambient_illumination.b + diffuse_illumination.b,
+        static_cast<float>(MAX_COLOR_VALUE)};
+  }
+
+  /**
+   * @brief Calcula o termo especular da iluminação constante, o único que depende do observador
+   *
+   * @tparam Precision Política de precisão (math::Exact ou math::Fast)
+   * @param omni Lampadas omnidirecionais
+   * @param lights Índices das luzes consideradas (nullptr = todas)
+   * @param centroid Centroide da face
+   * @param face_normal Vetor normal da face
+   * @param eye Posição do observador (câmera)
+   * @param material Material do objeto
+   *
+   * @return models::ColorFloat Termo especular
+   *
+   * @note Expandida em cada variante do conjunto de instruções (ver ISA_KERNEL)
+   */
+  template <typename Precision>
+  static ISA_KERNEL models::ColorFloat FlatSpecularLights(const std::vector<models::Omni> &omni, const std::vector<unsigned int> *lights, const core::Vector3 &centroid, const core::Vector3 &face_normal, const core::Vector3 &eye, const models::Material &material)
+  {
+    models::ColorFloat specular_illumination;
+
+    // pre computar o vetor S (direção do observador) já que ele é constante
+    core::Vector3 S = Precision::Normalize(math::Vector3Subtract(eye, centroid));
+
+    size_t count = lights != nullptr ? lights->size() : omni.size();
+
+    // Para cada fonte de luz na cena
+    for (size_t i = 0; i < count; i++)
+    {
+      const models::Omni &lamp = omni[lights != nullptr ? (*lights)[i] : i];
+
+      float attenuation = models::OmniAttenuation(lamp, centroid);
+
+      if (attenuation <= 0.0f)
+        continue;
+
+      attenuation *= models::OmniVisibility(lamp, centroid);
+
+      if (attenuation <= 0.0f)
+        continue;
+
+      core::Vector3 L = Precision::Normalize(math::Vector3Subtract(lamp.position, centroid));
+
+      float cos_theta = math::Vector3DotProduct(face_normal, L);
 
       // Passo 3: Calcular a iluminação especular
 
@@ -79,129 +360,392 @@ namespace models
 
       if (cos_alpha > 0)
       {
-        specular_illumination.b = static_cast<models::Uint8>(math::Clamp(specular_illumination.r + (lamp.intensity.r * ks.b * pow(cos_alpha, n)), 0, 255));
-        specular_illumination.r = static_cast<models::Uint8>(math::Clamp(specular_illumination.g + (lamp.intensity.g * ks.r * pow(cos_alpha, n)), 0, 255));
-        specular_illumination.g = static_cast<models::Uint8>(math::Clamp(specular_illumination.b + (lamp.intensity.b * ks.g * pow(cos_alpha, n)), 0, 255));
+        float specular = Precision::Pow(cos_alpha, n);
+
+        specular_illumination.r += lamp.intensity.r * ks.r * specular * attenuation;
+        specular_illumination.g += lamp.intensity.g * ks.g * specular * attenuation;
+        specular_illumination.b += lamp.intensity.b * ks.b * specular * attenuation;
       }
     }
 
-    models::Color color = models::BLACK;
-
-    ambient_illumination = {0, 0, 0, 255};
-    // diffuse_illumination = models::BLACK;
-    specular_illumination = {0, 0, 0, 255};
+    return specular_illumination;
+  }
 
+  /**
+   * @brief Calcula a iluminação constante com uma lista opcional de luzes
+   *
+   * @tparam Precision Política de precisão (math::Exact ou math::Fast)
+   * @param light Luz ambiente da cena
+   * @param omni Lampadas omnidirecionais
+   * @param lights Índices das luzes consideradas (nullptr = todas)
+   * @param centroid Centroide da face
+   * @param face_normal Vetor normal da face
+   * @param eye Posição do observador (câmera)
+   * @param material Material do objeto
+   *
+   * @return models::ColorFloat Cor da face
+   *
+   * @note Os termos usados são definidos por FLAT_AMBIENT_TERM e FLAT_SPECULAR_TERM
+   */
+  template <typename Precision>
+  static models::ColorFloat FlatShadingLights(const models::Light &light, const std::vector<models::Omni> &omni, const std::vector<unsigned int> *lights, const core::Vector3 &centroid, const core::Vector3 &face_normal, const core::Vector3 &eye, const models::Material &material)
+  {
     // Passo 4: Calcular a cor final
-    color.r = static_cast<models::Uint8>(math::Clamp(static_cast<float>(ambient_illumination.r + diffuse_illumination.r + specular_illumination.r), 0, 255));
-    color.g = static_cast<models::Uint8>(math::Clamp(static_cast<float>(ambient_illumination.g + diffuse_illumination.g + specular_illumination.g), 0, 255));
-    color.b = static_cast<models::Uint8>(math::Clamp(static_cast<float>(ambient_illumination.b + diffuse_illumination.b + specular_illumination.b), 0, 255));
+    models::ColorFloat color = FlatDiffuseLights<Precision>(light, omni, lights, centroid, face_normal, material);
+
+    if (models::FlatViewDependent(material))
+    {
+      models::ColorFloat specular_illumination = FlatSpecularLights<Precision>(omni, lights, centroid, face_normal, eye, material);
+
+      color.r += specular_illumination.r;
+      color.g += specular_illumination.g;
+      color.b += specular_illumination.b;
+    }
 
     return color;
   }
 
+  /**
+   * @brief Calcula a iluminação de um objeto utilizando o modelo de iluminação constante
+   *
+   * @tparam Precision Política de precisão (math::Exact ou math::Fast)
+   * @param light Luz ambiente da cena
+   * @param omni Lampa omnidirecionais
+   * @param centroid Centroide da face
+   * @param eye Posição do observador (câmera)
+   * @param material Material do objeto
+   */
+  template <typename Precision>
+  models::ColorFloat FlatShading(const models::Light &light, const std::vector<models::Omni> &omni, const core::Vector3 &centroid, const core::Vector3 &face_normal, const core::Vector3 &eye, const models::Material &material)
+  {
+    return FlatShadingLights<Precision>(light, omni, nullptr, centroid, face_normal, eye, material);
+  }
+
   /**
    * @brief Calcula a iluminação de um objeto utilizando o modelo de iluminação de Gouraud
    *
+   * @tparam Precision Política de precisão (math::Exact ou math::Fast)
    * @param light Luz ambiente da cena
    * @param omni Vetor de Lampa omnidirecionais
    * @param vertexes Vértice da face e Normal médio do vértice
    * @param eye Posição do observador (câmera)
    * @param material Material do objeto
    *
-   * @return models::Color Cor do vértice
+   * @return models::ColorFloat Cor do vértice
    */
-  models::Color GouraudShading(const models::Light &light, const std::vector<models::Omni> &omni, const std::pair<core::Vector3, core::Vector3> &vertex, const core::Vector3 &eye, const models::Material &material)
+  template <typename Precision>
+  models::ColorFloat GouraudShading(const models::Light &light, const std::vector<models::Omni> &omni, const std::pair<core::Vector3, core::Vector3> &vertex, const core::Vector3 &eye, const models::Material &material)
   {
-    return FlatShading(light, omni, vertex.first, vertex.second, eye, material);
+    return FlatShading<Precision>(light, omni, vertex.first, vertex.second, eye, material);
   }
 
   /**
-   * @brief Calcula a iluminação de um objeto utilizando o modelo de iluminação de Phong
+   * @brief Verifica se a iluminação constante de um material depende do observador
    *
+   * @param material Material do objeto
+   *
+   * @return bool Verdadeiro se o termo especular é usado e o material tem cor especular
+   */
+  bool FlatViewDependent(const models::Material &material)
+  {
+    if (!FLAT_SPECULAR_TERM)
+      return false;
+
+    return material.specular.r != 0.0f || material.specular.g != 0.0f || material.specular.b != 0.0f;
+  }
+
+  /**
+   * @brief Corpo de FlatDiffuseColors, expandido em cada variante do conjunto de instruções
+   *
+   * @note Os parâmetros são os de FlatDiffuseColors
+   */
+  template <typename Precision>
+  static ISA_KERNEL void FlatDiffuseColorsKernel(const models::Light &light, const std::vector<models::Omni> &omni, const std::vector<unsigned int> &lights, const core::Vector3 *positions, const core::Vector3 *normals, size_t count, const models::Material &material, core::Vector3 *diffuse)
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      models::ColorFloat color = FlatDiffuseLights<Precision>(light, omni, &lights, positions[i], normals[i], material);
+      diffuse[i] = {color.r, color.g, color.b};
+    }
+  }
+
+  ISA_TEMPLATE_VARIANTS(FlatDiffuseColors, FlatDiffuseColorsKernel, (const models::Light &light, const std::vector<models::Omni> &omni, const std::vector<unsigned int> &lights, const core::Vector3 *positions, const core::Vector3 *normals, size_t count, const models::Material &material, core::Vector3 *diffuse), (light, omni, lights, positions, normals, count, material, diffuse))
+
+  /**
+   * @brief Calcula os termos da iluminação constante que não dependem do observador de um bloco de elementos
+   *
+   * @tparam Precision Política de precisão (math::Exact ou math::Fast)
    * @param light Luz ambiente da cena
-   * @param omni Vetor de Lampa omnidirecionais
-   * @param centroid Centroide da face
-   * @param pixel Posição do pixel
-   * @param pixel_normal Normal do pixel
+   * @param omni Vetor de Lampadas omnidirecionais
+   * @param lights Índices das luzes que alcançam o bloco (ver GatherOmniLights)
+   * @param positions Posição (SRU) de cada elemento: centroide da face (Flat) ou vértice (Gouraud)
+   * @param normals Normal de cada elemento
+   * @param count Quantidade de elementos
+   * @param material Material do objeto
+   * @param diffuse Termos ambiente e difuso (r, g, b) de cada elemento
+   *
+   * @note Não usa os blocos da tela, que dependem da câmera: as luzes fora da lista não alcançam nenhum
+   * elemento e seriam descartadas pela atenuação, então o resultado é o mesmo do laço sobre todas as luzes
+   */
+  template <typename Precision>
+  void FlatDiffuseColors(const models::Light &light, const std::vector<models::Omni> &omni, const std::vector<unsigned int> &lights, const core::Vector3 *positions, const core::Vector3 *normals, size_t count, const models::Material &material, core::Vector3 *diffuse)
+  {
+    ISA_TEMPLATE_DISPATCH(FlatDiffuseColors, Precision)(light, omni, lights, positions, normals, count, material, diffuse);
+  }
+
+  /**
+   * @brief Corpo de FlatSpecularColors, expandido em cada variante do conjunto de instruções
+   *
+   * @note Os parâmetros são os de FlatSpecularColors
+   */
+  template <typename Precision>
+  static ISA_KERNEL void FlatSpecularColorsKernel(const std::vector<models::Omni> &omni, const std::vector<unsigned int> &lights, const core::Vector3 *positions, const core::Vector3 *normals, size_t count, const core::Vector3 &eye, const models::Material &material, const core::Vector3 *diffuse, core::Vector3 *colors)
+  {
+    if (!models::FlatViewDependent(material))
+    {
+      std::copy(diffuse, diffuse + count, colors);
+      return;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+      models::ColorFloat specular = FlatSpecularLights<Precision>(omni, &lights, positions[i], normals[i], eye, material);
+      colors[i] = {diffuse[i].x + specular.r, diffuse[i].y + specular.g, diffuse[i].z + specular.b};
+    }
+  }
+
+  ISA_TEMPLATE_VARIANTS(FlatSpecularColors, FlatSpecularColorsKernel, (const std::vector<models::Omni> &omni, const std::vector<unsigned int> &lights, const core::Vector3 *positions, const core::Vector3 *normals, size_t count, const core::Vector3 &eye, const models::Material &material, const core::Vector3 *diffuse, core::Vector3 *colors), (omni, lights, positions, normals, count, eye, material, diffuse, colors))
+
+  /**
+   * @brief Completa a iluminação constante de um bloco de elementos com o termo especular
+   *
+   * @tparam Precision Política de precisão (math::Exact ou math::Fast)
+   * @param omni Vetor de Lampadas omnidirecionais
+   * @param lights Índices das luzes que alcançam o bloco (ver GatherOmniLights)
+   * @param positions Posição (SRU) de cada elemento
+   * @param normals Normal de cada elemento
+   * @param count Quantidade de elementos
    * @param eye Posição do observador (câmera)
    * @param material Material do objeto
-   * @return models::Color Cor do pixel
+   * @param diffuse Termos ambiente e difuso de cada elemento (ver FlatDiffuseColors)
+   * @param colors Cor final (r, g, b) de cada elemento
+   *
+   * @note Se a iluminação não depende do observador (ver FlatViewDependent), apenas copia diffuse
    */
-  models::Color PhongIllumination(const models::Light &light, const std::vector<models::Omni> &omni, const core::Vector3 &centroid, const core::Vector3 &pixel, const core::Vector3 &pixel_normal, const core::Vector3 &eye, const models::Material &material)
+  template <typename Precision>
+  void FlatSpecularColors(const std::vector<models::Omni> &omni, const std::vector<unsigned int> &lights, const core::Vector3 *positions, const core::Vector3 *normals, size_t count, const core::Vector3 &eye, const models::Material &material, const core::Vector3 *diffuse, core::Vector3 *colors)
   {
-    models::Color ambient_illumination = models::BLACK;
-    models::Color diffuse_illumination = models::BLACK;
-    models::Color specular_illumination = models::BLACK;
+    ISA_TEMPLATE_DISPATCH(FlatSpecularColors, Precision)(omni, lights, positions, normals, count, eye, material, diffuse, colors);
+  }
 
-    core::Vector3 pixel_normal_normalized = math::Vector3Normalize(pixel_normal);
+  /**
+   * @brief Verifica se os termos que não dependem do observador ainda são válidos
+   *
+   * @param cache Iluminação da malha
+   * @param version Versão atual da malha
+   * @param normal_algorithm Algoritmo atual dos vetores normais
+   * @param light Luz ambiente da cena
+   * @param omni Vetor de Lampadas omnidirecionais (com os mapas de sombra do quadro)
+   * @param material Material do objeto
+   * @param precision Precisão da iluminação (EXACT_PRECISION ou FAST_PRECISION)
+   *
+   * @return bool Verdadeiro se nem a malha, nem as luzes, nem o material, nem a precisão mudaram
+   */
+  bool LightingCacheMatches(const models::LightingCache &cache, unsigned long version, int normal_algorithm, const models::Light &light, const std::vector<models::Omni> &omni, const models::Material &material, int precision)
+  {
+    if (cache.version != version || cache.normal_algorithm != normal_algorithm || cache.precision != precision)
+      return false;
 
-    // Passo 1: Calcular a iluminação ambiente
-    ambient_illumination.r = static_cast<models::Uint8>(math::Clamp(light.intensity.r * material.ambient.r, 0, 255));
-    ambient_illumination.g = static_cast<models::Uint8>(math::Clamp(light.intensity.g * material.ambient.g, 0, 255));
-    ambient_illumination.b = static_cast<models::Uint8>(math::Clamp(light.intensity.b * material.ambient.b, 0, 255));
+    if (!models::CompareColors(cache.global_light.intensity, light.intensity))
+      return false;
 
-    // pre computar o vetor S (direção do observador) já que ele é constante
-    core::Vector3 S = math::Vector3Normalize(math::Vector3Subtract(eye, centroid));
+    const models::Material &m = cache.material;
+    if (m.ambient.r != material.ambient.r || m.ambient.g != material.ambient.g || m.ambient.b != material.ambient.b ||
+        m.diffuse.r != material.diffuse.r || m.diffuse.g != material.diffuse.g || m.diffuse.b != material.diffuse.b ||
+        m.specular.r != material.specular.r || m.specular.g != material.specular.g || m.specular.b != material.specular.b ||
+        m.shininess != material.shininess)
+      return false;
 
-    // Para cada fonte de luz na cena
-    for (auto lamp : omni)
+    if (cache.omni_lights.size() != omni.size())
+      return false;
+
+    for (size_t i = 0; i < omni.size(); i++)
     {
-      // Passo 2: Calcular a iluminação difusa
-      // Vetor da luz (direção da luz)
-      core::Vector3 L = math::Vector3Normalize(math::Vector3Subtract(lamp.position, centroid));
+      const models::Omni &a = cache.omni_lights[i];
+      const models::Omni &b = omni[i];
 
-      float cos_theta = math::Vector3DotProduct(pixel_normal_normalized, L);
+      if (a.position.x != b.position.x || a.position.y != b.position.y || a.position.z != b.position.z)
+        return false;
 
-      models::ColorChannels kd = material.diffuse;
+      if (a.intensity.r != b.intensity.r || a.intensity.g != b.intensity.g || a.intensity.b != b.intensity.b)
+        return false;
 
-      if (cos_theta > 0)
-      {
-        diffuse_illumination.r = static_cast<models::Uint8>(math::Clamp(diffuse_illumination.r + (lamp.intensity.r * kd.r * cos_theta), 0, 255));
-        diffuse_illumination.g = static_cast<models::Uint8>(math::Clamp(diffuse_illumination.g + (lamp.intensity.g * kd.g * cos_theta), 0, 255));
-        diffuse_illumination.b = static_cast<models::Uint8>(math::Clamp(diffuse_illumination.b + (lamp.intensity.b * kd.b * cos_theta), 0, 255));
+      // Um mapa de sombra refeito é sempre um novo objeto (ver Scene::updateShadowMaps)
+      if (a.radius != b.radius || a.shadow_map != b.shadow_map)
+        return false;
+    }
 
-        // Passo 3: Calcular a iluminação especular
-        core::Vector3 LS = math::Vector3Add(L, S);
-        core::Vector3 H = math::Vector3Normalize(LS);
+    return true;
+  }
 
-        float cos_alpha = math::Vector3DotProduct(pixel_normal_normalized, H);
+  /**
+   * @brief Verifica se as cores finais ainda são válidas para o observador
+   *
+   * @param cache Iluminação da malha
+   * @param eye Posição do observador (câmera)
+   *
+   * @return bool Verdadeiro se as cores foram calculadas para este observador ou não dependem dele
+   */
+  bool LightingCacheViewMatches(const models::LightingCache &cache, const core::Vector3 &eye)
+  {
+    if (!cache.view_valid)
+      return false;
 
-        models::ColorChannels ks = material.specular;
-        float n = material.shininess;
+    if (!models::FlatViewDependent(cache.material))
+      return true;
 
-        if (cos_alpha > 0)
-        {
-          specular_illumination.b = static_cast<models::Uint8>(math::Clamp(specular_illumination.r + (lamp.intensity.r * ks.b * pow(cos_alpha, n)), 0, 255));
-          specular_illumination.r = static_cast<models::Uint8>(math::Clamp(specular_illumination.g + (lamp.intensity.g * ks.r * pow(cos_alpha, n)), 0, 255));
-          specular_illumination.g = static_cast<models::Uint8>(math::Clamp(specular_illumination.b + (lamp.intensity.b * ks.g * pow(cos_alpha, n)), 0, 255));
-        }
-      }
-    }
+    return cache.eye.x == eye.x && cache.eye.y == eye.y && cache.eye.z == eye.z;
+  }
 
-    models::Color color = models::BLACK;
+  /**
+   * @brief Guarda a chave dos termos que não dependem do observador e os prepara para serem recalculados
+   *
+   * @param cache Iluminação da malha
+   * @param version Versão atual da malha
+   * @param normal_algorithm Algoritmo atual dos vetores normais
+   * @param light Luz ambiente da cena
+   * @param omni Vetor de Lampadas omnidirecionais (com os mapas de sombra do quadro)
+   * @param material Material do objeto
+   * @param count Quantidade de elementos (faces ou vértices) da malha
+   * @param precision Precisão da iluminação (EXACT_PRECISION ou FAST_PRECISION)
+   *
+   * @note Invalida também as cores finais. Os termos são preenchidos depois, em blocos, por
+   * FlatDiffuseColors e FlatSpecularColors
+   */
+  void BeginLightingCache(models::LightingCache &cache, unsigned long version, int normal_algorithm, const models::Light &light, const std::vector<models::Omni> &omni, const models::Material &material, size_t count, int precision)
+  {
+    cache.version = version;
+    cache.normal_algorithm = normal_algorithm;
+    cache.precision = precision;
+    cache.global_light = light;
+    cache.omni_lights = omni;
+    cache.material = material;
+    cache.diffuse.resize(count);
+    cache.colors.resize(count);
+    cache.view_valid = false;
+  }
 
-    // Passo 4: Calcular a cor final
-    color.r = static_cast<models::Uint8>(math::Clamp(static_cast<float>(ambient_illumination.r + diffuse_illumination.r + specular_illumination.r), 0, 255));
-    color.g = static_cast<models::Uint8>(math::Clamp(static_cast<float>(ambient_illumination.g + diffuse_illumination.g + specular_illumination.g), 0, 255));
-    color.b = static_cast<models::Uint8>(math::Clamp(static_cast<float>(ambient_illumination.b + diffuse_illumination.b + specular_illumination.b), 0, 255));
+  /**
+   * @brief Guarda o observador das cores finais, que depois são preenchidas por FlatSpecularColors
+   *
+   * @param cache Iluminação da malha
+   * @param eye Posição do observador (câmera)
+   */
+  void BeginLightingCacheView(models::LightingCache &cache, const core::Vector3 &eye)
+  {
+    cache.eye = eye;
+    cache.view_valid = true;
+  }
 
-    return color;
+  ISA_TEMPLATE_VARIANTS(PhongIlluminationLights, PhongIlluminationLights, (const models::Light &light, const std::vector<models::Omni> &omni, const std::vector<unsigned int> *lights, const core::Vector3 &centroid, const core::Vector3 &pixel, const core::Vector3 &pixel_normal, const core::Vector3 &eye, const models::Material &material), (light, omni, lights, centroid, pixel, pixel_normal, eye, material))
+
+  /**
+   * @brief Calcula a iluminação de um objeto utilizando o modelo de iluminação de Phong
+   *
+   * @tparam Precision Política de precisão (math::Exact ou math::Fast)
+   * @param light Luz ambiente da cena
+   * @param omni Vetor de Lampa omnidirecionais
+   * @param centroid Centroide da face
+   * @param pixel Posição do pixel
+   * @param pixel_normal Normal do pixel
+   * @param eye Posição do observador (câmera)
+   * @param material Material do objeto
+   * @return models::ColorFloat Cor do pixel
+   */
+  template <typename Precision>
+  models::ColorFloat PhongIllumination(const models::Light &light, const std::vector<models::Omni> &omni, const core::Vector3 &centroid, const core::Vector3 &pixel, const core::Vector3 &pixel_normal, const core::Vector3 &eye, const models::Material &material)
+  {
+    return ISA_TEMPLATE_DISPATCH(PhongIlluminationLights, Precision)(light, omni, nullptr, centroid, pixel, pixel_normal, eye, material);
+  }
+
+  /**
+   * @brief Calcula a iluminação de Phong considerando apenas as luzes de uma lista
+   *
+   * @tparam Precision Política de precisão (math::Exact ou math::Fast)
+   * @param light Luz ambiente da cena
+   * @param omni Vetor de Lampadas omnidirecionais
+   * @param lights Índices das luzes do bloco da tela que contém o pixel
+   * @param centroid Centroide da face
+   * @param pixel Posição do pixel
+   * @param pixel_normal Normal do pixel
+   * @param eye Posição do observador (câmera)
+   * @param material Material do objeto
+   *
+   * @return models::ColorFloat Cor do pixel
+   */
+  template <typename Precision>
+  models::ColorFloat PhongIllumination(const models::Light &light, const std::vector<models::Omni> &omni, const std::vector<unsigned int> &lights, const core::Vector3 &centroid, const core::Vector3 &pixel, const core::Vector3 &pixel_normal, const core::Vector3 &eye, const models::Material &material)
+  {
+    return ISA_TEMPLATE_DISPATCH(PhongIlluminationLights, Precision)(light, omni, &lights, centroid, pixel, pixel_normal, eye, material);
   }
 
   /**
    * @brief Calcula a iluminação de um objeto utilizando o modelo de iluminação de Phong
    *
+   * @tparam Precision Política de precisão (math::Exact ou math::Fast)
    * @param light Luz ambiente da cena
    * @param omni Vetor de Lampa omnidirecionais
    * @param vertex Vértice da face e Normal médio do vértice
    * @param eye Posição do observador (câmera)
    * @param material Material do objeto
    *
-   * @return models::Color Cor do vértice
+   * @return models::ColorFloat Cor do vértice
    */
-  models::Color PhongShading(const models::Light &light, const std::vector<models::Omni> &omni, const core::Vector3 &centroid, const std::pair<core::Vector3, core::Vector3> &vertex, const core::Vector3 &eye, const models::Material &material)
+  template <typename Precision>
+  models::ColorFloat PhongShading(const models::Light &light, const std::vector<models::Omni> &omni, const core::Vector3 &centroid, const std::pair<core::Vector3, core::Vector3> &vertex, const core::Vector3 &eye, const models::Material &material)
   {
-    return PhongIllumination(light, omni, centroid, vertex.first, vertex.second, eye, material);
+    return PhongIllumination<Precision>(light, omni, centroid, vertex.first, vertex.second, eye, material);
   }
 
-} // namespace models
\ No newline at end of file
+  /**
+   * @brief Calcula a iluminação de Phong considerando apenas as luzes de uma lista
+   *
+   * @tparam Precision Política de precisão (math::Exact ou math::Fast)
+   * @param light Luz ambiente da cena
+   * @param omni Vetor de Lampadas omnidirecionais
+   * @param lights Índices das luzes do bloco da tela que contém o pixel
+   * @param centroid Centroide da face
+   * @param vertex Pixel e normal interpolada
+   * @param eye Posição do observador (câmera)
+   * @param material Material do objeto
+   *
+   * @return models::ColorFloat Cor do pixel
+   */
+  template <typename Precision>
+  models::ColorFloat PhongShading(const models::Light &light, const std::vector<models::Omni> &omni, const std::vector<unsigned int> &lights, const core::Vector3 &centroid, const std::pair<core::Vector3, core::Vector3> &vertex, const core::Vector3 &eye, const models::Material &material)
+  {
+    return PhongIllumination<Precision>(light, omni, lights, centroid, vertex.first, vertex.second, eye, material);
+  }
+
+  //-------------------------------------------------------------------------------------------------
+  // Instâncias das políticas de precisão (ver math::Exact e math::Fast)
+  //-------------------------------------------------------------------------------------------------
+
+  template models::ColorFloat FlatShading<math::Exact>(const models::Light &, const std::vector<models::Omni> &, const core::Vector3 &, const core::Vector3 &, const core::Vector3 &, const models::Material &);
+  template models::ColorFloat FlatShading<math::Fast>(const models::Light &, const std::vector<models::Omni> &, const core::Vector3 &, const core::Vector3 &, const core::Vector3 &, const models::Material &);
+  template models::ColorFloat GouraudShading<math::Exact>(const models::Light &, const std::vector<models::Omni> &, const std::pair<core::Vector3, core::Vector3> &, const core::Vector3 &, const models::Material &);
+  template models::ColorFloat GouraudShading<math::Fast>(const models::Light &, const std::vector<models::Omni> &, const std::pair<core::Vector3, core::Vector3> &, const core::Vector3 &, const models::Material &);
+  template void FlatDiffuseColors<math::Exact>(const models::Light &, const std::vector<models::Omni> &, const std::vector<unsigned int> &, const core::Vector3 *, const core::Vector3 *, size_t, const models::Material &, core::Vector3 *);
+  template void FlatDiffuseColors<math::Fast>(const models::Light &, const std::vector<models::Omni> &, const std::vector<unsigned int> &, const core::Vector3 *, const core::Vector3 *, size_t, const models::Material &, core::Vector3 *);
+  template void FlatSpecularColors<math::Exact>(const std::vector<models::Omni> &, const std::vector<unsigned int> &, const core::Vector3 *, const core::Vector3 *, size_t, const core::Vector3 &, const models::Material &, const core::Vector3 *, core::Vector3 *);
+  template void FlatSpecularColors<math::Fast>(const std::vector<models::Omni> &, const std::vector<unsigned int> &, const core::Vector3 *, const core::Vector3 *, size_t, const core::Vector3 &, const models::Material &, const core::Vector3 *, core::Vector3 *);
+  template models::ColorFloat PhongIllumination<math::Exact>(const models::Light &, const std::vector<models::Omni> &, const core::Vector3 &, const core::Vector3 &, const core::Vector3 &, const core::Vector3 &, const models::Material &);
+  template models::ColorFloat PhongIllumination<math::Fast>(const models::Light &, const std::vector<models::Omni> &, const core::Vector3 &, const core::Vector3 &, const core::Vector3 &, const core::Vector3 &, const models::Material &);
+  template models::ColorFloat PhongIllumination<math::Exact>(const models::Light &, const std::vector<models::Omni> &, const std::vector<unsigned int> &, const core::Vector3 &, const core::Vector3 &, const core::Vector3 &, const core::Vector3 &, const models::Material &);
+  template models::ColorFloat PhongIllumination<math::Fast>(const models::Light &, const std::vector<models::Omni> &, const std::vector<unsigned int> &, const core::Vector3 &, const core::Vector3 &, const core::Vector3 &, const core::Vector3 &, const models::Material &);
+  template models::ColorFloat PhongShading<math::Exact>(const models::Light &, const std::vector<models::Omni> &, const core::Vector3 &, const std::pair<core::Vector3, core::Vector3> &, const core::Vector3 &, const models::Material &);
+  template models::ColorFloat PhongShading<math::Fast>(const models::Light &, const std::vector<models::Omni> &, const core::Vector3 &, const std::pair<core::Vector3, core::Vector3> &, const core::Vector3 &, const models::Material &);
+  template models::ColorFloat PhongShading<math::Exact>(const models::Light &, const std::vector<models::Omni> &, const std::vector<unsigned int> &, const core::Vector3 &, const std::pair<core::Vector3, core::Vector3> &, const core::Vector3 &, const models::Material &);
+  template models::ColorFloat PhongShading<math::Fast>(const models::Light &, const std::vector<models::Omni> &, const std::vector<unsigned int> &, const core::Vector3 &, const std::pair<core::Vector3, core::Vector3> &, const core::Vector3 &, const models::Material &);
+
+} // namespace models
\ No newline at end of file
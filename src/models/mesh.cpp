@@ -1,8 +1,99 @@
 #include <models/mesh.hpp>
+#include <models/obj.hpp>
+#include <utils/trace.hpp>
 #include <iostream>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <unordered_map>
 
 namespace models
 {
+  // Contador global das versões das malhas (a versão 0 nunca é usada)
+  std::atomic<unsigned long> Mesh::next_version{1};
+
+  /**
+   * @brief Bits das coordenadas de uma normal, usados para reconhecer normais repetidas na importação
+   */
+  typedef struct NormalBits
+  {
+    unsigned int x, y, z;
+
+    bool operator==(const NormalBits &other) const = default;
+  } NormalBits;
+
+  struct NormalBitsHash
+  {
+    size_t operator()(const NormalBits &bits) const
+    {
+      unsigned long long result = bits.x;
+      result = result * 0x9e3779b97f4a7c15ULL + bits.y;
+      result = result * 0x9e3779b97f4a7c15ULL + bits.z;
+      return static_cast<size_t>(result ^ (result >> 32));
+    }
+  };
+
+  /**
+   * @brief Soma as normais das faces ao redor de um vértice
+   *
+   * @param vertex Vértice
+   * @param count Quantidade de faces somadas
+   *
+   * @return core::Vector3 Soma das normais
+   *
+   * @note As faces são visitadas pelas meias arestas que saem do vértice (he->twin->next). Em uma borda
+   * (meia aresta sem par) a volta continua no outro sentido (he->prev->twin) a partir da meia aresta
+   * do vértice, assim malhas abertas também são percorridas
+   */
+  static core::Vector3 SumFaceNormals(core::Vertex *vertex, int &count)
+  {
+    core::Vector3 result = {0.0f, 0.0f, 0.0f};
+    count = 0;
+
+    core::HalfEdge *start_he = vertex->getHalfEdge();
+    if (start_he == nullptr)
+      return result;
+
+    core::HalfEdge *he = start_he;
+    bool boundary = false;
+
+    while (true)
+    {
+      core::Vector3 face_normal = he->getFace()->getNormal();
+
+      result.x += face_normal.x;
+      result.y += face_normal.y;
+      result.z += face_normal.z;
+
+      count++;
+
+      if (he->getTwin() == nullptr)
+      {
+        boundary = true;
+        break;
+      }
+
+      he = he->getTwin()->getNext();
+
+      if (he == start_he)
+        break;
+    }
+
+    if (boundary)
+      for (he = start_he->getPrev()->getTwin(); he != nullptr; he = he->getPrev()->getTwin())
+      {
+        core::Vector3 face_normal = he->getFace()->getNormal();
+
+        result.x += face_normal.x;
+        result.y += face_normal.y;
+        result.z += face_normal.z;
+
+        count++;
+      }
+
+    return result;
+  }
+
   //------------------------------------------------------------------------------------------------
   // Constructors and Destructors
   //------------------------------------------------------------------------------------------------
@@ -16,6 +107,7 @@ namespace models
    */
   Mesh::Mesh()
   {
+    this->touch();
     this->num_faces = 0;
     this->id = "";
     this->vertices = std::vector<core::Vertex *>();
@@ -32,6 +124,7 @@ namespace models
    */
   Mesh::Mesh(std::vector<core::Vertex *> vertexes, std::vector<std::vector<int>> faces, std::string id)
   {
+    this->touch();
     this->setVertices(vertexes);
     this->setNumFaces(faces.size());
     this->setId(id);
@@ -61,6 +154,7 @@ namespace models
     this->index_vertices = mesh.index_vertices;
     this->id = mesh.id;
     this->name = mesh.name;
+    this->touch();
   }
 
   /**
@@ -76,6 +170,7 @@ namespace models
     this->num_faces = mesh.num_faces;
     this->id = mesh.id;
     this->name = mesh.name;
+    this->touch();
     return *this;
   }
 
@@ -87,8 +182,10 @@ namespace models
    * @brief Método que retorna o vetor de vértices da malha
    *
    * @return std::vector<core::Vertex> Vetor de vértices da malha
+   *
+   * @note Retorna uma referência para evitar a cópia do vetor a cada chamada (usado no pipeline)
    */
-  std::vector<core::Vertex *> Mesh::getVertices() const
+  const std::vector<core::Vertex *> &Mesh::getVertices() const
   {
     return this->vertices;
   }
@@ -98,7 +195,7 @@ namespace models
    *
    * @return std::vector<core::Face> Vetor de faces da malha
    */
-  std::vector<core::Face *> Mesh::getFaces() const
+  const std::vector<core::Face *> &Mesh::getFaces() const
   {
     return this->faces;
   }
@@ -108,7 +205,7 @@ namespace models
    *
    * @return std::vector<core::HalfEdge> Vetor de meias arestas da malha
    */
-  std::vector<core::HalfEdge *> Mesh::getHalfEdges() const
+  const std::vector<core::HalfEdge *> &Mesh::getHalfEdges() const
   {
     return this->half_edges;
   }
@@ -153,6 +250,42 @@ namespace models
     return this->selected;
   }
 
+  /**
+   * @brief Método que retorna a versão da geometria da malha
+   *
+   * @return unsigned long Versão da malha, muda sempre que os vértices são alterados
+   *
+   * @note Junto com o ponteiro da malha, identifica o estado da geometria em caches (ex.: mapas de sombra)
+   */
+  unsigned long Mesh::getVersion() const
+  {
+    return this->version;
+  }
+
+  /**
+   * @brief Método que retorna a esfera envolvente da malha (coordenadas do SRU)
+   *
+   * @return core::Vector4 Esfera envolvente (x, y, z = centro, w = raio)
+   *
+   * @note O centro é o centro da caixa envolvente. A esfera só é recalculada quando a versão muda
+   */
+  core::Vector4 Mesh::getBoundingSphere()
+  {
+    if (this->bounding_sphere_version == this->version)
+      return this->bounding_sphere;
+
+    core::Vector3 center = this->getCentroidByWrapBox();
+    float radius = 0.0f;
+
+    for (auto vertex : this->vertices)
+      radius = std::max(radius, math::Vector3Distance(center, {vertex->getX(), vertex->getY(), vertex->getZ()}));
+
+    this->bounding_sphere = {center.x, center.y, center.z, radius};
+    this->bounding_sphere_version = this->version;
+
+    return this->bounding_sphere;
+  }
+
   /**
    * @brief Método que define o vetor de vértices da malha
    *
@@ -161,6 +294,8 @@ namespace models
   void Mesh::setVertices(const std::vector<core::Vertex *> vertices)
   {
     this->vertices = vertices;
+    this->indexVertices();
+    this->touch();
   }
 
   /**
@@ -237,6 +372,13 @@ namespace models
   // Functions
   //------------------------------------------------------------------------------------------------
 
+  /**
+   * @brief Método que cria a malha (faces e meias arestas) a partir dos índices dos vértices das faces
+   *
+   * @param index_faces Índices (no vetor de vértices) dos vértices de cada face, no sentido anti-horário
+   *
+   * @note Os vértices devem ter sido definidos antes (ver setVertices)
+   */
   void Mesh::createMesh(std::vector<std::vector<int>> index_faces)
   {
     if (this->vertices.size() == 0)
@@ -256,55 +398,257 @@ namespace models
       return;
     }
 
-    std::vector<core::Vertex *> vertices = this->getVertices();
+    this->indexVertices();
+    this->buildHalfEdges(index_faces, nullptr);
+    this->initializeAttributes();
+  }
 
-    // Cria as faces da malha
-    for (auto face : index_faces)
+  /**
+   * @brief Método que cria a malha a partir de um arquivo Wavefront OBJ
+   *
+   * @param filename Caminho do arquivo
+   * @param pool Threads usadas na leitura e na montagem da malha (ex.: as da cena, ver models::Scene::getThreadPool)
+   *
+   * @return bool Verdadeiro se a malha foi criada e falso caso contrário (o erro é escrito em std::cerr)
+   *
+   * @note O arquivo é lido em paralelo (ver models::ReadObj) e a malha é montada diretamente dos
+   * vetores de índices, sem procurar as arestas uma a uma
+   * @note É criado um vértice para cada par (posição, normal) usado pelas faces: posições com normais
+   * diferentes (arestas vivas do modelo) viram vértices distintos, assim as normais calculadas pelo
+   * pipeline mantêm as arestas vivas. Posições não usadas por nenhuma face são descartadas
+   * @note Vértices repetidos em sequência em uma face são ignorados, e faces que ficam com menos de três
+   * vértices são descartadas
+   */
+  bool Mesh::createMesh(const std::string &filename, utils::ThreadPool &pool)
+  {
+    MRX_TRACE_SCOPE("Mesh::createMesh (OBJ)", TRACE_IO);
+
+    models::ObjData data;
+
+    if (!models::ReadObj(filename, data, pool))
+      return false;
+
+    // Normais iguais escritas mais de uma vez (um vn por vértice de face) valem como a mesma normal
+    std::vector<int> normal_ids(data.normals.size());
+    std::unordered_map<NormalBits, int, NormalBitsHash> normal_values;
+
+    for (size_t i = 0; i < data.normals.size(); i++)
     {
-      std::vector<core::Vertex *> face_vertices;
-      for (auto index : face)
+      NormalBits key;
+      std::memcpy(&key, &data.normals[i], sizeof(NormalBits));
+      normal_ids[i] = normal_values.emplace(key, static_cast<int>(i)).first->second;
+    }
+
+    // Vértice de cada par (posição, normal). O primeiro par de cada posição fica no vetor e os demais no mapa
+    std::vector<int> position_vertex(data.positions.size(), -1);
+    std::vector<int> position_normal(data.positions.size(), -1);
+    std::unordered_map<unsigned long long, int> split_vertices;
+    std::vector<std::pair<int, int>> vertex_sources;
+    std::vector<int> corner_vertices(data.position_indices.size());
+
+    for (size_t i = 0; i < data.position_indices.size(); i++)
+    {
+      int position = data.position_indices[i];
+      int normal = data.normal_indices[i] < 0 ? -1 : normal_ids[data.normal_indices[i]];
+
+      if (position_vertex[position] < 0)
       {
-        face_vertices.push_back(vertices[index]);
+        position_vertex[position] = static_cast<int>(vertex_sources.size());
+        position_normal[position] = normal;
+        vertex_sources.push_back({position, normal});
       }
 
-      core::Face *f = this->addFaceByVertices(face_vertices);
+      if (position_normal[position] == normal)
+      {
+        corner_vertices[i] = position_vertex[position];
+        continue;
+      }
+
+      unsigned long long key = (static_cast<unsigned long long>(position) << 32) | static_cast<unsigned int>(normal);
+      auto inserted = split_vertices.emplace(key, static_cast<int>(vertex_sources.size()));
+      if (inserted.second)
+        vertex_sources.push_back({position, normal});
 
-      f->setVertex(face_vertices);
+      corner_vertices[i] = inserted.first->second;
     }
 
-    for (auto edge : this->half_edges)
+    std::vector<std::vector<int>> index_faces;
+    index_faces.reserve(data.face_offsets.size() - 1);
+
+    for (size_t f = 0; f + 1 < data.face_offsets.size(); f++)
     {
-      if (edge->getTwin() == nullptr)
-      {
-        core::Vertex *v1 = edge->getOrigin();
-        core::Vertex *v2 = edge->getNext()->getOrigin();
+      std::vector<int> face;
+      face.reserve(data.face_offsets[f + 1] - data.face_offsets[f]);
 
-        core::HalfEdge *twin = this->findEdge(v2, v1);
-        if (twin != nullptr)
-        {
-          edge->setTwin(twin);
-          twin->setTwin(edge);
-        }
-      }
+      for (int i = data.face_offsets[f]; i < data.face_offsets[f + 1]; i++)
+        if (face.empty() || face.back() != corner_vertices[i])
+          face.push_back(corner_vertices[i]);
+
+      if (face.size() > 1 && face.front() == face.back())
+        face.pop_back();
+
+      if (face.size() >= 3)
+        index_faces.push_back(std::move(face));
     }
 
-    for (auto edge : this->half_edges)
+    if (index_faces.empty())
     {
-      if (edge->getFace() == nullptr)
+      std::cerr << "Erro: o OBJ '" << filename << "' não tem faces." << std::endl;
+      return false;
+    }
+
+    this->clearMesh();
+    this->vertices.resize(vertex_sources.size());
+
+    pool.parallel_for(vertex_sources.size(), MESH_BUILD_CHUNK_SIZE, [&](size_t begin, size_t end)
+                      {
+      for (size_t i = begin; i < end; i++)
       {
-        core::HalfEdge *next = edge->getTwin();
+        const core::Vector4 &position = data.positions[vertex_sources[i].first];
+        core::Vertex *vertex = new core::Vertex(position.x, position.y, position.z, position.w, nullptr, "v" + std::to_string(i));
+
+        if (vertex_sources[i].second >= 0)
+          vertex->setNormal(math::Vector3Normalize(data.normals[vertex_sources[i].second]));
+
+        this->vertices[i] = vertex;
+      } });
+
+    std::string name = std::filesystem::path(filename).stem().string();
+    this->setId(name);
+    this->setName(name);
+
+    this->indexVertices();
+    this->buildHalfEdges(index_faces, &pool);
+    this->index_vertices = std::move(index_faces);
+    this->initializeAttributes();
 
-        do
+    return true;
+  }
+
+  /**
+   * @brief Método que cria as faces e as meias arestas da malha a partir dos índices dos vértices
+   *
+   * @param index_faces Índices (no vetor de vértices) dos vértices de cada face
+   * @param pool Threads usadas na criação (nullptr = na thread atual)
+   *
+   * @note Cada vértice de face vira uma meia aresta, na ordem das faces. O par de cada meia aresta
+   * (a -> b) é a única meia aresta b -> a, procurada entre as meias arestas que saem de b. Arestas de
+   * borda e arestas com mais de duas faces (ou com faces em sentidos opostos) ficam sem par
+   * @note As faces e as meias arestas são alocadas em paralelo, cada bloco de faces escreve apenas nas
+   * suas posições dos vetores
+   */
+  void Mesh::buildHalfEdges(const std::vector<std::vector<int>> &index_faces, utils::ThreadPool *pool)
+  {
+    auto run = [pool](size_t count, const std::function<void(size_t, size_t)> &function)
+    {
+      if (pool != nullptr)
+        pool->parallel_for(count, MESH_BUILD_CHUNK_SIZE, function);
+      else
+        function(0, count);
+    };
+
+    size_t first_face = this->faces.size();
+    size_t first_edge = this->half_edges.size();
+
+    // Posição da primeira meia aresta de cada face
+    std::vector<size_t> offsets(index_faces.size() + 1, 0);
+    for (size_t f = 0; f < index_faces.size(); f++)
+      offsets[f + 1] = offsets[f] + index_faces[f].size();
+
+    size_t count = offsets.back();
+
+    this->faces.resize(first_face + index_faces.size());
+    this->half_edges.resize(first_edge + count);
+
+    // Vértices de origem e de destino de cada meia aresta
+    std::vector<int> origins(count);
+    std::vector<int> targets(count);
+
+    run(index_faces.size(), [&](size_t begin, size_t end)
         {
-          next = next->getPrev()->getTwin();
-        } while (next->getFace() != nullptr);
+      for (size_t f = begin; f < end; f++)
+      {
+        const std::vector<int> &face_indices = index_faces[f];
+        size_t len = face_indices.size();
 
-        edge->setNext(next);
-        next->setPrev(edge);
-      }
-    }
+        core::Face *face = new core::Face();
+        face->setId("f" + std::to_string(first_face + f));
 
-    // Inicialização dos outros atributos da malha
+        std::vector<core::Vertex *> face_vertices(len);
+        core::HalfEdge **face_edges = &this->half_edges[first_edge + offsets[f]];
+
+        for (size_t i = 0; i < len; i++)
+        {
+          core::HalfEdge *he = new core::HalfEdge();
+          he->setId("e" + std::to_string(first_edge + offsets[f] + i));
+          he->setOrigin(this->vertices[face_indices[i]]);
+          he->setFace(face);
+
+          face_vertices[i] = this->vertices[face_indices[i]];
+          face_edges[i] = he;
+          origins[offsets[f] + i] = face_indices[i];
+          targets[offsets[f] + i] = face_indices[(i + 1) % len];
+        }
+
+        // Conecta as meias arestas ao redor da face
+        for (size_t i = 0; i < len; i++)
+        {
+          face_edges[i]->setNext(face_edges[(i + 1) % len]);
+          face_edges[i]->setPrev(face_edges[(i + len - 1) % len]);
+        }
+
+        face->setHalfEdge(face_edges[0]);
+        face->setVertex(std::move(face_vertices));
+        this->faces[first_face + f] = face;
+      } });
+
+    // Meias arestas que saem de cada vértice, na ordem de criação
+    std::vector<size_t> outgoing_offsets(this->vertices.size() + 1, 0);
+    for (size_t e = 0; e < count; e++)
+      outgoing_offsets[origins[e] + 1]++;
+    for (size_t v = 0; v < this->vertices.size(); v++)
+      outgoing_offsets[v + 1] += outgoing_offsets[v];
+
+    std::vector<size_t> outgoing(count);
+    std::vector<size_t> cursor(outgoing_offsets.begin(), outgoing_offsets.end() - 1);
+    for (size_t e = 0; e < count; e++)
+      outgoing[cursor[origins[e]]++] = e;
+
+    for (size_t v = 0; v < this->vertices.size(); v++)
+      if (this->vertices[v]->getHalfEdge() == nullptr && outgoing_offsets[v] < outgoing_offsets[v + 1])
+        this->vertices[v]->setHalfEdge(this->half_edges[first_edge + outgoing[outgoing_offsets[v]]]);
+
+    // Cada meia aresta define apenas o seu próprio par, então os blocos não se sobrepõem
+    run(count, [&](size_t begin, size_t end)
+        {
+      for (size_t e = begin; e < end; e++)
+      {
+        int a = origins[e];
+        int b = targets[e];
+
+        size_t same = 0;
+        for (size_t k = outgoing_offsets[a]; k < outgoing_offsets[a + 1]; k++)
+          same += targets[outgoing[k]] == b;
+
+        size_t twins = 0;
+        size_t twin = 0;
+        for (size_t k = outgoing_offsets[b]; k < outgoing_offsets[b + 1]; k++)
+          if (targets[outgoing[k]] == a)
+          {
+            twins++;
+            twin = outgoing[k];
+          }
+
+        if (same == 1 && twins == 1)
+          this->half_edges[first_edge + e]->setTwin(this->half_edges[first_edge + twin]);
+      } });
+  }
+
+  /**
+   * @brief Método que inicializa os atributos da malha recém criada (seleção e material) e o número de faces
+   */
+  void Mesh::initializeAttributes()
+  {
     this->setSelected(false);
     this->material.ambient = {0.5f, 0.0f, 0.0f};
     this->material.diffuse = {0.7f, 0.5f, 0.0f};
@@ -312,6 +656,7 @@ namespace models
     this->material.shininess = 32.0f;
 
     this->setNumFaces(this->faces.size());
+    this->touch();
   }
 
   /**
@@ -424,28 +769,30 @@ namespace models
    */
   void Mesh::determineNormals()
   {
+    this->determineNormals(0, this->vertices.size());
+  }
 
-    for (auto v : this->getVertices())
+  /**
+   * @brief Método que calcula as normais de um intervalo de vértices da malha
+   *
+   * @param begin Índice do primeiro vértice
+   * @param end Índice posterior ao último vértice
+   *
+   * @note Cada vértice depende apenas das normais das faces, logo intervalos disjuntos podem ser
+   * processados em paralelo
+   * @note Vértices sem faces mantêm a normal anterior
+   */
+  void Mesh::determineNormals(size_t begin, size_t end)
+  {
+    for (size_t i = begin; i < end; i++)
     {
-      core::HalfEdge *start_he = v->getHalfEdge();
-      core::HalfEdge *he = start_he;
-
-      core::Vector3 normal = {0.0f, 0.0f, 0.0f};
+      core::Vertex *v = this->vertices[i];
 
-      while (true)
-      {
-
-        core::Vector3 face_normal = he->getFace()->getNormal();
-
-        normal.x += face_normal.x;
-        normal.y += face_normal.y;
-        normal.z += face_normal.z;
+      int count = 0;
+      core::Vector3 normal = SumFaceNormals(v, count);
 
-        he = he->getTwin()->getNext();
-
-        if (he == start_he)
-          break;
-      }
+      if (count == 0)
+        continue;
 
       float length = sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
 
@@ -464,30 +811,28 @@ namespace models
    */
   void Mesh::determineNormalsByAverage()
   {
-    for (auto v : this->getVertices())
-    {
-      core::HalfEdge *start_he = v->getHalfEdge();
-      core::HalfEdge *he = start_he;
+    this->determineNormalsByAverage(0, this->vertices.size());
+  }
 
-      core::Vector3 normal = {0.0f, 0.0f, 0.0f};
+  /**
+   * @brief Método que calcula as normais de um intervalo de vértices da malha pela média
+   *
+   * @param begin Índice do primeiro vértice
+   * @param end Índice posterior ao último vértice
+   *
+   * @note Vértices sem faces mantêm a normal anterior
+   */
+  void Mesh::determineNormalsByAverage(size_t begin, size_t end)
+  {
+    for (size_t i = begin; i < end; i++)
+    {
+      core::Vertex *v = this->vertices[i];
 
       int count = 0;
+      core::Vector3 normal = SumFaceNormals(v, count);
 
-      while (true)
-      {
-        core::Vector3 face_normal = he->getFace()->getNormal();
-
-        normal.x += face_normal.x;
-        normal.y += face_normal.y;
-        normal.z += face_normal.z;
-
-        count++;
-
-        he = he->getTwin()->getNext();
-
-        if (he == start_he)
-          break;
-      }
+      if (count == 0)
+        continue;
 
       normal.x /= count;
       normal.y /= count;
@@ -545,6 +890,45 @@ namespace models
     return centroid;
   }
 
+  /**
+   * @brief Método que marca a geometria da malha como alterada
+   *
+   * @note Deve ser chamado sempre que os vértices forem modificados fora da malha (ex.: transformações
+   * da cena), assim os caches que dependem da geometria são invalidados
+   */
+  void Mesh::touch()
+  {
+    this->version = Mesh::next_version.fetch_add(1);
+  }
+
+  /**
+   * @brief Método que guarda em cada vértice a sua posição no vetor de vértices da malha
+   *
+   * @note Permite que atributos calculados por vértice (ex.: cores do Gouraud Shading) sejam
+   * guardados em vetores indexados por core::Vertex::getIndex
+   */
+  void Mesh::indexVertices()
+  {
+    for (size_t i = 0; i < this->vertices.size(); i++)
+      this->vertices[i]->setIndex(i);
+  }
+
+  /**
+   * @brief Método que esvazia a malha (vértices, faces, meias arestas e índices)
+   *
+   * @note Os elementos não são liberados, como no destrutor: cópias da malha podem compartilhá-los
+   */
+  void Mesh::clearMesh()
+  {
+    this->vertices.clear();
+    this->faces.clear();
+    this->half_edges.clear();
+    this->index_vertices.clear();
+    this->half_edges_map.clear();
+    this->setNumFaces(0);
+    this->touch();
+  }
+
   core::HalfEdge *Mesh::addEdge(core::Vertex *vertex1, core::Vertex *vertex2)
   {
     core::HalfEdge *he = new core::HalfEdge();
@@ -0,0 +1,429 @@
+#include <models/obj.hpp>
+#include <utils/file.hpp>
+#include <utils/trace.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+namespace models
+{
+  /**
+   * @brief Vértice de uma face, como escrito no bloco
+   *
+   * @param position Índice da posição: a partir de 0 no arquivo, ou no bloco se relative_position
+   * @param normal Índice da normal (-1 = sem normal): a partir de 0 no arquivo, ou no bloco se relative_normal
+   * @param relative_position Se verdadeiro, o índice era negativo e foi resolvido dentro do bloco
+   * @param relative_normal Se verdadeiro, o índice era negativo e foi resolvido dentro do bloco
+   */
+  typedef struct ObjCorner
+  {
+    int position = 0;
+    int normal = -1;
+    bool relative_position = false;
+    bool relative_normal = false;
+  } ObjCorner;
+
+  /**
+   * @brief Trecho do arquivo analisado por uma thread
+   *
+   * @param begin Início do trecho (início de uma linha)
+   * @param end Fim do trecho (logo depois de um fim de linha ou o fim do arquivo)
+   * @param positions Posições lidas no trecho
+   * @param normals Normais lidas no trecho
+   * @param face_sizes Quantidade de vértices de cada face lida no trecho
+   * @param corners Vértices das faces lidas no trecho
+   * @param lines Quantidade de linhas do trecho
+   * @param error_line Linha (a partir de 1, dentro do trecho) do primeiro erro, 0 se não houve erro
+   * @param error Descrição do erro
+   */
+  typedef struct ObjChunk
+  {
+    const char *begin = nullptr;
+    const char *end = nullptr;
+    std::vector<core::Vector4> positions;
+    std::vector<core::Vector3> normals;
+    std::vector<int> face_sizes;
+    std::vector<models::ObjCorner> corners;
+    size_t lines = 0;
+    size_t error_line = 0;
+    std::string error;
+  } ObjChunk;
+
+  /**
+   * @brief Avança o cursor pelos espaços e tabulações
+   *
+   * @param cursor Posição atual
+   * @param end Fim da linha
+   *
+   * @return const char* Primeiro caractere que não é espaço nem tabulação
+   */
+  static const char *SkipSpaces(const char *cursor, const char *end)
+  {
+    while (cursor < end && (*cursor == ' ' || *cursor == '\t'))
+      cursor++;
+
+    return cursor;
+  }
+
+  /**
+   * @brief Lê um número real
+   *
+   * @param cursor Posição atual, avança até logo depois do número
+   * @param end Fim da linha
+   * @param value Número lido
+   *
+   * @return bool Verdadeiro se um número foi lido e falso caso contrário
+   *
+   * @note Números fora do intervalo do float (ex.: subnormais) são lidos com strtof, que os aproxima
+   */
+  static bool ParseFloat(const char *&cursor, const char *end, float &value)
+  {
+    cursor = SkipSpaces(cursor, end);
+
+    // std::from_chars não aceita o sinal positivo
+    if (cursor < end && *cursor == '+')
+      cursor++;
+
+    std::from_chars_result parsed = std::from_chars(cursor, end, value);
+
+    if (parsed.ec == std::errc::result_out_of_range)
+      value = std::strtof(std::string(cursor, parsed.ptr).c_str(), nullptr);
+    else if (parsed.ec != std::errc())
+      return false;
+
+    cursor = parsed.ptr;
+    return true;
+  }
+
+  /**
+   * @brief Lê um número inteiro
+   *
+   * @param cursor Posição atual, avança até logo depois do número
+   * @param end Fim da linha
+   * @param value Número lido
+   *
+   * @return bool Verdadeiro se um número foi lido e falso caso contrário
+   */
+  static bool ParseInt(const char *&cursor, const char *end, int &value)
+  {
+    if (cursor < end && *cursor == '+')
+      cursor++;
+
+    std::from_chars_result parsed = std::from_chars(cursor, end, value);
+    if (parsed.ec != std::errc())
+      return false;
+
+    cursor = parsed.ptr;
+    return true;
+  }
+
+  /**
+   * @brief Verifica se a palavra do início da linha é a instrução informada
+   *
+   * @param cursor Início da palavra
+   * @param end Fim da linha
+   * @param keyword Instrução (ex.: "vn")
+   * @param length Tamanho da instrução
+   *
+   * @return bool Verdadeiro se a palavra é a instrução (seguida de espaço, tabulação ou fim de linha)
+   */
+  static bool IsKeyword(const char *cursor, const char *end, const char *keyword, size_t length)
+  {
+    if (static_cast<size_t>(end - cursor) < length || std::memcmp(cursor, keyword, length) != 0)
+      return false;
+
+    return cursor + length == end || cursor[length] == ' ' || cursor[length] == '\t';
+  }
+
+  /**
+   * @brief Resolve o índice de um vértice de face escrito no arquivo
+   *
+   * @param index Índice escrito (a partir de 1, ou negativo a partir do último elemento lido)
+   * @param count Quantidade de elementos lidos até a linha, dentro do bloco
+   * @param result Índice a partir de 0
+   * @param relative Se verdadeiro, result é relativo ao início do bloco
+   *
+   * @return bool Falso se o índice é zero
+   */
+  static bool ResolveIndex(int index, size_t count, int &result, bool &relative)
+  {
+    if (index == 0)
+      return false;
+
+    relative = index < 0;
+    result = relative ? static_cast<int>(count) + index : index - 1;
+
+    return true;
+  }
+
+  /**
+   * @brief Analisa um trecho do arquivo
+   *
+   * @param chunk Trecho, recebe os elementos lidos e o primeiro erro
+   *
+   * @note Os índices negativos das faces são resolvidos em relação aos elementos lidos dentro do
+   * trecho e corrigidos quando os trechos são juntados (ver ParseObj)
+   */
+  static void ParseChunk(models::ObjChunk &chunk)
+  {
+    const char *cursor = chunk.begin;
+
+    while (cursor < chunk.end)
+    {
+      const char *line_end = static_cast<const char *>(std::memchr(cursor, '\n', chunk.end - cursor));
+      const char *next = line_end ? line_end + 1 : chunk.end;
+      if (!line_end)
+        line_end = chunk.end;
+      if (line_end > cursor && line_end[-1] == '\r')
+        line_end--;
+
+      chunk.lines++;
+      cursor = SkipSpaces(cursor, line_end);
+
+      if (IsKeyword(cursor, line_end, "v", 1))
+      {
+        // x y z [w], ou x y z r g b quando o arquivo traz cores por vértice
+        float values[7];
+        int count = 0;
+
+        cursor++;
+        while (count < 7 && SkipSpaces(cursor, line_end) < line_end && ParseFloat(cursor, line_end, values[count]))
+          count++;
+
+        if (count < 3)
+        {
+          chunk.error_line = chunk.lines;
+          chunk.error = "vértice com menos de três coordenadas";
+          return;
+        }
+
+        chunk.positions.push_back({values[0], values[1], values[2], count == 4 ? values[3] : 1.0f});
+      }
+      else if (IsKeyword(cursor, line_end, "vn", 2))
+      {
+        core::Vector3 normal;
+
+        cursor += 2;
+        if (!ParseFloat(cursor, line_end, normal.x) || !ParseFloat(cursor, line_end, normal.y) || !ParseFloat(cursor, line_end, normal.z))
+        {
+          chunk.error_line = chunk.lines;
+          chunk.error = "normal com menos de três coordenadas";
+          return;
+        }
+
+        chunk.normals.push_back(normal);
+      }
+      else if (IsKeyword(cursor, line_end, "f", 1))
+      {
+        int size = 0;
+
+        cursor = SkipSpaces(cursor + 1, line_end);
+        while (cursor < line_end)
+        {
+          models::ObjCorner corner;
+          int index = 0;
+
+          bool valid = ParseInt(cursor, line_end, index) && ResolveIndex(index, chunk.positions.size(), corner.position, corner.relative_position);
+
+          // v/vt, v//vn ou v/vt/vn (a coordenada de textura é ignorada)
+          if (valid && cursor < line_end && *cursor == '/')
+          {
+            cursor++;
+            if (cursor < line_end && *cursor != '/' && *cursor != ' ' && *cursor != '\t')
+              valid = ParseInt(cursor, line_end, index);
+
+            if (valid && cursor < line_end && *cursor == '/')
+            {
+              cursor++;
+              valid = ParseInt(cursor, line_end, index) && ResolveIndex(index, chunk.normals.size(), corner.normal, corner.relative_normal);
+            }
+          }
+
+          if (!valid || (cursor < line_end && *cursor != ' ' && *cursor != '\t'))
+          {
+            chunk.error_line = chunk.lines;
+            chunk.error = "vértice de face inválido";
+            return;
+          }
+
+          chunk.corners.push_back(corner);
+          size++;
+          cursor = SkipSpaces(cursor, line_end);
+        }
+
+        if (size < 3)
+        {
+          chunk.error_line = chunk.lines;
+          chunk.error = "face com menos de três vértices";
+          return;
+        }
+
+        chunk.face_sizes.push_back(size);
+      }
+
+      cursor = next;
+    }
+  }
+
+  /**
+   * @brief Analisa o conteúdo de um arquivo OBJ
+   *
+   * @param data Conteúdo do arquivo
+   * @param size Tamanho do conteúdo em bytes
+   * @param result Vértices, normais e faces lidos
+   * @param pool Threads usadas na análise
+   * @param chunk_size Tamanho aproximado (bytes) de cada trecho analisado por uma thread
+   *
+   * @return bool Verdadeiro se o conteúdo foi lido e falso se há uma linha inválida ou um índice fora
+   * do intervalo (o erro é escrito em std::cerr)
+   *
+   * @note Cada trecho termina no primeiro fim de linha depois de chunk_size bytes. Depois que os
+   * trechos são analisados, a quantidade de elementos de cada um dá a posição dele no resultado, e
+   * os trechos são copiados (e os seus índices relativos corrigidos) em paralelo
+   */
+  bool ParseObj(const char *data, size_t size, models::ObjData &result, utils::ThreadPool &pool, size_t chunk_size)
+  {
+    MRX_TRACE_SCOPE("ParseObj", TRACE_IO);
+
+    result = models::ObjData();
+
+    std::vector<models::ObjChunk> chunks;
+    const char *data_end = data + size;
+
+    for (const char *begin = data; begin < data_end;)
+    {
+      const char *chunk_end = begin + std::min(std::max<size_t>(chunk_size, 1), static_cast<size_t>(data_end - begin));
+      const char *line_end = chunk_end < data_end ? static_cast<const char *>(std::memchr(chunk_end, '\n', data_end - chunk_end)) : nullptr;
+      chunk_end = line_end ? line_end + 1 : data_end;
+
+      models::ObjChunk chunk;
+      chunk.begin = begin;
+      chunk.end = chunk_end;
+      chunks.push_back(std::move(chunk));
+
+      begin = chunk_end;
+    }
+
+    pool.parallel_for(chunks.size(), 1, [&](size_t begin, size_t end)
+                      {
+      for (size_t c = begin; c < end; c++)
+        ParseChunk(chunks[c]); });
+
+    // Posição de cada trecho no resultado
+    std::vector<size_t> position_offsets(chunks.size() + 1, 0);
+    std::vector<size_t> normal_offsets(chunks.size() + 1, 0);
+    std::vector<size_t> face_offsets(chunks.size() + 1, 0);
+    std::vector<size_t> corner_offsets(chunks.size() + 1, 0);
+    size_t lines = 0;
+
+    for (size_t c = 0; c < chunks.size(); c++)
+    {
+      if (chunks[c].error_line != 0)
+      {
+        std::cerr << "Erro na linha " << lines + chunks[c].error_line << " do OBJ: " << chunks[c].error << std::endl;
+        return false;
+      }
+
+      lines += chunks[c].lines;
+      position_offsets[c + 1] = position_offsets[c] + chunks[c].positions.size();
+      normal_offsets[c + 1] = normal_offsets[c] + chunks[c].normals.size();
+      face_offsets[c + 1] = face_offsets[c] + chunks[c].face_sizes.size();
+      corner_offsets[c + 1] = corner_offsets[c] + chunks[c].corners.size();
+    }
+
+    if (corner_offsets.back() > static_cast<size_t>(std::numeric_limits<int>::max()))
+    {
+      std::cerr << "Erro: o OBJ tem mais vértices de face do que o suportado" << std::endl;
+      return false;
+    }
+
+    result.positions.resize(position_offsets.back());
+    result.normals.resize(normal_offsets.back());
+    result.face_offsets.resize(face_offsets.back() + 1);
+    result.position_indices.resize(corner_offsets.back());
+    result.normal_indices.resize(corner_offsets.back());
+    result.face_offsets.back() = static_cast<int>(corner_offsets.back());
+
+    // Primeira face com um índice fora do intervalo (o número de faces se não houver)
+    std::atomic<size_t> invalid_face = face_offsets.back();
+
+    pool.parallel_for(chunks.size(), 1, [&](size_t begin, size_t end)
+                      {
+      for (size_t c = begin; c < end; c++)
+      {
+        const models::ObjChunk &chunk = chunks[c];
+        long long num_positions = static_cast<long long>(result.positions.size());
+        long long num_normals = static_cast<long long>(result.normals.size());
+
+        std::copy(chunk.positions.begin(), chunk.positions.end(), result.positions.begin() + position_offsets[c]);
+        std::copy(chunk.normals.begin(), chunk.normals.end(), result.normals.begin() + normal_offsets[c]);
+
+        size_t corner = corner_offsets[c];
+
+        for (size_t f = 0; f < chunk.face_sizes.size(); f++)
+        {
+          result.face_offsets[face_offsets[c] + f] = static_cast<int>(corner);
+
+          for (int i = 0; i < chunk.face_sizes[f]; i++, corner++)
+          {
+            const models::ObjCorner &source = chunk.corners[corner - corner_offsets[c]];
+
+            long long position = source.position + (source.relative_position ? static_cast<long long>(position_offsets[c]) : 0);
+            long long normal = source.normal + (source.relative_normal ? static_cast<long long>(normal_offsets[c]) : 0);
+
+            if (position < 0 || position >= num_positions || normal < -1 || normal >= num_normals || (source.relative_normal && normal < 0))
+            {
+              size_t face = face_offsets[c] + f;
+              size_t current = invalid_face.load();
+              while (face < current && !invalid_face.compare_exchange_weak(current, face))
+                ;
+            }
+
+            result.position_indices[corner] = static_cast<int>(position);
+            result.normal_indices[corner] = static_cast<int>(normal);
+          }
+        }
+      } });
+
+    if (invalid_face.load() < face_offsets.back())
+    {
+      std::cerr << "Erro: a face " << invalid_face.load() + 1 << " do OBJ usa um vértice ou uma normal que não existe" << std::endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief Lê um arquivo OBJ
+   *
+   * @param file_path Caminho do arquivo
+   * @param result Vértices, normais e faces lidos
+   * @param pool Threads usadas na análise
+   *
+   * @return bool Verdadeiro se o arquivo foi lido e falso caso contrário (o erro é escrito em std::cerr)
+   *
+   * @note O arquivo é mapeado na memória (ver utils::map_file), sem cópia para um buffer
+   */
+  bool ReadObj(const std::string &file_path, models::ObjData &result, utils::ThreadPool &pool)
+  {
+    MRX_TRACE_SCOPE("ReadObj", TRACE_IO);
+
+    utils::MappedFile file;
+    if (!utils::map_file(file_path, file))
+      return false;
+
+    bool parsed = models::ParseObj(file.data, file.size, result, pool);
+    utils::unmap_file(file);
+
+    if (!parsed)
+      std::cerr << "Erro ao ler o arquivo OBJ '" << file_path << "'." << std::endl;
+
+    return parsed;
+  }
+} // namespace models
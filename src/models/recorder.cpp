@@ -0,0 +1,471 @@
+#include <models/recorder.hpp>
+#include <utils/trace.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <iostream>
+
+namespace models
+{
+  /**
+   * @brief Retorna a quantidade de valores de um tipo de evento
+   *
+   * @param type Tipo do evento (RECORD_*)
+   *
+   * @return int Quantidade de valores ou -1 se o tipo não existe
+   */
+  int RecordValues(int type)
+  {
+    static const int values[RECORD_TYPES] = {1, 12, 0, 3, 3, 4, 3, 4, 7, 10, 9};
+
+    if (type < 0 || type >= RECORD_TYPES)
+      return -1;
+
+    return values[type];
+  }
+
+  /**
+   * @brief Cria um evento
+   *
+   * @param type Tipo do evento
+   * @param index Objeto ou luz do evento
+   * @param values Valores do evento
+   *
+   * @return models::RecordEvent Evento
+   */
+  static models::RecordEvent MakeRecordEvent(int type, int index, std::initializer_list<float> values)
+  {
+    models::RecordEvent event;
+
+    event.type = type;
+    event.index = index;
+    std::copy(values.begin(), values.end(), event.values);
+
+    return event;
+  }
+
+  /**
+   * @brief Retorna o índice de um objeto na cena
+   *
+   * @param scene Cena
+   * @param object Objeto
+   *
+   * @return int Índice do objeto ou -1 se ele não está na cena
+   */
+  static int ObjectIndex(models::Scene *scene, const models::Mesh *object)
+  {
+    std::vector<models::Mesh *> objects = scene->getObjects();
+    auto found = std::find(objects.begin(), objects.end(), object);
+
+    return found == objects.end() ? -1 : static_cast<int>(found - objects.begin());
+  }
+
+  /**
+   * @brief Monta o estado absoluto da cena que a gravação acompanha
+   *
+   * @param scene Cena
+   *
+   * @return std::vector<models::RecordEvent> Um evento por câmera, seleção, luz, material e
+   * configurações, sempre na mesma ordem enquanto a quantidade de luzes e objetos não muda
+   */
+  static std::vector<models::RecordEvent> SceneState(models::Scene *scene)
+  {
+    std::vector<models::RecordEvent> state;
+    std::vector<models::Mesh *> objects = scene->getObjects();
+
+    models::Camera3D *camera = scene->getCamera();
+    state.push_back(MakeRecordEvent(RECORD_CAMERA, 0, {camera->position.x, camera->position.y, camera->position.z, camera->target.x, camera->target.y, camera->target.z, camera->up.x, camera->up.y, camera->up.z, camera->d, camera->near, camera->far}));
+
+    state.push_back(MakeRecordEvent(RECORD_SELECT, ObjectIndex(scene, scene->getSelectedObject()), {}));
+
+    models::Color global = scene->global_light.intensity;
+    state.push_back(MakeRecordEvent(RECORD_GLOBAL_LIGHT, 0, {static_cast<float>(global.r), static_cast<float>(global.g), static_cast<float>(global.b), static_cast<float>(global.a)}));
+
+    for (size_t i = 0; i < scene->omni_lights.size(); i++)
+    {
+      const models::Omni &omni = scene->omni_lights[i];
+      state.push_back(MakeRecordEvent(RECORD_OMNI_LIGHT, static_cast<int>(i), {omni.position.x, omni.position.y, omni.position.z, omni.intensity.r, omni.intensity.g, omni.intensity.b, omni.radius}));
+    }
+
+    for (size_t i = 0; i < objects.size(); i++)
+    {
+      const models::Material &material = objects[i]->material;
+      state.push_back(MakeRecordEvent(RECORD_MATERIAL, static_cast<int>(i), {material.ambient.r, material.ambient.g, material.ambient.b, material.diffuse.r, material.diffuse.g, material.diffuse.b, material.specular.r, material.specular.g, material.specular.b, material.shininess}));
+    }
+
+    state.push_back(MakeRecordEvent(RECORD_SETTINGS, 0, {static_cast<float>(scene->lighting_model), static_cast<float>(scene->pipeline_model), static_cast<float>(scene->normal_algorithm), static_cast<float>(scene->centroid_algorithm), static_cast<float>(scene->clipping), static_cast<float>(scene->shadows), static_cast<float>(scene->overdraw), scene->render_scale, static_cast<float>(scene->precision)}));
+
+    return state;
+  }
+
+  /**
+   * @brief Compara dois eventos bit a bit
+   *
+   * @param a Primeiro evento
+   * @param b Segundo evento
+   *
+   * @return bool Verdadeiro se o tipo, o índice e os valores são iguais e falso caso contrário
+   */
+  static bool SameRecordEvent(const models::RecordEvent &a, const models::RecordEvent &b)
+  {
+    if (a.type != b.type || a.index != b.index)
+      return false;
+
+    return std::memcmp(a.values, b.values, sizeof(float) * RecordValues(a.type)) == 0;
+  }
+
+  /**
+   * @brief Inicia a gravação da cena, descartando a gravação anterior
+   *
+   * @param recorder Gravação
+   * @param scene Cena gravada
+   *
+   * @note A cena inicial é guardada na gravação, e a cena passa a gravar as transformações do objeto
+   * selecionado (ver Scene::recorder)
+   */
+  void RecordStart(models::Recorder &recorder, models::Scene *scene)
+  {
+    recorder.recording = models::Recording();
+    recorder.recording.scene = scene->to_json().dump();
+    recorder.state.clear();
+    recorder.objects = scene->getObjects().size();
+    recorder.start = std::chrono::steady_clock::now();
+    recorder.active = true;
+
+    scene->recorder = &recorder;
+  }
+
+  /**
+   * @brief Encerra a gravação, mantendo a sessão gravada em recorder.recording
+   *
+   * @param recorder Gravação
+   * @param scene Cena gravada
+   */
+  void RecordStop(models::Recorder &recorder, models::Scene *scene)
+  {
+    recorder.active = false;
+
+    if (scene != nullptr && scene->recorder == &recorder)
+      scene->recorder = nullptr;
+  }
+
+  /**
+   * @brief Grava um quadro: o estado que mudou desde o quadro anterior e o marcador do quadro
+   *
+   * @param recorder Gravação
+   * @param scene Cena gravada
+   *
+   * @return bool Verdadeiro se o quadro foi gravado e falso se a gravação não está ativa ou se a
+   * quantidade de objetos mudou (a gravação precisa ser encerrada)
+   *
+   * @note Deve ser chamada antes de processar o quadro, com a entrada do quadro já aplicada à cena
+   */
+  bool RecordFrame(models::Recorder &recorder, models::Scene *scene)
+  {
+    if (!recorder.active || scene->getObjects().size() != recorder.objects)
+      return false;
+
+    std::vector<models::RecordEvent> state = SceneState(scene);
+
+    for (size_t i = 0; i < state.size(); i++)
+      if (i >= recorder.state.size() || !SameRecordEvent(state[i], recorder.state[i]))
+        recorder.recording.events.push_back(state[i]);
+
+    recorder.state = std::move(state);
+
+    float timestamp = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - recorder.start).count();
+    recorder.recording.events.push_back(MakeRecordEvent(RECORD_FRAME, recorder.recording.frames++, {timestamp}));
+
+    return true;
+  }
+
+  /**
+   * @brief Grava uma transformação do objeto selecionado
+   *
+   * @param recorder Gravação
+   * @param scene Cena gravada
+   * @param type RECORD_TRANSLATE, RECORD_ROTATE, RECORD_ROTATE_AXIS ou RECORD_SCALE
+   * @param values Deslocamento, ângulos, eixo ou escala
+   * @param angle Ângulo (apenas RECORD_ROTATE_AXIS)
+   *
+   * @note Chamada pela cena no momento da transformação, já que as transformações se acumulam nos
+   * vértices e não podem ser recuperadas do estado no fim do quadro
+   */
+  void RecordTransform(models::Recorder &recorder, models::Scene *scene, int type, core::Vector3 values, float angle)
+  {
+    int index = ObjectIndex(scene, scene->getSelectedObject());
+
+    if (!recorder.active || index < 0)
+      return;
+
+    recorder.recording.events.push_back(MakeRecordEvent(type, index, {values.x, values.y, values.z, angle}));
+  }
+
+  /**
+   * @brief Escreve uma sessão gravada em um arquivo binário
+   *
+   * @param recording Sessão gravada
+   * @param file_path Caminho do arquivo
+   *
+   * @return bool Verdadeiro se o arquivo foi escrito com sucesso e falso caso contrário
+   *
+   * @note Formato: RECORDING_MAGIC, versão (uint32), tamanho da cena (uint32), cena (JSON) e os
+   * eventos, cada um com o tipo (uint8), o índice (int32) e RecordValues(tipo) floats, na ordem de
+   * bytes da máquina
+   */
+  bool WriteRecording(const models::Recording &recording, const std::string &file_path)
+  {
+    MRX_TRACE_SCOPE("write_recording", TRACE_IO);
+
+    std::ofstream file(file_path, std::ios::binary);
+
+    if (!file.is_open())
+    {
+      std::cerr << "Erro: Não foi possível abrir o arquivo '" << file_path << "' para escrita." << std::endl;
+      return false;
+    }
+
+    std::uint32_t version = RECORDING_VERSION;
+    std::uint32_t scene_size = static_cast<std::uint32_t>(recording.scene.size());
+
+    file.write(RECORDING_MAGIC, 4);
+    file.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    file.write(reinterpret_cast<const char *>(&scene_size), sizeof(scene_size));
+    file.write(recording.scene.data(), scene_size);
+
+    for (const models::RecordEvent &event : recording.events)
+    {
+      std::uint8_t type = static_cast<std::uint8_t>(event.type);
+      std::int32_t index = event.index;
+
+      file.write(reinterpret_cast<const char *>(&type), sizeof(type));
+      file.write(reinterpret_cast<const char *>(&index), sizeof(index));
+      file.write(reinterpret_cast<const char *>(event.values), sizeof(float) * RecordValues(event.type));
+    }
+
+    if (file.fail())
+    {
+      std::cerr << "Erro ao escrever no arquivo '" << file_path << "'." << std::endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief Lê uma sessão gravada por WriteRecording
+   *
+   * @param file_path Caminho do arquivo
+   * @param recording Sessão lida
+   *
+   * @return bool Verdadeiro se o arquivo é uma gravação válida e falso caso contrário
+   */
+  bool ReadRecording(const std::string &file_path, models::Recording &recording)
+  {
+    MRX_TRACE_SCOPE("read_recording", TRACE_IO);
+
+    std::ifstream file(file_path, std::ios::binary);
+
+    if (!file.is_open())
+    {
+      std::cerr << "Erro: Não foi possível abrir o arquivo '" << file_path << "'." << std::endl;
+      return false;
+    }
+
+    char magic[4] = {};
+    std::uint32_t version = 0;
+    std::uint32_t scene_size = 0;
+
+    file.read(magic, 4);
+    file.read(reinterpret_cast<char *>(&version), sizeof(version));
+    file.read(reinterpret_cast<char *>(&scene_size), sizeof(scene_size));
+
+    if (!file || std::memcmp(magic, RECORDING_MAGIC, 4) != 0 || version != RECORDING_VERSION)
+    {
+      std::cerr << "Erro: O arquivo '" << file_path << "' não é uma gravação (versão " << RECORDING_VERSION << ")." << std::endl;
+      return false;
+    }
+
+    recording = models::Recording();
+    recording.scene.resize(scene_size);
+    file.read(recording.scene.data(), scene_size);
+
+    std::uint8_t type;
+
+    while (file.read(reinterpret_cast<char *>(&type), sizeof(type)))
+    {
+      models::RecordEvent event;
+      std::int32_t index = 0;
+      int values = RecordValues(type);
+
+      if (values >= 0)
+      {
+        file.read(reinterpret_cast<char *>(&index), sizeof(index));
+        file.read(reinterpret_cast<char *>(event.values), sizeof(float) * values);
+      }
+
+      if (values < 0 || !file)
+      {
+        std::cerr << "Erro: Gravação corrompida ou incompleta em '" << file_path << "'." << std::endl;
+        return false;
+      }
+
+      event.type = type;
+      event.index = index;
+      recording.events.push_back(event);
+      recording.frames += type == RECORD_FRAME;
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief Inicia a reprodução de uma sessão gravada
+   *
+   * @param replay Reprodução
+   * @param recording Sessão gravada
+   *
+   * @note A cena reproduzida precisa ter os mesmos objetos da cena gravada (ver Recording::scene)
+   */
+  void ReplayStart(models::Replay &replay, const models::Recording &recording)
+  {
+    replay.recording = recording;
+    replay.cursor = 0;
+    replay.frame = 0;
+    replay.timestamp = 0.0f;
+  }
+
+  /**
+   * @brief Aplica à cena os eventos do próximo quadro gravado
+   *
+   * @param replay Reprodução
+   * @param scene Cena reproduzida
+   *
+   * @return bool Verdadeiro se um quadro foi aplicado e falso se a gravação terminou
+   *
+   * @note Deve ser chamada uma vez por quadro, antes de processá-lo
+   */
+  bool ReplayFrame(models::Replay &replay, models::Scene *scene)
+  {
+    std::vector<models::Mesh *> objects = scene->getObjects();
+    const std::vector<models::RecordEvent> &events = replay.recording.events;
+
+    auto object = [&objects](int index)
+    { return index >= 0 && index < static_cast<int>(objects.size()) ? objects[index] : nullptr; };
+
+    while (replay.cursor < events.size())
+    {
+      const models::RecordEvent &event = events[replay.cursor++];
+      const float *values = event.values;
+
+      switch (event.type)
+      {
+      case RECORD_FRAME:
+        replay.frame++;
+        replay.timestamp = values[0];
+        return true;
+
+      case RECORD_CAMERA:
+      {
+        models::Camera3D *camera = scene->getCamera();
+        camera->position = {values[0], values[1], values[2]};
+        camera->target = {values[3], values[4], values[5]};
+        camera->up = {values[6], values[7], values[8]};
+        camera->d = values[9];
+        camera->near = values[10];
+        camera->far = values[11];
+        break;
+      }
+
+      case RECORD_SELECT:
+        scene->setSelectedObject(object(event.index));
+        break;
+
+      case RECORD_TRANSLATE:
+      case RECORD_ROTATE:
+      case RECORD_ROTATE_AXIS:
+      case RECORD_SCALE:
+      {
+        if (object(event.index) == nullptr)
+          break;
+
+        // A transformação age sobre o objeto selecionado: o objeto do evento é selecionado apenas
+        // durante a transformação, a seleção do quadro vem do evento RECORD_SELECT
+        models::Mesh *selected = scene->getSelectedObject();
+        scene->setSelectedObject(object(event.index));
+
+        core::Vector3 vector = {values[0], values[1], values[2]};
+
+        if (event.type == RECORD_TRANSLATE)
+          scene->translateObject(vector);
+        else if (event.type == RECORD_ROTATE)
+          scene->rotateObject(vector);
+        else if (event.type == RECORD_ROTATE_AXIS)
+          scene->rotateObject(vector, values[3]);
+        else
+          scene->scaleObject(vector);
+
+        scene->setSelectedObject(selected);
+        break;
+      }
+
+      case RECORD_GLOBAL_LIGHT:
+        scene->global_light.intensity = {static_cast<Uint8>(values[0]), static_cast<Uint8>(values[1]), static_cast<Uint8>(values[2]), static_cast<Uint8>(values[3])};
+        break;
+
+      case RECORD_OMNI_LIGHT:
+      {
+        if (event.index < 0)
+          break;
+
+        if (static_cast<size_t>(event.index) >= scene->omni_lights.size())
+          scene->omni_lights.resize(event.index + 1);
+
+        models::Omni &omni = scene->omni_lights[event.index];
+        omni.position = {values[0], values[1], values[2]};
+        omni.intensity = {values[3], values[4], values[5]};
+        omni.radius = values[6];
+        break;
+      }
+
+      case RECORD_MATERIAL:
+      {
+        models::Mesh *mesh = object(event.index);
+
+        if (mesh != nullptr)
+          mesh->material = {{values[0], values[1], values[2]}, {values[3], values[4], values[5]}, {values[6], values[7], values[8]}, values[9]};
+        break;
+      }
+
+      case RECORD_SETTINGS:
+        scene->lighting_model = static_cast<int>(values[0]);
+        scene->pipeline_model = static_cast<int>(values[1]);
+        scene->normal_algorithm = static_cast<int>(values[2]);
+        scene->centroid_algorithm = static_cast<int>(values[3]);
+        scene->clipping = values[4] != 0.0f;
+        scene->shadows = values[5] != 0.0f;
+        scene->overdraw = values[6] != 0.0f;
+        scene->render_scale = values[7];
+        scene->precision = static_cast<int>(values[8]);
+        break;
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * @brief Verifica se todos os quadros gravados já foram reproduzidos
+   *
+   * @param replay Reprodução
+   *
+   * @return bool Verdadeiro se a reprodução terminou e falso caso contrário
+   */
+  bool ReplayFinished(const models::Replay &replay)
+  {
+    return replay.cursor >= replay.recording.events.size();
+  }
+} // namespace models
@@ -1,4 +1,8 @@
 #include <models/scene.hpp>
+#include <models/recorder.hpp>
+#include <utils/profiler.hpp>
+
+#include <bit>
 
 namespace models
 {
@@ -75,6 +79,7 @@ namespace models
    */
   Scene::~Scene()
   {
+    delete this->thread_pool;
     delete this->camera;
     for (auto object : this->objects)
     {
@@ -136,6 +141,32 @@ namespace models
     return this->max_viewport;
   }
 
+  /**
+   * @brief Retorna as coordenadas mínimas da viewport na resolução interna do framebuffer
+   *
+   * @return Coordenadas mínimas da viewport multiplicadas por render_scale
+   */
+  core::Vector2 Scene::getRenderMinViewport()
+  {
+    if (this->render_scale == 1.0f)
+      return this->min_viewport;
+
+    return {this->min_viewport.x * this->render_scale, this->min_viewport.y * this->render_scale};
+  }
+
+  /**
+   * @brief Retorna as coordenadas máximas da viewport na resolução interna do framebuffer
+   *
+   * @return Coordenadas máximas da viewport multiplicadas por render_scale (em pixels inteiros)
+   */
+  core::Vector2 Scene::getRenderMaxViewport()
+  {
+    if (this->render_scale == 1.0f)
+      return this->max_viewport;
+
+    return {std::floor(this->max_viewport.x * this->render_scale), std::floor(this->max_viewport.y * this->render_scale)};
+  }
+
   /**
    * @brief Retorna as coordenadas mínimas da janela
    *
@@ -176,6 +207,88 @@ namespace models
     return this->processed;
   }
 
+  /**
+   * @brief Retorna a quantidade de threads usadas no estágio de geometria
+   *
+   * @return Quantidade de threads (0 = quantidade de núcleos da máquina)
+   */
+  unsigned int Scene::getWorkerThreads()
+  {
+    return this->worker_threads;
+  }
+
+  /**
+   * @brief Retorna o framebuffer da frente (último quadro concluído)
+   *
+   * @return models::FrameBuffer& Framebuffer exibido pela interface
+   */
+  models::FrameBuffer &Scene::getFrontBuffer()
+  {
+    return this->frame_buffers[this->front_buffer];
+  }
+
+  /**
+   * @brief Retorna o framebuffer de trás (quadro em rasterização)
+   *
+   * @return models::FrameBuffer& Framebuffer de destino da rasterização
+   */
+  models::FrameBuffer &Scene::getBackBuffer()
+  {
+    return this->frame_buffers[1 - this->front_buffer];
+  }
+
+  /**
+   * @brief Retorna o framebuffer a ser exibido, na resolução da viewport
+   *
+   * @return models::FrameBuffer& Framebuffer da frente, ou a sua ampliação bilinear quando o quadro
+   * foi rasterizado com resolução interna menor (ver render_scale)
+   *
+   * @note A ampliação é feita uma vez por quadro, na primeira chamada depois de swapBuffers
+   */
+  models::FrameBuffer &Scene::getDisplayBuffer()
+  {
+    models::FrameBuffer &front = this->getFrontBuffer();
+
+    int width = static_cast<int>(this->max_viewport.x + 1);
+    int height = static_cast<int>(this->max_viewport.y + 1);
+
+    if (front.width == 0 || (front.width == width && front.height == height))
+      return front;
+
+    if (this->display_outdated)
+    {
+      MRX_PROFILE_SCOPE(PROFILE_PRESENT);
+
+      // Com apenas um pixel em uma direção, a escala vem da outra; com um único pixel, todos leem o (0, 0)
+      float scale = 0.0f;
+
+      if (width > 1)
+        scale = static_cast<float>(front.width - 1) / static_cast<float>(width - 1);
+      else if (height > 1)
+        scale = static_cast<float>(front.height - 1) / static_cast<float>(height - 1);
+
+      models::UpscaleFrameBuffer(front, this->display_buffer, width, height, scale);
+      this->display_outdated = false;
+    }
+
+    return this->display_buffer;
+  }
+
+  /**
+   * @brief Retorna o mapa de sombra de uma luz omni
+   *
+   * @param index Índice da luz omni
+   *
+   * @return std::shared_ptr<const models::ShadowCubeMap> Mapa de sombra usado no último quadro (nullptr se não existir)
+   */
+  std::shared_ptr<const models::ShadowCubeMap> Scene::getShadowMap(size_t index)
+  {
+    if (index >= this->shadow_maps.size())
+      return nullptr;
+
+    return this->shadow_maps[index];
+  }
+
   /**
    * @brief Define a câmera da cena
    *
@@ -266,6 +379,32 @@ namespace models
     this->processed = processed;
   }
 
+  /**
+   * @brief Define a quantidade de threads usadas no estágio de geometria
+   *
+   * @param worker_threads Quantidade de threads (0 = quantidade de núcleos da máquina)
+   */
+  void Scene::setWorkerThreads(unsigned int worker_threads)
+  {
+    this->worker_threads = worker_threads;
+
+    if (this->thread_pool != nullptr)
+      this->thread_pool->setNumThreads(worker_threads);
+  }
+
+  /**
+   * @brief Retorna o conjunto de threads do estágio de geometria, criando-o se necessário
+   *
+   * @return Ponteiro para o conjunto de threads
+   */
+  utils::ThreadPool *Scene::getThreadPool()
+  {
+    if (this->thread_pool == nullptr)
+      this->thread_pool = new utils::ThreadPool(this->worker_threads);
+
+    return this->thread_pool;
+  }
+
   //------------------------------------------------------------------------------------------------
   // Functions
   //------------------------------------------------------------------------------------------------
@@ -303,39 +442,140 @@ namespace models
    *
    * @note A rasterização da cena é responsável por renderizar todos os objetos
    * da cena na tela
-   * @todo REFATORAR ESTA FUNÇÃO E SEPARAR EM FUNÇÕES PARA CADA MODELO DE ILUMINAÇÃO
+   * @note Executa os dois estágios (geometria e rasterização) em sequência e troca os framebuffers
    */
   void Scene::adair_pipeline()
   {
-    // for (int i = 0; i < this->omni_lights.size(); i++)
-    //   LightOrbital(&this->omni_lights[i], 0.02f);
+    models::FrameGeometry &frame = this->nextFrameGeometry();
 
-    models::Camera3D *camera = this->getCamera();
+    this->adair_geometry(frame);
+    this->rasterize(frame);
+    this->swapBuffers();
+  }
 
-    // Pré computação da visibilidade dos objetos
-    // Se o objeto estiver dentro do intervalo de near e far da câmera, ele é visível
-    // Caso contrário, ele é invisível
-    for (auto object : this->objects)
+  /**
+   * @brief Função para rasterizar a cena utilizando o pipeline de Smith
+   *
+   * @note Executa os dois estágios (geometria e rasterização) em sequência e troca os framebuffers
+   */
+  void Scene::smith_pipeline()
+  {
+    models::FrameGeometry &frame = this->nextFrameGeometry();
+
+    this->smith_geometry(frame);
+    this->rasterize(frame);
+    this->swapBuffers();
+  }
+
+  /**
+   * @brief Rasteriza a cena utilizando o pipeline selecionado em pipeline_model
+   */
+  void Scene::pipeline()
+  {
+    if (this->pipeline_model == SANTA_CATARINA_PIPELINE)
+      this->adair_pipeline();
+    else
+      this->smith_pipeline();
+  }
+
+  /**
+   * @brief Descarta o estado com que os framebuffers foram rasterizados
+   *
+   * @note O próximo quadro é refeito por inteiro, mesmo que a cena não tenha mudado. Usado para
+   * medir o tempo de quadros completos de uma cena estática
+   */
+  void Scene::invalidate()
+  {
+    for (models::FrameBuffer &frame_buffer : this->frame_buffers)
     {
-      core::Vector3 centroid = this->centroid_algorithm == CENTROID_BY_MEAN ? object->getCentroidByMean() : object->getCentroidByWrapBox();
-      core::Vector3 vrp = camera->position;
-      core::Vector3 target = camera->target;
-
-      // Direção da câmera (eixo Z do espaço da câmera)
-      core::Vector3 camera_forward = math::Vector3Normalize(math::Vector3Subtract(target, vrp));
-      // Vetor do centroid para a câmera
-      core::Vector3 centroid_to_camera = centroid - vrp;
-
-      // Projeção na direção da câmera (depth)
-      float depth = math::Vector3DotProduct(camera_forward, centroid_to_camera);
-
-      // Verifica se está fora do near/far
-      if (depth < camera->near || depth > camera->far)
-        object->is_visible = false;
-      else
-        object->is_visible = true;
+      frame_buffer.state.clear();
+      frame_buffer.objects.clear();
     }
 
+    this->rendered_state.clear();
+  }
+
+  /**
+   * @brief Alterna e retorna a geometria do próximo quadro
+   *
+   * @return models::FrameGeometry& Geometria que não está sendo usada pela rasterização do quadro anterior
+   */
+  models::FrameGeometry &Scene::nextFrameGeometry()
+  {
+    this->current_geometry = 1 - this->current_geometry;
+
+    return this->frame_geometry[this->current_geometry];
+  }
+
+  /**
+   * @brief Troca os framebuffers da frente e de trás
+   *
+   * @note Deve ser chamada apenas depois que a rasterização do quadro terminar
+   */
+  void Scene::swapBuffers()
+  {
+    this->front_buffer = 1 - this->front_buffer;
+    this->display_outdated = true;
+  }
+
+  /**
+   * @brief Verifica se a cena mudou desde o último quadro processado
+   *
+   * @return bool Verdadeiro se a câmera, as luzes, os objetos, os materiais ou as configurações do
+   * pipeline mudaram, ou se nenhum quadro foi processado ainda
+   *
+   * @note A interface altera os campos da cena diretamente, então o estado é comparado por valor
+   * em vez de depender de cada alteração ser notificada
+   */
+  bool Scene::hasChanged()
+  {
+    std::vector<std::uint64_t> state;
+    this->renderState(state);
+
+    return state != this->rendered_state;
+  }
+
+  /**
+   * @brief Executa o estágio de geometria do pipeline selecionado em pipeline_model
+   *
+   * @param frame Geometria do quadro a ser preenchida
+   */
+  void Scene::geometry(models::FrameGeometry &frame)
+  {
+    if (this->pipeline_model == SANTA_CATARINA_PIPELINE)
+      this->adair_geometry(frame);
+    else
+      this->smith_geometry(frame);
+  }
+
+  /**
+   * @brief Rasteriza a geometria de um quadro no framebuffer de trás
+   *
+   * @param frame Geometria do quadro
+   *
+   * @note Acessa apenas a geometria do quadro e o framebuffer de trás, logo pode rodar em outra
+   * thread enquanto a geometria do próximo quadro é processada
+   */
+  void Scene::rasterize(const models::FrameGeometry &frame)
+  {
+    models::RasterizeFrame(frame, this->getBackBuffer());
+  }
+
+  /**
+   * @brief Estágio de geometria do pipeline de Adair
+   *
+   * @param frame Geometria do quadro a ser preenchida
+   *
+   * @note Transforma os vértices, oculta as faces, calcula as normais, recorta os polígonos e,
+   * no Gouraud Shading, ilumina os vértices
+   */
+  void Scene::adair_geometry(models::FrameGeometry &frame)
+  {
+    // for (int i = 0; i < this->omni_lights.size(); i++)
+    //   LightOrbital(&this->omni_lights[i], 0.02f);
+
+    models::Camera3D *camera = this->getCamera();
+
     // Obtém as matrizes de transformação
     core::Matrix sru_src_matrix = math::pipeline_adair::sru_to_src(camera->position, camera->target);
     core::Matrix projection_matrix = math::pipeline_adair::projection(
@@ -344,42 +584,17 @@ namespace models
         camera->d);
     core::Matrix viewport_matrix = math::pipeline_adair::src_to_srt(
         this->getMinWindow(),
-        this->getMinViewport(),
+        this->getRenderMinViewport(),
         this->getMaxWindow(),
-        this->getMaxViewport(),
+        this->getRenderMaxViewport(),
         true);
 
     // Multiplica as matrizes
     core::Matrix result = math::MatrixMultiply(viewport_matrix, projection_matrix);
     result = math::MatrixMultiply(result, sru_src_matrix);
 
-    core::Vector4 vectorResult = {0.0f, 0.0f, 0.0f, 0.0f};
-
-    // Rasteriza todos os objetos da cena
-    for (auto object : this->objects)
-    {
-      if (!object->is_visible)
-        continue;
-
-      for (auto vertex : object->getVertices())
-      {
-        vectorResult = math::MatrixMultiplyVector(result, vertex->getVector());
-
-        vertex->setVectorScreen({vectorResult.x / vectorResult.w, vectorResult.y / vectorResult.w, vectorResult.z});
-      }
-
-      for (auto face : object->getFaces())
-      {
-        face->setVisible(face->isVisible(camera->position));
-      }
-
-      // Só calcula os vetores unitários normais se o modelo de iluminação for diferente de FLAT_SHADING
-      if (this->lighting_model != FLAT_SHADING)
-        if (this->normal_algorithm == FOLEY_UNIT_NORMAL_VECTOR)
-          object->determineNormals();
-        else
-          object->determineNormalsByAverage();
-    }
+    // Transforma os vértices, determina a visibilidade das faces e as normais dos vértices
+    this->geometry_stage(result);
 
     // Rasteriza a luz
     core::Vector3 Light_position = this->omni_lights[0].position;
@@ -387,129 +602,175 @@ namespace models
 
     this->omni_lights[0].screen_position = {light.x / light.w, light.y / light.w, light.z};
 
-    // Rasterização dos objetos
-    this->initializeBuffers();
-
-    core::Vector2 min_viewport = this->getMinViewport();
-    core::Vector2 max_viewport = this->getMaxViewport();
+    this->beginFrameGeometry(frame);
+    this->binOmniLights(frame, result, nullptr);
 
-    for (auto object : this->getObjects())
-    {
-      if (!object->is_visible)
-        continue;
+    if (this->lighting_model != PHONG_SHADING)
+      this->updateLightingCaches(frame);
 
-      // Desenha a caixa envolvente do objeto se ele estiver selecionado
-      if (object == this->getSelectedObject())
-      {
-        core::Vector4 box = object->getBox(true);
-        utils::DrawBoundingBox({box.x, box.y}, {box.z, box.w}, models::YELLOW, this->z_buffer, this->color_buffer);
-      }
+    core::Vector2 min_viewport = this->getRenderMinViewport();
+    core::Vector2 max_viewport = this->getRenderMaxViewport();
 
-      core::Vector3 object_centroid = {0.0f, 0.0f, 0.0f};
+    std::vector<FrameChunk> chunks = this->frameChunks(true);
+    std::vector<models::FrameGeometry> parts(chunks.size());
 
-      if (this->centroid_algorithm == CENTROID_BY_WRAP_BOX)
-        object_centroid = object->getCentroidByWrapBox();
-      else if (this->centroid_algorithm == CENTROID_BY_MEAN)
-        object_centroid = object->getCentroidByMean();
+    this->getThreadPool()->parallel_for(chunks.size(), 1, [&](size_t begin, size_t end)
+                                        {
+      // Montagem e recorte 2D das faces visíveis
+      MRX_PROFILE_SCOPE(PROFILE_CLIP);
+      // Faces descartadas pelo recorte (totalmente fora da viewport)
+      [[maybe_unused]] size_t clipped = 0;
 
-      for (auto face : object->getFaces())
+      for (size_t c = begin; c < end; c++)
       {
+        const FrameChunk &chunk = chunks[c];
+        models::FrameGeometry &part = parts[c];
+        models::Mesh *object = chunk.object;
+
+        // Desenha a caixa envolvente do objeto se ele estiver selecionado
+        if (chunk.bounding_box)
+        {
+          core::Vector4 box = object->getBox(true);
 
-        if (!face->getVisible())
+          part.polygons.push_back({FRAME_BOUNDING_BOX, part.vertexes.size(), 2, {0.0f, 0.0f, 0.0f}, {}, chunk.material});
+          part.vertexes.push_back({box.x, box.y, 0.0f});
+          part.vertexes.push_back({box.z, box.w, 0.0f});
+
+          // Mantém os atributos (e as posições do Phong) alinhados com os vértices
+          if (this->lighting_model != FLAT_SHADING)
+            part.attributes.insert(part.attributes.end(), 2, {0.0f, 0.0f, 0.0f});
+          if (this->lighting_model == PHONG_SHADING)
+            part.positions.insert(part.positions.end(), 2, {0.0f, 0.0f, 0.0f});
           continue;
+        }
 
-        core::HalfEdge *he = face->getHalfEdge();
+        const std::vector<core::Face *> &faces = object->getFaces();
+        // Cores das faces (Flat) ou dos vértices (Gouraud) do objeto, calculadas em updateLightingCaches
+        const core::Vector3 *face_colors = this->lighting_model == FLAT_SHADING ? this->face_colors[chunk.material].colors.data() : nullptr;
+        const core::Vector3 *colors = this->lighting_model == GOURAUD_SHADING ? this->vertex_colors[chunk.material].colors.data() : nullptr;
 
         // first = Coordenadas de tela
-        // second = normal do vértice
+        // second = normal do vértice (Phong) ou cor do vértice (Gouraud)
         std::vector<std::pair<core::Vector3, core::Vector3>> vertexes;
+        // Posição de cada vértice no SRU (iluminação e sombras)
+        std::vector<core::Vector3> positions;
 
-        while (true)
+        for (size_t f = chunk.begin; f < chunk.end; f++)
         {
-          vertexes.push_back(std::make_pair(he->getOrigin()->getVectorScreen(), he->getOrigin()->getNormal()));
-
-          he = he->getNext();
-          if (he == face->getHalfEdge())
-            break;
-        }
+          core::Face *face = faces[f];
 
-        // O vetor normal da face é calculado na ocultação de faces
-        // precisa recortar o vetor normal do vertice também (assim simplifica o calculo de interpolação)
-        // usar excel como base
-
-        if (this->lighting_model == FLAT_SHADING)
-        {
-          std::vector<core::Vector3> clipped_vertexes;
+          if (!face->getVisible())
+            continue;
 
-          // O Flat shading precisa apenas dos vértices, sem os vetores normais
-          for (auto vertex : vertexes)
-            clipped_vertexes.push_back(vertex.first);
+          core::HalfEdge *he = face->getHalfEdge();
 
-          clipped_vertexes = math::clip2D_polygon(clipped_vertexes, min_viewport, max_viewport);
+          vertexes.clear();
+          positions.clear();
 
-          // Se o vetor de vértices for menor que 3, não é possível formar um polígono, então não é necessário desenhar
-          if (clipped_vertexes.size() < 3)
-            continue;
+          while (true)
+          {
+            core::Vertex *vertex = he->getOrigin();
 
-          utils::DrawFaceBufferFlatShading(clipped_vertexes, this->getCamera()->position, face->getFaceCentroid(), face->getNormal(), object->material, this->global_light, this->omni_lights, this->z_buffer, this->color_buffer);
-        }
-        else if (this->lighting_model == GOURAUD_SHADING)
-        {
-          // No Gouraud Shading, a cor de cada vértice é calculada antes do recorte
+            vertexes.push_back(std::make_pair(vertex->getVectorScreen(), colors != nullptr ? colors[vertex->getIndex()] : vertex->getNormal()));
+            positions.push_back(vertex->getVector().toVector3());
 
-          std::vector<std::pair<core::Vector3, core::Vector3>> vertexes_gouraud;
+            he = he->getNext();
+            if (he == face->getHalfEdge())
+              break;
+          }
 
-          core::Vector3 eye = this->getCamera()->position;
-          models::Material object_material = object->material;
+          // O vetor normal da face é calculado na ocultação de faces
+          // precisa recortar o vetor normal do vertice também (assim simplifica o calculo de interpolação)
+          // usar excel como base
 
-          for (auto vertex : vertexes)
+          if (this->lighting_model == FLAT_SHADING)
           {
-            core::Vector3 v = vertex.first;
-            core::Vector3 n = vertex.second;
-            models::Color c = models::GouraudShading(this->global_light, this->omni_lights, std::make_pair(v, n), eye, object_material);
-            core::Vector3 color = {static_cast<float>(c.r), static_cast<float>(c.g), static_cast<float>(c.b)};
-            vertexes_gouraud.push_back(std::make_pair(v, color));
-          }
+            std::vector<core::Vector3> clipped_vertexes;
 
-          vertexes_gouraud = math::clip2D_polygon(vertexes_gouraud, min_viewport, max_viewport);
+            // O Flat shading precisa apenas dos vértices, sem os vetores normais
+            for (auto vertex : vertexes)
+              clipped_vertexes.push_back(vertex.first);
 
-          std::vector<std::pair<core::Vector3, models::Color>> clipped_vertexes;
+            clipped_vertexes = math::clip2D_polygon(clipped_vertexes, min_viewport, max_viewport);
 
-          for (auto vertex : vertexes_gouraud)
+            // Se o vetor de vértices for menor que 3, não é possível formar um polígono, então não é necessário desenhar
+            if (clipped_vertexes.size() < 3)
+            {
+              clipped++;
+              continue;
+            }
+
+            core::Vector3 color = face_colors[f];
+            part.polygons.push_back({FRAME_POLYGON, part.vertexes.size(), clipped_vertexes.size(), {0.0f, 0.0f, 0.0f}, {color.x, color.y, color.z, static_cast<float>(MAX_COLOR_VALUE)}, chunk.material});
+            part.vertexes.insert(part.vertexes.end(), clipped_vertexes.begin(), clipped_vertexes.end());
+          }
+          else if (this->lighting_model == GOURAUD_SHADING)
           {
-            clipped_vertexes.push_back(std::make_pair(vertex.first, models::ChannelsToColor({vertex.second.x, vertex.second.y, vertex.second.z})));
+            // No Gouraud Shading, a cor de cada vértice já foi calculada (uma vez por vértice) e é recortada junto com ele
+            std::vector<std::pair<core::Vector3, core::Vector3>> vertexes_gouraud = math::clip2D_polygon(vertexes, min_viewport, max_viewport);
+
+            // Se o vetor de vértices for menor que 3, não é possível formar um polígono, então não é necessário desenhar
+            if (vertexes_gouraud.size() < 3)
+            {
+              clipped++;
+              continue;
+            }
+
+            part.polygons.push_back({FRAME_POLYGON, part.vertexes.size(), vertexes_gouraud.size(), {0.0f, 0.0f, 0.0f}, {}, chunk.material});
+            for (auto vertex : vertexes_gouraud)
+            {
+              part.vertexes.push_back(vertex.first);
+              part.attributes.push_back(vertex.second);
+            }
+          }
+          else if (this->lighting_model == PHONG_SHADING)
+          {
+            std::vector<std::pair<core::Vector3, core::Vector3>> clipped_vertex = math::clip2D_polygon(vertexes, min_viewport, max_viewport);
+
+            // Se o vetor de vértices for menor que 3, não é possível formar um polígono, então não é necessário desenhar
+            if (clipped_vertex.size() < 3)
+            {
+              clipped++;
+              continue;
+            }
+
+            // As posições no SRU são recortadas com as mesmas coordenadas de tela, logo ficam alinhadas com os vértices
+            std::vector<std::pair<core::Vector3, core::Vector3>> clipped_positions;
+            for (size_t i = 0; i < vertexes.size(); i++)
+              clipped_positions.push_back(std::make_pair(vertexes[i].first, positions[i]));
+            clipped_positions = math::clip2D_polygon(clipped_positions, min_viewport, max_viewport);
+
+            part.polygons.push_back({FRAME_POLYGON, part.vertexes.size(), clipped_vertex.size(), chunk.centroid, {}, chunk.material});
+            for (size_t i = 0; i < clipped_vertex.size(); i++)
+            {
+              part.vertexes.push_back(clipped_vertex[i].first);
+              part.attributes.push_back(clipped_vertex[i].second);
+              part.positions.push_back(clipped_positions[i].second);
+            }
           }
-
-          // Se o vetor de vértices for menor que 3, não é possível formar um polígono, então não é necessário desenhar
-          if (vertexes_gouraud.size() < 3)
-            continue;
-
-          utils::DrawFaceBufferGouraudShading(clipped_vertexes, this->z_buffer, this->color_buffer);
         }
-        else if (this->lighting_model == PHONG_SHADING)
-        {
-          std::vector<std::pair<core::Vector3, core::Vector3>> clipped_vertex = math::clip2D_polygon(vertexes, min_viewport, max_viewport);
+      }
 
-          // Se o vetor de vértices for menor que 3, não é possível formar um polígono, então não é necessário desenhar
-          if (clipped_vertex.size() < 3)
-            continue;
+      MRX_PROFILE_COUNT(PROFILE_FACES_CLIPPED, clipped); });
 
-          utils::DrawFaceBufferPhongShading(clipped_vertex, object_centroid, this->getCamera()->position, object->material, this->global_light, this->omni_lights, this->z_buffer, this->color_buffer);
-        }
-      }
-    }
+    for (const auto &part : parts)
+      models::AppendFrameGeometry(frame, part);
 
     // Resetar a clipping flag de cada vértice para a próxima iteração
     for (auto object : this->getObjects())
       object->is_visible = true;
+
+    this->renderState(this->rendered_state);
   }
 
   /**
-   * @brief Função para rasterizar a cena utilizando o pipeline de Smith
+   * @brief Estágio de geometria do pipeline de Smith
+   *
+   * @param frame Geometria do quadro a ser preenchida
    *
-   * @todo REFATORAR ESTA FUNÇÃO E SEPARAR EM FUNÇÕES PARA CADA MODELO DE ILUMINAÇÃO
+   * @note Transforma, ilumina (Gouraud), recorta em 3D e mapeia cada face para a viewport
    */
-  void Scene::smith_pipeline()
+  void Scene::smith_geometry(models::FrameGeometry &frame)
   {
     models::Camera3D *camera = this->getCamera();
 
@@ -534,157 +795,653 @@ namespace models
     //     this->getMaxViewport(),
     //     true);
     core::Matrix viewport_matrix = math::pipeline_smith::src_to_srt(
-        this->getMinViewport(),
-        this->getMaxViewport(),
+        this->getRenderMinViewport(),
+        this->getRenderMaxViewport(),
         this->getCamera()->near,
         this->getCamera()->far);
 
-    // core::Matrix result = math::MatrixMultiply(viewport_matrix, perspective_transformation_matrix);
+    // core::Matrix viewport_matrix = math::MatrixMultiply(viewport_matrix, perspective_transformation_matrix);
     core::Matrix result = math::MatrixMultiply(perspective_transformation_matrix, clipping_transformation_matrix);
     result = math::MatrixMultiply(result, sru_src_matrix);
 
-    // first = Vértice no SRC (sistema de câmera)
-    // second = normal/cor do vértice (usado no gouraud/phong)
-    std::vector<std::pair<core::Vector4, core::Vector3>> clipped_vertices;
+    // Só calcula os vetores unitários normais se o modelo de iluminação for diferente de FLAT_SHADING
+    // As normais das faces só seriam calculadas na ocultação de faces, depois da iluminação dos vértices
+    if (this->lighting_model != FLAT_SHADING)
+      this->normals_stage(true);
 
-    core::Vector4 vectorResult = {0.0f, 0.0f, 0.0f, 0.0f};
+    this->beginFrameGeometry(frame);
+    this->binOmniLights(frame, result, &viewport_matrix);
 
-    // Rasterização dos objetos
-    this->initializeBuffers();
+    if (this->lighting_model != PHONG_SHADING)
+      this->updateLightingCaches(frame);
 
-    for (auto object : this->getObjects())
-    {
-      // Só calcula os vetores unitários normais se o modelo de iluminação for diferente de FLAT_SHADING
-      if (this->lighting_model != FLAT_SHADING)
-        if (this->normal_algorithm == FOLEY_UNIT_NORMAL_VECTOR)
-          object->determineNormals();
-        else
-          object->determineNormalsByAverage();
+    // Direção de visão usada na ocultação de faces
+    core::Vector3 n = {camera->target.x - camera->position.x, camera->target.y - camera->position.y, camera->target.z - camera->position.z};
 
-      core::Vector3 centroid = this->centroid_algorithm == CENTROID_BY_MEAN ? object->getCentroidByMean() : object->getCentroidByWrapBox();
+    std::vector<FrameChunk> chunks = this->frameChunks(false);
+    std::vector<models::FrameGeometry> parts(chunks.size());
 
-      // usado como variável temporária pro flat shading e pro bounding box
-      std::vector<core::Vector3> vertexes_object;
+    this->getThreadPool()->parallel_for(chunks.size(), 1, [&](size_t begin, size_t end)
+                                        {
+      // No pipeline de Smith cada face é transformada, recortada em 3D e ocultada no mesmo laço,
+      // então o tempo do laço inteiro é atribuído ao recorte
+      MRX_PROFILE_SCOPE(PROFILE_CLIP);
+      [[maybe_unused]] size_t submitted = 0;
+      [[maybe_unused]] size_t culled = 0;
+      [[maybe_unused]] size_t clipped = 0;
 
-      vertexes_object.clear();
-      int num_clipped_faces = 0;
-
-      for (auto face : object->getFaces())
+      for (size_t c = begin; c < end; c++)
       {
-        core::HalfEdge *he = face->getHalfEdge();
-        clipped_vertices.clear();
-
-        while (true)
+        const FrameChunk &chunk = chunks[c];
+        models::FrameGeometry &part = parts[c];
+        models::Mesh *object = chunk.object;
+        const std::vector<core::Face *> &faces = object->getFaces();
+        // Cores das faces (Flat) ou dos vértices (Gouraud) do objeto, calculadas em updateLightingCaches
+        const core::Vector3 *face_colors = this->lighting_model == FLAT_SHADING ? this->face_colors[chunk.material].colors.data() : nullptr;
+        const core::Vector3 *colors = this->lighting_model == GOURAUD_SHADING ? this->vertex_colors[chunk.material].colors.data() : nullptr;
+
+        // first = Vértice no SRC (sistema de câmera)
+        // second = normal/cor do vértice (usado no gouraud/phong)
+        std::vector<std::pair<core::Vector4, core::Vector3>> clipped_vertices;
+        // first = Vértice no SRC, second = posição do vértice no SRU (iluminação e sombras)
+        std::vector<std::pair<core::Vector4, core::Vector3>> positions;
+
+        for (size_t f = chunk.begin; f < chunk.end; f++)
         {
-          core::Vector4 v = he->getOrigin()->getVector();
+          core::Face *face = faces[f];
+          core::HalfEdge *he = face->getHalfEdge();
+          clipped_vertices.clear();
+          positions.clear();
+          submitted++;
+
+          while (true)
+          {
+            core::Vertex *vertex = he->getOrigin();
+            core::Vector4 v = vertex->getVector();
+
+            core::Vector4 vectorResult = math::MatrixMultiplyVector(result, v);
 
-          vectorResult = math::MatrixMultiplyVector(result, v);
+            if (vectorResult.w != 0.0f && vectorResult.w > EPSILON)
+            {
+              // Gouraud: cor do vértice (recortada junto com ele), Phong: normal do vértice
+              clipped_vertices.push_back(std::make_pair(vectorResult, colors != nullptr ? colors[vertex->getIndex()] : vertex->getNormal()));
+              positions.push_back(std::make_pair(vectorResult, v.toVector3()));
+            }
 
-          if (vectorResult.w != 0.0f && vectorResult.w > EPSILON)
+            he = he->getNext();
+            if (he == face->getHalfEdge())
+              break;
+          }
+
+          if (this->lighting_model == GOURAUD_SHADING && clipped_vertices.size() < 3)
           {
-            vectorResult.x = vectorResult.x;
-            vectorResult.y = vectorResult.y;
-            vectorResult.z = vectorResult.z;
-            clipped_vertices.push_back(std::make_pair(vectorResult, he->getOrigin()->getNormal()));
+            clipped++;
+            continue;
           }
 
-          he = he->getNext();
-          if (he == face->getHalfEdge())
-            break;
-        }
+          if (this->clipping)
+          {
+            clipped_vertices = math::clip3D_polygon(clipped_vertices);
 
-        if (this->lighting_model == GOURAUD_SHADING)
-        {
-          if (clipped_vertices.size() < 3)
+            // As posições no SRU são recortadas com os mesmos vértices, logo ficam alinhadas
+            if (this->lighting_model == PHONG_SHADING)
+              positions = math::clip3D_polygon(positions);
+          }
+
+          for (auto &v : clipped_vertices)
+          {
+            core::Vector4 v_screen = math::MatrixMultiplyVector(viewport_matrix, v.first);
+
+            v_screen.x = v_screen.x / v_screen.w;
+            v_screen.y = v_screen.y / v_screen.w;
+            v_screen.z = v_screen.z;
+
+            v.first = v_screen;
+          }
+
+          // face->setVisible(face->isVisible(camera->position));
+          face->setVisible(face->isVisibleAltered(n));
+
+          if (!face->getVisible())
           {
-            num_clipped_faces++;
+            culled++;
             continue;
           }
-          // No Gouraud Shading, a cor de cada vértice é calculada antes do recorte
 
-          core::Vector3 eye = this->getCamera()->position;
-          models::Material object_material = object->material;
+          if (clipped_vertices.size() < 3)
+            clipped++;
+
+          models::FramePolygon polygon = {FRAME_POLYGON, part.vertexes.size(), clipped_vertices.size(), {0.0f, 0.0f, 0.0f}, {}, chunk.material};
 
-          for (auto &vertex : clipped_vertices)
+          if (this->lighting_model == FLAT_SHADING)
           {
-            core::Vector4 v = vertex.first;
-            core::Vector3 n = vertex.second;
-            models::Color c = models::GouraudShading(this->global_light, this->omni_lights, std::make_pair(v.toVector3(), n), eye, object_material);
-            core::Vector3 color = {static_cast<float>(c.r), static_cast<float>(c.g), static_cast<float>(c.b)};
-            vertex = std::make_pair(v, color);
+            core::Vector3 color = face_colors[f];
+            polygon.color = {color.x, color.y, color.z, static_cast<float>(MAX_COLOR_VALUE)};
           }
-        }
+          else if (this->lighting_model == PHONG_SHADING)
+            polygon.centroid = chunk.centroid;
 
-        if (this->clipping)
-          clipped_vertices = math::clip3D_polygon(clipped_vertices);
+          part.polygons.push_back(polygon);
 
-        for (auto &v : clipped_vertices)
-        {
-          core::Vector4 v_screen = math::MatrixMultiplyVector(viewport_matrix, v.first);
+          for (size_t i = 0; i < clipped_vertices.size(); i++)
+          {
+            part.vertexes.push_back(clipped_vertices[i].first.toVector3());
 
-          v_screen.x = v_screen.x / v_screen.w;
-          v_screen.y = v_screen.y / v_screen.w;
-          v_screen.z = v_screen.z;
+            // Gouraud: cor do vértice, Phong: normal do vértice
+            if (this->lighting_model != FLAT_SHADING)
+              part.attributes.push_back(clipped_vertices[i].second);
 
-          v.first = v_screen;
+            if (this->lighting_model == PHONG_SHADING)
+              part.positions.push_back(positions[i].second);
+          }
         }
+      }
 
-        // face->setVisible(face->isVisible(camera->position));
-        core::Vector3 n = {camera->target.x - camera->position.x, camera->target.y - camera->position.y, camera->target.z - camera->position.z};
+      MRX_PROFILE_COUNT(PROFILE_FACES_SUBMITTED, submitted);
+      MRX_PROFILE_COUNT(PROFILE_FACES_CULLED, culled);
+      MRX_PROFILE_COUNT(PROFILE_FACES_CLIPPED, clipped); });
 
-        face->setVisible(face->isVisibleAltered(n));
+    for (const auto &part : parts)
+      models::AppendFrameGeometry(frame, part);
 
-        if (!face->getVisible())
-          continue;
+    this->renderState(this->rendered_state);
+  }
 
-        if (this->lighting_model == FLAT_SHADING)
-        {
+  /**
+   * @brief Inicializa a geometria de um quadro com as cópias do estado da cena usadas na rasterização
+   *
+   * @param frame Geometria do quadro
+   *
+   * @note As luzes e os materiais são copiados para que a rasterização não acesse a cena
+   */
+  void Scene::beginFrameGeometry(models::FrameGeometry &frame)
+  {
+    models::ClearFrameGeometry(frame);
 
-          // usado como variável temporária pro flat shading e pro bounding box
-          std::vector<core::Vector3> vertexes;
+    frame.lighting_model = this->lighting_model;
+    frame.precision = this->precision;
+    frame.overdraw = this->overdraw;
+    frame.width = static_cast<int>(this->getRenderMaxViewport().x + 1);
+    frame.height = static_cast<int>(this->getRenderMaxViewport().y + 1);
+    frame.eye = this->getCamera()->position;
+    frame.global_light = this->global_light;
+    frame.omni_lights = this->omni_lights;
 
-          vertexes.clear();
+    this->updateShadowMaps();
+
+    for (size_t i = 0; i < this->shadow_maps.size(); i++)
+      frame.omni_lights[i].shadow_map = this->shadow_maps[i];
+
+    for (auto object : this->objects)
+    {
+      frame.materials.push_back(object->material);
+      frame.objects.push_back({object, object->getVersion(), object == this->selected_object});
+    }
+
+    // Estado comum a todos os objetos, usado para refazer apenas a parte da tela que mudou
+    this->renderState(frame.state, false);
+  }
+
+  /**
+   * @brief Distribui as luzes omni do quadro nos blocos da tela
+   *
+   * @param frame Geometria do quadro (usa as cópias das luzes e o tamanho do quadro)
+   * @param transformation Matriz que leva do SRU para a tela (Adair) ou para o espaço de recorte (Smith)
+   * @param viewport Matriz de viewport do pipeline de Smith (nullptr no pipeline de Adair)
+   *
+   * @note Luzes sem raio de influência alcançam todos os blocos
+   */
+  void Scene::binOmniLights(models::FrameGeometry &frame, const core::Matrix &transformation, const core::Matrix *viewport)
+  {
+    std::vector<core::Vector4> bounds;
+
+    for (const auto &omni : frame.omni_lights)
+      bounds.push_back(models::OmniBoundingBox(omni, transformation, viewport, frame.width, frame.height));
+
+    models::BinOmniLights(frame.light_tiles, bounds, frame.width, frame.height);
+  }
+
+  /**
+   * @brief Atualiza os mapas de sombra das luzes omni
+   *
+   * @note Cada mapa guarda a posição e o raio da luz e a versão dos objetos dentro do raio. Se nada
+   * mudou o mapa é reaproveitado, então uma cena estática com a câmera em movimento paga o custo das
+   * sombras apenas uma vez
+   * @note As 6 faces de todos os mapas desatualizados são geradas em paralelo
+   * @note Com as sombras desligadas os mapas são descartados
+   */
+  void Scene::updateShadowMaps()
+  {
+    if (!this->shadows)
+    {
+      this->shadow_maps.clear();
+      return;
+    }
+
+    this->shadow_maps.resize(this->omni_lights.size());
+
+    std::vector<std::shared_ptr<models::ShadowCubeMap>> rebuild;
+    std::vector<std::vector<models::Mesh *>> casters;
+
+    for (size_t i = 0; i < this->omni_lights.size(); i++)
+    {
+      const models::Omni &omni = this->omni_lights[i];
+      std::vector<models::Mesh *> light_casters = models::ShadowCasters(omni, this->objects);
+
+      if (this->shadow_maps[i] != nullptr && models::ShadowCubeMapMatches(*this->shadow_maps[i], omni, light_casters))
+        continue;
 
-          for (auto vertex : clipped_vertices)
+      // Novo mapa, o anterior pode estar sendo lido pela rasterização do quadro anterior
+      this->shadow_maps[i] = std::make_shared<models::ShadowCubeMap>();
+      models::BeginShadowCubeMap(*this->shadow_maps[i], omni, light_casters, SHADOW_MAP_SIZE);
+
+      rebuild.push_back(this->shadow_maps[i]);
+      casters.push_back(light_casters);
+    }
+
+    this->getThreadPool()->parallel_for(rebuild.size() * SHADOW_FACES, 1, [&](size_t begin, size_t end)
+                                        {
+      MRX_PROFILE_SCOPE(PROFILE_LIGHTING);
+
+      for (size_t i = begin; i < end; i++)
+        models::RenderShadowCubeFace(*rebuild[i / SHADOW_FACES], static_cast<int>(i % SHADOW_FACES), casters[i / SHADOW_FACES]); });
+  }
+
+  /**
+   * @brief Atualiza a iluminação constante dos objetos visíveis: cores dos vértices (Gouraud Shading)
+   * ou das faces (Flat Shading)
+   *
+   * @param frame Geometria do quadro (usa as cópias das luzes, com os mapas de sombra, e o observador)
+   *
+   * @note Deve ser chamada depois do cálculo das normais dos vértices
+   * @note Os termos ambiente e difuso só são refeitos quando a malha, as luzes ou o material mudam.
+   * Quando apenas a câmera se move, só o termo especular é refeito (nada, se ele não é usado)
+   * @note O trabalho é dividido em blocos de GEOMETRY_CHUNK_SIZE elementos. A montagem das faces
+   * apenas consulta as cores pelo índice da face ou do vértice
+   */
+  void Scene::updateLightingCaches(const models::FrameGeometry &frame)
+  {
+    bool faces = this->lighting_model == FLAT_SHADING;
+    std::vector<models::LightingCache> &caches = faces ? this->face_colors : this->vertex_colors;
+
+    caches.resize(this->objects.size());
+
+    struct LightingChunk
+    {
+      models::Mesh *object;
+      models::LightingCache *cache;
+      bool diffuse;
+      size_t begin;
+      size_t end;
+    };
+
+    std::vector<LightingChunk> chunks;
+
+    for (size_t i = 0; i < this->objects.size(); i++)
+    {
+      models::Mesh *object = this->objects[i];
+      models::LightingCache &cache = caches[i];
+
+      if (!object->is_visible)
+        continue;
+
+      bool diffuse = !models::LightingCacheMatches(cache, object->getVersion(), this->normal_algorithm, frame.global_light, frame.omni_lights, object->material, frame.precision);
+      size_t count = faces ? object->getFaces().size() : object->getVertices().size();
+
+      if (diffuse)
+        models::BeginLightingCache(cache, object->getVersion(), this->normal_algorithm, frame.global_light, frame.omni_lights, object->material, count, frame.precision);
+      else if (models::LightingCacheViewMatches(cache, frame.eye))
+        continue;
+
+      models::BeginLightingCacheView(cache, frame.eye);
+
+      for (size_t e = 0; e < count; e += GEOMETRY_CHUNK_SIZE)
+        chunks.push_back({object, &cache, diffuse, e, std::min(e + GEOMETRY_CHUNK_SIZE, count)});
+    }
+
+    this->getThreadPool()->parallel_for(chunks.size(), 1, [&](size_t begin, size_t end)
+                                        {
+      MRX_PROFILE_SCOPE(PROFILE_LIGHTING);
+
+      // Posições e normais do bloco em vetores contíguos
+      std::vector<core::Vector3> positions;
+      std::vector<core::Vector3> normals;
+      std::vector<unsigned int> lights;
+
+      for (size_t c = begin; c < end; c++)
+      {
+        const LightingChunk &chunk = chunks[c];
+        models::LightingCache &cache = *chunk.cache;
+
+        positions.clear();
+        normals.clear();
+
+        for (size_t e = chunk.begin; e < chunk.end; e++)
+        {
+          if (faces)
           {
-            vertexes.push_back({vertex.first.x, vertex.first.y, vertex.first.z});
-            vertexes_object.push_back({vertex.first.x, vertex.first.y, vertex.first.z});
+            core::Face *face = chunk.object->getFaces()[e];
+
+            // No pipeline de Smith, a normal da face só seria calculada na ocultação de faces
+            face->getFaceNormal();
+
+            positions.push_back(face->getFaceCentroid());
+            normals.push_back(face->getNormal());
           }
+          else
+          {
+            core::Vertex *vertex = chunk.object->getVertices()[e];
 
-          utils::DrawFaceBufferFlatShading(vertexes, this->getCamera()->position, face->getFaceCentroid(), face->getNormal(), object->material, this->global_light, this->omni_lights, this->z_buffer, this->color_buffer);
+            positions.push_back(vertex->getVector().toVector3());
+            normals.push_back(vertex->getNormal());
+          }
         }
-        else if (this->lighting_model == GOURAUD_SHADING)
+
+        // Apenas as luzes que alcançam o bloco (os blocos da tela dependem da câmera e não servem ao cache)
+        models::GatherOmniLights(frame.omni_lights, positions.data(), positions.size(), lights);
+
+        if (frame.precision == FAST_PRECISION)
         {
+          if (chunk.diffuse)
+            models::FlatDiffuseColors<math::Fast>(frame.global_light, frame.omni_lights, lights, positions.data(), normals.data(), positions.size(), cache.material, cache.diffuse.data() + chunk.begin);
+
+          models::FlatSpecularColors<math::Fast>(frame.omni_lights, lights, positions.data(), normals.data(), positions.size(), frame.eye, cache.material, cache.diffuse.data() + chunk.begin, cache.colors.data() + chunk.begin);
+        }
+        else
+        {
+          if (chunk.diffuse)
+            models::FlatDiffuseColors<math::Exact>(frame.global_light, frame.omni_lights, lights, positions.data(), normals.data(), positions.size(), cache.material, cache.diffuse.data() + chunk.begin);
+
+          models::FlatSpecularColors<math::Exact>(frame.omni_lights, lights, positions.data(), normals.data(), positions.size(), frame.eye, cache.material, cache.diffuse.data() + chunk.begin, cache.colors.data() + chunk.begin);
+        }
+      } });
+  }
+
+  /**
+   * @brief Divide as faces dos objetos visíveis em blocos para a montagem da geometria do quadro
+   *
+   * @param bounding_box Se verdadeiro, adiciona um bloco com a caixa envolvente do objeto selecionado
+   *
+   * @return std::vector<FrameChunk> Blocos na ordem em que devem ser rasterizados
+   */
+  std::vector<Scene::FrameChunk> Scene::frameChunks(bool bounding_box)
+  {
+    std::vector<FrameChunk> result;
+
+    for (size_t i = 0; i < this->objects.size(); i++)
+    {
+      models::Mesh *object = this->objects[i];
+
+      if (!object->is_visible)
+        continue;
+
+      core::Vector3 centroid = this->centroid_algorithm == CENTROID_BY_WRAP_BOX ? object->getCentroidByWrapBox() : object->getCentroidByMean();
+
+      if (bounding_box && object == this->getSelectedObject())
+        result.push_back({object, static_cast<int>(i), true, 0, 0, centroid});
+
+      for (size_t f = 0; f < object->getFaces().size(); f += GEOMETRY_CHUNK_SIZE)
+        result.push_back({object, static_cast<int>(i), false, f, std::min(f + GEOMETRY_CHUNK_SIZE, object->getFaces().size()), centroid});
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Monta o estado da cena que determina o conteúdo do framebuffer
+   *
+   * @param state Estado da cena (valores em float são guardados bit a bit)
+   * @param objects Se falso, apenas o estado comum a todos os objetos (câmera, luzes e configurações)
+   *
+   * @note Os objetos entram pelo endereço e pela versão (ver Mesh::touch), o que cobre as
+   * transformações sem percorrer os vértices
+   */
+  void Scene::renderState(std::vector<std::uint64_t> &state, bool objects)
+  {
+    auto push = [&state](float value)
+    { state.push_back(std::bit_cast<std::uint32_t>(value)); };
+    auto push_vector = [&push](const core::Vector3 &value)
+    { push(value.x); push(value.y); push(value.z); };
+    auto push_channels = [&push](const models::ColorChannels &value)
+    { push(value.r); push(value.g); push(value.b); };
+
+    state.clear();
+
+    models::Camera3D *camera = this->getCamera();
+    push_vector(camera->position);
+    push_vector(camera->target);
+    push_vector(camera->up);
+    push(camera->d);
+    push(camera->near);
+    push(camera->far);
+
+    push(this->min_viewport.x);
+    push(this->min_viewport.y);
+    push(this->max_viewport.x);
+    push(this->max_viewport.y);
+    push(this->min_window.x);
+    push(this->min_window.y);
+    push(this->max_window.x);
+    push(this->max_window.y);
+    push(this->render_scale);
+
+    state.push_back(static_cast<std::uint64_t>(this->lighting_model));
+    state.push_back(static_cast<std::uint64_t>(this->precision));
+    state.push_back(static_cast<std::uint64_t>(this->pipeline_model));
+    state.push_back(static_cast<std::uint64_t>(this->normal_algorithm));
+    state.push_back(static_cast<std::uint64_t>(this->centroid_algorithm));
+    state.push_back(this->clipping);
+    state.push_back(this->shadows);
+    state.push_back(this->overdraw);
+
+    models::Color global = this->global_light.intensity;
+    state.push_back(global.r | global.g << 8 | global.b << 16 | static_cast<std::uint64_t>(global.a) << 24);
+
+    state.push_back(this->omni_lights.size());
+    for (const auto &omni : this->omni_lights)
+    {
+      push_vector(omni.position);
+      push_channels(omni.intensity);
+      push(omni.radius);
+    }
+
+    if (!objects)
+      return;
+
+    state.push_back(this->objects.size());
+    for (auto object : this->objects)
+    {
+      state.push_back(reinterpret_cast<std::uintptr_t>(object));
+      state.push_back(object->getVersion());
+      state.push_back(object == this->selected_object);
+      push_channels(object->material.ambient);
+      push_channels(object->material.diffuse);
+      push_channels(object->material.specular);
+      push(object->material.shininess);
+    }
+  }
+
+  /**
+   * @brief Estágio de geometria do pipeline de Adair
+   *
+   * @param transformation Matriz composta (viewport * projeção * SRU -> SRC)
+   *
+   * @note O trabalho é dividido entre objetos e, em malhas grandes, em blocos de GEOMETRY_CHUNK_SIZE
+   * vértices/faces. Cada bloco escreve apenas nos seus próprios vértices/faces, então o resultado
+   * não depende da quantidade de threads
+   * @note A visibilidade das faces usa apenas as coordenadas do SRU, por isso é calculada junto
+   * com a transformação dos vértices. As normais dos vértices dependem das normais das faces e
+   * são calculadas em uma segunda etapa
+   */
+  void Scene::geometry_stage(const core::Matrix &transformation)
+  {
+    utils::ThreadPool *pool = this->getThreadPool();
+    models::Camera3D *camera = this->getCamera();
+
+    core::Vector3 vrp = camera->position;
+    core::Vector3 target = camera->target;
+
+    // Direção da câmera (eixo Z do espaço da câmera)
+    core::Vector3 camera_forward = math::Vector3Normalize(math::Vector3Subtract(target, vrp));
+
+    // Pré computação da visibilidade dos objetos
+    // Se o objeto estiver dentro do intervalo de near e far da câmera, ele é visível
+    // Caso contrário, ele é invisível
+    pool->parallel_for(this->objects.size(), 1, [&](size_t begin, size_t end)
+                       {
+      for (size_t i = begin; i < end; i++)
+      {
+        models::Mesh *object = this->objects[i];
+
+        core::Vector3 centroid = this->centroid_algorithm == CENTROID_BY_MEAN ? object->getCentroidByMean() : object->getCentroidByWrapBox();
+
+        // Vetor do centroid para a câmera
+        core::Vector3 centroid_to_camera = centroid - vrp;
+
+        // Projeção na direção da câmera (depth)
+        float depth = math::Vector3DotProduct(camera_forward, centroid_to_camera);
+
+        // Verifica se está fora do near/far
+        object->is_visible = !(depth < camera->near || depth > camera->far);
+      } });
+
+    // Blocos de vértices e faces dos objetos visíveis
+    struct GeometryChunk
+    {
+      models::Mesh *object;
+      bool faces;
+      size_t begin;
+      size_t end;
+    };
+
+    std::vector<GeometryChunk> chunks;
+
+    for (auto object : this->objects)
+    {
+      if (!object->is_visible)
+        continue;
+
+      for (size_t i = 0; i < object->getVertices().size(); i += GEOMETRY_CHUNK_SIZE)
+        chunks.push_back({object, false, i, std::min(i + GEOMETRY_CHUNK_SIZE, object->getVertices().size())});
+
+      for (size_t i = 0; i < object->getFaces().size(); i += GEOMETRY_CHUNK_SIZE)
+        chunks.push_back({object, true, i, std::min(i + GEOMETRY_CHUNK_SIZE, object->getFaces().size())});
+    }
 
-          std::vector<std::pair<core::Vector3, models::Color>> clipped_gouraud_vertexes;
+    pool->parallel_for(chunks.size(), 1, [&](size_t begin, size_t end)
+                       {
+      for (size_t c = begin; c < end; c++)
+      {
+        const GeometryChunk &chunk = chunks[c];
 
-          clipped_gouraud_vertexes.clear();
+        if (chunk.faces)
+        {
+          MRX_PROFILE_SCOPE(PROFILE_CULL);
+          const std::vector<core::Face *> &faces = chunk.object->getFaces();
+          [[maybe_unused]] size_t culled = 0;
 
-          for (auto vertex : clipped_vertices)
+          for (size_t i = chunk.begin; i < chunk.end; i++)
           {
-            clipped_gouraud_vertexes.push_back(std::make_pair(vertex.first.toVector3(), models::ChannelsToColor({vertex.second.x, vertex.second.y, vertex.second.z})));
-            vertexes_object.push_back({vertex.first.x, vertex.first.y, vertex.first.z});
+            faces[i]->setVisible(faces[i]->isVisible(vrp));
+
+            if (!faces[i]->getVisible())
+              culled++;
           }
 
-          utils::DrawFaceBufferGouraudShading(clipped_gouraud_vertexes, this->z_buffer, this->color_buffer);
+          MRX_PROFILE_COUNT(PROFILE_FACES_SUBMITTED, chunk.end - chunk.begin);
+          MRX_PROFILE_COUNT(PROFILE_FACES_CULLED, culled);
         }
-        else if (this->lighting_model == PHONG_SHADING)
+        else
         {
+          MRX_PROFILE_SCOPE(PROFILE_TRANSFORM);
+          const std::vector<core::Vertex *> &vertices = chunk.object->getVertices();
+          size_t count = chunk.end - chunk.begin;
 
-          std::vector<std::pair<core::Vector3, core::Vector3>> vertexes;
+          // Os vértices do bloco são copiados para um vetor contíguo, transformado de uma vez pelo kernel
+          std::vector<core::Vector4> vectors(count);
+          std::vector<core::Vector3> screen(count);
 
-          vertexes.clear();
+          for (size_t i = 0; i < count; i++)
+            vectors[i] = vertices[chunk.begin + i]->getVector();
 
-          for (auto v : clipped_vertices)
-          {
-            vertexes.push_back({v.first.toVector3(), v.second});
-            vertexes_object.push_back({v.first.x, v.first.y, v.first.z});
-          }
+          math::project_vertices(transformation, vectors.data(), screen.data(), count);
 
-          utils::DrawFaceBufferPhongShading(vertexes, centroid, this->getCamera()->position, object->material, this->global_light, this->omni_lights, this->z_buffer, this->color_buffer);
+          for (size_t i = 0; i < count; i++)
+            vertices[chunk.begin + i]->setVectorScreen(screen[i]);
         }
+      } });
+
+    // Só calcula os vetores unitários normais se o modelo de iluminação for diferente de FLAT_SHADING
+    if (this->lighting_model != FLAT_SHADING)
+      this->normals_stage();
+  }
+
+  /**
+   * @brief Calcula as normais dos vértices de todos os objetos visíveis em paralelo
+   *
+   * @param face_normals Se verdadeiro, calcula antes as normais das faces
+   *
+   * @note Sem face_normals, usa as normais das faces calculadas previamente (na ocultação de faces do
+   * pipeline de Adair). Cada bloco escreve apenas nos seus vértices
+   */
+  void Scene::normals_stage(bool face_normals)
+  {
+    struct NormalChunk
+    {
+      models::Mesh *object;
+      size_t begin;
+      size_t end;
+    };
+
+    std::vector<NormalChunk> chunks;
+
+    if (face_normals)
+    {
+      for (auto object : this->objects)
+      {
+        if (!object->is_visible)
+          continue;
+
+        for (size_t i = 0; i < object->getFaces().size(); i += GEOMETRY_CHUNK_SIZE)
+          chunks.push_back({object, i, std::min(i + GEOMETRY_CHUNK_SIZE, object->getFaces().size())});
       }
+
+      this->getThreadPool()->parallel_for(chunks.size(), 1, [&](size_t begin, size_t end)
+                                          {
+        MRX_PROFILE_SCOPE(PROFILE_LIGHTING);
+
+        for (size_t c = begin; c < end; c++)
+        {
+          const std::vector<core::Face *> &faces = chunks[c].object->getFaces();
+
+          for (size_t i = chunks[c].begin; i < chunks[c].end; i++)
+            faces[i]->getFaceNormal();
+        } });
+
+      chunks.clear();
     }
+
+    for (auto object : this->objects)
+    {
+      if (!object->is_visible)
+        continue;
+
+      for (size_t i = 0; i < object->getVertices().size(); i += GEOMETRY_CHUNK_SIZE)
+        chunks.push_back({object, i, std::min(i + GEOMETRY_CHUNK_SIZE, object->getVertices().size())});
+    }
+
+    this->getThreadPool()->parallel_for(chunks.size(), 1, [&](size_t begin, size_t end)
+                                        {
+      // As normais dos vértices são usadas apenas na iluminação
+      MRX_PROFILE_SCOPE(PROFILE_LIGHTING);
+
+      for (size_t c = begin; c < end; c++)
+      {
+        if (this->normal_algorithm == FOLEY_UNIT_NORMAL_VECTOR)
+          chunks[c].object->determineNormals(chunks[c].begin, chunks[c].end);
+        else
+          chunks[c].object->determineNormalsByAverage(chunks[c].begin, chunks[c].end);
+      } });
   }
 
   /**
@@ -696,11 +1453,15 @@ namespace models
    */
   void Scene::selectObject(int x, int y)
   {
+    // As caixas estão na resolução interna do framebuffer (ver render_scale)
+    float render_x = static_cast<float>(x) * this->render_scale;
+    float render_y = static_cast<float>(y) * this->render_scale;
+
     // iterate over all objects
     for (auto object : this->objects)
     {
       core::Vector4 box = object->getBox(true);
-      if (box.x <= x && box.y <= y && box.z >= x && box.w >= y)
+      if (box.x <= render_x && box.y <= render_y && box.z >= render_x && box.w >= render_y)
       {
         this->setSelectedObject(object);
         object->setSelected(true);
@@ -732,20 +1493,6 @@ namespace models
   {
   }
 
-  void Scene::initializeBuffers()
-  {
-    int width = static_cast<int>(this->max_viewport.x + 1);
-    int height = static_cast<int>(this->max_viewport.y + 1);
-
-    // clear the buffers
-    this->z_buffer.clear();
-    this->color_buffer.clear();
-
-    // Resize and initialize the z-buffer and color buffer
-    this->z_buffer = std::vector<std::vector<float>>(width, std::vector<float>(height, std::numeric_limits<float>::infinity()));
-    this->color_buffer = std::vector<std::vector<models::Color>>(width, std::vector<models::Color>(height, models::TRANSPARENT));
-  }
-
   /**
    * @brief Função para converter a cena em um objeto json
    *
@@ -768,6 +1515,7 @@ namespace models
     j["min_window"] = this->min_window.to_json();
     j["max_window"] = this->max_window.to_json();
     j["illumination"] = this->lighting_model;
+    j["precision"] = this->precision;
     j["pipeline"] = this->pipeline_model;
 
     return j;
@@ -797,6 +1545,7 @@ namespace models
     this->max_window = core::Vector2::from_json(json_data["max_window"]);
 
     this->lighting_model = json_data["illumination"];
+    this->precision = json_data.value("precision", EXACT_PRECISION);
     this->pipeline_model = json_data["pipeline"];
   }
 
@@ -814,6 +1563,9 @@ namespace models
     if (this->selected_object == nullptr) // Nada a fazer
       return;
 
+    if (this->recorder != nullptr)
+      models::RecordTransform(*this->recorder, this, RECORD_TRANSLATE, translation);
+
     // Inverte a matriz de viewport
     // Obs.: A inversão é necessária pois estamos trabalhando com coordenadas de tela (SRT)
     // e a transformação deve ser feita em relação ao espaço do objeto (SRU)
@@ -836,6 +1588,8 @@ namespace models
                          vertex->getY() + transformedTranslation.y,
                          vertex->getZ() + transformedTranslation.z, 1.0f});
     }
+
+    this->selected_object->touch();
   }
 
   /**
@@ -849,6 +1603,9 @@ namespace models
     if (this->selected_object == nullptr) // Nada a fazer
       return;
 
+    if (this->recorder != nullptr)
+      models::RecordTransform(*this->recorder, this, RECORD_ROTATE_AXIS, axis, angle);
+
     core::Matrix rotateMatrix = math::MatrixRotate(axis, angle);
 
     for (auto vertex : this->selected_object->getVertices())
@@ -858,6 +1615,8 @@ namespace models
 
       vertex->setVector(result);
     }
+
+    this->selected_object->touch();
   }
 
   void Scene::scaleObject(core::Vector3 scale)
@@ -865,6 +1624,9 @@ namespace models
     if (this->selected_object == nullptr) // Nada a fazer
       return;
 
+    if (this->recorder != nullptr)
+      models::RecordTransform(*this->recorder, this, RECORD_SCALE, scale);
+
     core::Matrix scaleMatrix = math::MatrixScale(scale);
 
     for (auto vertex : this->selected_object->getVertices())
@@ -874,6 +1636,8 @@ namespace models
 
       vertex->setVector(result);
     }
+
+    this->selected_object->touch();
   }
 
   /**
@@ -888,6 +1652,9 @@ namespace models
     if (this->selected_object == nullptr) // Nada a fazer
       return;
 
+    if (this->recorder != nullptr)
+      models::RecordTransform(*this->recorder, this, RECORD_ROTATE, angle);
+
     core::Matrix rotateMatrix = math::MatrixRotateXYZ(angle);
 
     for (auto vertex : this->selected_object->getVertices())
@@ -897,5 +1664,7 @@ namespace models
 
       vertex->setVector(result);
     }
+
+    this->selected_object->touch();
   }
 } // namespace models
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include <models/shadow.hpp>
+#include <math/pipeline.hpp>
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace models
+{
+  /**
+   * @brief Recorta um polígono (coordenadas da face) contra um plano
+   *
+   * @param polygon Vértices do polígono
+   * @param distance Distância com sinal de um vértice ao plano (positiva = dentro)
+   *
+   * @return std::vector<core::Vector3> Polígono recortado
+   *
+   * @note O algoritmo de Sutherland-Hodgman é utilizado
+   */
+  template <typename Distance>
+  static std::vector<core::Vector3> ClipShadowPolygon(const std::vector<core::Vector3> &polygon, Distance distance)
+  {
+    std::vector<core::Vector3> result;
+
+    for (size_t i = 0; i < polygon.size(); i++)
+    {
+      const core::Vector3 &p1 = polygon[i];
+      const core::Vector3 &p2 = polygon[(i + 1) % polygon.size()];
+
+      float d1 = distance(p1);
+      float d2 = distance(p2);
+
+      if (d1 >= 0.0f && d2 >= 0.0f)
+        result.push_back(p2);
+      else if (d1 >= 0.0f || d2 >= 0.0f)
+      {
+        float t = d1 / (d1 - d2);
+        result.push_back({p1.x + (p2.x - p1.x) * t, p1.y + (p2.y - p1.y) * t, p1.z + (p2.z - p1.z) * t});
+
+        if (d2 >= 0.0f)
+          result.push_back(p2);
+      }
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Seleciona os objetos que podem projetar sombra de uma luz
+   *
+   * @param omni Luz omnidirecional
+   * @param objects Objetos da cena
+   *
+   * @return std::vector<models::Mesh *> Objetos cuja esfera envolvente intersecta a esfera de influência da luz
+   *
+   * @note Luzes sem raio (alcance infinito) usam todos os objetos
+   */
+  std::vector<models::Mesh *> ShadowCasters(const models::Omni &omni, const std::vector<models::Mesh *> &objects)
+  {
+    std::vector<models::Mesh *> result;
+
+    for (auto object : objects)
+    {
+      if (omni.radius > 0.0f)
+      {
+        core::Vector4 sphere = object->getBoundingSphere();
+
+        if (math::Vector3Distance(omni.position, {sphere.x, sphere.y, sphere.z}) > omni.radius + sphere.w)
+          continue;
+      }
+
+      result.push_back(object);
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Verifica se um mapa de sombra ainda corresponde à luz e aos objetos
+   *
+   * @param map Mapa de sombra
+   * @param omni Luz omnidirecional
+   * @param casters Objetos que projetam sombra (ver ShadowCasters)
+   *
+   * @return bool Verdadeiro se nem a luz nem os objetos mudaram desde que o mapa foi gerado
+   */
+  bool ShadowCubeMapMatches(const models::ShadowCubeMap &map, const models::Omni &omni, const std::vector<models::Mesh *> &casters)
+  {
+    if (map.position.x != omni.position.x || map.position.y != omni.position.y || map.position.z != omni.position.z)
+      return false;
+
+    if (map.radius != omni.radius || map.casters.size() != casters.size())
+      return false;
+
+    for (size_t i = 0; i < casters.size(); i++)
+      if (map.casters[i].first != casters[i] || map.casters[i].second != casters[i]->getVersion())
+        return false;
+
+    return true;
+  }
+
+  /**
+   * @brief Prepara um mapa de sombra para ser gerado
+   *
+   * @param map Mapa de sombra
+   * @param omni Luz omnidirecional
+   * @param casters Objetos que projetam sombra (ver ShadowCasters)
+   * @param size Resolução de cada face
+   *
+   * @note Guarda a chave do mapa e limpa as faces, que depois são preenchidas por RenderShadowCubeFace
+   */
+  void BeginShadowCubeMap(models::ShadowCubeMap &map, const models::Omni &omni, const std::vector<models::Mesh *> &casters, int size)
+  {
+    map.position = omni.position;
+    map.radius = omni.radius;
+    map.size = size;
+
+    map.casters.clear();
+    for (auto caster : casters)
+      map.casters.push_back(std::make_pair(caster, caster->getVersion()));
+
+    for (auto &face : map.faces)
+      face.assign(size, std::vector<float>(size, std::numeric_limits<float>::infinity()));
+  }
+
+  /**
+   * @brief Preenche uma face do mapa de sombra com a profundidade dos objetos
+   *
+   * @param map Mapa de sombra (ver BeginShadowCubeMap)
+   * @param face Face do cube map (0: +X, 1: -X, 2: +Y, 3: -Y, 4: +Z, 5: -Z)
+   * @param casters Objetos que projetam sombra
+   *
+   * @note Cada face escreve apenas no seu próprio buffer, então as 6 faces podem ser geradas em paralelo
+   * @note A profundidade guardada é -1/z, que varia linearmente na tela da face e mantém o menor valor
+   * para o ponto mais próximo da luz
+   */
+  void RenderShadowCubeFace(models::ShadowCubeMap &map, int face, const std::vector<models::Mesh *> &casters)
+  {
+    float scale = 0.5f * static_cast<float>(map.size - 1);
+
+    std::vector<core::Vector3> polygon;
+
+    for (auto caster : casters)
+    {
+      for (auto f : caster->getFaces())
+      {
+        core::HalfEdge *he = f->getHalfEdge();
+
+        polygon.clear();
+
+        while (true)
+        {
+          core::Vertex *vertex = he->getOrigin();
+          polygon.push_back(CubeFaceCoordinates(face, math::Vector3Subtract({vertex->getX(), vertex->getY(), vertex->getZ()}, map.position)));
+
+          he = he->getNext();
+          if (he == f->getHalfEdge())
+            break;
+        }
+
+        // Recorta contra o plano near e os 4 planos laterais da face
+        polygon = ClipShadowPolygon(polygon, [](const core::Vector3 &p)
+                                    { return p.z - SHADOW_NEAR; });
+        polygon = ClipShadowPolygon(polygon, [](const core::Vector3 &p)
+                                    { return p.z - p.x; });
+        polygon = ClipShadowPolygon(polygon, [](const core::Vector3 &p)
+                                    { return p.z + p.x; });
+        polygon = ClipShadowPolygon(polygon, [](const core::Vector3 &p)
+                                    { return p.z - p.y; });
+        polygon = ClipShadowPolygon(polygon, [](const core::Vector3 &p)
+                                    { return p.z + p.y; });
+
+        if (polygon.size() < 3)
+          continue;
+
+        for (auto &p : polygon)
+          p = {(p.x / p.z + 1.0f) * scale, (p.y / p.z + 1.0f) * scale, -1.0f / p.z};
+
+        math::fill_polygon_depth(polygon, map.faces[face]);
+      }
+    }
+  }
+
+  /**
+   * @brief Gera todas as faces de um mapa de sombra
+   *
+   * @param map Mapa de sombra
+   * @param omni Luz omnidirecional
+   * @param casters Objetos que projetam sombra (ver ShadowCasters)
+   * @param size Resolução de cada face
+   */
+  void BuildShadowCubeMap(models::ShadowCubeMap &map, const models::Omni &omni, const std::vector<models::Mesh *> &casters, int size)
+  {
+    models::BeginShadowCubeMap(map, omni, casters, size);
+
+    for (int face = 0; face < SHADOW_FACES; face++)
+      models::RenderShadowCubeFace(map, face, casters);
+  }
+} // namespace models
@@ -1,4 +1,16 @@
 #include <utils/file.hpp>
+#include <utils/trace.hpp>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace utils
 {
@@ -12,6 +24,8 @@ namespace utils
    */
   json load_json(const std::string &file_path)
   {
+    MRX_TRACE_SCOPE("load_json", TRACE_IO);
+
     std::ifstream file(file_path);
     json json_file;
 
@@ -38,6 +52,8 @@ namespace utils
    */
   void save_json(const std::string &file_path, const json &json_data)
   {
+    MRX_TRACE_SCOPE("save_json", TRACE_IO);
+
     std::ofstream json_file(file_path);
     if (!json_file.is_open())
     {
@@ -50,4 +66,117 @@ namespace utils
       std::cerr << "Erro ao escrever no arquivo '" << file_path << "'." << std::endl;
     }
   }
+
+  /**
+   * @brief Mapeia um arquivo inteiro na memória para leitura
+   *
+   * @param file_path Caminho do arquivo
+   * @param file Arquivo mapeado (ver unmap_file)
+   *
+   * @return bool Verdadeiro se o arquivo foi mapeado e falso caso contrário
+   *
+   * @note As páginas são lidas do disco sob demanda, sem a cópia para um buffer intermediário de
+   * std::ifstream. Um arquivo vazio é mapeado com data = nullptr e size = 0
+   */
+  bool map_file(const std::string &file_path, utils::MappedFile &file)
+  {
+    MRX_TRACE_SCOPE("map_file", TRACE_IO);
+
+    file = utils::MappedFile();
+
+#if defined(_WIN32)
+    HANDLE handle = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+    {
+      std::cerr << "Erro: Não foi possível abrir o arquivo '" << file_path << "'." << std::endl;
+      return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size))
+    {
+      std::cerr << "Erro: Não foi possível ler o tamanho do arquivo '" << file_path << "'." << std::endl;
+      CloseHandle(handle);
+      return false;
+    }
+
+    if (size.QuadPart == 0)
+    {
+      CloseHandle(handle);
+      return true;
+    }
+
+    // A visão mapeada continua válida depois que os handles são fechados
+    HANDLE mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void *data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+    if (mapping)
+      CloseHandle(mapping);
+    CloseHandle(handle);
+#else
+    int descriptor = open(file_path.c_str(), O_RDONLY);
+    if (descriptor < 0)
+    {
+      std::cerr << "Erro: Não foi possível abrir o arquivo '" << file_path << "'." << std::endl;
+      return false;
+    }
+
+    struct stat status;
+    if (fstat(descriptor, &status) != 0)
+    {
+      std::cerr << "Erro: Não foi possível ler o tamanho do arquivo '" << file_path << "'." << std::endl;
+      close(descriptor);
+      return false;
+    }
+
+    if (status.st_size == 0)
+    {
+      close(descriptor);
+      return true;
+    }
+
+    // O mapeamento continua válido depois que o descritor é fechado
+    void *data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+
+    if (data == MAP_FAILED)
+      data = nullptr;
+    else
+      madvise(data, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+#endif
+
+    if (data == nullptr)
+    {
+      std::cerr << "Erro: Não foi possível mapear o arquivo '" << file_path << "' na memória." << std::endl;
+      return false;
+    }
+
+    file.data = static_cast<const char *>(data);
+#if defined(_WIN32)
+    file.size = static_cast<size_t>(size.QuadPart);
+#else
+    file.size = static_cast<size_t>(status.st_size);
+#endif
+
+    return true;
+  }
+
+  /**
+   * @brief Desfaz o mapeamento de um arquivo (ver map_file)
+   *
+   * @param file Arquivo mapeado, volta a ficar vazio
+   */
+  void unmap_file(utils::MappedFile &file)
+  {
+    if (file.data != nullptr)
+    {
+#if defined(_WIN32)
+      UnmapViewOfFile(file.data);
+#else
+      munmap(const_cast<char *>(file.data), file.size);
+#endif
+    }
+
+    file = utils::MappedFile();
+  }
 }
\ No newline at end of file
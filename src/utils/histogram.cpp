@@ -0,0 +1,119 @@
+#include <utils/histogram.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace utils
+{
+  /**
+   * @brief Retorna o balde de um valor
+   *
+   * @param value Valor
+   * @return size_t Índice do balde (os valores fora do alcance ficam no primeiro ou no último)
+   */
+  static size_t HistogramBucket(double value)
+  {
+    double scaled = value / HISTOGRAM_MIN_VALUE;
+
+    // Também trata NaN
+    if (!(scaled >= 1.0))
+      return 0;
+
+    // scaled = mantissa * 2^exponent, com a mantissa em [0.5, 1)
+    int exponent;
+    double mantissa = std::frexp(scaled, &exponent);
+
+    size_t octave = static_cast<size_t>(exponent - 1);
+    size_t sub_bucket = static_cast<size_t>((mantissa * 2.0 - 1.0) * HISTOGRAM_SUB_BUCKETS);
+
+    return std::min(octave * HISTOGRAM_SUB_BUCKETS + sub_bucket, static_cast<size_t>(HISTOGRAM_OCTAVES * HISTOGRAM_SUB_BUCKETS - 1));
+  }
+
+  /**
+   * @brief Retorna o valor que representa um balde (ponto médio do intervalo do balde)
+   *
+   * @param bucket Índice do balde
+   * @return double Valor do balde
+   */
+  static double HistogramBucketValue(size_t bucket)
+  {
+    double base = std::ldexp(HISTOGRAM_MIN_VALUE, static_cast<int>(bucket / HISTOGRAM_SUB_BUCKETS));
+    double sub_bucket = static_cast<double>(bucket % HISTOGRAM_SUB_BUCKETS);
+
+    return base * (1.0 + (sub_bucket + 0.5) / HISTOGRAM_SUB_BUCKETS);
+  }
+
+  /**
+   * @brief Descarta todos os valores do histograma
+   *
+   * @param histogram Histograma
+   */
+  void HistogramReset(utils::Histogram &histogram)
+  {
+    histogram.counts.assign(HISTOGRAM_OCTAVES * HISTOGRAM_SUB_BUCKETS, 0);
+    histogram.total = 0;
+    histogram.min = 0.0;
+    histogram.max = 0.0;
+  }
+
+  /**
+   * @brief Adiciona um valor ao histograma
+   *
+   * @param histogram Histograma
+   * @param value Valor (ex.: tempo de um quadro em ms)
+   *
+   * @note O(1): apenas incrementa o balde do valor
+   */
+  void HistogramAdd(utils::Histogram &histogram, double value)
+  {
+    if (histogram.counts.empty())
+      HistogramReset(histogram);
+
+    histogram.counts[HistogramBucket(value)]++;
+
+    if (histogram.total == 0 || value < histogram.min)
+      histogram.min = value;
+    if (histogram.total == 0 || value > histogram.max)
+      histogram.max = value;
+
+    histogram.total++;
+  }
+
+  /**
+   * @brief Retorna um percentil dos valores adicionados
+   *
+   * @param histogram Histograma
+   * @param percentile Percentil, no intervalo [0, 100] (ex.: 99.9)
+   *
+   * @return double Valor do percentil (0 se o histograma estiver vazio)
+   *
+   * @note O resultado é o ponto médio do balde, limitado ao menor e ao maior valor adicionados,
+   * então o percentil 0 e o 100 são exatos
+   */
+  double HistogramPercentile(const utils::Histogram &histogram, double percentile)
+  {
+    if (histogram.total == 0)
+      return 0.0;
+
+    if (percentile <= 0.0)
+      return histogram.min;
+    if (percentile >= 100.0)
+      return histogram.max;
+
+    // Posição (a partir de 1) do valor procurado entre os valores ordenados
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(histogram.total)));
+    rank = std::max<uint64_t>(rank, 1);
+
+    uint64_t accumulated = 0;
+
+    for (size_t bucket = 0; bucket < histogram.counts.size(); bucket++)
+    {
+      accumulated += histogram.counts[bucket];
+
+      if (accumulated >= rank)
+        return std::clamp(HistogramBucketValue(bucket), histogram.min, histogram.max);
+    }
+
+    return histogram.max;
+  }
+} // namespace utils
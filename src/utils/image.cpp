@@ -0,0 +1,340 @@
+#include <utils/image.hpp>
+#include <utils/trace.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <cstdint>
+#include <algorithm>
+#include <cstdlib>
+
+namespace utils
+{
+  /**
+   * @brief Calcula o CRC-32 usado nos blocos (chunks) do PNG
+   *
+   * @param data Bytes
+   * @param size Quantidade de bytes
+   * @param crc Valor anterior, para calcular em partes
+   *
+   * @return std::uint32_t CRC-32 dos bytes
+   */
+  static std::uint32_t Crc32(const unsigned char *data, size_t size, std::uint32_t crc = 0)
+  {
+    static std::uint32_t table[256] = {};
+
+    if (table[1] == 0)
+    {
+      for (std::uint32_t i = 0; i < 256; i++)
+      {
+        std::uint32_t value = i;
+
+        for (int bit = 0; bit < 8; bit++)
+          value = (value & 1) ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+
+        table[i] = value;
+      }
+    }
+
+    crc = ~crc;
+
+    for (size_t i = 0; i < size; i++)
+      crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+    return ~crc;
+  }
+
+  /**
+   * @brief Adiciona um inteiro de 32 bits (big endian) a um vetor de bytes
+   *
+   * @param bytes Vetor de bytes
+   * @param value Valor
+   */
+  static void PushUint32(std::vector<unsigned char> &bytes, std::uint32_t value)
+  {
+    bytes.push_back(static_cast<unsigned char>(value >> 24));
+    bytes.push_back(static_cast<unsigned char>(value >> 16));
+    bytes.push_back(static_cast<unsigned char>(value >> 8));
+    bytes.push_back(static_cast<unsigned char>(value));
+  }
+
+  /**
+   * @brief Escreve um bloco (chunk) do PNG: tamanho, tipo, dados e CRC
+   *
+   * @param file Arquivo de saída
+   * @param type Tipo do bloco (4 caracteres)
+   * @param data Dados do bloco
+   */
+  static void WritePNGChunk(std::ofstream &file, const char *type, const std::vector<unsigned char> &data)
+  {
+    std::vector<unsigned char> header;
+    PushUint32(header, static_cast<std::uint32_t>(data.size()));
+    header.insert(header.end(), type, type + 4);
+
+    std::uint32_t crc = Crc32(header.data() + 4, 4);
+    crc = Crc32(data.data(), data.size(), crc);
+
+    std::vector<unsigned char> footer;
+    PushUint32(footer, crc);
+
+    file.write(reinterpret_cast<const char *>(header.data()), header.size());
+    file.write(reinterpret_cast<const char *>(data.data()), data.size());
+    file.write(reinterpret_cast<const char *>(footer.data()), footer.size());
+  }
+
+  /**
+   * @brief Escreve o buffer de cores em um arquivo PPM binário (P6)
+   *
+   * @param file_path Caminho do arquivo
+   * @param color_buffer Buffer de cores, indexado por [x][y]
+   *
+   * @return bool Verdadeiro se o arquivo foi escrito com sucesso e falso caso contrário
+   *
+   * @note O PPM não tem canal alfa, os pixels transparentes (fundo) ficam pretos
+   */
+  bool WritePPM(const std::string &file_path, const std::vector<std::vector<models::Color>> &color_buffer)
+  {
+    std::ofstream file(file_path, std::ios::binary);
+
+    if (!file.is_open())
+    {
+      std::cerr << "Erro: Não foi possível abrir o arquivo '" << file_path << "' para escrita." << std::endl;
+      return false;
+    }
+
+    size_t width = color_buffer.size();
+    size_t height = width > 0 ? color_buffer[0].size() : 0;
+
+    file << "P6\n"
+         << width << " " << height << "\n255\n";
+
+    std::vector<unsigned char> row(width * 3);
+
+    for (size_t y = 0; y < height; y++)
+    {
+      for (size_t x = 0; x < width; x++)
+      {
+        const models::Color &color = color_buffer[x][y];
+        row[x * 3 + 0] = color.r;
+        row[x * 3 + 1] = color.g;
+        row[x * 3 + 2] = color.b;
+      }
+
+      file.write(reinterpret_cast<const char *>(row.data()), row.size());
+    }
+
+    if (file.fail())
+    {
+      std::cerr << "Erro ao escrever no arquivo '" << file_path << "'." << std::endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief Escreve o buffer de cores em um arquivo PNG (RGBA de 8 bits)
+   *
+   * @param file_path Caminho do arquivo
+   * @param color_buffer Buffer de cores, indexado por [x][y]
+   *
+   * @return bool Verdadeiro se o arquivo foi escrito com sucesso e falso caso contrário
+   *
+   * @note Os dados da imagem usam blocos deflate sem compressão (no máximo 65535 bytes cada),
+   * o que dispensa uma biblioteca de compressão. O fundo transparente é mantido no canal alfa
+   */
+  bool WritePNG(const std::string &file_path, const std::vector<std::vector<models::Color>> &color_buffer)
+  {
+    std::ofstream file(file_path, std::ios::binary);
+
+    if (!file.is_open())
+    {
+      std::cerr << "Erro: Não foi possível abrir o arquivo '" << file_path << "' para escrita." << std::endl;
+      return false;
+    }
+
+    std::uint32_t width = static_cast<std::uint32_t>(color_buffer.size());
+    std::uint32_t height = width > 0 ? static_cast<std::uint32_t>(color_buffer[0].size()) : 0;
+
+    // Linhas da imagem, cada uma precedida pelo filtro (0 = nenhum)
+    std::vector<unsigned char> pixels;
+    pixels.reserve(static_cast<size_t>(height) * (width * 4 + 1));
+
+    for (std::uint32_t y = 0; y < height; y++)
+    {
+      pixels.push_back(0);
+
+      for (std::uint32_t x = 0; x < width; x++)
+      {
+        const models::Color &color = color_buffer[x][y];
+        pixels.insert(pixels.end(), {color.r, color.g, color.b, color.a});
+      }
+    }
+
+    // Fluxo zlib: cabeçalho, blocos deflate sem compressão e Adler-32
+    std::vector<unsigned char> data = {0x78, 0x01};
+
+    std::uint32_t a = 1, b = 0;
+    for (unsigned char byte : pixels)
+    {
+      a = (a + byte) % 65521;
+      b = (b + a) % 65521;
+    }
+
+    size_t offset = 0;
+    do
+    {
+      size_t size = std::min<size_t>(pixels.size() - offset, 65535);
+      bool last = offset + size == pixels.size();
+
+      data.push_back(last ? 1 : 0);
+      data.push_back(static_cast<unsigned char>(size & 0xFF));
+      data.push_back(static_cast<unsigned char>(size >> 8));
+      data.push_back(static_cast<unsigned char>(~size & 0xFF));
+      data.push_back(static_cast<unsigned char>((~size >> 8) & 0xFF));
+      data.insert(data.end(), pixels.begin() + offset, pixels.begin() + offset + size);
+
+      offset += size;
+    } while (offset < pixels.size());
+
+    PushUint32(data, (b << 16) | a);
+
+    std::vector<unsigned char> header;
+    PushUint32(header, width);
+    PushUint32(header, height);
+    header.insert(header.end(), {8, 6, 0, 0, 0}); // 8 bits, RGBA, deflate, filtro padrão, sem entrelaçamento
+
+    const unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    file.write(reinterpret_cast<const char *>(signature), sizeof(signature));
+
+    WritePNGChunk(file, "IHDR", header);
+    WritePNGChunk(file, "IDAT", data);
+    WritePNGChunk(file, "IEND", {});
+
+    if (file.fail())
+    {
+      std::cerr << "Erro ao escrever no arquivo '" << file_path << "'." << std::endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief Escreve o buffer de cores em um arquivo de imagem, com o formato escolhido pela extensão
+   *
+   * @param file_path Caminho do arquivo (.ppm ou .png)
+   * @param color_buffer Buffer de cores, indexado por [x][y]
+   *
+   * @return bool Verdadeiro se o arquivo foi escrito com sucesso e falso caso contrário
+   */
+  bool WriteImage(const std::string &file_path, const std::vector<std::vector<models::Color>> &color_buffer)
+  {
+    MRX_TRACE_SCOPE("write_image", TRACE_IO);
+
+    std::string extension = file_path.substr(std::min(file_path.size(), file_path.find_last_of('.')));
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c)
+                   { return static_cast<char>(std::tolower(c)); });
+
+    if (extension == ".ppm")
+      return WritePPM(file_path, color_buffer);
+    if (extension == ".png")
+      return WritePNG(file_path, color_buffer);
+
+    std::cerr << "Erro: Formato de imagem desconhecido em '" << file_path << "' (use .ppm ou .png)." << std::endl;
+    return false;
+  }
+
+  /**
+   * @brief Lê um arquivo PPM binário (P6) com 8 bits por canal, como os escritos por WritePPM
+   *
+   * @param file_path Caminho do arquivo
+   * @param color_buffer Buffer de cores lido, indexado por [x][y]
+   *
+   * @return bool Verdadeiro se o arquivo foi lido com sucesso e falso caso contrário
+   *
+   * @note Os pixels lidos são opacos (alfa 255)
+   */
+  bool ReadPPM(const std::string &file_path, std::vector<std::vector<models::Color>> &color_buffer)
+  {
+    MRX_TRACE_SCOPE("read_image", TRACE_IO);
+
+    std::ifstream file(file_path, std::ios::binary);
+
+    if (!file.is_open())
+    {
+      std::cerr << "Erro: Não foi possível abrir o arquivo '" << file_path << "'." << std::endl;
+      return false;
+    }
+
+    std::string magic;
+    int width = 0, height = 0, max_value = 0;
+
+    file >> magic >> width >> height >> max_value;
+    file.get(); // Espaço em branco único depois do cabeçalho
+
+    if (!file || magic != "P6" || width <= 0 || height <= 0 || max_value != 255)
+    {
+      std::cerr << "Erro: O arquivo '" << file_path << "' não é um PPM binário (P6) de 8 bits." << std::endl;
+      return false;
+    }
+
+    color_buffer.assign(width, std::vector<models::Color>(height));
+    std::vector<unsigned char> row(static_cast<size_t>(width) * 3);
+
+    for (int y = 0; y < height; y++)
+    {
+      if (!file.read(reinterpret_cast<char *>(row.data()), row.size()))
+      {
+        std::cerr << "Erro: O arquivo '" << file_path << "' está incompleto." << std::endl;
+        return false;
+      }
+
+      for (int x = 0; x < width; x++)
+        color_buffer[x][y] = {row[x * 3 + 0], row[x * 3 + 1], row[x * 3 + 2], 255};
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief Compara uma imagem com a imagem de referência
+   *
+   * @param image Imagem, indexada por [x][y]
+   * @param reference Imagem de referência, indexada por [x][y]
+   * @param tolerance Maior diferença de um canal para que o pixel ainda seja considerado igual
+   *
+   * @return utils::ImageDifference Maior erro de um canal e quantidade de pixels acima da tolerância
+   *
+   * @note Apenas os canais RGB são comparados, já que o PPM não guarda o canal alfa
+   */
+  utils::ImageDifference CompareImages(const std::vector<std::vector<models::Color>> &image, const std::vector<std::vector<models::Color>> &reference, int tolerance)
+  {
+    utils::ImageDifference difference;
+
+    size_t width = image.size();
+    size_t height = width > 0 ? image[0].size() : 0;
+
+    if (reference.size() != width || (width > 0 && reference[0].size() != height))
+    {
+      difference.same_size = false;
+      return difference;
+    }
+
+    for (size_t x = 0; x < width; x++)
+      for (size_t y = 0; y < height; y++)
+      {
+        const models::Color &a = image[x][y];
+        const models::Color &b = reference[x][y];
+
+        int error = std::max({std::abs(a.r - b.r), std::abs(a.g - b.g), std::abs(a.b - b.b)});
+
+        difference.max_error = std::max(difference.max_error, error);
+        difference.mismatched += error > tolerance;
+      }
+
+    if (width * height > 0)
+      difference.mismatch_percent = 100.0 * static_cast<double>(difference.mismatched) / static_cast<double>(width * height);
+
+    return difference;
+  }
+} // namespace utils
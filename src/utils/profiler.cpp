@@ -0,0 +1,167 @@
+#include <utils/profiler.hpp>
+#include <utils/trace.hpp>
+
+#include <atomic>
+
+namespace utils
+{
+  // Acumuladores globais, compartilhados por todas as threads
+  static std::atomic<uint64_t> stage_times[PROFILE_STAGES];
+  static std::atomic<uint64_t> stage_calls[PROFILE_STAGES];
+  static std::atomic<uint64_t> counters[PROFILE_COUNTERS];
+
+  //------------------------------------------------------------------------------------------------
+  // Constructors and Destructors
+  //------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Construtor da classe ProfileScope, inicia o cronômetro
+   *
+   * @param stage Estágio (PROFILE_TRANSFORM, PROFILE_CULL, ...) que recebe o tempo medido
+   */
+  ProfileScope::ProfileScope(int stage) : stage(stage), start(std::chrono::steady_clock::now())
+  {
+  }
+
+  /**
+   * @brief Destrutor da classe ProfileScope, soma ao estágio o tempo decorrido
+   *
+   * @note Com a gravação da linha do tempo ligada, o escopo também vira um evento (ver utils/trace.hpp)
+   */
+  ProfileScope::~ProfileScope()
+  {
+    auto end = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - this->start);
+    ProfilerAddTime(this->stage, static_cast<uint64_t>(elapsed.count()));
+
+    if (TraceEnabled())
+      TraceRecord(ProfileStageName(this->stage), TRACE_PIPELINE, this->start, end);
+  }
+
+  //------------------------------------------------------------------------------------------------
+  // Functions
+  //------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Soma um tempo ao estágio
+   *
+   * @param stage Estágio que recebe o tempo
+   * @param nanoseconds Tempo medido (ns)
+   * @param calls Quantidade de medições (ou de itens) representadas pelo tempo
+   */
+  void ProfilerAddTime(int stage, uint64_t nanoseconds, uint64_t calls)
+  {
+    if (stage < 0 || stage >= PROFILE_STAGES)
+      return;
+
+    stage_times[stage].fetch_add(nanoseconds, std::memory_order_relaxed);
+    stage_calls[stage].fetch_add(calls, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Soma um valor ao contador
+   *
+   * @param counter Contador (PROFILE_FACES_SUBMITTED, PROFILE_PIXELS_SHADED, ...)
+   * @param amount Valor somado
+   */
+  void ProfilerAddCount(int counter, uint64_t amount)
+  {
+    if (counter < 0 || counter >= PROFILE_COUNTERS)
+      return;
+
+    counters[counter].fetch_add(amount, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Retorna os tempos e contadores acumulados desde a última coleta e os zera
+   *
+   * @return utils::ProfileFrame Tempos e contadores do período
+   *
+   * @note Deve ser chamada uma vez por quadro. Com o pipeline em paralelo, a rasterização que
+   * termina durante a coleta entra no quadro seguinte
+   */
+  utils::ProfileFrame ProfilerCollect()
+  {
+    utils::ProfileFrame result;
+
+    for (int i = 0; i < PROFILE_STAGES; i++)
+    {
+      result.time[i] = stage_times[i].exchange(0, std::memory_order_relaxed);
+      result.calls[i] = stage_calls[i].exchange(0, std::memory_order_relaxed);
+    }
+
+    for (int i = 0; i < PROFILE_COUNTERS; i++)
+      result.counters[i] = counters[i].exchange(0, std::memory_order_relaxed);
+
+    return result;
+  }
+
+  /**
+   * @brief Retorna o tempo de um estágio em milissegundos
+   *
+   * @param frame Tempos e contadores de um quadro
+   * @param stage Estágio
+   * @return float Tempo (ms)
+   */
+  float ProfileStageMilliseconds(const utils::ProfileFrame &frame, int stage)
+  {
+    if (stage < 0 || stage >= PROFILE_STAGES)
+      return 0.0f;
+
+    return static_cast<float>(static_cast<double>(frame.time[stage]) / 1.0e6);
+  }
+
+  /**
+   * @brief Retorna o nome de um estágio, usado nos relatórios e na interface
+   *
+   * @param stage Estágio
+   * @return const char* Nome do estágio
+   */
+  const char *ProfileStageName(int stage)
+  {
+    switch (stage)
+    {
+    case PROFILE_TRANSFORM:
+      return "transform";
+    case PROFILE_CULL:
+      return "cull";
+    case PROFILE_CLIP:
+      return "clip";
+    case PROFILE_LIGHTING:
+      return "lighting";
+    case PROFILE_RASTER:
+      return "raster";
+    case PROFILE_DEPTH_TEST:
+      return "depth_test";
+    case PROFILE_PRESENT:
+      return "present";
+    default:
+      return "unknown";
+    }
+  }
+
+  /**
+   * @brief Retorna o nome de um contador, usado nos relatórios e na interface
+   *
+   * @param counter Contador
+   * @return const char* Nome do contador
+   */
+  const char *ProfileCounterName(int counter)
+  {
+    switch (counter)
+    {
+    case PROFILE_FACES_SUBMITTED:
+      return "faces_submitted";
+    case PROFILE_FACES_CULLED:
+      return "faces_culled";
+    case PROFILE_FACES_CLIPPED:
+      return "faces_clipped";
+    case PROFILE_PIXELS_SHADED:
+      return "pixels_shaded";
+    case PROFILE_PIXELS_REJECTED:
+      return "pixels_rejected";
+    default:
+      return "unknown";
+    }
+  }
+} // namespace utils
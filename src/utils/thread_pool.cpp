@@ -0,0 +1,230 @@
+#include <utils/thread_pool.hpp>
+#include <utils/trace.hpp>
+
+#include <algorithm>
+
+namespace utils
+{
+  //------------------------------------------------------------------------------------------------
+  // Constructors and Destructors
+  //------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Construtor da classe ThreadPool
+   *
+   * @param num_threads Quantidade total de threads (0 = quantidade de núcleos da máquina)
+   */
+  ThreadPool::ThreadPool(unsigned int num_threads)
+  {
+    this->setNumThreads(num_threads);
+  }
+
+  /**
+   * @brief Destrutor da classe ThreadPool
+   *
+   * @note As threads são encerradas através do stop_token dos std::jthread
+   */
+  ThreadPool::~ThreadPool()
+  {
+    this->stop();
+  }
+
+  //------------------------------------------------------------------------------------------------
+  // Getters and Setters
+  //------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Retorna a quantidade total de threads usadas pelo conjunto
+   *
+   * @return unsigned int Quantidade de threads (inclui a thread que chama parallel_for)
+   */
+  unsigned int ThreadPool::getNumThreads() const
+  {
+    return this->num_threads;
+  }
+
+  /**
+   * @brief Define a quantidade total de threads do conjunto
+   *
+   * @param num_threads Quantidade total de threads (0 = quantidade de núcleos da máquina)
+   *
+   * @note As threads anteriores são encerradas e novas threads são criadas
+   */
+  void ThreadPool::setNumThreads(unsigned int num_threads)
+  {
+    std::lock_guard<std::mutex> submit_lock(this->submit_mutex);
+
+    if (num_threads == 0)
+      num_threads = ThreadPool::hardware_threads();
+
+    if (num_threads == this->num_threads && this->workers.size() == num_threads - 1)
+      return;
+
+    this->stop();
+
+    this->num_threads = num_threads;
+
+    for (unsigned int i = 1; i < num_threads; i++)
+      this->workers.emplace_back([this](std::stop_token stop_token)
+                                 { this->worker_loop(stop_token); });
+  }
+
+  //------------------------------------------------------------------------------------------------
+  // Functions
+  //------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Executa uma função em paralelo sobre o intervalo [0, count)
+   *
+   * @param count Quantidade de itens a serem processados
+   * @param chunk_size Quantidade de itens de cada bloco
+   * @param function Função que processa o intervalo [begin, end)
+   *
+   * @note A divisão em blocos é fixa e não depende da quantidade de threads, então desde que cada
+   * bloco escreva apenas nos seus próprios itens o resultado é determinístico
+   * @note A função só retorna quando todos os blocos foram processados
+   */
+  void ThreadPool::parallel_for(size_t count, size_t chunk_size, const std::function<void(size_t, size_t)> &function)
+  {
+    if (count == 0)
+      return;
+
+    if (chunk_size == 0)
+      chunk_size = 1;
+
+    size_t num_chunks = (count + chunk_size - 1) / chunk_size;
+
+    // Não compensa acordar as threads para um único bloco
+    if (this->workers.empty() || num_chunks == 1)
+    {
+      for (size_t begin = 0; begin < count; begin += chunk_size)
+        function(begin, std::min(begin + chunk_size, count));
+      return;
+    }
+
+    std::lock_guard<std::mutex> submit_lock(this->submit_mutex);
+
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->task = &function;
+      this->task_count = count;
+      this->task_chunk_size = chunk_size;
+      this->task_num_chunks = num_chunks;
+      this->finished_chunks = 0;
+      this->next_chunk.store(0);
+      this->generation++;
+    }
+    this->work_available.notify_all();
+
+    // A thread chamadora também processa blocos
+    size_t processed = this->run_chunks();
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->finished_chunks += processed;
+    // Aguarda também as threads que ainda estão dentro de run_chunks, assim nenhuma delas
+    // acessa a tarefa depois que parallel_for retorna
+    this->work_done.wait(lock, [this]
+                         { return this->finished_chunks == this->task_num_chunks && this->active_workers == 0; });
+    this->task = nullptr;
+  }
+
+  /**
+   * @brief Retorna a quantidade de threads de hardware disponíveis
+   *
+   * @return unsigned int Quantidade de threads de hardware (no mínimo 1)
+   */
+  unsigned int ThreadPool::hardware_threads()
+  {
+    unsigned int result = std::thread::hardware_concurrency();
+
+    if (result == 0)
+      result = 1;
+
+    return result;
+  }
+
+  /**
+   * @brief Processa blocos da tarefa corrente até que não existam mais blocos disponíveis
+   *
+   * @return size_t Quantidade de blocos processados pela thread
+   */
+  size_t ThreadPool::run_chunks()
+  {
+    size_t result = 0;
+
+    while (true)
+    {
+      size_t chunk = this->next_chunk.fetch_add(1);
+
+      if (chunk >= this->task_num_chunks)
+        break;
+
+      size_t begin = chunk * this->task_chunk_size;
+      size_t end = std::min(begin + this->task_chunk_size, this->task_count);
+
+      MRX_TRACE_SCOPE("chunk", TRACE_WORKER);
+      (*this->task)(begin, end);
+      result++;
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Laço principal das threads trabalhadoras
+   *
+   * @param stop_token Token de parada do std::jthread
+   */
+  void ThreadPool::worker_loop(std::stop_token stop_token)
+  {
+    size_t last_generation = 0;
+
+    utils::TraceThreadName("worker");
+
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      last_generation = this->generation;
+    }
+
+    while (true)
+    {
+      {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        if (!this->work_available.wait(lock, stop_token, [this, last_generation]
+                                       { return this->generation != last_generation; }))
+          return;
+
+        last_generation = this->generation;
+
+        // A tarefa já foi concluída pelas demais threads
+        if (this->task == nullptr)
+          continue;
+
+        this->active_workers++;
+      }
+
+      size_t processed = this->run_chunks();
+
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->finished_chunks += processed;
+        this->active_workers--;
+      }
+      this->work_done.notify_all();
+    }
+  }
+
+  /**
+   * @brief Encerra e aguarda todas as threads trabalhadoras
+   */
+  void ThreadPool::stop()
+  {
+    for (auto &worker : this->workers)
+      worker.request_stop();
+
+    this->work_available.notify_all();
+
+    // O destrutor do std::jthread aguarda (join) a thread
+    this->workers.clear();
+  }
+} // namespace utils
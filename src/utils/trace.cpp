@@ -0,0 +1,274 @@
+#include <utils/trace.hpp>
+
+#include <atomic>
+#include <algorithm>
+#include <mutex>
+#include <fstream>
+#include <iostream>
+
+namespace utils
+{
+  // Buffer circular e estado da gravação, compartilhados por todas as threads
+  static std::mutex trace_mutex;
+  static std::atomic<bool> trace_enabled = false;
+  static std::vector<utils::TraceEvent> trace_ring;
+  static uint64_t trace_recorded = 0;
+  static std::chrono::steady_clock::time_point trace_epoch;
+  // Nome de cada thread, indexado pelo identificador sequencial
+  static std::vector<const char *> trace_threads;
+  // Identificadores liberados por threads encerradas, reaproveitados pelas próximas
+  static std::vector<uint32_t> trace_free_threads;
+
+  /**
+   * @brief Identificador sequencial de uma thread, devolvido quando a thread termina
+   *
+   * @note A rasterização em paralelo cria uma thread por quadro (std::async), então sem a
+   * devolução a tabela de threads cresceria durante a gravação
+   */
+  struct TraceThread
+  {
+    int id = -1;
+
+    ~TraceThread()
+    {
+      if (this->id < 0)
+        return;
+
+      std::lock_guard<std::mutex> lock(trace_mutex);
+      trace_free_threads.push_back(static_cast<uint32_t>(this->id));
+    }
+  };
+
+  static thread_local TraceThread trace_thread;
+
+  /**
+   * @brief Retorna o identificador sequencial da thread atual, registrando-a na primeira chamada
+   *
+   * @return uint32_t Identificador da thread
+   *
+   * @note Deve ser chamada com trace_mutex travado
+   */
+  static uint32_t TraceThreadId()
+  {
+    if (trace_thread.id < 0)
+    {
+      if (!trace_free_threads.empty())
+      {
+        trace_thread.id = static_cast<int>(trace_free_threads.back());
+        trace_free_threads.pop_back();
+        trace_threads[trace_thread.id] = nullptr;
+      }
+      else
+      {
+        trace_thread.id = static_cast<int>(trace_threads.size());
+        trace_threads.push_back(nullptr);
+      }
+    }
+
+    return static_cast<uint32_t>(trace_thread.id);
+  }
+
+  //------------------------------------------------------------------------------------------------
+  // Constructors and Destructors
+  //------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Construtor da classe TraceScope, inicia o cronômetro se a gravação estiver ligada
+   *
+   * @param name Nome do evento (texto estático)
+   * @param category Categoria do evento (TRACE_PIPELINE, TRACE_WORKER, ...)
+   */
+  TraceScope::TraceScope(const char *name, const char *category) : name(name), category(category), active(TraceEnabled())
+  {
+    if (this->active)
+      this->start = std::chrono::steady_clock::now();
+  }
+
+  /**
+   * @brief Destrutor da classe TraceScope, grava o evento
+   */
+  TraceScope::~TraceScope()
+  {
+    if (this->active)
+      TraceRecord(this->name, this->category, this->start, std::chrono::steady_clock::now());
+  }
+
+  //------------------------------------------------------------------------------------------------
+  // Functions
+  //------------------------------------------------------------------------------------------------
+
+  /**
+   * @brief Liga a gravação, descartando os eventos anteriores
+   *
+   * @param capacity Quantidade máxima de eventos guardados (os mais antigos são sobrescritos)
+   */
+  void TraceStart(size_t capacity)
+  {
+    std::lock_guard<std::mutex> lock(trace_mutex);
+
+    trace_ring.assign(std::max<size_t>(capacity, 1), utils::TraceEvent());
+    trace_recorded = 0;
+    trace_epoch = std::chrono::steady_clock::now();
+    trace_enabled.store(true, std::memory_order_release);
+  }
+
+  /**
+   * @brief Desliga a gravação, mantendo os eventos para TraceWrite
+   */
+  void TraceStop()
+  {
+    trace_enabled.store(false, std::memory_order_release);
+  }
+
+  /**
+   * @brief Retorna se a gravação está ligada
+   *
+   * @return bool Verdadeiro se os eventos estão sendo gravados
+   */
+  bool TraceEnabled()
+  {
+    return trace_enabled.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Define o nome da thread atual exibido no visualizador
+   *
+   * @param name Nome da thread (texto estático)
+   */
+  void TraceThreadName(const char *name)
+  {
+    std::lock_guard<std::mutex> lock(trace_mutex);
+
+    trace_threads[TraceThreadId()] = name;
+  }
+
+  /**
+   * @brief Grava um evento no buffer circular
+   *
+   * @param name Nome do evento (texto estático)
+   * @param category Categoria do evento
+   * @param start Início do evento
+   * @param end Fim do evento
+   *
+   * @note Não faz nada se a gravação estiver desligada
+   */
+  void TraceRecord(const char *name, const char *category, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+  {
+    if (!TraceEnabled())
+      return;
+
+    std::lock_guard<std::mutex> lock(trace_mutex);
+
+    // Eventos iniciados antes da gravação começam no instante zero
+    if (start < trace_epoch)
+      start = trace_epoch;
+    if (end < start)
+      end = start;
+
+    utils::TraceEvent &event = trace_ring[trace_recorded % trace_ring.size()];
+
+    event.name = name;
+    event.category = category;
+    event.start = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(start - trace_epoch).count());
+    event.duration = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    event.thread = TraceThreadId();
+
+    trace_recorded++;
+  }
+
+  /**
+   * @brief Retorna os eventos guardados, do mais antigo para o mais recente
+   *
+   * @return std::vector<utils::TraceEvent> Eventos guardados no buffer circular
+   */
+  std::vector<utils::TraceEvent> TraceEvents()
+  {
+    std::lock_guard<std::mutex> lock(trace_mutex);
+
+    std::vector<utils::TraceEvent> result;
+
+    if (trace_ring.empty())
+      return result;
+
+    uint64_t count = std::min<uint64_t>(trace_recorded, trace_ring.size());
+    uint64_t first = trace_recorded - count;
+
+    for (uint64_t i = first; i < trace_recorded; i++)
+      result.push_back(trace_ring[i % trace_ring.size()]);
+
+    return result;
+  }
+
+  /**
+   * @brief Retorna quantos eventos foram sobrescritos porque o buffer circular encheu
+   *
+   * @return uint64_t Quantidade de eventos descartados
+   */
+  uint64_t TraceDropped()
+  {
+    std::lock_guard<std::mutex> lock(trace_mutex);
+
+    return trace_recorded > trace_ring.size() ? trace_recorded - trace_ring.size() : 0;
+  }
+
+  /**
+   * @brief Converte os eventos guardados para o formato de eventos do Chrome
+   *
+   * @return nlohmann::json Objeto com "traceEvents" (eventos "X" em microssegundos e os nomes das
+   * threads) e a quantidade de eventos descartados em "otherData"
+   */
+  nlohmann::json TraceToJson()
+  {
+    std::vector<utils::TraceEvent> events = TraceEvents();
+    nlohmann::json trace_events = nlohmann::json::array();
+
+    {
+      std::lock_guard<std::mutex> lock(trace_mutex);
+
+      for (size_t i = 0; i < trace_threads.size(); i++)
+      {
+        std::string name = trace_threads[i] != nullptr ? trace_threads[i] : "thread " + std::to_string(i);
+        trace_events.push_back({{"name", "thread_name"}, {"ph", "M"}, {"pid", 1}, {"tid", i}, {"args", {{"name", name}}}});
+      }
+    }
+
+    for (const auto &event : events)
+      trace_events.push_back({{"name", event.name},
+                              {"cat", event.category},
+                              {"ph", "X"},
+                              {"ts", static_cast<double>(event.start) / 1.0e3},
+                              {"dur", static_cast<double>(event.duration) / 1.0e3},
+                              {"pid", 1},
+                              {"tid", event.thread}});
+
+    return {{"traceEvents", trace_events}, {"displayTimeUnit", "ms"}, {"otherData", {{"dropped_events", TraceDropped()}}}};
+  }
+
+  /**
+   * @brief Escreve os eventos guardados em um arquivo JSON do Chrome (chrome://tracing, Perfetto)
+   *
+   * @param file_path Caminho do arquivo
+   *
+   * @return bool Verdadeiro se o arquivo foi escrito com sucesso e falso caso contrário
+   */
+  bool TraceWrite(const std::string &file_path)
+  {
+    std::ofstream file(file_path);
+
+    if (!file.is_open())
+    {
+      std::cerr << "Erro: Não foi possível abrir o arquivo '" << file_path << "' para escrita." << std::endl;
+      return false;
+    }
+
+    file << TraceToJson().dump() << std::endl;
+
+    if (file.fail())
+    {
+      std::cerr << "Erro ao escrever no arquivo '" << file_path << "'." << std::endl;
+      return false;
+    }
+
+    return true;
+  }
+} // namespace utils
@@ -12,13 +12,13 @@ namespace utils
    * @param color Cor do pixel
    * @param z_buffer Buffer de profundidade
    * @param color_buffer Buffer de cores
-   * @param window_size Tamanho da janela
+   * @param scissor Retângulo de recorte (min x, min y, max x, max y), os pixels fora dele são ignorados
    *
    * @note Esta função é um wrapper para a função z_buffer
    */
-  void setPixel(const float x, const float y, const float z, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer)
+  void setPixel(const float x, const float y, const float z, const models::ColorFloat &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor)
   {
-    math::z_buffer(x, y, z, color, z_buffer, color_buffer);
+    math::z_buffer(x, y, z, color, z_buffer, color_buffer, scissor);
   }
 
   /**
@@ -61,16 +61,17 @@ namespace utils
    *
    * @todo Ajustar o calculo do z_buffer para esta função
    */
-  void DrawVertexBuffer(const core::Vector3 point, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer, const int size = 3)
+  void DrawVertexBuffer(const core::Vector3 point, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const int size = 3)
   {
     int x = static_cast<int>(point.x);
     int y = static_cast<int>(point.y);
+    models::ColorFloat value = models::ColorToFloat(color);
 
     for (float i = -2; i < size; i++)
     {
       for (float j = -2; j < size; j++)
       {
-        setPixel(x + i, y + j, point.z, color, z_buffer, color_buffer);
+        setPixel(x + i, y + j, point.z, value, z_buffer, color_buffer);
       }
     }
   }
@@ -82,13 +83,14 @@ namespace utils
    * @param color Cor da linha
    * @param z_buffer Buffer de profundidade
    * @param color_buffer Buffer de cores
+   * @param scissor Retângulo de recorte (ver setPixel)
    *
    * @note O Algoritmo implementado é o do Bresenham adaptado para interpolação de Z também.
    */
-  void DrawLineBuffer(const std::vector<core::Vector3> &vertexes, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer)
+  void DrawLineBuffer(const std::vector<core::Vector3> &vertexes, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor)
   {
-    ImDrawList *draw_list = ImGui::GetForegroundDrawList();
     int vertex_length = vertexes.size();
+    models::ColorFloat value = models::ColorToFloat(color);
     for (size_t i = 0; i < vertex_length - 1; i = i + 2)
     {
       // Se o vértice for válido
@@ -98,7 +100,7 @@ namespace utils
 
         for (auto vertex : line)
         {
-          setPixel(vertex.x, vertex.y, vertex.z, color, z_buffer, color_buffer);
+          setPixel(vertex.x, vertex.y, vertex.z, value, z_buffer, color_buffer, scissor);
         }
       }
     }
@@ -108,20 +110,17 @@ namespace utils
    * @brief Desenha uma face no buffer
    *
    * @param vertexes Vetor de vértices que compõem a face
-   * @param eye Posição do observador
-   * @param face_centroid Centroide da face
-   * @param face_normal Vetor normal da face
-   * @param object_material Material do objeto
-   * @param global_light Luz global
-   * @param omni_lights Vetor de luzes omni
+   * @param color Cor da face (ver models::FlatShading)
    * @param z_buffer Buffer de profundidade
    * @param color_buffer Buffer de cores
+   * @param scissor Retângulo de recorte (ver setPixel)
+   * @param depth_complexity Contagem dos testes de profundidade por pixel, pode ser nulo
    *
    * @todo Arrumar bug de preenchimento
    */
-  void DrawFaceBufferFlatShading(const std::vector<core::Vector3> &vertexes, const core::Vector3 &eye, const core::Vector3 &face_centroid, const core::Vector3 &face_normal, const models::Material &object_material, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer)
+  void DrawFaceBufferFlatShading(const std::vector<core::Vector3> &vertexes, const models::ColorFloat &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity)
   {
-    math::fill_polygon_flat_shading(vertexes, global_light, omni_lights, eye, face_centroid, face_normal, object_material, z_buffer, color_buffer, {static_cast<float>(color_buffer.size()), static_cast<float>(color_buffer[0].size())});
+    math::fill_polygon_flat_shading(vertexes, color, z_buffer, color_buffer, {static_cast<float>(color_buffer.size()), static_cast<float>(color_buffer[0].size())}, scissor, depth_complexity);
   }
 
   /**
@@ -135,31 +134,42 @@ namespace utils
    * @param omni_lights Vetor de luzes omni
    * @param z_buffer Buffer de profundidade
    * @param color_buffer Buffer de cores
+   * @param scissor Retângulo de recorte (ver setPixel)
+   * @param depth_complexity Contagem dos testes de profundidade por pixel, pode ser nulo
    *
    */
-  void DrawFaceBufferGouraudShading(const std::vector<std::pair<core::Vector3, models::Color>> &vertexes, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer)
+  void DrawFaceBufferGouraudShading(const std::vector<std::pair<core::Vector3, models::ColorFloat>> &vertexes, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity)
   {
 
-    math::fill_polygon_gourand(vertexes, z_buffer, color_buffer);
+    math::fill_polygon_gourand(vertexes, z_buffer, color_buffer, scissor, depth_complexity);
   }
 
   /**
    * @brief Desenha uma face no buffer utilizando Phong Shading
    *
+   * @tparam Precision Política de precisão da iluminação (math::Exact ou math::Fast)
    * @param vertexes Vetor de vértices e normais dos vertices que compõem a face
+   * @param positions Posição (SRU) de cada vértice da face (vazio = centroide)
    * @param centroid Centroide da face
    * @param eye Posição do observador
    * @param object_material Material do objeto
    * @param global_light Luz global
    * @param omni_lights Vetor de luzes omni
+   * @param light_tiles Listas de luzes omni por bloco da tela
    * @param z_buffer Buffer de profundidade
    * @param color_buffer Buffer de cores
+   * @param scissor Retângulo de recorte (ver setPixel)
+   * @param depth_complexity Contagem dos testes de profundidade por pixel, pode ser nulo
    */
-  void DrawFaceBufferPhongShading(const std::vector<std::pair<core::Vector3, core::Vector3>> &vertexes, const core::Vector3 &centroid, const core::Vector3 &eye, const models::Material &object_material, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer)
+  template <typename Precision>
+  void DrawFaceBufferPhongShading(const std::vector<std::pair<core::Vector3, core::Vector3>> &vertexes, const std::vector<core::Vector3> &positions, const core::Vector3 &centroid, const core::Vector3 &eye, const models::Material &object_material, const models::Light &global_light, const std::vector<models::Omni> &omni_lights, const models::LightTiles &light_tiles, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor, math::DepthComplexityBuffer *depth_complexity)
   {
-    math::fill_polygon_phong(vertexes, centroid, global_light, omni_lights, eye, object_material, z_buffer, color_buffer);
+    math::fill_polygon_phong<Precision>(vertexes, positions, centroid, global_light, omni_lights, light_tiles, eye, object_material, z_buffer, color_buffer, scissor, depth_complexity);
   }
 
+  template void DrawFaceBufferPhongShading<math::Exact>(const std::vector<std::pair<core::Vector3, core::Vector3>> &, const std::vector<core::Vector3> &, const core::Vector3 &, const core::Vector3 &, const models::Material &, const models::Light &, const std::vector<models::Omni> &, const models::LightTiles &, std::vector<std::vector<float>> &, std::vector<std::vector<models::ColorFloat>> &, const core::Vector4 &, math::DepthComplexityBuffer *);
+  template void DrawFaceBufferPhongShading<math::Fast>(const std::vector<std::pair<core::Vector3, core::Vector3>> &, const std::vector<core::Vector3> &, const core::Vector3 &, const core::Vector3 &, const models::Material &, const models::Light &, const std::vector<models::Omni> &, const models::LightTiles &, std::vector<std::vector<float>> &, std::vector<std::vector<models::ColorFloat>> &, const core::Vector4 &, math::DepthComplexityBuffer *);
+
   /**
    * @brief Desenha um texto na janela
    *
@@ -182,8 +192,9 @@ namespace utils
    * @param color Cor da caixa
    * @param z_buffer Buffer de profundidade
    * @param color_buffer Buffer de cores
+   * @param scissor Retângulo de recorte (ver setPixel)
    */
-  void DrawBoundingBox(const core::Vector2 &min_point, const core::Vector2 &max_point, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::Color>> &color_buffer)
+  void DrawBoundingBox(const core::Vector2 &min_point, const core::Vector2 &max_point, const models::Color &color, std::vector<std::vector<float>> &z_buffer, std::vector<std::vector<models::ColorFloat>> &color_buffer, const core::Vector4 &scissor)
   {
     // Vetor de vértices que compõem a caixa
     // Obs.: O valor de z é -99999 para que a caixa seja desenhada na frente de todos os objetos
@@ -202,7 +213,7 @@ namespace utils
         {max_point.x, max_point.y, -99999.f},
     };
 
-    DrawLineBuffer(vertexes, color, z_buffer, color_buffer);
+    DrawLineBuffer(vertexes, color, z_buffer, color_buffer, scissor);
   }
 
   /**
@@ -0,0 +1,44 @@
+#pragma once
+
+// Cenas e luzes usadas por vários arquivos de teste
+
+#include <models/scene.hpp>
+#include <models/light.hpp>
+#include <shapes/shapes.hpp>
+
+/**
+ * @brief Cria uma cena pequena com dois cubos
+ *
+ * @param max_viewport Canto inferior direito da tela (o superior esquerdo é (0, 0))
+ *
+ * @return models::Scene* Cena alocada com new
+ */
+inline models::Scene *small_scene(core::Vector2 max_viewport = {159, 119})
+{
+  return new models::Scene(
+      models::CreateCamera3D({20, 20, 40}, {0, 0, 0}, {0, 1, 0}, 30, 5, 100),
+      {shapes::cube({-3, 0, 0}), shapes::cube({3, 0, 0})},
+      {0, 0},
+      max_viewport,
+      {-3, -3},
+      {3, 3});
+}
+
+/**
+ * @brief Cria uma luz omni branca com raio de influência
+ *
+ * @param position Posição da luz
+ * @param radius Raio de influência (0 = alcance infinito)
+ *
+ * @return models::Omni Luz omni
+ */
+inline models::Omni omni_light(core::Vector3 position, float radius)
+{
+  models::Omni result;
+
+  result.position = position;
+  result.intensity = models::ColorToChannels(models::WHITE);
+  result.radius = radius;
+
+  return result;
+}
@@ -2,7 +2,11 @@
 #include <core/vector.hpp>
 #include <core/vertex.hpp>
 #include <math/math.hpp>
+#include <bit>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <random>
 
 class MathTest : public ::testing::Test
 {
@@ -144,3 +148,220 @@ TEST_F(MathTest, matrix_identity)
 //   EXPECT_EQ(actual_vector->getH(), expected_H);
 //   EXPECT_EQ(actual_vector->getHalfEdge(), expected_halfedge);
 // }
+
+/**
+ * @brief Cópias do código escalar das funções de include/math/math.hpp, usadas como referência do backend SIMD
+ */
+namespace scalar
+{
+  static core::Matrix multiply(const core::Matrix &a, const core::Matrix &b)
+  {
+    core::Matrix result;
+
+    for (int i = 0; i < 4; i++)
+      for (int j = 0; j < 4; j++)
+      {
+        // result.m(4i + j) = a.m(4i) * b.m(j) + a.m(4i + 1) * b.m(4 + j) + ...
+        float value = a(i, 0) * b(0, j);
+        value = value + a(i, 1) * b(1, j);
+        value = value + a(i, 2) * b(2, j);
+        result(i, j) = value + a(i, 3) * b(3, j);
+      }
+
+    return result;
+  }
+
+  static core::Vector4 multiply(const core::Matrix &mat, const core::Vector4 &vec)
+  {
+    return {mat.m0 * vec.x + mat.m1 * vec.y + mat.m2 * vec.z + mat.m3 * vec.w,
+            mat.m4 * vec.x + mat.m5 * vec.y + mat.m6 * vec.z + mat.m7 * vec.w,
+            mat.m8 * vec.x + mat.m9 * vec.y + mat.m10 * vec.z + mat.m11 * vec.w,
+            mat.m12 * vec.x + mat.m13 * vec.y + mat.m14 * vec.z + mat.m15 * vec.w};
+  }
+
+  static core::Matrix invert(const core::Matrix &mat)
+  {
+    float a00 = mat.m0, a01 = mat.m1, a02 = mat.m2, a03 = mat.m3;
+    float a10 = mat.m4, a11 = mat.m5, a12 = mat.m6, a13 = mat.m7;
+    float a20 = mat.m8, a21 = mat.m9, a22 = mat.m10, a23 = mat.m11;
+    float a30 = mat.m12, a31 = mat.m13, a32 = mat.m14, a33 = mat.m15;
+
+    float b00 = a00 * a11 - a01 * a10, b01 = a00 * a12 - a02 * a10, b02 = a00 * a13 - a03 * a10;
+    float b03 = a01 * a12 - a02 * a11, b04 = a01 * a13 - a03 * a11, b05 = a02 * a13 - a03 * a12;
+    float b06 = a20 * a31 - a21 * a30, b07 = a20 * a32 - a22 * a30, b08 = a20 * a33 - a23 * a30;
+    float b09 = a21 * a32 - a22 * a31, b10 = a21 * a33 - a23 * a31, b11 = a22 * a33 - a23 * a32;
+
+    float invDet = 1.0f / (b00 * b11 - b01 * b10 + b02 * b09 + b03 * b08 - b04 * b07 + b05 * b06);
+
+    core::Matrix result;
+    result.m0 = (a11 * b11 - a12 * b10 + a13 * b09) * invDet;
+    result.m1 = (-a01 * b11 + a02 * b10 - a03 * b09) * invDet;
+    result.m2 = (a31 * b05 - a32 * b04 + a33 * b03) * invDet;
+    result.m3 = (-a21 * b05 + a22 * b04 - a23 * b03) * invDet;
+    result.m4 = (-a10 * b11 + a12 * b08 - a13 * b07) * invDet;
+    result.m5 = (a00 * b11 - a02 * b08 + a03 * b07) * invDet;
+    result.m6 = (-a30 * b05 + a32 * b02 - a33 * b01) * invDet;
+    result.m7 = (a20 * b05 - a22 * b02 + a23 * b01) * invDet;
+    result.m8 = (a10 * b10 - a11 * b08 + a13 * b06) * invDet;
+    result.m9 = (-a00 * b10 + a01 * b08 - a03 * b06) * invDet;
+    result.m10 = (a30 * b04 - a31 * b02 + a33 * b00) * invDet;
+    result.m11 = (-a20 * b04 + a21 * b02 - a23 * b00) * invDet;
+    result.m12 = (-a10 * b09 + a11 * b07 - a12 * b06) * invDet;
+    result.m13 = (a00 * b09 - a01 * b07 + a02 * b06) * invDet;
+    result.m14 = (-a30 * b03 + a31 * b01 - a32 * b00) * invDet;
+    result.m15 = (a20 * b03 - a21 * b01 + a22 * b00) * invDet;
+
+    return result;
+  }
+
+  static float dot(const core::Vector3 &a, const core::Vector3 &b)
+  {
+    return (a.x * b.x) + (a.y * b.y) + (a.z * b.z);
+  }
+
+  static core::Vector3 cross(const core::Vector3 &a, const core::Vector3 &b)
+  {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+  }
+
+  static core::Vector3 normalize(const core::Vector3 &a)
+  {
+    float length = sqrtf((a.x * a.x) + (a.y * a.y) + (a.z * a.z));
+
+    if (length == 0.0f)
+      return {0.0f, 0.0f, 0.0f};
+
+    return {a.x / length, a.y / length, a.z / length};
+  }
+} // namespace scalar
+
+/**
+ * @brief Compara a representação binária de dois valores
+ */
+template <typename T>
+static bool same_bits(const T &a, const T &b)
+{
+  return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+/**
+ * @brief O backend SIMD (MRX_SIMD) dá exatamente os mesmos bits que o código escalar
+ */
+TEST_F(MathTest, simd_matches_scalar)
+{
+  std::cout << "Backend SIMD: " << math::SimdBackend() << std::endl;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+
+  auto random_matrix = [&]()
+  {
+    core::Matrix m;
+    for (int i = 0; i < 16; i++)
+      (&m.m0)[i] = distribution(generator);
+    return m;
+  };
+
+  auto random_vector = [&]() -> core::Vector3
+  { return {distribution(generator), distribution(generator), distribution(generator)}; };
+
+  for (int i = 0; i < 1000; i++)
+  {
+    core::Matrix a = random_matrix();
+    core::Matrix b = random_matrix();
+    core::Vector4 v = {distribution(generator), distribution(generator), distribution(generator), 1.0f};
+
+    ASSERT_TRUE(same_bits(math::MatrixMultiply(a, b), scalar::multiply(a, b))) << "MatrixMultiply, caso " << i;
+    ASSERT_TRUE(same_bits(math::MatrixMultiplyVector(a, v), scalar::multiply(a, v))) << "MatrixMultiplyVector, caso " << i;
+    ASSERT_TRUE(same_bits(math::MatrixInvert(a), scalar::invert(a))) << "MatrixInvert, caso " << i;
+
+    core::Vector3 x = random_vector();
+    core::Vector3 y = random_vector();
+
+    ASSERT_TRUE(same_bits(math::Vector3DotProduct(x, y), scalar::dot(x, y))) << "Vector3DotProduct, caso " << i;
+    ASSERT_TRUE(same_bits(math::Vector3CrossProduct(x, y), scalar::cross(x, y))) << "Vector3CrossProduct, caso " << i;
+    ASSERT_TRUE(same_bits(math::Vector3Normalize(x), scalar::normalize(x))) << "Vector3Normalize, caso " << i;
+  }
+
+  // Vetor nulo e matriz identidade
+  EXPECT_TRUE(same_bits(math::Vector3Normalize({0.0f, 0.0f, 0.0f}), core::Vector3{0.0f, 0.0f, 0.0f}));
+  EXPECT_TRUE(same_bits(math::MatrixInvert(identity), identity));
+  EXPECT_TRUE(same_bits(math::MatrixMultiply(identity, identity), identity));
+}
+
+/**
+ * @brief As aproximações da política Fast respeitam os erros máximos documentados, e a política
+ * Exact dá os mesmos bits que as funções de mrxmath
+ */
+TEST_F(MathTest, precision_policies)
+{
+  double inverse_sqrt = 0.0, log2 = 0.0, exp = 0.0, pow = 0.0, normalize = 0.0;
+
+  // Floats normais, de 2^-126 até perto do maior float
+  for (std::uint32_t bits = 0x00800000u; bits < 0x7f000000u; bits += 4099)
+  {
+    float x = std::bit_cast<float>(bits);
+
+    double expected = 1.0 / std::sqrt(static_cast<double>(x));
+    inverse_sqrt = std::max(inverse_sqrt, std::fabs(math::Fast::InverseSqrt(x) - expected) / expected);
+
+    expected = std::log2(static_cast<double>(x));
+    log2 = std::max(log2, std::fabs(math::Fast::Log2(x) - expected) / std::max(std::fabs(expected), 1.0));
+  }
+
+  for (float x = -87.0f; x < 88.0f; x += 0.01f)
+  {
+    double expected = std::exp(static_cast<double>(x));
+    exp = std::max(exp, std::fabs(math::Fast::Exp(x) - expected) / expected);
+
+    expected = std::exp2(static_cast<double>(x));
+    exp = std::max(exp, std::fabs(math::Fast::Exp2(x) - expected) / expected);
+  }
+
+  // Brilho especular: cosseno em [0, 1] e expoente até FAST_POW_MAX_EXPONENT
+  for (int i = 0; i <= 1000; i++)
+    for (float exponent = 0.0f; exponent <= FAST_POW_MAX_EXPONENT; exponent += 0.75f)
+    {
+      float base = static_cast<float>(i) / 1000.0f;
+      pow = std::max(pow, std::fabs(math::Fast::Pow(base, exponent) - std::pow(static_cast<double>(base), static_cast<double>(exponent))));
+    }
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+
+  for (int i = 0; i < 1000; i++)
+  {
+    core::Vector3 a = {distribution(generator), distribution(generator), distribution(generator)};
+    core::Vector3 b = {distribution(generator), distribution(generator), distribution(generator)};
+
+    double length = std::sqrt(static_cast<double>(a.x) * a.x + static_cast<double>(a.y) * a.y + static_cast<double>(a.z) * a.z);
+    core::Vector3 fast = math::Fast::Normalize(a);
+    normalize = std::max(normalize, std::fabs(std::sqrt(static_cast<double>(fast.x) * fast.x + static_cast<double>(fast.y) * fast.y + static_cast<double>(fast.z) * fast.z) - 1.0));
+
+    double dot = (static_cast<double>(a.x) * b.x + static_cast<double>(a.y) * b.y + static_cast<double>(a.z) * b.z) / length;
+    EXPECT_NEAR(math::Fast::NormalizeDot(b, a), dot, FAST_INVERSE_SQRT_ERROR * std::fabs(dot) + 1e-4) << "caso " << i;
+
+    ASSERT_TRUE(same_bits(math::Exact::Normalize(a), math::Vector3Normalize(a))) << "caso " << i;
+    ASSERT_TRUE(same_bits(math::Exact::NormalizeDot(b, a), math::Vector3DotProduct(b, math::Vector3Normalize(a)))) << "caso " << i;
+  }
+
+  std::cout << "Erros da política Fast: inverso da raiz " << inverse_sqrt << ", log2 " << log2 << ", exp " << exp << ", pow " << pow << ", normalização " << normalize << std::endl;
+
+  EXPECT_LE(inverse_sqrt, FAST_INVERSE_SQRT_ERROR);
+  EXPECT_LE(normalize, FAST_INVERSE_SQRT_ERROR);
+  EXPECT_LE(log2, FAST_LOG2_ERROR);
+  EXPECT_LE(exp, FAST_EXP_ERROR);
+  EXPECT_LE(pow, FAST_POW_ERROR);
+
+  // Casos especiais e avaliação em tempo de compilação
+  EXPECT_EQ(math::Fast::Pow(0.0f, 8.0f), 0.0f);
+  EXPECT_EQ(math::Fast::Pow(0.3f, 0.0f), 1.0f);
+  EXPECT_EQ(math::Fast::Exp2(-200.0f), 0.0f);
+  EXPECT_TRUE(same_bits(math::Fast::Normalize({0.0f, 0.0f, 0.0f}), core::Vector3{0.0f, 0.0f, 0.0f}));
+  EXPECT_EQ(math::Fast::NormalizeDot({1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}), 0.0f);
+
+  static_assert(math::Fast::Pow(1.0f, 32.0f) == 1.0f);
+  static_assert(math::Fast::Exp2(3.0f) == 8.0f);
+  constexpr float quarter = math::Fast::Pow(0.5f, 2.0f);
+  EXPECT_NEAR(quarter, 0.25f, FAST_POW_ERROR);
+}
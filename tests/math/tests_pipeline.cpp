@@ -160,4 +160,37 @@ TEST_F(PipelineTest, full_pipeline)
 
     j++;
   }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief As matrizes de uma câmera fixa podem ser montadas em tempo de compilação, com os mesmos
+ * valores (a menos do último bit da raiz quadrada) das montadas em tempo de execução
+ */
+TEST_F(PipelineTest, constexpr_camera)
+{
+  constexpr core::Vector3 fixed_vrp = {25.0f, 15.0f, 80.0f};
+  constexpr core::Vector3 fixed_p = {20.0f, 10.0f, 25.0f};
+
+  constexpr core::Matrix sru_to_src_matrix = math::pipeline_adair::sru_to_src(fixed_vrp, fixed_p);
+  constexpr core::Matrix projection_matrix = math::pipeline_adair::projection(fixed_vrp, fixed_p, 40.0f);
+  constexpr core::Matrix src_to_srt_matrix = math::pipeline_adair::src_to_srt({0.0f, 0.0f}, {0.0f, 0.0f}, {16.0f, 12.0f}, {319.0f, 239.0f}, true);
+  constexpr core::Matrix camera_matrix = math::MatrixMultiply(math::MatrixMultiply(src_to_srt_matrix, projection_matrix), sru_to_src_matrix);
+
+  static_assert(projection_matrix.m14 == -1.0f / 40.0f);
+  static_assert(math::Sqrt(16.0f) == 4.0f);
+
+  core::Matrix runtime_matrix = math::MatrixMultiply(src_to_srt_matrix, projection_matrix);
+  runtime_matrix = math::MatrixMultiply(runtime_matrix, math::pipeline_adair::sru_to_src(vrp, p));
+
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 4; j++)
+      EXPECT_FLOAT_EQ(camera_matrix(i, j), runtime_matrix(i, j));
+
+  // Pipeline de Smith
+  constexpr core::Matrix perspective_matrix = math::pipeline_smith::perspective_transformation(5.0f, 100.0f);
+  core::Matrix runtime_perspective = math::pipeline_smith::perspective_transformation(5.0f, 100.0f);
+
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 4; j++)
+      EXPECT_EQ(perspective_matrix(i, j), runtime_perspective(i, j));
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <models/batch.hpp>
+#include <shapes/shapes.hpp>
+#include <utils/file.hpp>
+
+#include <filesystem>
+
+#include "../fixtures.hpp"
+
+/**
+ * @brief Cada configuração com uma lista de valores gera um trabalho por combinação, herdando os
+ * campos de "defaults"
+ */
+TEST(BatchTest, load_render_jobs)
+{
+  json manifest = {
+      {"defaults", {{"width", 64}, {"height", 48}}},
+      {"jobs", {{{"scene", {"a.json", "b.json"}}, {"output", "out/{scene}_{pipeline}_{lighting}.png"}, {"pipeline", {"adair", "smith"}}, {"lighting", {"flat", "phong"}}},
+                {{"scene", "c.json"}, {"output", "c.ppm"}, {"height", 32}, {"camera", {{{"position", {{"x", 0}, {"y", 0}, {"z", 10}}}}, {{"d", 40}}}}, {"frames", 3}}}}};
+
+  std::vector<models::RenderJob> jobs;
+  ASSERT_TRUE(models::LoadRenderJobs(manifest, "base", jobs));
+  ASSERT_EQ(jobs.size(), 2u * 2u * 2u + 1u);
+
+  EXPECT_EQ(jobs[0].width, 64);
+  EXPECT_EQ(jobs[0].pipeline_model, SANTA_CATARINA_PIPELINE);
+  EXPECT_EQ(jobs[0].normal_algorithm, -1);
+  EXPECT_EQ(models::RenderJobOutput(jobs[7], 0), (std::filesystem::path("base") / "out/b_smith_phong.png").string());
+
+  // Vários quadros sem {frame}: o número é adicionado antes da extensão
+  const models::RenderJob &path = jobs.back();
+  EXPECT_EQ(path.height, 32);
+  EXPECT_EQ(path.frames, 3);
+  EXPECT_EQ(models::RenderJobOutput(path, 2), (std::filesystem::path("base") / "c_0002.ppm").string());
+
+  // Dois trabalhos escrevendo na mesma imagem
+  json repeated = {{"jobs", {{{"scene", "a.json"}, {"output", "a.png"}, {"lighting", {"flat", "phong"}}}}}};
+  EXPECT_FALSE(models::LoadRenderJobs(repeated, "", jobs));
+
+  json invalid = {{"jobs", {{{"scene", "a.json"}, {"output", "a.png"}, {"pipeline", "foley"}}}}};
+  EXPECT_FALSE(models::LoadRenderJobs(invalid, "", jobs));
+}
+
+/**
+ * @brief A câmera é interpolada linearmente entre quadros-chave igualmente espaçados
+ */
+TEST(BatchTest, interpolate_camera_keyframes)
+{
+  std::vector<models::CameraKeyframe> keyframes = {
+      {{0, 0, 10}, {0, 0, 0}, {0, 1, 0}, 20},
+      {{10, 0, 0}, {0, 0, 0}, {0, 1, 0}, 40},
+      {{0, 10, 0}, {0, 2, 0}, {0, 1, 0}, 40}};
+
+  models::CameraKeyframe start = models::InterpolateCameraKeyframes(keyframes, 0.0f);
+  EXPECT_FLOAT_EQ(start.position.z, 10.0f);
+
+  models::CameraKeyframe quarter = models::InterpolateCameraKeyframes(keyframes, 0.25f);
+  EXPECT_FLOAT_EQ(quarter.position.x, 5.0f);
+  EXPECT_FLOAT_EQ(quarter.position.z, 5.0f);
+  EXPECT_FLOAT_EQ(quarter.d, 30.0f);
+
+  models::CameraKeyframe end = models::InterpolateCameraKeyframes(keyframes, 1.0f);
+  EXPECT_FLOAT_EQ(end.position.y, 10.0f);
+  EXPECT_FLOAT_EQ(end.target.y, 2.0f);
+}
+
+/**
+ * @brief O lote renderiza todos os quadros e, ao ser executado novamente, não refaz as imagens que já existem
+ */
+TEST(BatchTest, run_render_jobs)
+{
+  std::filesystem::path directory = std::filesystem::path(testing::TempDir()) / "mrx_batch_test";
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+
+  models::Scene *scene = small_scene({79, 59});
+
+  json scene_json;
+  scene_json["scene"] = scene->to_json();
+  utils::save_json((directory / "scene.json").string(), scene_json);
+  delete scene;
+
+  json manifest = {{"jobs", {{{"scene", "scene.json"}, {"output", "{lighting}/frame_{frame}.ppm"}, {"lighting", {"flat", "gouraud"}}, {"frames", 2}, {"camera", {{{"position", {{"x", 20}, {"y", 20}, {"z", 40}}}}, {{"position", {{"x", 30}, {"y", 10}, {"z", 30}}}}}}}}}};
+
+  std::vector<models::RenderJob> jobs;
+  ASSERT_TRUE(models::LoadRenderJobs(manifest, directory.string(), jobs));
+  ASSERT_EQ(jobs.size(), 2u);
+
+  EXPECT_EQ(models::RunRenderJobs(jobs, 2, false), 0);
+
+  std::filesystem::path image = directory / "gouraud" / "frame_0001.ppm";
+  ASSERT_TRUE(std::filesystem::exists(image));
+  EXPECT_EQ(std::filesystem::file_size(image), std::string("P6\n80 60\n255\n").size() + 80 * 60 * 3);
+  EXPECT_FALSE(std::filesystem::exists(directory / "gouraud" / "frame_0001.part.ppm"));
+
+  // Retomada: as imagens existentes são mantidas
+  std::filesystem::file_time_type written = std::filesystem::last_write_time(image);
+  std::filesystem::resize_file(directory / "flat" / "frame_0000.ppm", 0);
+
+  EXPECT_EQ(models::RunRenderJobs(jobs, 2, false), 0);
+  EXPECT_EQ(std::filesystem::last_write_time(image), written);
+  EXPECT_EQ(std::filesystem::file_size(directory / "flat" / "frame_0000.ppm"), 0u);
+
+  // Sobrescrita
+  EXPECT_EQ(models::RunRenderJobs(jobs, 2, true), 0);
+  EXPECT_GT(std::filesystem::file_size(directory / "flat" / "frame_0000.ppm"), 0u);
+
+  std::filesystem::remove_all(directory);
+}
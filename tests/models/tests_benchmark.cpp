@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <models/benchmark.hpp>
+
+#include <cmath>
+
+/**
+ * @brief O caminho da câmera se aproxima até a origem, dá uma volta em torno do alvo e se afasta
+ * até BENCHMARK_END_Z, sempre com a mesma quantidade de passos
+ */
+TEST(BenchmarkTest, camera_path)
+{
+  models::Camera3D *camera = models::CreateCamera3D({0, 0, 10}, {0, 0, 5}, {0, 1, 0}, 20, 1, 100);
+  models::BenchmarkCamera path;
+
+  for (int i = 0; i < 10; i++)
+    models::benchmark_camera_step(&path, camera);
+
+  EXPECT_EQ(path.movement, BENCHMARK_DOLLY);
+  EXPECT_FLOAT_EQ(camera->position.z, 0.0f);
+
+  int orbit_frames = 0;
+  do
+  {
+    models::benchmark_camera_step(&path, camera);
+    orbit_frames++;
+  } while (path.movement == BENCHMARK_ORBIT);
+
+  EXPECT_EQ(orbit_frames, static_cast<int>(std::ceil(2 * M_PI / BENCHMARK_ORBIT_SPEED)));
+
+  while (!path.finished)
+    models::benchmark_camera_step(&path, camera);
+
+  EXPECT_LE(camera->position.z, BENCHMARK_END_Z);
+  EXPECT_GT(camera->position.z, BENCHMARK_END_Z - BENCHMARK_DOLLY_SPEED);
+
+  delete camera;
+}
+
+/**
+ * @brief As estatísticas são atualizadas a cada quadro, em milissegundos, e os 10% piores quadros
+ * são separados ao final
+ */
+TEST(BenchmarkTest, update)
+{
+  models::Benchmark benchmark;
+  models::benchmark_start(&benchmark);
+
+  for (int i = 1; i <= 20; i++)
+    models::benchmark_update(&benchmark, static_cast<double>(i));
+
+  EXPECT_DOUBLE_EQ(benchmark.total_frames, 20.0);
+  EXPECT_DOUBLE_EQ(benchmark.min_frame_time, 1.0);
+  EXPECT_DOUBLE_EQ(benchmark.max_frame_time, 20.0);
+  EXPECT_NEAR(benchmark.average_frame_time, 10.5, 1e-9);
+  EXPECT_NEAR(benchmark.average_fps, 1000.0 / 10.5, 1e-9);
+  EXPECT_EQ(benchmark.frame_times.size(), 20u);
+
+  models::benchmark_end(&benchmark);
+  EXPECT_EQ(benchmark.worst_10_percentile, (std::vector<double>{19.0, 20.0}));
+}
+
+/**
+ * @brief Os percentis vêm do histograma, também sem guardar o tempo de cada quadro
+ */
+TEST(BenchmarkTest, percentiles)
+{
+  models::Benchmark benchmark;
+  models::benchmark_start(&benchmark);
+  benchmark.keep_frame_times = false;
+
+  for (int i = 1; i <= 1000; i++)
+    models::benchmark_update(&benchmark, static_cast<double>(i) / 10.0);
+
+  models::benchmark_end(&benchmark);
+
+  EXPECT_TRUE(benchmark.frame_times.empty());
+  EXPECT_TRUE(benchmark.worst_10_percentile.empty());
+  EXPECT_DOUBLE_EQ(benchmark.max_frame_time, 100.0);
+
+  EXPECT_NEAR(models::benchmark_percentile(&benchmark, 50.0), 50.0, 50.0 / HISTOGRAM_SUB_BUCKETS);
+  EXPECT_NEAR(models::benchmark_percentile(&benchmark, 99.0), 99.0, 99.0 / HISTOGRAM_SUB_BUCKETS);
+  EXPECT_DOUBLE_EQ(models::benchmark_percentile(&benchmark, 100.0), 100.0);
+
+  EXPECT_EQ(models::benchmark_percentile_name(50.0), "p50");
+  EXPECT_EQ(models::benchmark_percentile_name(99.9), "p99.9");
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <models/frame.hpp>
+
+/**
+ * @brief A escala diminui quando os quadros passam do tempo alvo, volta a subir quando sobra tempo
+ * e respeita a escala mínima
+ */
+TEST(FrameTest, render_scale)
+{
+  models::RenderScale render_scale;
+
+  // Desligada: sempre 1
+  EXPECT_FLOAT_EQ(models::UpdateRenderScale(render_scale, 1000.0f), 1.0f);
+
+  render_scale.enabled = true;
+  render_scale.target_fps = 50.0f; // 20 ms
+  render_scale.min_scale = 0.3f;
+
+  // Quadros de 80 ms: a quantidade de pixels precisa cair para 1/4, ou seja, metade da escala
+  for (int i = 0; i < RENDER_SCALE_FRAMES; i++)
+    models::UpdateRenderScale(render_scale, 80.0f);
+  EXPECT_FLOAT_EQ(render_scale.scale, 0.5f);
+
+  // Dentro da tolerância: a escala não muda
+  for (int i = 0; i < 2 * RENDER_SCALE_FRAMES; i++)
+    models::UpdateRenderScale(render_scale, 21.0f);
+  EXPECT_FLOAT_EQ(render_scale.scale, 0.5f);
+
+  // Quadros muito lentos: limitada pela escala mínima
+  for (int i = 0; i < RENDER_SCALE_FRAMES; i++)
+    models::UpdateRenderScale(render_scale, 1000.0f);
+  EXPECT_FLOAT_EQ(render_scale.scale, 0.3f);
+
+  // Quadros rápidos: volta para a resolução da viewport
+  for (int i = 0; i < 4 * RENDER_SCALE_FRAMES; i++)
+    models::UpdateRenderScale(render_scale, 1.0f);
+  EXPECT_FLOAT_EQ(render_scale.scale, 1.0f);
+}
+
+/**
+ * @brief A ampliação bilinear interpola as cores sem escurecer as bordas com o fundo transparente
+ */
+TEST(FrameTest, upscale_frame_buffer)
+{
+  models::FrameBuffer source;
+  models::ClearFrameBuffer(source, 2, 2);
+
+  source.shading_buffer[0][0] = {0.0f, 0.0f, 0.0f, 255.0f};
+  source.shading_buffer[1][0] = {200.0f, 100.0f, 50.0f, 255.0f};
+  source.z_buffer[0][0] = 1.0f;
+
+  models::FrameBuffer destination;
+  models::UpscaleFrameBuffer(source, destination, 3, 3, 0.5f);
+
+  ASSERT_EQ(destination.width, 3);
+  ASSERT_EQ(destination.height, 3);
+
+  // Pixels que coincidem com a fonte
+  EXPECT_TRUE(models::CompareColors(destination.color_buffer[0][0], models::Color{0, 0, 0, 255}));
+  EXPECT_TRUE(models::CompareColors(destination.color_buffer[2][0], models::Color{200, 100, 50, 255}));
+  EXPECT_TRUE(models::CompareColors(destination.color_buffer[2][2], models::TRANSPARENT));
+
+  // Entre dois pixels opacos: média
+  EXPECT_TRUE(models::CompareColors(destination.color_buffer[1][0], models::Color{100, 50, 25, 255}));
+
+  // Entre um pixel opaco e o fundo: mesma cor, metade da cobertura
+  EXPECT_TRUE(models::CompareColors(destination.color_buffer[2][1], models::Color{200, 100, 50, 128}));
+
+  EXPECT_FLOAT_EQ(destination.z_buffer[0][0], 1.0f);
+}
@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+#include <models/golden.hpp>
+#include <utils/image.hpp>
+
+/**
+ * @brief Cada combinação de pipeline e modelo de iluminação renderiza a cena de referência igual à
+ * imagem guardada em MRX_GOLDEN_DIRECTORY, a menos de pequenas diferenças de arredondamento
+ *
+ * @note Se a mudança na imagem for esperada, as referências são refeitas com o mrx-golden
+ */
+TEST(GoldenTest, pipelines_and_lighting_models)
+{
+  for (const models::GoldenCase &golden_case : models::GoldenCases())
+  {
+    std::string name = golden_case.pipeline + "_" + golden_case.lighting;
+    std::string reference_path = models::GoldenReferencePath(MRX_GOLDEN_DIRECTORY, golden_case);
+
+    std::vector<std::vector<models::Color>> reference;
+    ASSERT_TRUE(utils::ReadPPM(reference_path, reference)) << "referência '" << reference_path << "' não encontrada, rode o mrx-golden";
+
+    std::vector<std::vector<models::Color>> image = models::RenderGolden(golden_case);
+    utils::ImageDifference difference = utils::CompareImages(image, reference, GOLDEN_CHANNEL_TOLERANCE);
+
+    ASSERT_TRUE(difference.same_size) << name;
+
+    if (difference.mismatch_percent > GOLDEN_MISMATCH_PERCENT)
+    {
+      std::string actual_path = testing::TempDir() + "mrx_golden_" + name + ".ppm";
+      utils::WritePPM(actual_path, image);
+
+      ADD_FAILURE() << name << ": " << difference.mismatched << " pixels diferentes (" << difference.mismatch_percent
+                    << "%), erro máximo " << difference.max_error << ", imagem gerada em '" << actual_path << "'";
+    }
+  }
+}
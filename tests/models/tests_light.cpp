@@ -0,0 +1,287 @@
+#include <gtest/gtest.h>
+#include <models/light.hpp>
+#include <math/pipeline.hpp>
+#include <vector>
+#include <algorithm>
+
+#include "../fixtures.hpp"
+
+/**
+ * @brief A atenuação vale 1 no centro, cai suavemente e zera no raio
+ */
+TEST(LightTest, omni_attenuation)
+{
+  models::Omni omni = omni_light({0, 0, 0}, 4.0f);
+
+  EXPECT_FLOAT_EQ(models::OmniAttenuation(omni, {0, 0, 0}), 1.0f);
+  EXPECT_GT(models::OmniAttenuation(omni, {1, 0, 0}), models::OmniAttenuation(omni, {2, 0, 0}));
+  EXPECT_FLOAT_EQ(models::OmniAttenuation(omni, {4, 0, 0}), 0.0f);
+  EXPECT_FLOAT_EQ(models::OmniAttenuation(omni, {10, 0, 0}), 0.0f);
+
+  // Sem raio, a luz não é atenuada
+  omni.radius = 0.0f;
+  EXPECT_FLOAT_EQ(models::OmniAttenuation(omni, {100, 0, 0}), 1.0f);
+}
+
+/**
+ * @brief Cada luz deve estar apenas nos blocos cobertos pelo seu retângulo, em ordem crescente
+ */
+TEST(LightTest, bin_omni_lights)
+{
+  models::LightTiles tiles;
+
+  std::vector<core::Vector4> bounds = {
+      {20, 20, 40, 40},    // blocos (1, 1) a (2, 2)
+      {0, 0, 63, 47},      // tela inteira
+      {-50, -50, -10, -10} // fora da tela
+  };
+
+  models::BinOmniLights(tiles, bounds, 64, 48);
+
+  ASSERT_EQ(tiles.columns, 4);
+  ASSERT_EQ(tiles.rows, 3);
+
+  EXPECT_EQ(models::GetTileLights(tiles, 0, 0), (std::vector<unsigned int>{1}));
+  EXPECT_EQ(models::GetTileLights(tiles, 20, 20), (std::vector<unsigned int>{0, 1}));
+  EXPECT_EQ(models::GetTileLights(tiles, 40, 40), (std::vector<unsigned int>{0, 1}));
+  EXPECT_EQ(models::GetTileLights(tiles, 63, 20), (std::vector<unsigned int>{1}));
+
+  std::vector<unsigned int> lights;
+  models::GatherTileLights(tiles, {0, 0, 63, 47}, lights);
+  EXPECT_EQ(lights, (std::vector<unsigned int>{0, 1}));
+}
+
+/**
+ * @brief Toda luz que alcança um ponto visível deve estar no bloco onde o ponto é projetado
+ */
+TEST(LightTest, omni_bounding_box_is_conservative)
+{
+  core::Vector3 eye = {10, 10, 20};
+  core::Vector3 target = {0, 0, 0};
+  int width = 160, height = 120;
+
+  core::Matrix transformation = math::MatrixMultiply(
+      math::MatrixMultiply(
+          math::pipeline_adair::src_to_srt({-3, -3}, {0, 0}, {3, 3}, {static_cast<float>(width - 1), static_cast<float>(height - 1)}, true),
+          math::pipeline_adair::projection(eye, target, 30)),
+      math::pipeline_adair::sru_to_src(eye, target));
+
+  std::vector<models::Omni> omni;
+  std::vector<core::Vector4> bounds;
+
+  for (int i = 0; i < 64; i++)
+  {
+    core::Vector3 position = {static_cast<float>(i % 8) - 4.0f, static_cast<float>((i * 3) % 5) - 2.0f, static_cast<float>(i / 8) - 4.0f};
+    omni.push_back(omni_light(position, 0.5f + static_cast<float>(i % 3)));
+    bounds.push_back(models::OmniBoundingBox(omni.back(), transformation, nullptr, width, height));
+  }
+
+  models::LightTiles tiles;
+  models::BinOmniLights(tiles, bounds, width, height);
+
+  for (float x = -3.0f; x <= 3.0f; x += 0.25f)
+    for (float z = -3.0f; z <= 3.0f; z += 0.25f)
+    {
+      core::Vector3 point = {x, 0.0f, z};
+      core::Vector4 screen = math::MatrixMultiplyVector(transformation, {point.x, point.y, point.z, 1.0f});
+      float sx = screen.x / screen.w;
+      float sy = screen.y / screen.w;
+
+      if (sx < 0 || sy < 0 || sx > width - 1 || sy > height - 1)
+        continue;
+
+      const std::vector<unsigned int> &lights = models::GetTileLights(tiles, sx, sy);
+
+      for (unsigned int i = 0; i < omni.size(); i++)
+      {
+        if (models::OmniAttenuation(omni[i], point) > 0.0f)
+        {
+          EXPECT_NE(std::find(lights.begin(), lights.end(), i), lights.end()) << "luz " << i << " em (" << x << ", " << z << ")";
+        }
+      }
+    }
+}
+
+/**
+ * @brief Com todas as luzes na lista, o resultado deve ser idêntico ao laço sobre todas as luzes
+ */
+TEST(LightTest, light_list_matches_all_lights)
+{
+  models::Light global_light;
+  global_light.intensity = models::WHITE;
+
+  models::Material material = {{0.2f, 0.2f, 0.2f}, {0.7f, 0.6f, 0.5f}, {0.5f, 0.5f, 0.5f}, 10.0f};
+  std::vector<models::Omni> omni = {omni_light({2, 2, 2}, 0.0f), omni_light({-3, 1, 0}, 6.0f), omni_light({0, 5, 1}, 8.0f)};
+  std::vector<unsigned int> lights = {0, 1, 2};
+
+  core::Vector3 centroid = {0.5f, 0.0f, 0.5f};
+  core::Vector3 normal = {0.0f, 1.0f, 0.0f};
+  core::Vector3 eye = {10, 10, 20};
+
+  models::ColorFloat expected = models::PhongIllumination(global_light, omni, centroid, centroid, normal, eye, material);
+  models::ColorFloat result = models::PhongIllumination(global_light, omni, lights, centroid, centroid, normal, eye, material);
+  EXPECT_TRUE(models::CompareColors(expected, result));
+}
+
+/**
+ * @brief Apenas as luzes que alcançam a caixa de um bloco de pontos devem ser reunidas, e a iluminação
+ * constante com elas deve ser idêntica à com todas as luzes
+ */
+TEST(LightTest, omni_lights_near_block)
+{
+  models::Light global_light;
+  global_light.intensity = models::WHITE;
+
+  models::Material material = {{0.2f, 0.2f, 0.2f}, {0.7f, 0.6f, 0.5f}, {0.5f, 0.5f, 0.5f}, 10.0f};
+  std::vector<models::Omni> omni = {omni_light({0, 3, 0}, 4.0f), omni_light({20, 0, 0}, 4.0f), omni_light({-30, 0, 0}, 0.0f), omni_light({1, 1, 3}, 2.5f)};
+
+  std::vector<core::Vector3> positions = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 1}};
+  std::vector<core::Vector3> normals = {{0, 1, 0}, {0, 1, 0}, {0, 0, 1}, {0.6f, 0.8f, 0}};
+
+  // A luz 1 está longe, a 2 não tem raio e a 3 alcança apenas o canto (1, 1, 1)
+  std::vector<unsigned int> lights;
+  models::GatherOmniLights(omni, positions.data(), positions.size(), lights);
+  EXPECT_EQ(lights, (std::vector<unsigned int>{0, 2, 3}));
+
+  std::vector<core::Vector3> expected(positions.size());
+  std::vector<core::Vector3> result(positions.size());
+
+  models::FlatDiffuseColors(global_light, omni, {0, 1, 2, 3}, positions.data(), normals.data(), positions.size(), material, expected.data());
+  models::FlatDiffuseColors(global_light, omni, lights, positions.data(), normals.data(), positions.size(), material, result.data());
+
+  for (size_t i = 0; i < positions.size(); i++)
+  {
+    EXPECT_EQ(result[i].x, expected[i].x);
+    EXPECT_EQ(result[i].y, expected[i].y);
+    EXPECT_EQ(result[i].z, expected[i].z);
+  }
+}
+
+/**
+ * @brief A iluminação com a política Fast fica perto da exata: cada cosseno tem erro relativo de até
+ * FAST_INVERSE_SQRT_ERROR por normalização e o brilho especular até FAST_POW_ERROR
+ */
+TEST(LightTest, fast_precision)
+{
+  models::Light global_light;
+  global_light.intensity = models::WHITE;
+
+  models::Material material = {{0.2f, 0.2f, 0.2f}, {0.7f, 0.6f, 0.5f}, {0.5f, 0.5f, 0.5f}, 10.0f};
+  std::vector<models::Omni> omni = {omni_light({2, 2, 2}, 0.0f), omni_light({-3, 1, 0}, 6.0f), omni_light({0, 5, 1}, 8.0f)};
+
+  core::Vector3 eye = {10, 10, 20};
+  std::vector<core::Vector3> points = {{0.5f, 0.0f, 0.5f}, {-1.0f, 0.5f, 0.0f}, {0.0f, 1.0f, -1.0f}};
+  std::vector<core::Vector3> normals = {{0.0f, 1.0f, 0.0f}, {-0.6f, 0.8f, 0.0f}, {0.2f, 1.3f, 0.4f}};
+
+  // Até três normalizações por termo (normal, luz e vetor médio): 1% do valor com folga
+  auto expect_near = [](const models::ColorFloat &exact, const models::ColorFloat &fast)
+  {
+    EXPECT_NEAR(fast.r, exact.r, 0.01f * exact.r + 0.01f);
+    EXPECT_NEAR(fast.g, exact.g, 0.01f * exact.g + 0.01f);
+    EXPECT_NEAR(fast.b, exact.b, 0.01f * exact.b + 0.01f);
+  };
+
+  for (size_t i = 0; i < points.size(); i++)
+  {
+    core::Vector3 normal = math::Vector3Normalize(normals[i]);
+
+    expect_near(models::FlatShading<math::Exact>(global_light, omni, points[i], normal, eye, material), models::FlatShading<math::Fast>(global_light, omni, points[i], normal, eye, material));
+    expect_near(models::PhongIllumination<math::Exact>(global_light, omni, points[i], points[i], normals[i], eye, material), models::PhongIllumination<math::Fast>(global_light, omni, points[i], points[i], normals[i], eye, material));
+  }
+
+  // O padrão é a política exata
+  models::ColorFloat expected = models::PhongIllumination<math::Exact>(global_light, omni, points[0], points[0], normals[0], eye, material);
+  EXPECT_TRUE(models::CompareColors(models::PhongIllumination(global_light, omni, points[0], points[0], normals[0], eye, material), expected));
+
+  // A cache é refeita quando a precisão muda
+  models::LightingCache cache;
+  models::BeginLightingCache(cache, 1, 0, global_light, omni, material, points.size(), FAST_PRECISION);
+  EXPECT_TRUE(models::LightingCacheMatches(cache, 1, 0, global_light, omni, material, FAST_PRECISION));
+  EXPECT_FALSE(models::LightingCacheMatches(cache, 1, 0, global_light, omni, material, EXACT_PRECISION));
+}
+
+/**
+ * @brief A conversão para RGBA8 limita e arredonda apenas no final, e a iluminação acumula sem limite
+ */
+TEST(LightTest, linear_color_resolve)
+{
+  models::Color color = models::PackColor({-10.0f, 127.5f, 300.0f, 255.0f});
+  EXPECT_TRUE(models::CompareColors(color, models::Color{0, 128, 255, 255}));
+
+  models::Color rounded = models::PackColor({0.49f, 0.5f, 254.6f, 0.0f});
+  EXPECT_TRUE(models::CompareColors(rounded, models::Color{0, 1, 255, 0}));
+
+  // Duas luzes fortes somadas passam de 255 antes do resolve
+  models::Light global_light;
+  global_light.intensity = models::WHITE;
+
+  models::Material material = {{1.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}, 1.0f};
+  std::vector<models::Omni> omni = {omni_light({0, 5, 0}, 0.0f), omni_light({0, 5, 0}, 0.0f)};
+
+  models::ColorFloat result = models::FlatShading(global_light, omni, {0, 0, 0}, {0, 1, 0}, {0, 5, 5}, material);
+  EXPECT_GT(result.r, static_cast<float>(MAX_COLOR_VALUE));
+  EXPECT_TRUE(models::CompareColors(models::PackColor(result), models::WHITE));
+}
+
+/**
+ * @brief As cores calculadas em bloco devem ser as mesmas do Gouraud por canto de face, e a chave
+ * deve invalidar os termos difusos quando a luz, o material ou a malha mudam, mas não com a câmera
+ */
+TEST(LightTest, lighting_cache)
+{
+  models::Light global_light;
+  global_light.intensity = models::WHITE;
+
+  models::Material material = {{0.2f, 0.2f, 0.2f}, {0.7f, 0.6f, 0.5f}, {0.5f, 0.5f, 0.5f}, 10.0f};
+  std::vector<models::Omni> omni = {omni_light({2, 2, 2}, 0.0f), omni_light({-3, 1, 0}, 6.0f)};
+  core::Vector3 eye = {10, 10, 20};
+
+  std::vector<core::Vector3> positions = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-2, 0.5f, 1}};
+  std::vector<core::Vector3> normals = {{0, 1, 0}, {1, 0, 0}, {0, 0, 1}, {-0.6f, 0.8f, 0}};
+  std::vector<unsigned int> lights = {0, 1};
+
+  models::LightingCache cache;
+  EXPECT_FALSE(models::LightingCacheMatches(cache, 1, 0, global_light, omni, material));
+
+  models::BeginLightingCache(cache, 1, 0, global_light, omni, material, positions.size());
+  EXPECT_FALSE(models::LightingCacheViewMatches(cache, eye));
+
+  models::BeginLightingCacheView(cache, eye);
+  models::FlatDiffuseColors(global_light, omni, lights, positions.data(), normals.data(), positions.size(), material, cache.diffuse.data());
+  models::FlatSpecularColors(omni, lights, positions.data(), normals.data(), positions.size(), eye, material, cache.diffuse.data(), cache.colors.data());
+
+  for (size_t i = 0; i < positions.size(); i++)
+  {
+    models::ColorFloat expected = models::GouraudShading(global_light, omni, std::make_pair(positions[i], normals[i]), eye, material);
+    EXPECT_FLOAT_EQ(cache.colors[i].x, expected.r);
+    EXPECT_FLOAT_EQ(cache.colors[i].y, expected.g);
+    EXPECT_FLOAT_EQ(cache.colors[i].z, expected.b);
+  }
+
+  EXPECT_TRUE(models::LightingCacheMatches(cache, 1, 0, global_light, omni, material));
+  EXPECT_TRUE(models::LightingCacheViewMatches(cache, eye));
+
+  // Câmera em movimento: os termos difusos continuam válidos, o especular só é refeito se for usado
+  EXPECT_TRUE(models::LightingCacheMatches(cache, 1, 0, global_light, omni, material));
+  EXPECT_EQ(models::LightingCacheViewMatches(cache, {10, 10, 21}), !models::FlatViewDependent(material));
+
+  // Sem cor especular, a iluminação nunca depende do observador
+  models::Material matte = material;
+  matte.specular = {0.0f, 0.0f, 0.0f};
+  EXPECT_FALSE(models::FlatViewDependent(matte));
+
+  // Malha alterada
+  EXPECT_FALSE(models::LightingCacheMatches(cache, 2, 0, global_light, omni, material));
+  // Outro algoritmo de normais
+  EXPECT_FALSE(models::LightingCacheMatches(cache, 1, 1, global_light, omni, material));
+
+  // Luz em movimento
+  std::vector<models::Omni> moved = omni;
+  moved[1].position.x += 0.5f;
+  EXPECT_FALSE(models::LightingCacheMatches(cache, 1, 0, global_light, moved, material));
+
+  // Material alterado
+  models::Material shiny = material;
+  shiny.shininess = 20.0f;
+  EXPECT_FALSE(models::LightingCacheMatches(cache, 1, 0, global_light, omni, shiny));
+}
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <models/obj.hpp>
+#include <models/mesh.hpp>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+/**
+ * @brief Escreve um arquivo OBJ temporário
+ *
+ * @param name Nome do arquivo
+ * @param content Conteúdo
+ *
+ * @return std::string Caminho do arquivo
+ */
+static std::string write_obj(const std::string &name, const std::string &content)
+{
+  std::string path = (std::filesystem::temp_directory_path() / name).string();
+  std::ofstream file(path, std::ios::binary);
+  file << content;
+  return path;
+}
+
+/**
+ * @brief Cubo de lado 2 centrado na origem, com faces quadradas no sentido anti-horário
+ *
+ * @param normals Se verdadeiro, cada face usa a sua normal (vn), como um exportador com arestas vivas
+ */
+static std::string cube_obj(bool normals)
+{
+  std::string result = "# cubo\r\nmtllib cubo.mtl\r\no Cubo\r\n"
+                       "v -1 -1 -1\r\nv 1 -1 -1\r\nv 1 1 -1\r\nv -1 1 -1\r\n"
+                       "v -1 -1 1\r\nv 1 -1 1\r\nv +1 1 1\r\nv -1 1 1.0 1.0\r\n"
+                       "vt 0 0\r\nvt 1 0\r\nvt 1 1\r\nvt 0 1\r\n\r\n"
+                       "s off\r\n";
+
+  if (normals)
+    result += "vn 0 0 -1\nvn 0 0 1\nvn 0 -1 0\nvn 0 1 0\nvn -1 0 0\nvn 1 0 0\n"
+              "f 1/1/1 4/4/1 3/3/1 2/2/1\n"
+              "f 5//2 6//2 7//2 8//2\n"
+              "f -8/1/-4 -7/2/-4 -3/3/-4 -4/4/-4\n"
+              "f 4//4 8//4 7//4 3//4\n"
+              "f 1//5 5//5 8//5 4//5\n"
+              "f\t2//6 3//6  7//6 6//6\n";
+  else
+    result += "f 1/1 4/4 3/3 2/2\n"
+              "f 5 6 7 8\n"
+              "f -8 -7 -3 -4\n"
+              "f 4 8 7 3\n"
+              "f 1 5 8 4\n"
+              "f 2 3 7 6";
+
+  return result;
+}
+
+/**
+ * @brief Grade de quadrados no plano z = 0, com índices negativos em linhas alternadas
+ *
+ * @param size Quantidade de quadrados em cada direção
+ * @param normals Se verdadeiro, escreve uma normal por vértice
+ */
+static std::string grid_obj(int size, bool normals)
+{
+  std::ostringstream result;
+  int count = 0;
+
+  for (int y = 0; y <= size; y++)
+  {
+    for (int x = 0; x <= size; x++)
+    {
+      result << "v " << x * 0.5f << " " << y * 0.25f << " 0\n";
+      if (normals)
+        result << "vn 0 0 1\n";
+      count++;
+    }
+
+    if (y == 0)
+      continue;
+
+    for (int x = 0; x < size; x++)
+    {
+      int a = (y - 1) * (size + 1) + x + 1;
+      int b = a + 1;
+      int c = b + size + 1;
+      int d = a + size + 1;
+
+      if (y % 2 == 0)
+      {
+        a -= count + 1;
+        b -= count + 1;
+        c -= count + 1;
+        d -= count + 1;
+      }
+
+      if (normals)
+        result << "f " << a << "//" << a << " " << b << "//" << b << " " << c << "//" << c << " " << d << "//" << d << "\n";
+      else
+        result << "f " << a << " " << b << " " << c << " " << d << "\n";
+    }
+  }
+
+  return result.str();
+}
+
+/**
+ * @brief Faces quadradas, índices negativos, coordenadas de textura ignoradas e normais: sem as
+ * normais o cubo é uma malha fechada, com elas cada face tem os seus próprios vértices (arestas vivas)
+ */
+TEST(ObjTest, cube)
+{
+  std::string path = write_obj("mrx_obj_cube.obj", cube_obj(false));
+
+  utils::ThreadPool pool(2);
+  models::Mesh mesh;
+  ASSERT_TRUE(mesh.createMesh(path, pool));
+  std::filesystem::remove(path);
+
+  EXPECT_EQ(mesh.getName(), "mrx_obj_cube");
+  EXPECT_EQ(mesh.getNumFaces(), 6);
+  ASSERT_EQ(mesh.getVertices().size(), 8u);
+  ASSERT_EQ(mesh.getHalfEdges().size(), 24u);
+
+  for (auto he : mesh.getHalfEdges())
+  {
+    ASSERT_NE(he->getTwin(), nullptr);
+    EXPECT_EQ(he->getTwin()->getTwin(), he);
+    EXPECT_EQ(he->getTwin()->getOrigin(), he->getNext()->getOrigin());
+    EXPECT_EQ(he->getNext()->getPrev(), he);
+  }
+
+  for (auto face : mesh.getFaces())
+    face->getFaceNormal();
+  mesh.determineNormals();
+
+  // Normais para fora do cubo, nas diagonais
+  for (auto vertex : mesh.getVertices())
+  {
+    core::Vector3 normal = vertex->getNormal();
+    EXPECT_NEAR(normal.x, vertex->getX() / std::sqrt(3.0f), 1e-5f);
+    EXPECT_NEAR(normal.y, vertex->getY() / std::sqrt(3.0f), 1e-5f);
+    EXPECT_NEAR(normal.z, vertex->getZ() / std::sqrt(3.0f), 1e-5f);
+  }
+
+  path = write_obj("mrx_obj_cube_normals.obj", cube_obj(true));
+
+  models::Mesh sharp;
+  ASSERT_TRUE(sharp.createMesh(path, pool));
+  std::filesystem::remove(path);
+
+  EXPECT_EQ(sharp.getNumFaces(), 6);
+  EXPECT_EQ(sharp.getVertices().size(), 24u);
+
+  for (auto he : sharp.getHalfEdges())
+    EXPECT_EQ(he->getTwin(), nullptr);
+
+  for (auto face : sharp.getFaces())
+    face->getFaceNormal();
+  sharp.determineNormals();
+
+  for (auto face : sharp.getFaces())
+    for (auto vertex : face->getVertex())
+    {
+      EXPECT_NEAR(vertex->getNormal().x, face->getNormal().x, 1e-5f);
+      EXPECT_NEAR(vertex->getNormal().y, face->getNormal().y, 1e-5f);
+      EXPECT_NEAR(vertex->getNormal().z, face->getNormal().z, 1e-5f);
+    }
+}
+
+/**
+ * @brief O resultado não depende do tamanho dos trechos analisados em paralelo, inclusive com
+ * índices negativos que apontam para vértices de trechos anteriores
+ */
+TEST(ObjTest, parallel_chunks)
+{
+  const int size = 40;
+  std::string content = grid_obj(size, true);
+
+  utils::ThreadPool pool(4);
+  models::ObjData whole;
+  ASSERT_TRUE(models::ParseObj(content.data(), content.size(), whole, pool, content.size()));
+
+  EXPECT_EQ(whole.positions.size(), static_cast<size_t>((size + 1) * (size + 1)));
+  EXPECT_EQ(whole.normals.size(), whole.positions.size());
+  ASSERT_EQ(whole.face_offsets.size(), static_cast<size_t>(size * size + 1));
+  EXPECT_EQ(whole.face_offsets.back(), 4 * size * size);
+
+  for (size_t chunk_size : {1, 7, 100, 4096})
+  {
+    models::ObjData chunked;
+    ASSERT_TRUE(models::ParseObj(content.data(), content.size(), chunked, pool, chunk_size));
+
+    ASSERT_EQ(chunked.positions.size(), whole.positions.size());
+    for (size_t i = 0; i < whole.positions.size(); i++)
+    {
+      EXPECT_EQ(chunked.positions[i].x, whole.positions[i].x);
+      EXPECT_EQ(chunked.positions[i].y, whole.positions[i].y);
+    }
+
+    EXPECT_EQ(chunked.normals.size(), whole.normals.size());
+    EXPECT_EQ(chunked.face_offsets, whole.face_offsets) << "trechos de " << chunk_size << " bytes";
+    EXPECT_EQ(chunked.position_indices, whole.position_indices) << "trechos de " << chunk_size << " bytes";
+    EXPECT_EQ(chunked.normal_indices, whole.normal_indices) << "trechos de " << chunk_size << " bytes";
+  }
+
+  // Linhas com índices negativos e positivos apontam para os mesmos vértices
+  for (int face = 0; face < size * size; face++)
+  {
+    int x = face % size;
+    int y = face / size;
+    EXPECT_EQ(whole.position_indices[4 * face], y * (size + 1) + x);
+    EXPECT_EQ(whole.normal_indices[4 * face + 2], (y + 1) * (size + 1) + x + 1);
+  }
+}
+
+/**
+ * @brief Uma malha aberta tem meias arestas de borda sem par, e as normais dos vértices da borda
+ * também são calculadas
+ */
+TEST(ObjTest, open_mesh)
+{
+  const int size = 6;
+  std::string path = write_obj("mrx_obj_grid.obj", grid_obj(size, true));
+
+  utils::ThreadPool pool(2);
+  models::Mesh mesh;
+  ASSERT_TRUE(mesh.createMesh(path, pool));
+  std::filesystem::remove(path);
+
+  // As normais repetidas (um vn por vértice) não separam os vértices
+  EXPECT_EQ(mesh.getVertices().size(), static_cast<size_t>((size + 1) * (size + 1)));
+  EXPECT_EQ(mesh.getNumFaces(), size * size);
+
+  int boundary = 0;
+  for (auto he : mesh.getHalfEdges())
+    boundary += he->getTwin() == nullptr;
+
+  EXPECT_EQ(boundary, 4 * size);
+
+  for (auto face : mesh.getFaces())
+    face->getFaceNormal();
+  mesh.determineNormals();
+
+  for (auto vertex : mesh.getVertices())
+  {
+    EXPECT_NEAR(vertex->getNormal().x, 0.0f, 1e-6f);
+    EXPECT_NEAR(vertex->getNormal().y, 0.0f, 1e-6f);
+    EXPECT_NEAR(vertex->getNormal().z, 1.0f, 1e-6f);
+  }
+}
+
+/**
+ * @brief Arquivos com linhas ou índices inválidos são recusados
+ */
+TEST(ObjTest, invalid_files)
+{
+  utils::ThreadPool pool(2);
+  models::ObjData data;
+
+  for (std::string content : {"v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 4\n",
+                              "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 0\n",
+                              "v 0 0 0\nv 1 0 0\nv 0 1 0\nf -1 -2 -4\n",
+                              "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2\n",
+                              "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3x\n",
+                              "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1//1 2//1 3//1\n",
+                              "v 0 0\n",
+                              "vn 0 a 1\n"})
+    EXPECT_FALSE(models::ParseObj(content.data(), content.size(), data, pool, 4)) << content;
+
+  models::Mesh mesh;
+  EXPECT_FALSE(mesh.createMesh((std::filesystem::temp_directory_path() / "mrx_obj_inexistente.obj").string(), pool));
+
+  // Um arquivo sem faces não cria uma malha
+  std::string path = write_obj("mrx_obj_empty.obj", "v 0 0 0\n");
+  EXPECT_FALSE(mesh.createMesh(path, pool));
+  std::filesystem::remove(path);
+}
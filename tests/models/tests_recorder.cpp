@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <models/recorder.hpp>
+#include <models/batch.hpp>
+#include <shapes/shapes.hpp>
+
+#include <filesystem>
+
+#include "../fixtures.hpp"
+
+/**
+ * @brief Aplica a entrada de um quadro da sessão de teste, como a interface faria
+ *
+ * @param scene Cena
+ * @param frame Número do quadro
+ */
+static void session_input(models::Scene *scene, int frame)
+{
+  switch (frame)
+  {
+  case 1:
+    models::CameraArcball(scene->getCamera(), 0.1f, 0.3f);
+    break;
+  case 2:
+    scene->setSelectedObject(scene->getObjects()[1]);
+    scene->translateObject({-4.0f, 2.0f, 0.0f});
+    break;
+  case 3:
+    scene->rotateObject({0.0f, 0.5f, 0.0f});
+    scene->scaleObject({1.2f, 1.2f, 1.2f});
+    break;
+  case 4:
+    scene->omni_lights[0].position.x += 3.0f;
+    scene->getObjects()[0]->material.diffuse.g = 0.1f;
+    break;
+  case 5:
+    scene->lighting_model = PHONG_SHADING;
+    scene->precision = FAST_PRECISION;
+    scene->deselectObject();
+    break;
+  case 6:
+    models::CameraMoveForward(scene->getCamera(), 2.0f, true);
+    scene->pipeline_model = SMITH_PIPELINE;
+    break;
+  }
+}
+
+/**
+ * @brief A reprodução de uma sessão gravada (lida de volta do arquivo, a partir da cena guardada na
+ * gravação) gera exatamente os mesmos quadros
+ */
+TEST(RecorderTest, record_and_replay)
+{
+  const int frames = 9;
+
+  models::Scene *scene = small_scene();
+  models::Recorder recorder;
+  models::RecordStart(recorder, scene);
+
+  std::vector<std::vector<std::vector<float>>> depths;
+  std::vector<std::vector<std::vector<models::Color>>> colors;
+
+  for (int frame = 0; frame < frames; frame++)
+  {
+    session_input(scene, frame);
+    ASSERT_TRUE(models::RecordFrame(recorder, scene));
+
+    scene->pipeline();
+    depths.push_back(scene->getFrontBuffer().z_buffer);
+    colors.push_back(scene->getFrontBuffer().color_buffer);
+  }
+
+  models::RecordStop(recorder, scene);
+  EXPECT_EQ(scene->recorder, nullptr);
+  EXPECT_FALSE(models::RecordFrame(recorder, scene));
+
+  std::string path = (std::filesystem::temp_directory_path() / "mrx_recorder_test.mrxr").string();
+  ASSERT_TRUE(models::WriteRecording(recorder.recording, path));
+
+  models::Recording recording;
+  ASSERT_TRUE(models::ReadRecording(path, recording));
+  std::filesystem::remove(path);
+
+  EXPECT_EQ(recording.frames, frames);
+  EXPECT_EQ(recording.events.size(), recorder.recording.events.size());
+
+  models::Scene *replayed = models::SceneFromJson(json::parse(recording.scene));
+  ASSERT_NE(replayed, nullptr);
+
+  models::Replay replay;
+  models::ReplayStart(replay, recording);
+
+  for (int frame = 0; frame < frames; frame++)
+  {
+    ASSERT_TRUE(models::ReplayFrame(replay, replayed));
+    EXPECT_EQ(replay.frame, frame + 1);
+
+    replayed->pipeline();
+
+    const models::FrameBuffer &buffer = replayed->getFrontBuffer();
+    ASSERT_EQ(buffer.width, static_cast<int>(depths[frame].size()));
+
+    for (int x = 0; x < buffer.width; x++)
+      for (int y = 0; y < buffer.height; y++)
+      {
+        ASSERT_EQ(buffer.z_buffer[x][y], depths[frame][x][y]) << "quadro " << frame << " em (" << x << ", " << y << ")";
+        ASSERT_TRUE(models::CompareColors(buffer.color_buffer[x][y], colors[frame][x][y])) << "quadro " << frame << " em (" << x << ", " << y << ")";
+      }
+  }
+
+  EXPECT_EQ(replayed->lighting_model, PHONG_SHADING);
+  EXPECT_EQ(replayed->precision, FAST_PRECISION);
+  EXPECT_EQ(replayed->getSelectedObject(), nullptr);
+
+  EXPECT_TRUE(models::ReplayFinished(replay));
+  EXPECT_FALSE(models::ReplayFrame(replay, replayed));
+
+  delete replayed;
+  delete scene;
+}
+
+/**
+ * @brief Um quadro sem entrada grava apenas o seu marcador, a gravação para quando a quantidade de
+ * objetos muda e arquivos inválidos são recusados
+ */
+TEST(RecorderTest, invalid_sessions)
+{
+  models::Scene *scene = small_scene();
+  models::Recorder recorder;
+  models::RecordStart(recorder, scene);
+
+  EXPECT_TRUE(models::RecordFrame(recorder, scene));
+
+  size_t events = recorder.recording.events.size();
+  EXPECT_TRUE(models::RecordFrame(recorder, scene));
+  EXPECT_EQ(recorder.recording.events.size(), events + 1);
+  EXPECT_EQ(recorder.recording.events.back().type, RECORD_FRAME);
+  EXPECT_EQ(recorder.recording.events.back().index, 1);
+
+  scene->addObject(shapes::cube({0, 3, 0}));
+  EXPECT_FALSE(models::RecordFrame(recorder, scene));
+
+  models::RecordStop(recorder, scene);
+  delete scene;
+
+  models::Recording recording;
+  std::string path = (std::filesystem::temp_directory_path() / "mrx_recorder_invalid.mrxr").string();
+
+  EXPECT_FALSE(models::ReadRecording(path + ".inexistente", recording));
+
+  // Gravação cortada no meio de um evento
+  ASSERT_TRUE(models::WriteRecording(recorder.recording, path));
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+  EXPECT_FALSE(models::ReadRecording(path, recording));
+
+  // Outro formato
+  std::filesystem::resize_file(path, 2);
+  EXPECT_FALSE(models::ReadRecording(path, recording));
+
+  std::filesystem::remove(path);
+}
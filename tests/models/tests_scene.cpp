@@ -0,0 +1,282 @@
+#include <gtest/gtest.h>
+#include <models/scene.hpp>
+#include <math/dispatch.hpp>
+#include <shapes/shapes.hpp>
+
+#include "../fixtures.hpp"
+
+/**
+ * @brief A cena só deve ser considerada alterada quando algo que afeta o quadro muda
+ */
+TEST(SceneTest, change_tracking)
+{
+  models::Scene *scene = small_scene();
+
+  // Nenhum quadro foi processado
+  EXPECT_TRUE(scene->hasChanged());
+
+  scene->adair_pipeline();
+  EXPECT_FALSE(scene->hasChanged());
+
+  // Câmera
+  scene->getCamera()->position = {12, 8, 18};
+  EXPECT_TRUE(scene->hasChanged());
+  scene->adair_pipeline();
+  EXPECT_FALSE(scene->hasChanged());
+
+  // Material editado diretamente pela interface
+  scene->getObjects()[0]->material.diffuse.r = 0.1f;
+  EXPECT_TRUE(scene->hasChanged());
+  scene->adair_pipeline();
+
+  // Luz omni
+  scene->omni_lights[0].radius = 12.0f;
+  EXPECT_TRUE(scene->hasChanged());
+  scene->adair_pipeline();
+
+  // Transformação de um objeto
+  scene->setSelectedObject(scene->getObjects()[1]);
+  EXPECT_TRUE(scene->hasChanged());
+  scene->adair_pipeline();
+  scene->translateObject({1, 0, 0});
+  EXPECT_TRUE(scene->hasChanged());
+  scene->adair_pipeline();
+
+  // Configurações do pipeline
+  scene->lighting_model = GOURAUD_SHADING;
+  EXPECT_TRUE(scene->hasChanged());
+  scene->adair_pipeline();
+  EXPECT_FALSE(scene->hasChanged());
+
+  scene->precision = FAST_PRECISION;
+  EXPECT_TRUE(scene->hasChanged());
+  scene->adair_pipeline();
+  EXPECT_FALSE(scene->hasChanged());
+
+  // O pipeline de Smith move a primeira luz, mas a cena fica estável a partir do quadro seguinte
+  scene->pipeline_model = SMITH_PIPELINE;
+  EXPECT_TRUE(scene->hasChanged());
+  scene->smith_pipeline();
+  EXPECT_FALSE(scene->hasChanged());
+
+  delete scene;
+}
+
+/**
+ * @brief Todas as variantes dos kernels suportadas pelo processador geram exatamente o mesmo quadro
+ * que a baseline, em todos os pipelines e modelos de iluminação
+ */
+TEST(SceneTest, isa_variants)
+{
+  int active = math::ActiveIsa();
+  int available = std::min(math::CpuIsa(), math::MaxIsa());
+
+  std::cout << "Variante dos kernels: " << math::IsaName(active) << " (processador: " << math::IsaName(math::CpuIsa()) << ")" << std::endl;
+
+  EXPECT_EQ(active, available);
+  EXPECT_FALSE(math::SelectIsa(ISA_VARIANTS_COUNT));
+  EXPECT_FALSE(math::SelectIsa(-1));
+
+  for (int isa = ISA_BASELINE; isa < ISA_VARIANTS_COUNT; isa++)
+  {
+    int parsed = -1;
+    EXPECT_TRUE(math::ParseIsa(math::IsaName(isa), parsed));
+    EXPECT_EQ(parsed, isa);
+  }
+
+  for (int pipeline_model : {SANTA_CATARINA_PIPELINE, SMITH_PIPELINE})
+    for (int lighting_model : {FLAT_SHADING, GOURAUD_SHADING, PHONG_SHADING})
+    {
+      std::vector<std::vector<float>> depth;
+      std::vector<std::vector<models::Color>> colors;
+
+      for (int isa = ISA_BASELINE; isa <= available; isa++)
+      {
+        ASSERT_TRUE(math::SelectIsa(isa));
+
+        models::Scene *scene = small_scene();
+        scene->pipeline_model = pipeline_model;
+        scene->lighting_model = lighting_model;
+        scene->pipeline();
+
+        const models::FrameBuffer &buffer = scene->getFrontBuffer();
+
+        if (isa == ISA_BASELINE)
+        {
+          depth = buffer.z_buffer;
+          colors = buffer.color_buffer;
+        }
+        else
+          for (int x = 0; x < buffer.width; x++)
+            for (int y = 0; y < buffer.height; y++)
+            {
+              ASSERT_EQ(buffer.z_buffer[x][y], depth[x][y]) << math::IsaName(isa) << ", modelo " << lighting_model << " em (" << x << ", " << y << ")";
+              ASSERT_TRUE(models::CompareColors(buffer.color_buffer[x][y], colors[x][y])) << math::IsaName(isa) << ", modelo " << lighting_model << " em (" << x << ", " << y << ")";
+            }
+
+        delete scene;
+      }
+    }
+
+  math::SelectIsa(active);
+}
+
+/**
+ * @brief Quando apenas um objeto se move, só o retângulo que ele ocupava e passou a ocupar é refeito,
+ * com o mesmo resultado de refazer a tela inteira
+ */
+TEST(SceneTest, partial_rasterization)
+{
+  for (int lighting_model : {FLAT_SHADING, GOURAUD_SHADING, PHONG_SHADING})
+  {
+    models::Scene *scene = small_scene();
+    scene->lighting_model = lighting_model;
+
+    models::FrameBuffer buffer;
+
+    models::FrameGeometry *frame = &scene->nextFrameGeometry();
+    scene->geometry(*frame);
+    models::RasterizeFrame(*frame, buffer);
+
+    // Nada mudou: nada é refeito
+    frame = &scene->nextFrameGeometry();
+    scene->geometry(*frame);
+    models::RasterizeFrame(*frame, buffer);
+    EXPECT_LT(buffer.dirty.z, buffer.dirty.x);
+
+    // Um objeto selecionado e movido até ficar parcialmente na frente do outro
+    scene->setSelectedObject(scene->getObjects()[1]);
+    scene->translateObject({-5.0f, 0.25f, 1.0f});
+
+    frame = &scene->nextFrameGeometry();
+    scene->geometry(*frame);
+    models::RasterizeFrame(*frame, buffer);
+
+    float area = (buffer.dirty.z - buffer.dirty.x + 1) * (buffer.dirty.w - buffer.dirty.y + 1);
+    EXPECT_GT(area, 0.0f);
+    EXPECT_LT(area, static_cast<float>(buffer.width * buffer.height));
+
+    models::FrameBuffer reference;
+    models::RasterizeFrame(*frame, reference);
+
+    for (int x = 0; x < buffer.width; x++)
+      for (int y = 0; y < buffer.height; y++)
+      {
+        EXPECT_EQ(buffer.z_buffer[x][y], reference.z_buffer[x][y]) << "modelo " << lighting_model << " em (" << x << ", " << y << ")";
+        EXPECT_TRUE(models::CompareColors(buffer.color_buffer[x][y], reference.color_buffer[x][y])) << "modelo " << lighting_model << " em (" << x << ", " << y << ")";
+      }
+
+    // A câmera se moveu: a tela inteira é refeita
+    scene->getCamera()->position = {12, 8, 18};
+    frame = &scene->nextFrameGeometry();
+    scene->geometry(*frame);
+    models::RasterizeFrame(*frame, buffer);
+    EXPECT_FLOAT_EQ(buffer.dirty.z, static_cast<float>(buffer.width - 1));
+    EXPECT_FLOAT_EQ(buffer.dirty.w, static_cast<float>(buffer.height - 1));
+
+    delete scene;
+  }
+}
+
+/**
+ * @brief Com a resolução interna reduzida, o quadro é rasterizado em um framebuffer menor e exibido
+ * na resolução da viewport
+ */
+TEST(SceneTest, render_scale)
+{
+  models::Scene *scene = small_scene();
+
+  scene->render_scale = 0.5f;
+  scene->adair_pipeline();
+
+  EXPECT_EQ(scene->getFrontBuffer().width, 80);
+  EXPECT_EQ(scene->getFrontBuffer().height, 60);
+  EXPECT_EQ(scene->getDisplayBuffer().width, 160);
+  EXPECT_EQ(scene->getDisplayBuffer().height, 120);
+
+  // A escala faz parte do estado da cena
+  scene->render_scale = 1.0f;
+  EXPECT_TRUE(scene->hasChanged());
+  scene->adair_pipeline();
+  EXPECT_EQ(&scene->getDisplayBuffer(), &scene->getFrontBuffer());
+
+  delete scene;
+
+  // Viewport com um pixel de largura: a ampliação usa a escala da altura
+  scene = small_scene({0, 119});
+  scene->render_scale = 0.5f;
+  scene->adair_pipeline();
+
+  const models::FrameBuffer &display = scene->getDisplayBuffer();
+  ASSERT_EQ(display.width, 1);
+  ASSERT_EQ(display.height, 120);
+
+  // As bordas coincidem com as do quadro rasterizado
+  const models::FrameBuffer &front = scene->getFrontBuffer();
+  EXPECT_EQ(display.z_buffer[0][0], front.z_buffer[0][0]);
+  EXPECT_EQ(display.z_buffer[0][119], front.z_buffer[0][front.height - 1]);
+
+  delete scene;
+}
+
+/**
+ * @brief O mapa de overdraw conta os testes de profundidade de cada pixel, sem mudar a profundidade
+ * do quadro, e as razões refletem os cubos sobrepostos
+ */
+TEST(SceneTest, overdraw_heatmap)
+{
+  for (int lighting_model : {FLAT_SHADING, GOURAUD_SHADING, PHONG_SHADING})
+  {
+    models::Scene *scene = small_scene();
+    scene->lighting_model = lighting_model;
+
+    // Câmera alinhada com os dois cubos: o segundo fica na frente do primeiro
+    scene->getCamera()->position = {30, 4, 2};
+
+    models::FrameBuffer reference;
+    models::FrameGeometry *frame = &scene->nextFrameGeometry();
+    scene->geometry(*frame);
+    models::RasterizeFrame(*frame, reference);
+    EXPECT_TRUE(reference.depth_complexity.empty());
+
+    scene->overdraw = true;
+    EXPECT_TRUE(scene->hasChanged());
+
+    models::FrameBuffer buffer;
+    frame = &scene->nextFrameGeometry();
+    scene->geometry(*frame);
+    models::RasterizeFrame(*frame, buffer);
+
+    ASSERT_EQ(buffer.depth_complexity.size(), static_cast<size_t>(buffer.width));
+
+    unsigned int overdrawn = 0;
+
+    for (int x = 0; x < buffer.width; x++)
+      for (int y = 0; y < buffer.height; y++)
+      {
+        const math::DepthComplexity &counts = buffer.depth_complexity[x][y];
+
+        EXPECT_LE(counts.passes, counts.tests);
+        EXPECT_EQ(buffer.z_buffer[x][y], reference.z_buffer[x][y]) << "modelo " << lighting_model << " em (" << x << ", " << y << ")";
+
+        // Pixel coberto: pelo menos um teste passou e a cor é a do mapa
+        if (counts.passes > 0)
+        {
+          EXPECT_TRUE(models::CompareColors(buffer.color_buffer[x][y], models::PackColor(models::OverdrawHeatmapColor(counts.tests))));
+        }
+
+        overdrawn += counts.tests > 1;
+      }
+
+    EXPECT_GT(overdrawn, 0u);
+    EXPECT_GE(buffer.overdraw_ratio, 1.0f);
+    EXPECT_GE(buffer.depth_complexity_ratio, buffer.overdraw_ratio);
+
+    delete scene;
+  }
+
+  // Extremos do gradiente
+  EXPECT_TRUE(models::CompareColors(models::PackColor(models::OverdrawHeatmapColor(1)), models::BLUE));
+  EXPECT_TRUE(models::CompareColors(models::PackColor(models::OverdrawHeatmapColor(OVERDRAW_HEATMAP_MAX)), models::RED));
+  EXPECT_TRUE(models::CompareColors(models::PackColor(models::OverdrawHeatmapColor(100)), models::RED));
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <models/shadow.hpp>
+#include <models/scene.hpp>
+#include <shapes/shapes.hpp>
+#include <vector>
+#include <cmath>
+
+#include "../fixtures.hpp"
+
+/**
+ * @brief Um objeto entre a luz e o ponto deve sombreá-lo, nas 6 faces do cube map
+ */
+TEST(ShadowTest, occluder_blocks_light)
+{
+  models::Mesh *cube = shapes::cube({0, 0, 0});
+  models::Omni omni = omni_light({0, 0, 0}, 0.0f);
+
+  // Luz fora do cubo, em cada um dos 6 eixos
+  std::vector<core::Vector3> directions = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+
+  for (const auto &direction : directions)
+  {
+    omni.position = math::Vector3MultiplyValue(direction, 5.0f);
+
+    models::ShadowCubeMap map;
+    models::BuildShadowCubeMap(map, omni, {cube}, 64);
+
+    // Atrás do cubo: sombra
+    EXPECT_FLOAT_EQ(models::SampleShadowCubeMap(map, math::Vector3MultiplyValue(direction, -4.0f)), 0.0f);
+    // Entre a luz e o cubo: iluminado
+    EXPECT_FLOAT_EQ(models::SampleShadowCubeMap(map, math::Vector3MultiplyValue(direction, 3.0f)), 1.0f);
+    // Na face do cubo voltada para a luz: iluminado (sem auto sombreamento)
+    EXPECT_FLOAT_EQ(models::SampleShadowCubeMap(map, direction), 1.0f);
+    // Ao lado do cubo: iluminado
+    EXPECT_FLOAT_EQ(models::SampleShadowCubeMap(map, math::Vector3Add(math::Vector3MultiplyValue(direction, -4.0f), {direction.y * 4.0f, direction.z * 4.0f, direction.x * 4.0f})), 1.0f);
+  }
+
+  delete cube;
+}
+
+/**
+ * @brief Uma luz dentro de um objeto deve ter todos os texels das 6 faces cobertos, inclusive as bordas
+ */
+TEST(ShadowTest, enclosing_caster_covers_every_texel)
+{
+  models::Mesh *cube = shapes::cube({0, 0, 0});
+
+  models::ShadowCubeMap map;
+  models::BuildShadowCubeMap(map, omni_light({0, 0, 0}, 0.0f), {cube}, 64);
+
+  for (int face = 0; face < SHADOW_FACES; face++)
+    for (int x = 0; x < map.size; x++)
+      for (int y = 0; y < map.size; y++)
+      {
+        EXPECT_TRUE(std::isfinite(map.faces[face][x][y])) << "face " << face << " em (" << x << ", " << y << ")";
+      }
+
+  // Direções que caem na última linha ou coluna de uma face: sombra
+  EXPECT_FLOAT_EQ(models::SampleShadowCubeMap(map, {5.0f, 4.99f, 4.99f}), 0.0f);
+  EXPECT_FLOAT_EQ(models::SampleShadowCubeMap(map, {-4.99f, -4.99f, -5.0f}), 0.0f);
+
+  delete cube;
+}
+
+/**
+ * @brief Apenas os objetos que alcançam a esfera de influência da luz projetam sombra
+ */
+TEST(ShadowTest, casters_inside_radius)
+{
+  std::vector<models::Mesh *> objects = {shapes::cube({0, 0, 0}), shapes::cube({20, 0, 0})};
+
+  std::vector<models::Mesh *> casters = models::ShadowCasters(omni_light({0, 4, 0}, 5.0f), objects);
+  ASSERT_EQ(casters.size(), 1u);
+  EXPECT_EQ(casters[0], objects[0]);
+
+  // Sem raio, todos os objetos projetam sombra
+  EXPECT_EQ(models::ShadowCasters(omni_light({0, 4, 0}, 0.0f), objects).size(), 2u);
+
+  for (auto object : objects)
+    delete object;
+}
+
+/**
+ * @brief O mapa só deve ser refeito quando a luz ou um objeto dentro do seu raio muda
+ */
+TEST(ShadowTest, shadow_map_cache)
+{
+  models::Scene *scene = new models::Scene(
+      models::CreateCamera3D({10, 10, 20}, {0, 0, 0}, {0, 1, 0}, 30, 5, 60),
+      {shapes::cube({0, 0, 0}), shapes::cube({30, 0, 0})},
+      {0, 0},
+      {159, 119},
+      {-3, -3},
+      {3, 3});
+
+  scene->shadows = true;
+  scene->omni_lights[0].position = {0, 5, 0};
+  scene->omni_lights[0].radius = 10.0f;
+  scene->adair_pipeline();
+
+  std::shared_ptr<const models::ShadowCubeMap> map = scene->getShadowMap(0);
+  ASSERT_NE(map, nullptr);
+
+  // Nada mudou: o mesmo mapa é reaproveitado, mesmo com a câmera em movimento
+  scene->getCamera()->position = {12, 8, 18};
+  scene->adair_pipeline();
+  EXPECT_EQ(scene->getShadowMap(0), map);
+
+  // Um objeto fora do raio da luz mudou: o mapa continua válido
+  scene->setSelectedObject(scene->getObjects()[1]);
+  scene->rotateObject({0, 1, 0}, 0.5f);
+  scene->adair_pipeline();
+  EXPECT_EQ(scene->getShadowMap(0), map);
+
+  // Um objeto dentro do raio mudou: o mapa é refeito
+  scene->setSelectedObject(scene->getObjects()[0]);
+  scene->rotateObject({0, 1, 0}, 0.5f);
+  scene->adair_pipeline();
+  EXPECT_NE(scene->getShadowMap(0), map);
+
+  // A luz se moveu: o mapa é refeito
+  map = scene->getShadowMap(0);
+  scene->omni_lights[0].position = {1, 5, 0};
+  scene->adair_pipeline();
+  EXPECT_NE(scene->getShadowMap(0), map);
+
+  // Sombras desligadas: os mapas são descartados
+  scene->shadows = false;
+  scene->adair_pipeline();
+  EXPECT_EQ(scene->getShadowMap(0), nullptr);
+
+  delete scene;
+}
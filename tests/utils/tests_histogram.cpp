@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+#include <utils/histogram.hpp>
+
+#include <cmath>
+
+/**
+ * @brief Os percentis ficam dentro do erro relativo dos baldes, e os extremos são exatos
+ */
+TEST(HistogramTest, percentiles)
+{
+  utils::Histogram histogram;
+
+  EXPECT_DOUBLE_EQ(utils::HistogramPercentile(histogram, 50.0), 0.0);
+
+  // 1 a 10000 (µs em ms): a ordem de inserção não importa
+  for (int i = 10000; i >= 1; i--)
+    utils::HistogramAdd(histogram, static_cast<double>(i) / 1000.0);
+
+  EXPECT_EQ(histogram.total, 10000u);
+
+  for (double percentile : {1.0, 10.0, 50.0, 90.0, 99.0, 99.9})
+  {
+    double expected = percentile * 100.0 / 1000.0;
+    EXPECT_NEAR(utils::HistogramPercentile(histogram, percentile), expected, expected / HISTOGRAM_SUB_BUCKETS) << "p" << percentile;
+  }
+
+  EXPECT_DOUBLE_EQ(utils::HistogramPercentile(histogram, 0.0), 0.001);
+  EXPECT_DOUBLE_EQ(utils::HistogramPercentile(histogram, 100.0), 10.0);
+
+  utils::HistogramReset(histogram);
+  EXPECT_EQ(histogram.total, 0u);
+}
+
+/**
+ * @brief Valores fora do alcance ficam nos baldes das pontas, sem perder a contagem
+ */
+TEST(HistogramTest, out_of_range)
+{
+  utils::Histogram histogram;
+
+  utils::HistogramAdd(histogram, 0.0);
+  utils::HistogramAdd(histogram, -1.0);
+  utils::HistogramAdd(histogram, std::ldexp(HISTOGRAM_MIN_VALUE, HISTOGRAM_OCTAVES + 4));
+
+  EXPECT_EQ(histogram.total, 3u);
+  EXPECT_DOUBLE_EQ(histogram.min, -1.0);
+  EXPECT_LT(utils::HistogramPercentile(histogram, 50.0), 2.0 * HISTOGRAM_MIN_VALUE);
+  EXPECT_DOUBLE_EQ(utils::HistogramPercentile(histogram, 100.0), histogram.max);
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <utils/image.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Lê todos os bytes de um arquivo
+ */
+static std::string read_file(const std::string &file_path)
+{
+  std::ifstream file(file_path, std::ios::binary);
+
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/**
+ * @brief Buffer de cores 3x2 indexado por [x][y]
+ */
+static std::vector<std::vector<models::Color>> small_buffer()
+{
+  std::vector<std::vector<models::Color>> buffer(3, std::vector<models::Color>(2, models::TRANSPARENT));
+
+  buffer[0][0] = {255, 0, 0, 255};
+  buffer[2][1] = {10, 20, 30, 255};
+
+  return buffer;
+}
+
+/**
+ * @brief O PPM tem o cabeçalho P6 e os pixels em ordem de linha, começando pela linha de cima
+ */
+TEST(ImageTest, write_ppm)
+{
+  std::string file_path = testing::TempDir() + "mrx_image_test.ppm";
+  ASSERT_TRUE(utils::WriteImage(file_path, small_buffer()));
+
+  std::string data = read_file(file_path);
+  std::string header = "P6\n3 2\n255\n";
+
+  ASSERT_EQ(data.size(), header.size() + 3 * 2 * 3);
+  EXPECT_EQ(data.substr(0, header.size()), header);
+
+  // Primeiro pixel (0, 0) e último pixel (2, 1)
+  EXPECT_EQ(data.substr(header.size(), 3), std::string("\xFF\x00\x00", 3));
+  EXPECT_EQ(data.substr(data.size() - 3), std::string("\x0A\x14\x1E", 3));
+}
+
+/**
+ * @brief O PNG tem a assinatura, o cabeçalho IHDR com a resolução e termina no bloco IEND
+ */
+TEST(ImageTest, write_png)
+{
+  std::string file_path = testing::TempDir() + "mrx_image_test.png";
+  ASSERT_TRUE(utils::WriteImage(file_path, small_buffer()));
+
+  std::string data = read_file(file_path);
+
+  ASSERT_GT(data.size(), 33u);
+  EXPECT_EQ(data.substr(0, 8), std::string("\x89PNG\r\n\x1A\n", 8));
+  EXPECT_EQ(data.substr(12, 4), "IHDR");
+  EXPECT_EQ(data.substr(16, 8), std::string("\x00\x00\x00\x03\x00\x00\x00\x02", 8));
+  EXPECT_EQ(data.substr(data.size() - 8, 4), "IEND");
+
+  // Extensão desconhecida
+  EXPECT_FALSE(utils::WriteImage(testing::TempDir() + "mrx_image_test.bmp", small_buffer()));
+}
+
+/**
+ * @brief O PPM escrito é lido de volta com os mesmos pixels, e a comparação conta apenas os pixels
+ * acima da tolerância
+ */
+TEST(ImageTest, read_and_compare_ppm)
+{
+  std::string file_path = testing::TempDir() + "mrx_image_read.ppm";
+  ASSERT_TRUE(utils::WritePPM(file_path, small_buffer()));
+
+  std::vector<std::vector<models::Color>> image;
+  ASSERT_TRUE(utils::ReadPPM(file_path, image));
+  ASSERT_EQ(image.size(), 3u);
+  ASSERT_EQ(image[0].size(), 2u);
+
+  EXPECT_TRUE(models::CompareColors(image[0][0], models::Color{255, 0, 0, 255}));
+  EXPECT_TRUE(models::CompareColors(image[2][1], models::Color{10, 20, 30, 255}));
+
+  // Pixels transparentes são escritos como preto, então a imagem lida é igual ao buffer original
+  utils::ImageDifference difference = utils::CompareImages(image, small_buffer(), 0);
+  EXPECT_TRUE(difference.same_size);
+  EXPECT_EQ(difference.mismatched, 0u);
+
+  // Um pixel dentro da tolerância e outro fora dela
+  image[1][0].g = 5;
+  image[1][1].b = 40;
+  difference = utils::CompareImages(image, small_buffer(), 8);
+  EXPECT_EQ(difference.max_error, 40);
+  EXPECT_EQ(difference.mismatched, 1u);
+  EXPECT_DOUBLE_EQ(difference.mismatch_percent, 100.0 / 6.0);
+
+  // Resoluções diferentes
+  image.pop_back();
+  EXPECT_FALSE(utils::CompareImages(image, small_buffer(), 8).same_size);
+
+  // Arquivo que não é um PPM
+  EXPECT_FALSE(utils::ReadPPM(testing::TempDir() + "mrx_image_test.png", image));
+}
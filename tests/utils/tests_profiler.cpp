@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <utils/profiler.hpp>
+#include <utils/thread_pool.hpp>
+#include <models/scene.hpp>
+#include <shapes/shapes.hpp>
+#include <thread>
+
+#include "../fixtures.hpp"
+
+/**
+ * @brief O cronômetro soma o tempo ao seu estágio e a coleta zera os acumuladores
+ */
+TEST(ProfilerTest, scope_and_collect)
+{
+  utils::ProfilerCollect();
+
+  {
+    utils::ProfileScope scope(PROFILE_RASTER);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+
+  utils::ProfilerAddCount(PROFILE_PIXELS_SHADED, 10);
+  utils::ProfilerAddCount(PROFILE_PIXELS_SHADED, 5);
+
+  utils::ProfileFrame frame = utils::ProfilerCollect();
+
+  EXPECT_GE(utils::ProfileStageMilliseconds(frame, PROFILE_RASTER), 2.0f);
+  EXPECT_EQ(frame.calls[PROFILE_RASTER], 1u);
+  EXPECT_EQ(frame.time[PROFILE_CLIP], 0u);
+  EXPECT_EQ(frame.counters[PROFILE_PIXELS_SHADED], 15u);
+
+  frame = utils::ProfilerCollect();
+  EXPECT_EQ(frame.time[PROFILE_RASTER], 0u);
+  EXPECT_EQ(frame.counters[PROFILE_PIXELS_SHADED], 0u);
+}
+
+/**
+ * @brief Os contadores somados em várias threads não perdem incrementos
+ */
+TEST(ProfilerTest, counters_across_threads)
+{
+  utils::ProfilerCollect();
+
+  utils::ThreadPool pool(4);
+  pool.parallel_for(1000, 10, [](size_t begin, size_t end)
+                    { utils::ProfilerAddCount(PROFILE_FACES_SUBMITTED, end - begin); });
+
+  EXPECT_EQ(utils::ProfilerCollect().counters[PROFILE_FACES_SUBMITTED], 1000u);
+}
+
+#ifdef MRX_PROFILE
+/**
+ * @brief Um quadro da cena preenche os estágios e os contadores de forma coerente
+ */
+TEST(ProfilerTest, pipeline_counters)
+{
+  for (int pipeline_model : {SANTA_CATARINA_PIPELINE, SMITH_PIPELINE})
+  {
+    models::Scene *scene = small_scene();
+    scene->pipeline_model = pipeline_model;
+
+    utils::ProfilerCollect();
+    scene->pipeline();
+    utils::ProfileFrame frame = utils::ProfilerCollect();
+
+    EXPECT_GT(frame.calls[PROFILE_RASTER], 0u) << "pipeline " << pipeline_model;
+    EXPECT_GT(frame.calls[PROFILE_CLIP], 0u) << "pipeline " << pipeline_model;
+
+    // Dois cubos de 12 triângulos, pelo menos metade das faces ocultada
+    EXPECT_EQ(frame.counters[PROFILE_FACES_SUBMITTED], 24u) << "pipeline " << pipeline_model;
+    EXPECT_GE(frame.counters[PROFILE_FACES_CULLED], 12u) << "pipeline " << pipeline_model;
+
+    // Todo pixel testado passa ou é rejeitado
+    EXPECT_GT(frame.counters[PROFILE_PIXELS_SHADED], 0u) << "pipeline " << pipeline_model;
+    EXPECT_EQ(frame.calls[PROFILE_DEPTH_TEST], frame.counters[PROFILE_PIXELS_SHADED] + frame.counters[PROFILE_PIXELS_REJECTED]) << "pipeline " << pipeline_model;
+
+    delete scene;
+  }
+}
+#endif
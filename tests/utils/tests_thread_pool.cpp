@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <utils/thread_pool.hpp>
+#include <models/scene.hpp>
+#include <shapes/shapes.hpp>
+#include <vector>
+
+/**
+ * @brief Cada índice do intervalo deve ser processado exatamente uma vez
+ *
+ */
+TEST(ThreadPoolTest, parallel_for_covers_range)
+{
+  for (unsigned int threads : {1u, 2u, 4u, 7u})
+  {
+    utils::ThreadPool pool(threads);
+    std::vector<int> hits(10007, 0);
+
+    pool.parallel_for(hits.size(), 64, [&](size_t begin, size_t end)
+                      {
+      for (size_t i = begin; i < end; i++)
+        hits[i]++; });
+
+    for (size_t i = 0; i < hits.size(); i++)
+      EXPECT_EQ(hits[i], 1) << "threads = " << threads << ", i = " << i;
+  }
+}
+
+/**
+ * @brief O estágio de geometria deve produzir o mesmo resultado para qualquer quantidade de threads
+ *
+ */
+TEST(ThreadPoolTest, geometry_stage_is_deterministic)
+{
+  auto render = [](unsigned int threads)
+  {
+    models::Scene *scene = new models::Scene(
+        models::CreateCamera3D({10, 10, 20}, {0, 0, 0}, {0, 1, 0}, 30, 5, 60),
+        {shapes::icosphere(3.0f, 4), shapes::cube({2, 0, 0})},
+        {0, 0},
+        {159, 119},
+        {-3, -3},
+        {3, 3});
+
+    scene->setSelectedObject(scene->getObjects()[1]);
+    scene->setWorkerThreads(threads);
+    scene->lighting_model = GOURAUD_SHADING;
+    scene->adair_pipeline();
+
+    std::vector<float> result;
+
+    for (auto object : scene->getObjects())
+    {
+      for (auto vertex : object->getVertices())
+      {
+        core::Vector3 screen = vertex->getVectorScreen();
+        core::Vector3 normal = vertex->getNormal();
+        result.insert(result.end(), {screen.x, screen.y, screen.z, normal.x, normal.y, normal.z});
+      }
+
+      for (auto face : object->getFaces())
+        result.push_back(face->getVisible() ? 1.0f : 0.0f);
+    }
+
+    // A geometria do quadro é montada em blocos paralelos, a imagem também não pode mudar
+    for (const auto &column : scene->getFrontBuffer().color_buffer)
+      for (auto color : column)
+        result.insert(result.end(), {static_cast<float>(color.r), static_cast<float>(color.g), static_cast<float>(color.b), static_cast<float>(color.a)});
+
+    delete scene;
+
+    return result;
+  };
+
+  std::vector<float> expected = render(1);
+
+  for (unsigned int threads : {2u, 3u, 8u})
+  {
+    std::vector<float> result = render(threads);
+
+    ASSERT_EQ(result.size(), expected.size());
+    for (size_t i = 0; i < result.size(); i++)
+      ASSERT_EQ(result[i], expected[i]) << "threads = " << threads << ", i = " << i;
+  }
+}
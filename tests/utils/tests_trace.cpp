@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <utils/trace.hpp>
+#include <utils/profiler.hpp>
+
+#include <thread>
+#include <set>
+
+/**
+ * @brief Os eventos só são gravados com a gravação ligada e saem do mais antigo para o mais recente
+ */
+TEST(TraceTest, scope_records_only_while_enabled)
+{
+  utils::TraceStop();
+  {
+    utils::TraceScope scope("ignored", TRACE_FRAME);
+  }
+
+  utils::TraceStart(16);
+  {
+    utils::TraceScope outer("outer", TRACE_FRAME);
+    utils::TraceScope inner("inner", TRACE_PIPELINE);
+  }
+  utils::TraceStop();
+
+  // Depois de parar, nada mais é gravado
+  {
+    utils::TraceScope scope("ignored", TRACE_FRAME);
+  }
+
+  std::vector<utils::TraceEvent> events = utils::TraceEvents();
+
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_STREQ(events[0].name, "inner");
+  EXPECT_STREQ(events[1].name, "outer");
+  EXPECT_STREQ(events[0].category, TRACE_PIPELINE);
+
+  // O escopo interno está contido no externo
+  EXPECT_GE(events[0].start, events[1].start);
+  EXPECT_LE(events[0].start + events[0].duration, events[1].start + events[1].duration);
+}
+
+/**
+ * @brief O buffer circular guarda apenas os eventos mais recentes e conta os descartados
+ */
+TEST(TraceTest, ring_buffer_is_bounded)
+{
+  static const char *names[] = {"e0", "e1", "e2", "e3", "e4", "e5", "e6", "e7", "e8", "e9"};
+
+  utils::TraceStart(4);
+
+  for (const char *name : names)
+  {
+    auto now = std::chrono::steady_clock::now();
+    utils::TraceRecord(name, TRACE_IO, now, now);
+  }
+
+  utils::TraceStop();
+
+  std::vector<utils::TraceEvent> events = utils::TraceEvents();
+
+  ASSERT_EQ(events.size(), 4u);
+  EXPECT_STREQ(events[0].name, "e6");
+  EXPECT_STREQ(events[3].name, "e9");
+  EXPECT_EQ(utils::TraceDropped(), 6u);
+}
+
+/**
+ * @brief Cada thread tem o seu identificador e o JSON segue o formato de eventos do Chrome
+ */
+TEST(TraceTest, chrome_json)
+{
+  utils::TraceStart(64);
+
+  {
+    utils::TraceScope scope("main", TRACE_FRAME);
+  }
+
+  std::thread worker([]
+                     {
+                       utils::TraceThreadName("test-worker");
+                       utils::TraceScope scope("task", TRACE_WORKER); });
+  worker.join();
+
+  utils::TraceStop();
+
+  std::vector<utils::TraceEvent> events = utils::TraceEvents();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_NE(events[0].thread, events[1].thread);
+
+  nlohmann::json trace = utils::TraceToJson();
+
+  ASSERT_TRUE(trace["traceEvents"].is_array());
+  EXPECT_EQ(trace["otherData"]["dropped_events"], 0);
+
+  std::set<std::string> names;
+  bool worker_named = false;
+
+  for (const auto &event : trace["traceEvents"])
+  {
+    if (event["ph"] == "M")
+    {
+      worker_named |= event["args"]["name"] == "test-worker";
+      continue;
+    }
+
+    EXPECT_EQ(event["ph"], "X");
+    EXPECT_TRUE(event["ts"].is_number());
+    EXPECT_TRUE(event["dur"].is_number());
+    names.insert(event["name"].get<std::string>());
+  }
+
+  EXPECT_TRUE(worker_named);
+  EXPECT_EQ(names, (std::set<std::string>{"main", "task"}));
+}
+
+#ifdef MRX_PROFILE
+/**
+ * @brief Os estágios medidos pelo profiler também viram eventos da linha do tempo
+ */
+TEST(TraceTest, profile_scopes_become_events)
+{
+  utils::TraceStart(16);
+  {
+    MRX_PROFILE_SCOPE(PROFILE_RASTER);
+  }
+  utils::TraceStop();
+  utils::ProfilerCollect();
+
+  std::vector<utils::TraceEvent> events = utils::TraceEvents();
+
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_STREQ(events[0].name, utils::ProfileStageName(PROFILE_RASTER));
+  EXPECT_STREQ(events[0].category, TRACE_PIPELINE);
+}
+#endif
@@ -0,0 +1,343 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cxxopts.hpp>
+
+#include <models/camera.hpp>
+#include <models/scene.hpp>
+#include <models/batch.hpp>
+#include <models/benchmark.hpp>
+#include <models/recorder.hpp>
+#include <math/dispatch.hpp>
+#include <utils/profiler.hpp>
+#include <utils/trace.hpp>
+
+#include <shapes/shapes.hpp>
+
+#include <filesystem>
+
+/**
+ * @brief Cria a cena padrão do benchmark
+ *
+ * @return models::Scene* Cena com uma grade de objetos em torno do ponto (0, 0, -30)
+ *
+ * @note A câmera começa sobre o eixo z, olhando para -z, e o alvo anda junto com ela na aproximação,
+ * então a câmera chega exatamente à origem com o alvo no centro da grade, dá a volta em torno dos
+ * objetos e depois os atravessa até BENCHMARK_END_Z
+ */
+static models::Scene *BenchmarkScene()
+{
+  core::Vector3 center = {0.0f, 0.0f, -30.0f};
+
+  std::vector<models::Mesh *> objects = {
+      shapes::icosphere(2.5f, 3, {center.x - 6.0f, center.y, center.z - 6.0f}),
+      shapes::torus(2.5f, 0.8f, 32, 16, {center.x, center.y, center.z - 6.0f}),
+      shapes::cone(2.0f, 4.0f, 32, {center.x + 6.0f, center.y, center.z - 6.0f}),
+      shapes::cube({center.x - 6.0f, center.y, center.z}),
+      shapes::icosphere(3.0f, 4, center),
+      shapes::cylinder(2.0f, 4.0f, 32, {center.x + 6.0f, center.y, center.z}),
+      shapes::pyramid(4.0f, 4.0f, {center.x - 6.0f, center.y, center.z + 6.0f}),
+      shapes::torus(2.0f, 0.6f, 24, 12, {center.x, center.y, center.z + 6.0f}),
+      shapes::icosphere(2.0f, 2, {center.x + 6.0f, center.y, center.z + 6.0f})};
+
+  return new models::Scene(
+      models::CreateCamera3D({0.0f, 0.0f, 60.0f}, {0.0f, 0.0f, 30.0f}, {0.0f, 1.0f, 0.0f}, 12.0f, 1.0f, 300.0f),
+      objects,
+      {0.0f, 0.0f},
+      {959.0f, 539.0f},
+      {-4.0f, -2.25f},
+      {4.0f, 2.25f});
+}
+
+/**
+ * @brief Lê uma opção que aceita um nome ou "all"
+ *
+ * @param setting Configuração (ver models::ParseRenderSetting)
+ * @param value Texto informado
+ * @param names Todos os nomes da configuração
+ * @param result Valores escolhidos
+ *
+ * @return bool Verdadeiro se o valor é válido e falso caso contrário
+ */
+static bool ParseSettingList(const std::string &setting, const std::string &value, const std::vector<std::string> &names, std::vector<std::string> &result)
+{
+  int index;
+
+  if (value == "all")
+    result = names;
+  else if (models::ParseRenderSetting(setting, value, index))
+    result = {names[index]};
+  else
+    return false;
+
+  return true;
+}
+
+/**
+ * @brief Encerra a gravação da linha do tempo e escreve o arquivo pedido em --trace
+ *
+ * @param arguments Argumentos de linha de comando
+ *
+ * @return bool Verdadeiro se não havia gravação ou se o arquivo foi escrito e falso caso contrário
+ */
+static bool WriteTrace(const cxxopts::ParseResult &arguments)
+{
+  if (!arguments.count("trace"))
+    return true;
+
+  utils::TraceStop();
+
+  std::string path = arguments["trace"].as<std::string>();
+
+  if (!utils::TraceWrite(path))
+    return false;
+
+  std::cout << "Linha do tempo: " << utils::TraceEvents().size() << " eventos (" << utils::TraceDropped() << " descartados) -> " << path << std::endl;
+  return true;
+}
+
+/**
+ * @brief Liga a gravação da linha do tempo se --trace foi informado
+ *
+ * @param arguments Argumentos de linha de comando
+ */
+static void StartTrace(const cxxopts::ParseResult &arguments)
+{
+  if (!arguments.count("trace"))
+    return;
+
+#ifndef MRX_PROFILE
+  std::cerr << "Aviso: compilado sem MRX_PROFILE (xmake f --profile=n), a linha do tempo terá apenas os nomes das threads." << std::endl;
+#endif
+
+  utils::TraceStart(arguments["trace-capacity"].as<size_t>());
+}
+
+int main(int argc, char *argv[])
+{
+  // Argumentos de linha de comando
+  cxxopts::Options options("mrx-bench", "MRX - Benchmark determinístico do pipeline (sem janela)");
+
+  options.add_options()
+      ("s,scene", "Arquivo da cena (padrão: cena embutida)", cxxopts::value<std::string>())
+      ("o,output", "Diretório dos resultados", cxxopts::value<std::string>()->default_value("resultados"))
+      ("p,pipeline", "Pipeline: adair, smith ou all", cxxopts::value<std::string>()->default_value("all"))
+      ("l,lighting", "Modelo de iluminação: flat, gouraud, phong ou all", cxxopts::value<std::string>()->default_value("all"))
+      ("precision", "Precisão da iluminação: exact ou fast", cxxopts::value<std::string>()->default_value("exact"))
+      ("isa", "Variante dos kernels: baseline, sse4, avx2, avx512 ou auto (a maior suportada pelo processador)", cxxopts::value<std::string>()->default_value("auto"))
+      ("W,width", "Largura da imagem (padrão: largura da viewport da cena)", cxxopts::value<int>()->default_value("0"))
+      ("H,height", "Altura da imagem (padrão: altura da viewport da cena)", cxxopts::value<int>()->default_value("0"))
+      ("f,frames", "Quantidade de quadros medidos (0 = caminho completo da câmera)", cxxopts::value<int>()->default_value("0"))
+      ("w,warmup", "Quadros de aquecimento, renderizados e descartados antes de cada repetição", cxxopts::value<int>()->default_value("10"))
+      ("r,repetitions", "Quantidade de repetições de cada configuração", cxxopts::value<int>()->default_value("10"))
+      ("replay", "Troca o caminho da câmera pela entrada gravada na interface (Gravar entrada), reproduzida quadro a quadro com a cena e as configurações gravadas", cxxopts::value<std::string>())
+      ("shadows", "Liga as sombras das luzes omni")
+      ("no-frame-log", "Não guarda o tempo de cada quadro (sem a coluna frame_ms e os 10% piores quadros, os percentis continuam)")
+      ("t,threads", "Quantidade de threads do estágio de geometria (0 = quantidade de núcleos)", cxxopts::value<unsigned int>()->default_value("0"))
+      ("trace", "Grava a linha do tempo dos quadros neste arquivo (JSON de eventos do Chrome)", cxxopts::value<std::string>())
+      ("trace-capacity", "Quantidade máxima de eventos guardados na linha do tempo (os mais antigos são descartados)", cxxopts::value<size_t>()->default_value(std::to_string(TRACE_CAPACITY)))
+      ("h,help", "Mostra esta ajuda");
+
+  cxxopts::ParseResult arguments;
+
+  try
+  {
+    arguments = options.parse(argc, argv);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Erro ao ler os argumentos: " << e.what() << std::endl;
+    std::cout << options.help() << std::endl;
+    return -1;
+  }
+
+  if (arguments.count("help"))
+  {
+    std::cout << options.help() << std::endl;
+    return 0;
+  }
+
+  std::vector<std::string> pipelines, lightings;
+
+  if (!ParseSettingList("pipeline", arguments["pipeline"].as<std::string>(), {"adair", "smith"}, pipelines) ||
+      !ParseSettingList("lighting", arguments["lighting"].as<std::string>(), {"flat", "gouraud", "phong"}, lightings))
+    return -1;
+
+  int precision;
+
+  if (!models::ParseRenderSetting("precision", arguments["precision"].as<std::string>(), precision))
+    return -1;
+
+  std::string isa_name = arguments["isa"].as<std::string>();
+
+  if (isa_name != "auto")
+  {
+    int isa;
+
+    if (!math::ParseIsa(isa_name, isa))
+    {
+      std::cerr << "Erro: Variante '" << isa_name << "' inválida (use baseline, sse4, avx2, avx512 ou auto)." << std::endl;
+      return -1;
+    }
+
+    if (!math::SelectIsa(isa))
+    {
+      std::cerr << "Erro: A variante '" << isa_name << "' não é suportada pelo processador ou não foi compilada (maior disponível: " << math::IsaName(std::min(math::CpuIsa(), math::MaxIsa())) << ")." << std::endl;
+      return -1;
+    }
+  }
+
+  std::cout << "Kernels: " << math::IsaName(math::ActiveIsa()) << " (processador: " << math::IsaName(math::CpuIsa()) << ")" << std::endl;
+
+  std::string output = arguments["output"].as<std::string>();
+  int frames = arguments["frames"].as<int>();
+  int warmup = arguments["warmup"].as<int>();
+  int repetitions = arguments["repetitions"].as<int>();
+
+  // A reprodução traz as suas próprias configurações e viewport: uma única configuração, com o nome da gravação
+  bool replaying = arguments.count("replay") > 0;
+  models::Recording recording;
+
+  if (replaying)
+  {
+    std::string replay_path = arguments["replay"].as<std::string>();
+
+    if (!models::ReadRecording(replay_path, recording))
+      return -1;
+
+    pipelines = {"replay"};
+    lightings = {std::filesystem::path(replay_path).stem().string()};
+  }
+
+  StartTrace(arguments);
+
+  for (const std::string &pipeline : pipelines)
+    for (const std::string &lighting : lightings)
+      for (int repetition = 1; repetition <= repetitions; repetition++)
+      {
+        // Cada repetição começa da cena recém carregada, com a câmera no início do caminho
+        models::Scene *scene;
+
+        if (arguments.count("scene"))
+          scene = models::LoadScene(arguments["scene"].as<std::string>());
+        else if (replaying)
+          scene = models::SceneFromJson(json::parse(recording.scene, nullptr, false));
+        else
+          scene = BenchmarkScene();
+
+        if (scene == nullptr)
+        {
+          if (replaying && !arguments.count("scene"))
+            std::cerr << "Erro: A gravação não contém uma cena (use --scene)." << std::endl;
+
+          return -1;
+        }
+
+        // Na reprodução a viewport não muda: as translações gravadas estão em coordenadas de tela
+        if (!replaying)
+        {
+          models::RenderJob job;
+          job.width = arguments["width"].as<int>();
+          job.height = arguments["height"].as<int>();
+          job.shadows = arguments.count("shadows") > 0;
+          models::ParseRenderSetting("pipeline", pipeline, job.pipeline_model);
+          models::ParseRenderSetting("lighting", lighting, job.lighting_model);
+          job.precision = precision;
+
+          models::ApplyRenderJob(scene, job);
+        }
+
+        scene->setWorkerThreads(arguments["threads"].as<unsigned int>());
+
+        // Aquecimento: threads, caches e framebuffers já alocados antes da medição
+        for (int i = 0; i < warmup; i++)
+        {
+          scene->invalidate();
+          scene->pipeline();
+        }
+
+        models::Benchmark benchmark;
+        models::BenchmarkCamera path;
+        models::Camera3D *camera = scene->getCamera();
+        models::Replay replay;
+        int measured = 0;
+
+        if (replaying)
+          models::ReplayStart(replay, recording);
+
+        models::benchmark_start(&benchmark);
+        benchmark.keep_frame_times = arguments.count("no-frame-log") == 0;
+
+        // Descarta os tempos e contadores do aquecimento
+        utils::ProfilerCollect();
+
+        while (frames <= 0 || measured < frames)
+        {
+          MRX_TRACE_SCOPE("frame", TRACE_FRAME);
+
+          if (replaying)
+          {
+            if (!models::ReplayFrame(replay, scene))
+              break;
+
+            // Como na interface, um quadro em que nada mudou não é refeito
+            if (!scene->hasChanged())
+              continue;
+          }
+          else
+          {
+            if (path.finished)
+              break;
+
+            models::benchmark_camera_step(&path, camera);
+          }
+
+          measured++;
+
+          auto start = std::chrono::steady_clock::now();
+
+          models::FrameGeometry &frame = scene->nextFrameGeometry();
+          scene->geometry(frame);
+
+          auto geometry_end = std::chrono::steady_clock::now();
+
+          scene->rasterize(frame);
+          scene->swapBuffers();
+
+          auto end = std::chrono::steady_clock::now();
+
+          benchmark.geometry_times.push_back(std::chrono::duration<double, std::milli>(geometry_end - start).count());
+          benchmark.rasterization_times.push_back(std::chrono::duration<double, std::milli>(end - geometry_end).count());
+          models::benchmark_update(&benchmark, std::chrono::duration<double, std::milli>(end - start).count());
+
+#ifdef MRX_PROFILE
+          benchmark.profiles.push_back(utils::ProfilerCollect());
+#endif
+        }
+
+        models::benchmark_end(&benchmark);
+
+        std::string path_name = models::benchmark_results_path(output, pipeline, lighting, repetition);
+        std::string display_pipeline = replaying ? "Replay" : pipeline == "smith" ? "Smith" : "Adair";
+
+        bool written = models::benchmark_write_report(&benchmark, path_name + ".txt", display_pipeline, lighting, repetition) &&
+                       models::benchmark_write_json(&benchmark, path_name + ".json", display_pipeline, lighting, repetition) &&
+                       models::benchmark_write_csv(&benchmark, path_name + ".csv");
+
+        delete scene;
+
+        if (!written)
+          return -1;
+
+        std::cout << display_pipeline << " " << lighting << " #" << repetition << ": "
+                  << benchmark.total_frames << " quadros, " << benchmark.average_frame_time << " ms/quadro, "
+                  << benchmark.average_fps << " FPS -> " << path_name << std::endl;
+
+        if (replaying)
+          std::cout << "Reprodução: " << replay.frame << " de " << recording.frames << " quadros gravados (gravação: " << replay.timestamp << " ms)" << std::endl;
+      }
+
+  return WriteTrace(arguments) ? 0 : -1;
+}
@@ -0,0 +1,60 @@
+#include <iostream>
+#include <string>
+#include <cxxopts.hpp>
+
+#include <models/golden.hpp>
+#include <utils/image.hpp>
+
+#include <filesystem>
+
+int main(int argc, char *argv[])
+{
+  // Argumentos de linha de comando
+  cxxopts::Options options("mrx-golden", "MRX - Refaz as imagens de referência dos testes de regressão por imagem");
+
+  options.add_options()
+      ("o,output", "Diretório das imagens de referência", cxxopts::value<std::string>()->default_value(MRX_GOLDEN_DIRECTORY))
+      ("h,help", "Mostra esta ajuda");
+
+  cxxopts::ParseResult arguments;
+
+  try
+  {
+    arguments = options.parse(argc, argv);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Erro ao ler os argumentos: " << e.what() << std::endl;
+    std::cout << options.help() << std::endl;
+    return -1;
+  }
+
+  if (arguments.count("help"))
+  {
+    std::cout << options.help() << std::endl;
+    return 0;
+  }
+
+  std::string directory = arguments["output"].as<std::string>();
+  std::error_code error;
+  std::filesystem::create_directories(directory, error);
+
+  if (error)
+  {
+    std::cerr << "Erro: Não foi possível criar o diretório '" << directory << "': " << error.message() << std::endl;
+    return -1;
+  }
+
+  // Uma imagem por combinação de pipeline e modelo de iluminação
+  for (const models::GoldenCase &golden_case : models::GoldenCases())
+  {
+    std::string path = models::GoldenReferencePath(directory, golden_case);
+
+    if (!utils::WritePPM(path, models::RenderGolden(golden_case)))
+      return -1;
+
+    std::cout << path << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,227 @@
+#include <iostream>
+#include <sstream>
+#include <chrono>
+#include <string>
+#include <algorithm>
+#include <filesystem>
+#include <cxxopts.hpp>
+
+#include <models/camera.hpp>
+#include <models/scene.hpp>
+#include <models/batch.hpp>
+
+#include <utils/file.hpp>
+#include <utils/image.hpp>
+#include <utils/trace.hpp>
+
+/**
+ * @brief Renderiza os trabalhos de um manifesto
+ *
+ * @param manifest_path Arquivo do manifesto
+ * @param threads Quantidade de trabalhos renderizados ao mesmo tempo (0 = quantidade de núcleos)
+ * @param overwrite Se verdadeiro, refaz também os quadros cuja imagem já existe
+ *
+ * @return int 0 se todos os quadros foram renderizados e -1 caso contrário
+ */
+static int RenderBatch(const std::string &manifest_path, unsigned int threads, bool overwrite)
+{
+  std::vector<models::RenderJob> jobs;
+
+  if (!models::LoadRenderJobs(utils::load_json(manifest_path), std::filesystem::path(manifest_path).parent_path().string(), jobs))
+    return -1;
+
+  auto start = std::chrono::steady_clock::now();
+  int failures = models::RunRenderJobs(jobs, threads, overwrite);
+  float total_time = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << jobs.size() << " trabalho(s) em " << total_time << " s, " << failures << " quadro(s) com falha" << std::endl;
+
+  return failures == 0 ? 0 : -1;
+}
+
+/**
+ * @brief Lê um vetor no formato "x,y,z"
+ *
+ * @param text Texto com as três coordenadas separadas por vírgula
+ * @param vector Vetor lido
+ *
+ * @return bool Verdadeiro se o texto é um vetor válido e falso caso contrário
+ */
+static bool ParseVector3(const std::string &text, core::Vector3 &vector)
+{
+  std::stringstream stream(text);
+  char separator_a = 0, separator_b = 0;
+
+  stream >> vector.x >> separator_a >> vector.y >> separator_b >> vector.z;
+
+  return !stream.fail() && separator_a == ',' && separator_b == ',' && stream.eof();
+}
+
+/**
+ * @brief Encerra a gravação da linha do tempo e escreve o arquivo pedido em --trace
+ *
+ * @param arguments Argumentos de linha de comando
+ *
+ * @return bool Verdadeiro se não havia gravação ou se o arquivo foi escrito e falso caso contrário
+ */
+static bool WriteTrace(const cxxopts::ParseResult &arguments)
+{
+  if (!arguments.count("trace"))
+    return true;
+
+  utils::TraceStop();
+
+  std::string path = arguments["trace"].as<std::string>();
+
+  if (!utils::TraceWrite(path))
+    return false;
+
+  std::cout << "Linha do tempo: " << utils::TraceEvents().size() << " eventos (" << utils::TraceDropped() << " descartados) -> " << path << std::endl;
+  return true;
+}
+
+/**
+ * @brief Liga a gravação da linha do tempo se --trace foi informado
+ *
+ * @param arguments Argumentos de linha de comando
+ */
+static void StartTrace(const cxxopts::ParseResult &arguments)
+{
+  if (!arguments.count("trace"))
+    return;
+
+#ifndef MRX_PROFILE
+  std::cerr << "Aviso: compilado sem MRX_PROFILE (xmake f --profile=n), a linha do tempo terá apenas os nomes das threads." << std::endl;
+#endif
+
+  utils::TraceStart(arguments["trace-capacity"].as<size_t>());
+}
+
+int main(int argc, char *argv[])
+{
+  // Argumentos de linha de comando
+  cxxopts::Options options("mrx-render", "MRX - Renderizador de linha de comando (sem janela)");
+
+  options.add_options()
+      ("s,scene", "Arquivo da cena (formato salvo pela interface)", cxxopts::value<std::string>()->default_value("scene.json"))
+      ("o,output", "Imagem de saída (.ppm ou .png)", cxxopts::value<std::string>()->default_value("render.ppm"))
+      ("p,pipeline", "Pipeline: adair ou smith (padrão: o da cena)", cxxopts::value<std::string>())
+      ("l,lighting", "Modelo de iluminação: flat, gouraud ou phong (padrão: o da cena)", cxxopts::value<std::string>())
+      ("normal", "Algoritmo do vetor normal: foley ou conci (padrão: o da cena)", cxxopts::value<std::string>())
+      ("centroid", "Algoritmo do centroide: mean ou box (padrão: o da cena)", cxxopts::value<std::string>())
+      ("precision", "Precisão da iluminação: exact ou fast (padrão: a da cena)", cxxopts::value<std::string>())
+      ("W,width", "Largura da imagem (padrão: largura da viewport da cena)", cxxopts::value<int>())
+      ("H,height", "Altura da imagem (padrão: altura da viewport da cena)", cxxopts::value<int>())
+      ("camera-position", "Posição da câmera (x,y,z)", cxxopts::value<std::string>())
+      ("camera-target", "Alvo da câmera (x,y,z)", cxxopts::value<std::string>())
+      ("camera-up", "Vetor up da câmera (x,y,z)", cxxopts::value<std::string>())
+      ("camera-d", "Distância da câmera ao plano de projeção", cxxopts::value<float>())
+      ("f,frames", "Quantidade de quadros renderizados (cada um refeito por inteiro)", cxxopts::value<int>()->default_value("1"))
+      ("shadows", "Liga as sombras das luzes omni")
+      ("t,threads", "Quantidade de threads do estágio de geometria (0 = quantidade de núcleos)", cxxopts::value<unsigned int>()->default_value("0"))
+      ("b,batch", "Manifesto de renderização em lote (ignora as opções da cena única)", cxxopts::value<std::string>())
+      ("j,jobs", "Quantidade de trabalhos do lote renderizados ao mesmo tempo (0 = quantidade de núcleos)", cxxopts::value<unsigned int>()->default_value("0"))
+      ("overwrite", "Refaz os quadros do lote cuja imagem já existe")
+      ("trace", "Grava a linha do tempo dos quadros neste arquivo (JSON de eventos do Chrome)", cxxopts::value<std::string>())
+      ("trace-capacity", "Quantidade máxima de eventos guardados na linha do tempo (os mais antigos são descartados)", cxxopts::value<size_t>()->default_value(std::to_string(TRACE_CAPACITY)))
+      ("h,help", "Mostra esta ajuda");
+
+  cxxopts::ParseResult arguments;
+
+  try
+  {
+    arguments = options.parse(argc, argv);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Erro ao ler os argumentos: " << e.what() << std::endl;
+    std::cout << options.help() << std::endl;
+    return -1;
+  }
+
+  if (arguments.count("help"))
+  {
+    std::cout << options.help() << std::endl;
+    return 0;
+  }
+
+  StartTrace(arguments);
+
+  if (arguments.count("batch"))
+  {
+    int result = RenderBatch(arguments["batch"].as<std::string>(), arguments["jobs"].as<unsigned int>(), arguments.count("overwrite") > 0);
+    return WriteTrace(arguments) ? result : -1;
+  }
+
+  // Configurações
+  models::RenderJob job;
+
+  job.scene = arguments["scene"].as<std::string>();
+  job.width = arguments.count("width") ? arguments["width"].as<int>() : 0;
+  job.height = arguments.count("height") ? arguments["height"].as<int>() : 0;
+  job.shadows = arguments.count("shadows") > 0;
+
+  for (auto [setting, value] : {std::make_pair("pipeline", &job.pipeline_model), std::make_pair("lighting", &job.lighting_model), std::make_pair("normal", &job.normal_algorithm), std::make_pair("centroid", &job.centroid_algorithm), std::make_pair("precision", &job.precision)})
+  {
+    if (arguments.count(setting) && !models::ParseRenderSetting(setting, arguments[setting].as<std::string>(), *value))
+      return -1;
+  }
+
+  if ((arguments.count("width") && job.width <= 0) || (arguments.count("height") && job.height <= 0))
+  {
+    std::cerr << "Erro: Resolução inválida (" << job.width << "x" << job.height << ")." << std::endl;
+    return -1;
+  }
+
+  // Carrega a cena
+  models::Scene *scene = models::LoadScene(job.scene);
+
+  if (scene == nullptr)
+    return -1;
+
+  models::ApplyRenderJob(scene, job);
+  scene->setWorkerThreads(arguments["threads"].as<unsigned int>());
+
+  int width = static_cast<int>(scene->getMaxViewport().x) + 1;
+  int height = static_cast<int>(scene->getMaxViewport().y) + 1;
+
+  // Câmera
+  models::Camera3D *camera = scene->getCamera();
+
+  for (auto [option, vector] : {std::make_pair("camera-position", &camera->position), std::make_pair("camera-target", &camera->target), std::make_pair("camera-up", &camera->up)})
+  {
+    if (arguments.count(option) && !ParseVector3(arguments[option].as<std::string>(), *vector))
+    {
+      std::cerr << "Erro: Vetor '" << arguments[option].as<std::string>() << "' inválido para --" << option << " (use x,y,z)." << std::endl;
+      return -1;
+    }
+  }
+
+  if (arguments.count("camera-d"))
+    camera->d = arguments["camera-d"].as<float>();
+
+  // Renderiza os quadros
+  int frames = std::max(1, arguments["frames"].as<int>());
+  float total_time = 0.0f;
+
+  for (int i = 0; i < frames; i++)
+  {
+    MRX_TRACE_SCOPE("frame", TRACE_FRAME);
+    scene->invalidate();
+
+    auto start = std::chrono::steady_clock::now();
+    scene->pipeline();
+    total_time += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  float average_time = total_time / static_cast<float>(frames);
+
+  std::cout << width << "x" << height << ", " << frames << " quadro(s): "
+            << average_time << " ms/quadro, " << (average_time > 0.0f ? 1000.0f / average_time : 0.0f) << " FPS" << std::endl;
+
+  bool written = utils::WriteImage(arguments["output"].as<std::string>(), scene->getDisplayBuffer().color_buffer);
+
+  delete scene;
+
+  return WriteTrace(arguments) && written ? 0 : -1;
+}
@@ -19,12 +19,40 @@ set_optimize("fastest")
 
 add_includedirs("include")
 
+-- per-stage profiling timers and counters (disable with: xmake f --profile=n)
+option("profile")
+  set_default(true)
+  set_showmenu(true)
+  set_description("Enable the per-stage profiling timers and counters (MRX_PROFILE)")
+  add_defines("MRX_PROFILE")
+option_end()
+
+-- SSE/AVX/NEON paths of the math vector and matrix functions (enable with: xmake f --simd=y)
+option("simd")
+  set_default(false)
+  set_showmenu(true)
+  set_description("Use SSE/AVX (x86) or NEON (AArch64) in the math vector and matrix functions (MRX_SIMD)")
+  add_defines("MRX_SIMD")
+  -- the SIMD paths match the scalar code bit for bit only if multiply-adds are not fused
+  add_cxflags("-ffp-contract=off", { tools = { "clang", "gcc" } })
+option_end()
+
+add_options("profile", "simd")
+
+-- the AVX2/AVX-512 variants of the kernels (include/math/dispatch.hpp) give the same results as the
+-- baseline only if multiply-adds are not fused
+if is_arch("x86_64", "i386") and not is_plat("windows") then
+  add_cxflags("-ffp-contract=off")
+end
+
 -- add libraries
 local project_libs = { "cxxopts", "fmt", "opengl", "libsdl" }
 local test_libs = { "gtest" }
+local bench_libs = { "benchmark" }
 
 add_requires(table.unpack(project_libs))
 add_requires(table.unpack(test_libs))
+add_requires(table.unpack(bench_libs))
 
 -- librarys
 target("core")
@@ -91,10 +119,51 @@ target("app")
   add_deps("utils")
   set_targetdir("./app")
 
+-- headless renderer (no window): renders a saved scene to PPM/PNG files
+target("mrx-render")
+  set_kind("binary")
+  add_files("tools/render/*.cpp")
+  add_packages(table.unpack(project_libs))
+  add_deps("core")
+  add_deps("math")
+  add_deps("models")
+  add_deps("gui/imgui")
+  add_deps("shapes")
+  add_deps("utils")
+  set_targetdir("./app")
+
+-- headless benchmark: fixed camera path, warm-up and repetitions, results in resultados/
+target("mrx-bench")
+  set_kind("binary")
+  add_files("tools/bench/*.cpp")
+  add_packages(table.unpack(project_libs))
+  add_deps("core")
+  add_deps("math")
+  add_deps("models")
+  add_deps("gui/imgui")
+  add_deps("shapes")
+  add_deps("utils")
+  set_targetdir("./app")
+
+-- regenerates the reference images of the golden-image tests (tests/golden)
+target("mrx-golden")
+  set_kind("binary")
+  add_files("tools/golden/*.cpp")
+  add_defines("MRX_GOLDEN_DIRECTORY=\"$(projectdir)/tests/golden\"")
+  add_packages(table.unpack(project_libs))
+  add_deps("core")
+  add_deps("math")
+  add_deps("models")
+  add_deps("gui/imgui")
+  add_deps("shapes")
+  add_deps("utils")
+  set_targetdir("./app")
+
 -- test suites
 target("app_test")
   set_kind("binary")
   add_files("tests/**/*.cpp", "tests/main.cpp")
+  add_defines("MRX_GOLDEN_DIRECTORY=\"$(projectdir)/tests/golden\"")
   add_packages(table.unpack(test_libs))
   add_deps("core")
   add_deps("math")
@@ -103,6 +172,18 @@ target("app_test")
   add_deps("utils")
   set_targetdir("./app")
 
+-- microbenchmarks of the math and raster kernels (JSON baseline in resultados/)
+target("app_bench")
+  set_kind("binary")
+  add_files("bench/**/*.cpp", "bench/main.cpp")
+  add_packages(table.unpack(bench_libs))
+  add_deps("core")
+  add_deps("math")
+  add_deps("models")
+  add_deps("shapes")
+  add_deps("utils")
+  set_targetdir("./app")
+
 -- If you want to known more usage about xmake, please see https://xmake.io
 
 -- FAQ